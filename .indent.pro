@@ -7,13 +7,20 @@
 -T FriBidiMaskType
 -T FriBidiCharType
 -T FriBidiPropCharType
+-T FriBidiProps
 -T FriBidiLevel
 -T FriBidiCharSet
 -T FriBidiCharSetHandler
+-T FriBidiCharSetConverter
 -T FriBidiRunType
 -T FriBidiList
 -T FriBidiMemChunk
 -T FriBidiEnv
+-T FriBidiEnvExtension
+-T FriBidiStats
+-T FriBidiTables
+-T FriBidiTablesHeader
+-T FriBidiCharSet8bit
 -T fribidi_int8
 -T fribidi_uint8
 -T fribidi_int16
@@ -7,6 +7,9 @@
 
 #undef FRIBIDI_NO_CHARSETS
 
+/* Define to compile in the sys/sdt.h static tracepoints */
+#undef FRIBIDI_PROBES
+
 #define FRIBIDI_EXPORT
 
 /* Check for fribidi_tab_char_type_*.i files */
@@ -26,6 +26,11 @@
 #endif
 #include "fribidi.h"
 #include "fribidi_mem.h"
+#include "fribidi_stats.h"
+#include "fribidi_inline.h"
+#include "fribidi_probes.h"
+#include "fribidi_utf8.h"
+#include <string.h>
 #ifdef DEBUG
 #include <stdio.h>
 #endif
@@ -68,6 +73,11 @@ struct _TypeLink
   FriBidiLevel level;
 };
 
+/* The strings are analysed from the one byte FriBidiPropCharType of
+   each character, which are mapped to FriBidiCharType as they are
+   used. */
+#define PROP_TO_TYPE(p) (fribidi_prop_to_type[(unsigned char) (p)])
+
 #define FRIBIDI_LEVEL_START   -1
 #define FRIBIDI_LEVEL_END     -1
 #define FRIBIDI_LEVEL_REMOVED -2
@@ -167,7 +177,7 @@ free_type_link (FriBidiEnv *fribidienv,
 
 static TypeLink *
 run_length_encode_types (FriBidiEnv *fribidienv,
-			 FriBidiCharType *char_type,
+			 const FriBidiPropCharType *char_type,
 			 FriBidiStrIndex type_len)
 {
   TypeLink *list, *last, *link;
@@ -182,10 +192,10 @@ run_length_encode_types (FriBidiEnv *fribidienv,
 
   /* Sweep over the string_type s */
   for (i = 0; i < type_len; i++)
-    if (char_type[i] != last->type)
+    if (i == 0 || char_type[i] != char_type[i - 1])
       {
 	link = new_type_link (fribidienv);
-	link->type = char_type[i];
+	link->type = PROP_TO_TYPE (char_type[i]);
 	link->pos = i;
 	FRIBIDI_ADD_TYPE_LINK (last, link);
       }
@@ -563,27 +573,93 @@ print_resolved_types (TypeLink *pp)
   fprintf (stderr, "\n");
 }
 
-/* Here, only for test porpuses, we have assumed that a fribidi_string
-   ends with a 0 character */
 static void
-print_bidi_string (FriBidiChar *str)
+print_bidi_string (const FriBidiPropCharType *char_type,
+		   FriBidiStrIndex len)
 {
   FriBidiStrIndex i;
   fprintf (stderr, "  Org. types : ");
-  for (i = 0; str[i]; i++)
+  for (i = 0; i < len; i++)
     fprintf (stderr, "%c",
-	     fribidi_char_from_type (fribidi_get_type (fribidienv, str[i])));
+	     fribidi_char_from_type (PROP_TO_TYPE (char_type[i])));
   fprintf (stderr, "\n");
 }
 #endif
 
+/*======================================================================
+ *  Add an analysed string to the statistics attached to the env.
+ *----------------------------------------------------------------------*/
+static void
+update_stats (FriBidiStats *stats,
+	      TypeLink *type_rl_list,
+	      FriBidiStrIndex len,
+	      FriBidiStrIndex run_count,
+	      FriBidiStrIndex explicit_count,
+	      FriBidiLevel max_level)
+{
+  TypeLink *pp;
+  FriBidiLevel min_level = max_level;
+
+  for (pp = type_rl_list->next; pp->next; pp = pp->next)
+    if (RL_LEVEL (pp) < min_level)
+      min_level = RL_LEVEL (pp);
+
+  stats->calls++;
+  if (max_level == 0)
+    stats->pure_ltr++;
+  else if (max_level == 1 && min_level == 1)
+    stats->pure_rtl++;
+  stats->length[fribidi_stats_bucket (len)]++;
+  stats->runs[fribidi_stats_bucket (run_count)]++;
+  stats->max_level[fribidi_stats_bucket (max_level)]++;
+  stats->explicits[fribidi_stats_bucket (explicit_count)]++;
+}
+
+/*======================================================================
+ *  Determine the character types of a string, in a new array to be
+ *  freed with fribidi_free().
+ *----------------------------------------------------------------------*/
+static FriBidiPropCharType *
+get_char_types (FriBidiEnv *fribidienv,
+		const FriBidiChar *str,
+		FriBidiStrIndex len,
+		/* output */
+		fribidi_boolean *phas_mirror)
+{
+  FriBidiPropCharType *char_type =
+    (FriBidiPropCharType *) fribidi_malloc (fribidienv,
+					    len *
+					    sizeof (FriBidiPropCharType));
+  fribidi_boolean has_mirror = FRIBIDI_FALSE;
+  fribidi_boolean runtime_tables = fribidi_get_tables (fribidienv) != NULL;
+  FriBidiStrIndex i;
+
+  /* One lookup gives both the type and the mirror flag, so L4 can be
+     skipped for strings without any mirrored character. */
+  for (i = 0; i < len; i++)
+    {
+      FriBidiProps props = runtime_tables ?
+	fribidi_get_props (fribidienv, str[i]) :
+	fribidi_get_props_inline (str[i]);
+
+      char_type[i] = props & FRIBIDI_PROPS_TYPE_MASK;
+      has_mirror |= FRIBIDI_PROPS_HAS_MIRROR (props);
+    }
+  if (phas_mirror)
+    *phas_mirror = has_mirror;
+
+  return char_type;
+}
+
 /*======================================================================
  *  This function should follow the Unicode specification closely!
+ *  It works on the types of the characters only, so that it serves any
+ *  encoding of the string.
  *----------------------------------------------------------------------*/
 static void
 fribidi_analyse_string (FriBidiEnv *fribidienv,
 			/* input */
-			const FriBidiChar *str,
+			const FriBidiPropCharType *char_type,
 			FriBidiStrIndex len,
 			FriBidiCharType *pbase_dir,
 			/* output */
@@ -592,25 +668,16 @@ fribidi_analyse_string (FriBidiEnv *fribidienv,
 {
   FriBidiLevel base_level, max_level;
   FriBidiCharType base_dir;
-  FriBidiStrIndex i;
+  FriBidiStrIndex run_count = 0, explicit_count = 0;
   TypeLink *type_rl_list, *explicits_list, *explicits_list_end, *pp;
+  FriBidiStats *stats;
 
   DBG ("Entering fribidi_analyse_string()\n");
 
-  /* Determinate character types */
-  DBG ("  Determine character types\n");
-  {
-    FriBidiCharType *char_type =
-      (FriBidiCharType *) fribidi_malloc (fribidienv,
-					  len * sizeof (FriBidiCharType));
-    for (i = 0; i < len; i++)
-      char_type[i] = fribidi_get_type (fribidienv, str[i]);
-
-    /* Run length encode the character types */
-    type_rl_list = run_length_encode_types (fribidienv, char_type, len);
-    fribidi_free (fribidienv, char_type);
-  }
-  DBG ("  Determine character types, Done\n");
+  stats = fribidi_get_stats (fribidienv);
+
+  /* Run length encode the character types */
+  type_rl_list = run_length_encode_types (fribidienv, char_type, len);
 
   init_list (fribidienv, &explicits_list, &explicits_list_end);
 
@@ -676,6 +743,8 @@ fribidi_analyse_string (FriBidiEnv *fribidienv,
 	FriBidiCharType this_type = RL_TYPE (pp);
 	if (FRIBIDI_IS_EXPLICIT_OR_BN (this_type))
 	  {
+	    if (this_type != FRIBIDI_TYPE_BN)
+	      explicit_count += RL_LEN (pp);
 	    if (FRIBIDI_IS_STRONG (this_type))
 	      {			/* LRE, RLE, LRO, RLO */
 		/* 1. Explicit Embeddings */
@@ -747,11 +816,15 @@ fribidi_analyse_string (FriBidiEnv *fribidienv,
 
   compact_list (fribidienv, type_rl_list);
 
+  if (stats)
+    for (pp = type_rl_list->next; pp->next; pp = pp->next)
+      run_count++;
+
 #ifdef DEBUG
   if (fribidi_debug_status (fribidienv))
     {
       print_types_re (type_rl_list);
-      print_bidi_string (str);
+      print_bidi_string (char_type, len);
       print_resolved_levels (type_rl_list);
       print_resolved_types (type_rl_list);
     }
@@ -950,7 +1023,7 @@ fribidi_analyse_string (FriBidiEnv *fribidienv,
 #ifdef DEBUG
   if (fribidi_debug_status (fribidienv))
     {
-      print_bidi_string (str);
+      print_bidi_string (char_type, len);
       print_resolved_levels (type_rl_list);
       print_resolved_types (type_rl_list);
     }
@@ -994,7 +1067,7 @@ fribidi_analyse_string (FriBidiEnv *fribidienv,
       {
 	/* if state is on at the very first of string, do this too. */
 	if (j >= 0)
-	  k = fribidi_get_type (fribidienv, str[j]);
+	  k = PROP_TO_TYPE (char_type[j]);
 	else
 	  k = FRIBIDI_TYPE_ON;
 	if (!state && FRIBIDI_IS_SEPARATOR (k))
@@ -1027,6 +1100,10 @@ fribidi_analyse_string (FriBidiEnv *fribidienv,
     }
 #endif
 
+  if (stats)
+    update_stats (stats, type_rl_list, len, run_count, explicit_count,
+		  max_level);
+
   *ptype_rl_list = type_rl_list;
   *pmax_level = max_level;
   *pbase_dir = base_dir;
@@ -1077,6 +1154,138 @@ free_rl_list (FriBidiEnv *fribidienv,
 }
 
 
+#ifdef FRIBIDI_PROBES
+FRIBIDI_PROBE_DEFINE (log2vis__entry);
+FRIBIDI_PROBE_DEFINE (log2vis__return);
+FRIBIDI_PROBE_DEFINE (get_embedding_levels__entry);
+FRIBIDI_PROBE_DEFINE (get_embedding_levels__return);
+FRIBIDI_PROBE_DEFINE (types_get_embedding_levels__entry);
+FRIBIDI_PROBE_DEFINE (types_get_embedding_levels__return);
+FRIBIDI_PROBE_DEFINE (log2vis_utf16__entry);
+FRIBIDI_PROBE_DEFINE (log2vis_utf16__return);
+FRIBIDI_PROBE_DEFINE (log2vis_utf8__entry);
+FRIBIDI_PROBE_DEFINE (log2vis_utf8__return);
+FRIBIDI_PROBE_DEFINE (remove_bidi_marks__entry);
+FRIBIDI_PROBE_DEFINE (remove_bidi_marks__return);
+FRIBIDI_PROBE_DEFINE (charset_to_unicode__entry);
+FRIBIDI_PROBE_DEFINE (charset_to_unicode__return);
+FRIBIDI_PROBE_DEFINE (unicode_to_charset__entry);
+FRIBIDI_PROBE_DEFINE (unicode_to_charset__return);
+
+/*======================================================================
+ *  Count the level runs of an analysed string, for the return probes.
+ *----------------------------------------------------------------------*/
+static FriBidiStrIndex
+count_runs (TypeLink *type_rl_list)
+{
+  TypeLink *pp;
+  FriBidiStrIndex run_count = 0;
+
+  for (pp = type_rl_list->next; pp->next; pp = pp->next)
+    if (RL_LEVEL (pp) != RL_LEVEL (pp->prev))
+      run_count++;
+
+  return run_count;
+}
+#endif /* FRIBIDI_PROBES */
+
+
+/*======================================================================
+ *  L3. Reorder the NSM sequences of the odd levels, in visual_str and
+ *  position_V_to_L_list, whichever is not NULL.  We apply this rule
+ *  before L2, so go backward in odd levels.
+ *----------------------------------------------------------------------*/
+static void
+reorder_nsm (TypeLink *type_rl_list,
+	     const FriBidiPropCharType *char_type,
+	     FriBidiChar *visual_str,
+	     FriBidiStrIndex *position_V_to_L_list)
+{
+  TypeLink *pp;
+
+  DBG ("  Reordering NSM sequences\n");
+  for (pp = type_rl_list->next; pp->next; pp = pp->next)
+    {
+      if (pp->level & 1)
+	{
+	  FriBidiStrIndex i, seq_end = 0;
+	  fribidi_boolean is_nsm_seq;
+
+	  is_nsm_seq = 0;
+	  for (i = RL_POS (pp) + RL_LEN (pp) - 1; i >= RL_POS (pp); i--)
+	    {
+	      FriBidiPropCharType this_type;
+
+	      this_type = char_type[i];
+	      if (is_nsm_seq && this_type != FRIBIDI_PROP_TYPE_NSM)
+		{
+		  if (visual_str)
+		    {
+		      bidi_string_reverse (visual_str + i, seq_end - i + 1);
+		    }
+		  if (position_V_to_L_list)
+		    {
+		      index_array_reverse (position_V_to_L_list + i,
+					   seq_end - i + 1);
+		    }
+		  is_nsm_seq = 0;
+		}
+	      else if (!is_nsm_seq && this_type == FRIBIDI_PROP_TYPE_NSM)
+		{
+		  seq_end = i;
+		  is_nsm_seq = 1;
+		}
+	    }
+	  if (is_nsm_seq)
+	    {
+	      DBG ("Warning: NSMs at the beggining of run level.\n");
+	    }
+	}
+    }
+  DBG ("  Reordering NSM sequences, Done\n");
+}
+
+/*======================================================================
+ *  L2. Reverse the runs of each level and up, in visual_str and
+ *  position_V_to_L_list, whichever is not NULL.
+ *----------------------------------------------------------------------*/
+static void
+reorder_levels (TypeLink *type_rl_list,
+		FriBidiLevel max_level,
+		FriBidiChar *visual_str,
+		FriBidiStrIndex *position_V_to_L_list)
+{
+  TypeLink *pp;
+  FriBidiLevel level_idx;
+
+  DBG ("  Reordering\n");
+  for (level_idx = max_level; level_idx > 0; level_idx--)
+    {
+      for (pp = type_rl_list->next; pp->next; pp = pp->next)
+	{
+	  if (RL_LEVEL (pp) >= level_idx)
+	    {
+	      /* Find all stretches that are >= level_idx */
+	      FriBidiStrIndex len = RL_LEN (pp),
+		pos = RL_POS (pp);
+	      TypeLink *pp1 = pp->next;
+	      while (pp1->next && RL_LEVEL (pp1) >= level_idx)
+		{
+		  len += RL_LEN (pp1);
+		  pp1 = pp1->next;
+		}
+	      pp = pp1->prev;
+	      if (visual_str)
+		bidi_string_reverse (visual_str + pos, len);
+	      if (position_V_to_L_list)
+		index_array_reverse (position_V_to_L_list + pos, len);
+	    }
+	}
+    }
+  DBG ("  Reordering, Done\n");
+}
+
+
 /*======================================================================
  *  Here starts the exposed front end functions.
  *----------------------------------------------------------------------*/
@@ -1097,6 +1306,7 @@ fribidi_remove_bidi_marks (FriBidiEnv *fribidienv,
   fribidi_boolean private_from_this = FRIBIDI_FALSE;
 
   DBG ("Entering fribidi_remove_bidi_marks()\n");
+  FRIBIDI_PROBE1 (remove_bidi_marks__entry, length);
 
   /* If to_this is to not null, we must have from_this as well. If it is
      not given by the caller, we have to make a private instance of it. */
@@ -1136,6 +1346,7 @@ fribidi_remove_bidi_marks (FriBidiEnv *fribidienv,
   if (private_from_this)
     fribidi_free (fribidienv, position_from_this_list);
 
+  FRIBIDI_PROBE2 (remove_bidi_marks__return, length, j);
   DBG ("Leaving fribidi_remove_bidi_marks()\n");
   return j;
 }
@@ -1159,12 +1370,16 @@ fribidi_log2vis (FriBidiEnv *fribidienv,
 {
   TypeLink *type_rl_list, *pp = (TypeLink *) NULL;
   FriBidiLevel max_level;
+  FriBidiPropCharType *char_type;
   fribidi_boolean private_V_to_L = FRIBIDI_FALSE;
+  fribidi_boolean has_mirror;
 
   DBG ("Entering fribidi_log2vis()\n");
+  FRIBIDI_PROBE2 (log2vis__entry, len, *pbase_dir);
 
   if (len == 0)
     {
+      FRIBIDI_PROBE4 (log2vis__return, len, *pbase_dir, 0, 0);
       DBG ("Leaving fribidi_log2vis()\n");
       return FRIBIDI_TRUE;
     }
@@ -1185,16 +1400,17 @@ fribidi_log2vis (FriBidiEnv *fribidienv,
       fprintf (stderr, "%s: cannot handle strings > %ld characters\n",
 	       FRIBIDI_PACKAGE, (long) FRIBIDI_MAX_STRING_LENGTH);
 #endif
+      FRIBIDI_PROBE4 (log2vis__return, len, *pbase_dir, 0, 0);
       return FRIBIDI_FALSE;
     }
-  fribidi_analyse_string (fribidienv, str, len, pbase_dir,
+  char_type = get_char_types (fribidienv, str, len, &has_mirror);
+  fribidi_analyse_string (fribidienv, char_type, len, pbase_dir,
 			  /* output */
 			  &type_rl_list, &max_level);
 
   /* 7. Reordering resolved levels */
   DBG ("Reordering resolved levels\n");
   {
-    FriBidiLevel level_idx;
     FriBidiStrIndex i;
 
     /* Set up the ordering array to sorted order */
@@ -1236,102 +1452,26 @@ fribidi_log2vis (FriBidiEnv *fribidienv,
     /* Reorder both the outstring and the order array */
     if (visual_str || position_V_to_L_list)
       {
-	if (fribidi_mirroring_status (fribidienv) && visual_str)
+	if (fribidi_mirroring_status (fribidienv) && visual_str && has_mirror)
 	  {
 	    /* L4. Mirror all characters that are in odd levels and have mirrors. */
 	    DBG ("  Mirroring\n");
 	    for (pp = type_rl_list->next; pp->next; pp = pp->next)
 	      {
 		if (pp->level & 1)
-		  {
-		    FriBidiStrIndex i;
-		    for (i = RL_POS (pp); i < RL_POS (pp) + RL_LEN (pp); i++)
-		      {
-			FriBidiChar mirrored_ch;
-			if (fribidi_get_mirror_char
-			    (fribidienv, visual_str[i], &mirrored_ch))
-			  visual_str[i] = mirrored_ch;
-		      }
-		  }
+		  fribidi_mirror_string (fribidienv,
+					 visual_str + RL_POS (pp),
+					 RL_LEN (pp));
 	      }
 	    DBG ("  Mirroring, Done\n");
 	  }
 
 	if (fribidi_reorder_nsm_status (fribidienv))
-	  {
-	    /* L3. Reorder NSMs. */
-	    DBG ("  Reordering NSM sequences\n");
-	    /* We apply this rule before L2, so go backward in odd levels. */
-	    for (pp = type_rl_list->next; pp->next; pp = pp->next)
-	      {
-		if (pp->level & 1)
-		  {
-		    FriBidiStrIndex i, seq_end = 0;
-		    fribidi_boolean is_nsm_seq;
-
-		    is_nsm_seq = 0;
-		    for (i = RL_POS (pp) + RL_LEN (pp) - 1; i >= RL_POS (pp);
-			 i--)
-		      {
-			FriBidiCharType this_type;
-
-			this_type = fribidi_get_type (NULL, str[i]);
-			if (is_nsm_seq && this_type != FRIBIDI_TYPE_NSM)
-			  {
-			    if (visual_str)
-			      {
-				bidi_string_reverse (visual_str + i,
-						     seq_end - i + 1);
-			      }
-			    if (position_V_to_L_list)
-			      {
-				index_array_reverse (position_V_to_L_list + i,
-						     seq_end - i + 1);
-			      }
-			    is_nsm_seq = 0;
-			  }
-			else if (!is_nsm_seq && this_type == FRIBIDI_TYPE_NSM)
-			  {
-			    seq_end = i;
-			    is_nsm_seq = 1;
-			  }
-		      }
-		    if (is_nsm_seq)
-		      {
-			DBG
-			  ("Warning: NSMs at the beggining of run level.\n");
-		      }
-		  }
-	      }
-	    DBG ("  Reordering NSM sequences, Done\n");
-	  }
+	  reorder_nsm (type_rl_list, char_type, visual_str,
+		       position_V_to_L_list);
 
-	/* L2. Reorder. */
-	DBG ("  Reordering\n");
-	for (level_idx = max_level; level_idx > 0; level_idx--)
-	  {
-	    for (pp = type_rl_list->next; pp->next; pp = pp->next)
-	      {
-		if (RL_LEVEL (pp) >= level_idx)
-		  {
-		    /* Find all stretches that are >= level_idx */
-		    FriBidiStrIndex len = RL_LEN (pp),
-		      pos = RL_POS (pp);
-		    TypeLink *pp1 = pp->next;
-		    while (pp1->next && RL_LEVEL (pp1) >= level_idx)
-		      {
-			len += RL_LEN (pp1);
-			pp1 = pp1->next;
-		      }
-		    pp = pp1->prev;
-		    if (visual_str)
-		      bidi_string_reverse (visual_str + pos, len);
-		    if (position_V_to_L_list)
-		      index_array_reverse (position_V_to_L_list + pos, len);
-		  }
-	      }
-	  }
-	DBG ("  Reordering, Done\n");
+	reorder_levels (type_rl_list, max_level, visual_str,
+			position_V_to_L_list);
       }
 
     /* Convert the v2l list to l2v */
@@ -1347,7 +1487,11 @@ fribidi_log2vis (FriBidiEnv *fribidienv,
 
   if (private_V_to_L)
     fribidi_free (fribidienv, position_V_to_L_list);
+  fribidi_free (fribidienv, char_type);
 
+  FRIBIDI_PROBE4 (log2vis__return, len, *pbase_dir,
+		  FRIBIDI_PROBE_ENABLED (log2vis__return) ?
+		  count_runs (type_rl_list) : 0, max_level);
   free_rl_list (fribidienv, type_rl_list);
 
   DBG ("Leaving fribidi_log2vis()\n");
@@ -1370,18 +1514,23 @@ fribidi_log2vis_get_embedding_levels (FriBidiEnv *fribidienv,
 {
   TypeLink *type_rl_list, *pp;
   FriBidiLevel max_level;
+  FriBidiPropCharType *char_type;
 
   DBG ("Entering fribidi_log2vis_get_embedding_levels()\n");
+  FRIBIDI_PROBE2 (get_embedding_levels__entry, len, *pbase_dir);
 
   if (len == 0)
     {
+      FRIBIDI_PROBE4 (get_embedding_levels__return, len, *pbase_dir, 0, 0);
       DBG ("Leaving fribidi_log2vis_get_embedding_levels()\n");
       return FRIBIDI_TRUE;
     }
 
-  fribidi_analyse_string (fribidienv, str, len, pbase_dir,
+  char_type = get_char_types (fribidienv, str, len, NULL);
+  fribidi_analyse_string (fribidienv, char_type, len, pbase_dir,
 			  /* output */
 			  &type_rl_list, &max_level);
+  fribidi_free (fribidienv, char_type);
 
   for (pp = type_rl_list->next; pp->next; pp = pp->next)
     {
@@ -1392,12 +1541,354 @@ fribidi_log2vis_get_embedding_levels (FriBidiEnv *fribidienv,
 	embedding_level_list[pos + i] = level;
     }
 
+  FRIBIDI_PROBE4 (get_embedding_levels__return, len, *pbase_dir,
+		  FRIBIDI_PROBE_ENABLED (get_embedding_levels__return) ?
+		  count_runs (type_rl_list) : 0, max_level);
   free_rl_list (fribidienv, type_rl_list);
 
   DBG ("Leaving fribidi_log2vis_get_embedding_levels()\n");
   return FRIBIDI_TRUE;
 }
 
+FRIBIDI_API fribidi_boolean
+fribidi_types_get_embedding_levels (FriBidiEnv *fribidienv,
+				    /* input */
+				    const FriBidiPropCharType *char_type,
+				    FriBidiStrIndex len,
+				    FriBidiCharType *pbase_dir,
+				    /* output */
+				    FriBidiLevel *embedding_level_list)
+{
+  TypeLink *type_rl_list, *pp;
+  FriBidiLevel max_level;
+
+  DBG ("Entering fribidi_types_get_embedding_levels()\n");
+  FRIBIDI_PROBE2 (types_get_embedding_levels__entry, len, *pbase_dir);
+
+  if (len == 0)
+    {
+      FRIBIDI_PROBE4 (types_get_embedding_levels__return, len, *pbase_dir,
+		      0, 0);
+      DBG ("Leaving fribidi_types_get_embedding_levels()\n");
+      return FRIBIDI_TRUE;
+    }
+
+  fribidi_analyse_string (fribidienv, char_type, len, pbase_dir,
+			  /* output */
+			  &type_rl_list, &max_level);
+
+  for (pp = type_rl_list->next; pp->next; pp = pp->next)
+    {
+      FriBidiStrIndex i, pos = RL_POS (pp),
+        len = RL_LEN (pp);
+      FriBidiLevel level = RL_LEVEL (pp);
+      for (i = 0; i < len; i++)
+	embedding_level_list[pos + i] = level;
+    }
+
+  FRIBIDI_PROBE4 (types_get_embedding_levels__return, len, *pbase_dir,
+		  FRIBIDI_PROBE_ENABLED (types_get_embedding_levels__return) ?
+		  count_runs (type_rl_list) : 0, max_level);
+  free_rl_list (fribidienv, type_rl_list);
+
+  DBG ("Leaving fribidi_types_get_embedding_levels()\n");
+  return FRIBIDI_TRUE;
+}
+
+FRIBIDI_API FriBidiCharType
+fribidi_get_par_direction (FriBidiEnv *fribidienv,
+			   const FriBidiChar *str,
+			   FriBidiStrIndex len)
+{
+  fribidi_boolean runtime_tables = fribidi_get_tables (fribidienv) != NULL;
+  FriBidiStrIndex i;
+
+  for (i = 0; i < len; i++)
+    {
+      FriBidiCharType type = runtime_tables ?
+	fribidi_get_type (fribidienv, str[i]) :
+	fribidi_get_type_inline (str[i]);
+
+      if (FRIBIDI_IS_LETTER (type))
+	return FRIBIDI_LEVEL_TO_DIR (FRIBIDI_DIR_TO_LEVEL (type));
+    }
+
+  return FRIBIDI_TYPE_ON;
+}
+
+#define IS_HIGH_SURROGATE(c) ((c) >= 0xD800 && (c) <= 0xDBFF)
+#define IS_LOW_SURROGATE(c) ((c) >= 0xDC00 && (c) <= 0xDFFF)
+#define IS_SURROGATE(c) ((c) >= 0xD800 && (c) <= 0xDFFF)
+#define IS_SURROGATE_PAIR(str, i, len) \
+	((i) + 1 < (len) && IS_HIGH_SURROGATE ((str)[i]) \
+	 && IS_LOW_SURROGATE ((str)[(i) + 1]))
+#define SURROGATE_PAIR_TO_CHAR(high, low) \
+	(0x10000 + (((FriBidiChar) (high) - 0xD800) << 10) + ((low) - 0xDC00))
+
+/*======================================================================
+ *  fribidi_log2vis_utf16() is fribidi_log2vis() for UTF-16 strings.
+ *  Both code units of a surrogate pair get the type of the character
+ *  they encode, so the analysis sees the pair as one character, and
+ *  the pair stays in order in the visual string.
+ *----------------------------------------------------------------------*/
+FRIBIDI_API fribidi_boolean
+fribidi_log2vis_utf16 (FriBidiEnv *fribidienv,
+		       /* input */
+		       const fribidi_uint16 *str,
+		       FriBidiStrIndex len,
+		       FriBidiCharType *pbase_dir,
+		       /* output */
+		       fribidi_uint16 *visual_str,
+		       FriBidiStrIndex *position_L_to_V_list,
+		       FriBidiStrIndex *position_V_to_L_list,
+		       FriBidiLevel *embedding_level_list)
+{
+  TypeLink *type_rl_list, *pp;
+  FriBidiLevel max_level, *levels;
+  FriBidiPropCharType *char_type;
+  FriBidiStrIndex i, *v2l;
+  fribidi_boolean has_mirror = FRIBIDI_FALSE, runtime_tables;
+
+  DBG ("Entering fribidi_log2vis_utf16()\n");
+  FRIBIDI_PROBE2 (log2vis_utf16__entry, len, *pbase_dir);
+
+  if (len == 0)
+    {
+      FRIBIDI_PROBE4 (log2vis_utf16__return, len, *pbase_dir, 0, 0);
+      DBG ("Leaving fribidi_log2vis_utf16()\n");
+      return FRIBIDI_TRUE;
+    }
+  if (len > FRIBIDI_MAX_STRING_LENGTH
+      && (visual_str || position_L_to_V_list || position_V_to_L_list))
+    {
+      FRIBIDI_PROBE4 (log2vis_utf16__return, len, *pbase_dir, 0, 0);
+      return FRIBIDI_FALSE;
+    }
+
+  char_type =
+    (FriBidiPropCharType *) fribidi_malloc (fribidienv,
+					    len *
+					    sizeof (FriBidiPropCharType));
+  runtime_tables = fribidi_get_tables (fribidienv) != NULL;
+  for (i = 0; i < len; i++)
+    {
+      FriBidiChar ch = str[i];
+      FriBidiProps props;
+
+      if (IS_SURROGATE_PAIR (str, i, len))
+	ch = SURROGATE_PAIR_TO_CHAR (str[i], str[i + 1]);
+      props = runtime_tables ? fribidi_get_props (fribidienv, ch) :
+	fribidi_get_props_inline (ch);
+      char_type[i] = props & FRIBIDI_PROPS_TYPE_MASK;
+      has_mirror |= FRIBIDI_PROPS_HAS_MIRROR (props);
+      if (ch > 0xFFFF)
+	{
+	  i++;
+	  char_type[i] = char_type[i - 1];
+	}
+    }
+
+  fribidi_analyse_string (fribidienv, char_type, len, pbase_dir,
+			  /* output */
+			  &type_rl_list, &max_level);
+
+  levels = embedding_level_list ? embedding_level_list :
+    (FriBidiLevel *) fribidi_malloc (fribidienv, len * sizeof (FriBidiLevel));
+  for (pp = type_rl_list->next; pp->next; pp = pp->next)
+    for (i = 0; i < RL_LEN (pp); i++)
+      levels[RL_POS (pp) + i] = RL_LEVEL (pp);
+
+  if (visual_str || position_L_to_V_list || position_V_to_L_list)
+    {
+      v2l = position_V_to_L_list ? position_V_to_L_list :
+	(FriBidiStrIndex *) fribidi_malloc (fribidienv,
+					    len * sizeof (FriBidiStrIndex));
+      for (i = 0; i < len; i++)
+	v2l[i] = i;
+      if (fribidi_reorder_nsm_status (fribidienv))
+	reorder_nsm (type_rl_list, char_type, NULL, v2l);
+      reorder_levels (type_rl_list, max_level, NULL, v2l);
+
+      /* Reversing a run reversed its surrogate pairs too, put them back
+         in order. */
+      for (i = 0; i + 1 < len; i++)
+	if (v2l[i + 1] + 1 == v2l[i] && IS_SURROGATE_PAIR (str, v2l[i + 1],
+							   len))
+	  {
+	    v2l[i + 1] = v2l[i];
+	    v2l[i] = v2l[i + 1] - 1;
+	    i++;
+	  }
+
+      if (visual_str)
+	{
+	  for (i = 0; i < len; i++)
+	    visual_str[i] = str[v2l[i]];
+	  visual_str[len] = 0;
+
+	  /* L4. Mirror the characters of odd levels, all of them in the
+	     BMP. */
+	  if (fribidi_mirroring_status (fribidienv) && has_mirror)
+	    for (i = 0; i < len; i++)
+	      {
+		FriBidiChar mirrored_ch;
+
+		if (levels[v2l[i]] & 1 && !IS_SURROGATE (visual_str[i])
+		    && fribidi_get_mirror_char (fribidienv, visual_str[i],
+						&mirrored_ch))
+		  visual_str[i] = mirrored_ch;
+	      }
+	}
+
+      if (position_L_to_V_list)
+	for (i = 0; i < len; i++)
+	  position_L_to_V_list[v2l[i]] = i;
+      if (v2l != position_V_to_L_list)
+	fribidi_free (fribidienv, v2l);
+    }
+
+  if (levels != embedding_level_list)
+    fribidi_free (fribidienv, levels);
+  fribidi_free (fribidienv, char_type);
+  FRIBIDI_PROBE4 (log2vis_utf16__return, len, *pbase_dir,
+		  FRIBIDI_PROBE_ENABLED (log2vis_utf16__return) ?
+		  count_runs (type_rl_list) : 0, max_level);
+  free_rl_list (fribidienv, type_rl_list);
+
+  DBG ("Leaving fribidi_log2vis_utf16()\n");
+  return FRIBIDI_TRUE;
+}
+
+/*======================================================================
+ *  fribidi_log2vis_utf8() is fribidi_log2vis() for UTF-8 strings.  The
+ *  analysis runs on the types of the characters, and the reordering on
+ *  the indices of the characters, which are then mapped to the byte
+ *  sequences that encode them.
+ *----------------------------------------------------------------------*/
+FRIBIDI_API fribidi_boolean
+fribidi_log2vis_utf8 (FriBidiEnv *fribidienv,
+		      /* input */
+		      const char *str,
+		      FriBidiStrIndex len,
+		      FriBidiCharType *pbase_dir,
+		      /* output */
+		      char *visual_str,
+		      FriBidiStrIndex *position_L_to_V_list,
+		      FriBidiStrIndex *position_V_to_L_list,
+		      FriBidiLevel *embedding_level_list,
+		      FriBidiStrIndex *pchar_len)
+{
+  TypeLink *type_rl_list, *pp;
+  FriBidiLevel max_level, *levels;
+  FriBidiPropCharType *char_type;
+  FriBidiStrIndex i, char_len, *offset;
+  fribidi_boolean has_mirror;
+
+  DBG ("Entering fribidi_log2vis_utf8()\n");
+  FRIBIDI_PROBE2 (log2vis_utf8__entry, len, *pbase_dir);
+
+  if (len == 0)
+    {
+      if (pchar_len)
+	*pchar_len = 0;
+      FRIBIDI_PROBE4 (log2vis_utf8__return, len, *pbase_dir, 0, 0);
+      DBG ("Leaving fribidi_log2vis_utf8()\n");
+      return FRIBIDI_TRUE;
+    }
+  if (len > FRIBIDI_MAX_STRING_LENGTH)
+    {
+      FRIBIDI_PROBE4 (log2vis_utf8__return, len, *pbase_dir, 0, 0);
+      return FRIBIDI_FALSE;
+    }
+
+  /* The types of the characters, and the offsets of their sequences,
+     with offset[char_len] == len. */
+  char_type =
+    (FriBidiPropCharType *) fribidi_malloc (fribidienv,
+					    len *
+					    sizeof (FriBidiPropCharType));
+  offset =
+    (FriBidiStrIndex *) fribidi_malloc (fribidienv,
+					(len + 1) * sizeof (FriBidiStrIndex));
+  char_len = fribidi_utf8_get_types_offsets (fribidienv, str, len, NULL,
+					     char_type, offset, NULL,
+					     &has_mirror);
+  if (pchar_len)
+    *pchar_len = char_len;
+
+  fribidi_analyse_string (fribidienv, char_type, char_len, pbase_dir,
+			  /* output */
+			  &type_rl_list, &max_level);
+
+  levels = embedding_level_list ? embedding_level_list :
+    (FriBidiLevel *) fribidi_malloc (fribidienv,
+				     char_len * sizeof (FriBidiLevel));
+  for (pp = type_rl_list->next; pp->next; pp = pp->next)
+    for (i = 0; i < RL_LEN (pp); i++)
+      levels[RL_POS (pp) + i] = RL_LEVEL (pp);
+
+  if (visual_str || position_L_to_V_list || position_V_to_L_list)
+    {
+      FriBidiStrIndex *v2l, pos;
+      fribidi_boolean mirror = visual_str && has_mirror
+	&& fribidi_mirroring_status (fribidienv);
+
+      v2l = (FriBidiStrIndex *) fribidi_malloc (fribidienv,
+						char_len *
+						sizeof (FriBidiStrIndex));
+      for (i = 0; i < char_len; i++)
+	v2l[i] = i;
+      if (fribidi_reorder_nsm_status (fribidienv))
+	reorder_nsm (type_rl_list, char_type, NULL, v2l);
+      reorder_levels (type_rl_list, max_level, NULL, v2l);
+
+      /* Move the whole sequence of each character. */
+      for (i = 0, pos = 0; i < char_len; i++)
+	{
+	  FriBidiStrIndex j, from = offset[v2l[i]],
+	    size = offset[v2l[i] + 1] - from;
+
+	  if (visual_str)
+	    {
+	      FriBidiChar ch, mirrored_ch;
+	      char mirrored[4];
+
+	      memcpy (visual_str + pos, str + from, size);
+	      /* L4. Ill-formed sequences have no mirror, and mirrors are
+	         encoded in as many bytes as the originals. */
+	      if (mirror && levels[v2l[i]] & 1
+		  && fribidi_utf8_get_char (str + from, size, &ch) == size
+		  && fribidi_get_mirror_char (fribidienv, ch, &mirrored_ch)
+		  && fribidi_utf8_put_char (mirrored_ch, mirrored) == size)
+		memcpy (visual_str + pos, mirrored, size);
+	    }
+	  for (j = 0; j < size; j++)
+	    {
+	      if (position_V_to_L_list)
+		position_V_to_L_list[pos + j] = from + j;
+	      if (position_L_to_V_list)
+		position_L_to_V_list[from + j] = pos + j;
+	    }
+	  pos += size;
+	}
+      if (visual_str)
+	visual_str[len] = 0;
+      fribidi_free (fribidienv, v2l);
+    }
+
+  if (levels != embedding_level_list)
+    fribidi_free (fribidienv, levels);
+  fribidi_free (fribidienv, offset);
+  fribidi_free (fribidienv, char_type);
+  FRIBIDI_PROBE4 (log2vis_utf8__return, len, *pbase_dir,
+		  FRIBIDI_PROBE_ENABLED (log2vis_utf8__return) ?
+		  count_runs (type_rl_list) : 0, max_level);
+  free_rl_list (fribidienv, type_rl_list);
+
+  DBG ("Leaving fribidi_log2vis_utf8()\n");
+  return FRIBIDI_TRUE;
+}
+
 
 
 const char *fribidi_version_info =
@@ -1424,4 +1915,7 @@ const char *fribidi_version_info =
 #ifdef FRIBIDI_NO_CHARSETS
   "--without-charsts\n"
 #endif
+#ifdef FRIBIDI_PROBES
+  "--enable-probes\n"
+#endif
 ;
@@ -32,6 +32,8 @@
 #include "fribidi_unicode.h"
 #include "fribidi_types.h"
 #include "fribidi_env.h"
+#include "fribidi_stats.h"
+#include "fribidi_tables.h"
 
 #ifndef FRIBIDI_NO_CHARSETS
 #include "fribidi_char_sets.h"
@@ -70,6 +72,119 @@ extern "C"
 								    FriBidiLevel
 								    *embedding_level_list);
 
+/*======================================================================
+ *  fribidi_log2vis_utf16() is fribidi_log2vis() for a string of len
+ *  UTF-16 code units.  Surrogate pairs are classified as the characters
+ *  they encode and are kept in order in visual_str, and the maps and
+ *  levels are indexed by code unit.  An unpaired surrogate is a
+ *  character of its own.
+ *----------------------------------------------------------------------*/
+  FRIBIDI_API fribidi_boolean fribidi_log2vis_utf16 (FriBidiEnv *fribidienv,
+						     /* input */
+						     const fribidi_uint16
+						     *str,
+						     FriBidiStrIndex len,
+						     FriBidiCharType
+						     *pbase_dir,
+						     /* output */
+						     fribidi_uint16
+						     *visual_str,
+						     FriBidiStrIndex
+						     *position_L_to_V_list,
+						     FriBidiStrIndex
+						     *position_V_to_L_list,
+						     FriBidiLevel
+						     *embedding_level_list);
+
+/*======================================================================
+ *  fribidi_log2vis_utf8() is fribidi_log2vis() for a string of len
+ *  UTF-8 bytes.  visual_str gets len bytes and a NUL: the sequences of
+ *  the characters are moved whole, so ill-formed bytes are kept as they
+ *  are and the position maps, of len entries each, map byte offsets.
+ *  embedding_level_list gets one level per character; it must have room
+ *  for len of them, and *pchar_len, if not NULL, gets their number.
+ *----------------------------------------------------------------------*/
+  FRIBIDI_API fribidi_boolean fribidi_log2vis_utf8 (FriBidiEnv *fribidienv,
+						    /* input */
+						    const char *str,
+						    FriBidiStrIndex len,
+						    FriBidiCharType
+						    *pbase_dir,
+						    /* output */
+						    char *visual_str,
+						    FriBidiStrIndex
+						    *position_L_to_V_list,
+						    FriBidiStrIndex
+						    *position_V_to_L_list,
+						    FriBidiLevel
+						    *embedding_level_list,
+						    FriBidiStrIndex
+						    *pchar_len);
+
+/*======================================================================
+ *  fribidi_utf8_get_types() decodes len bytes of UTF-8, as
+ *  fribidi_utf8_to_unicode() does, and in the same pass looks up the
+ *  FriBidiPropCharType of each character, one byte each, for
+ *  fribidi_types_get_embedding_levels().  us, if not NULL, gets the
+ *  characters, with no terminating 0; both arrays must have room for
+ *  len entries.  Returns the number of characters.  *pneeds_bidi, if
+ *  pneeds_bidi is not NULL, is set to whether any character is RTL, AL,
+ *  AN or an explicit code: if none is, all the levels are 0 for a base
+ *  direction of LTR, WL or ON, and the visual string is the logical one.
+ *----------------------------------------------------------------------*/
+  FRIBIDI_API FriBidiStrIndex fribidi_utf8_get_types (FriBidiEnv *fribidienv,
+						      /* input */
+						      const char *str,
+						      FriBidiStrIndex len,
+						      /* output */
+						      FriBidiChar *us,
+						      FriBidiPropCharType
+						      *char_type,
+						      fribidi_boolean
+						      *pneeds_bidi);
+
+/*======================================================================
+ *  fribidi_types_get_embedding_levels() is
+ *  fribidi_log2vis_get_embedding_levels() for the FriBidiPropCharType
+ *  of the characters, as fribidi_utf8_get_types() returns them.
+ *----------------------------------------------------------------------*/
+  FRIBIDI_API fribidi_boolean fribidi_types_get_embedding_levels (FriBidiEnv
+								  *fribidienv,
+								  /* input */
+								  const
+								  FriBidiPropCharType
+								  *char_type,
+								  FriBidiStrIndex
+								  len,
+								  FriBidiCharType
+								  *pbase_dir,
+								  /* output */
+								  FriBidiLevel
+								  *embedding_level_list);
+
+/*======================================================================
+ *  fribidi_get_par_direction() returns the base direction
+ *  fribidi_log2vis() would find for a string under a weak or neutral
+ *  base direction (P2, P3): FRIBIDI_TYPE_LTR or FRIBIDI_TYPE_RTL for the
+ *  first letter, L, R or AL, or FRIBIDI_TYPE_ON if there is none.  As
+ *  in the analysis, explicit codes are skipped but the text they embed
+ *  is not.  It allocates nothing and stops at the first letter.
+ *  fribidi_utf8_get_par_direction() does the same on len bytes of
+ *  UTF-8, decoding only up to the first letter.
+ *----------------------------------------------------------------------*/
+  FRIBIDI_API FriBidiCharType fribidi_get_par_direction (FriBidiEnv
+							 *fribidienv,
+							 const FriBidiChar
+							 *str,
+							 FriBidiStrIndex len);
+
+  FRIBIDI_API FriBidiCharType fribidi_utf8_get_par_direction (FriBidiEnv
+							      *fribidienv,
+							      const char
+							      *str,
+							      FriBidiStrIndex
+							      len);
+
 /*======================================================================
  *  fribidi_remove_bidi_marks() removes bidirectional marks, and returns
  *  the new length, also updates each of other inputs if not NULL.
@@ -102,6 +217,14 @@ extern "C"
 				      /* output */
 				      FriBidiCharType *type);
 
+/*======================================================================
+ *  fribidi_get_props() returns the combined properties of a character,
+ *  its bidi type, mirror flag, width class and combining flag, in one
+ *  lookup.  See FriBidiProps in fribidi_types.h.
+ *----------------------------------------------------------------------*/
+  FRIBIDI_API FriBidiProps fribidi_get_props (FriBidiEnv *fribidienv,
+					      FriBidiChar uch);
+
 /*======================================================================
  *  fribidi_get_mirror_char() returns the mirrored character, if any.
  *----------------------------------------------------------------------*/
@@ -123,6 +246,31 @@ extern "C"
 						       /* Output */
 						       FriBidiChar
 						       *mirrored_ch);
+
+/*======================================================================
+ *  fribidi_mirror_string() replaces each character of str that has a
+ *  mirror with its mirror, in place, and returns the number of
+ *  characters replaced.  Characters in blocks without any mirrorable
+ *  character are skipped without a table lookup.
+ *----------------------------------------------------------------------*/
+  FRIBIDI_API FriBidiStrIndex fribidi_mirror_string (FriBidiEnv *fribidienv,
+						     FriBidiChar *str,
+						     FriBidiStrIndex len);
+
+/*======================================================================
+ *  fribidi_get_mirror_char_bsearch() is the same as
+ *  fribidi_get_mirror_char(), done by a binary search in the plain list
+ *  of mirrored characters.  It is slower and is only kept as a reference
+ *  for testing and benchmarking.
+ *----------------------------------------------------------------------*/
+  FRIBIDI_API fribidi_boolean fribidi_get_mirror_char_bsearch (FriBidiEnv
+							       *fribidienv,
+							       /* Input */
+							       FriBidiChar ch,
+							       /* Output */
+							       FriBidiChar
+							       *mirrored_ch);
+
 /*======================================================================
  *  The following functions were moved to fribidi_env:
  *  - fribidi_mirroring_status()
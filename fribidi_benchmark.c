@@ -31,6 +31,7 @@
 #include <sys/times.h>
 #include "getopt.h"
 #include "fribidi.h"
+#include "fribidi_inline.h"
 
 #define appname "fribidi_benchmark"
 #define appversion VERSION
@@ -183,6 +184,173 @@ benchmark (char *S_,
   return;
 }
 
+typedef fribidi_boolean (*MirrorFunc) (FriBidiEnv *fribidienv,
+				      FriBidiChar ch,
+				      FriBidiChar *mirrored_ch);
+
+static double
+time_mirroring (MirrorFunc func,
+		int npass)
+{
+  int i;
+  FriBidiChar ch, mirrored_ch, sum = 0;
+  double time0, time1;
+
+  time0 = utime ();
+  for (i = 0; i < npass; i++)
+    for (ch = 0; ch < 0x10000; ch++)
+      {
+	func (NULL, ch, &mirrored_ch);
+	sum += mirrored_ch;
+      }
+  time1 = utime ();
+
+  /* Keep the compiler from dropping the calls. */
+  if (sum == 1)
+    printf ("\n");
+
+  return time1 - time0;
+}
+
+static void
+fill_block (FriBidiChar *str,
+	    FriBidiChar start)
+{
+  int j;
+
+  for (j = 0; j < 0x100; j++)
+    str[j] = start + j;
+}
+
+static double
+time_mirror_string (int npass)
+{
+  int i;
+  FriBidiChar ch, str[0x100];
+  double time0, time1;
+
+  time0 = utime ();
+  for (i = 0; i < npass; i++)
+    for (ch = 0; ch < 0x10000; ch += 0x100)
+      {
+	fill_block (str, ch);
+	fribidi_mirror_string (NULL, str, 0x100);
+      }
+  time1 = utime ();
+
+  return time1 - time0;
+}
+
+static void
+benchmark_mirroring (int niter)
+{
+  int npass;
+  FriBidiChar ch, m1, m2;
+  double t_table, t_bsearch, t_string;
+
+  /* First make sure the two agree, on all of Unicode and a bit more. */
+  for (ch = 0; ch < 0x110100; ch++)
+    if (fribidi_get_mirror_char (NULL, ch, &m1) !=
+	fribidi_get_mirror_char_bsearch (NULL, ch, &m2) || m1 != m2)
+      die ("mirroring mismatch at U+%04lX: table %04lX, bsearch %04lX\n",
+	   (unsigned long) ch, (unsigned long) m1, (unsigned long) m2);
+  for (ch = 0; ch < 0x110000; ch += 0x100)
+    {
+      FriBidiChar str[0x100];
+      int j;
+
+      fill_block (str, ch);
+      fribidi_mirror_string (NULL, str, 0x100);
+      for (j = 0; j < 0x100; j++)
+	if (fribidi_get_mirror_char (NULL, ch + j, &m1), str[j] != m1)
+	  die ("fribidi_mirror_string mismatch at U+%04lX\n",
+	       (unsigned long) (ch + j));
+    }
+
+  npass = niter / 100 + 1;
+  t_table = time_mirroring (fribidi_get_mirror_char, npass);
+  t_bsearch = time_mirroring (fribidi_get_mirror_char_bsearch, npass);
+  t_string = time_mirror_string (npass);
+
+  printf ("Lookups = %d\n", npass * 0x10000);
+  printf ("table:   %f seconds\n", t_table);
+  printf ("bsearch: %f seconds\n", t_bsearch);
+  printf ("bulk:    %f seconds\n", t_string);
+}
+
+static double
+time_props (int npass)
+{
+  int i;
+  FriBidiChar ch;
+  FriBidiProps sum = 0;
+  double time0, time1;
+
+  time0 = utime ();
+  for (i = 0; i < npass; i++)
+    for (ch = 0; ch < 0x10000; ch++)
+      sum += fribidi_get_props (NULL, ch);
+  time1 = utime ();
+
+  /* Keep the compiler from dropping the calls. */
+  if (sum == 1)
+    printf ("\n");
+
+  return time1 - time0;
+}
+
+static double
+time_separate (int npass)
+{
+  int i;
+  FriBidiChar ch, mirrored_ch;
+  unsigned long sum = 0;
+  double time0, time1;
+
+  time0 = utime ();
+  for (i = 0; i < npass; i++)
+    for (ch = 0; ch < 0x10000; ch++)
+      sum += fribidi_get_type (NULL, ch)
+	+ fribidi_get_mirror_char (NULL, ch, &mirrored_ch)
+	+ fribidi_get_width_class (ch);
+  time1 = utime ();
+
+  if (sum == 1)
+    printf ("\n");
+
+  return time1 - time0;
+}
+
+static void
+benchmark_props (int niter)
+{
+  int npass;
+  FriBidiChar ch;
+  double t_props, t_separate;
+
+  /* First make sure the combined table agrees with the separate ones. */
+  for (ch = 0; ch < 0x110100; ch++)
+    {
+      FriBidiProps props = fribidi_get_props (NULL, ch);
+
+      if (FRIBIDI_PROPS_TYPE (props) != fribidi_get_type (NULL, ch)
+	  || FRIBIDI_PROPS_HAS_MIRROR (props) !=
+	  fribidi_get_mirror_char (NULL, ch, NULL)
+	  || FRIBIDI_PROPS_WIDTH_CLASS (props) != fribidi_get_width_class (ch)
+	  || fribidi_get_props_inline (ch) != props
+	  || fribidi_get_type_inline (ch) != fribidi_get_type (NULL, ch))
+	die ("properties mismatch at U+%04lX\n", (unsigned long) ch);
+    }
+
+  npass = niter / 100 + 1;
+  t_props = time_props (npass);
+  t_separate = time_separate (npass);
+
+  printf ("Lookups = %d\n", npass * 0x10000);
+  printf ("props:    %f seconds\n", t_props);
+  printf ("separate: %f seconds\n", t_separate);
+}
+
 int
 main (int argc,
       char *argv[])
@@ -234,6 +402,12 @@ main (int argc,
   printf ("\n");
   printf ("* With explicit marks:\n");
   benchmark (TEST_STRING_EXPLICIT, niter);
+  printf ("\n");
+  printf ("* Mirroring, all of BMP:\n");
+  benchmark_mirroring (niter);
+  printf ("\n");
+  printf ("* Properties, all of BMP:\n");
+  benchmark_props (niter);
 
   return 0;
 }
@@ -0,0 +1,309 @@
+/* FriBidi - Library of BiDi algorithm
+ * Copyright (C) 2002 FriBidi Project (http://fribidi.sf.net/).
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library, in a file named COPYING; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307, USA
+ *
+ * For licensing issues, contact <dov@imagic.weizmann.ac.il> and
+ * <fwpg@sharif.edu>.
+ */
+
+/*======================================================================
+ *  Measures the lookup speed and the size of one fribidi_tab_char_type
+ *  compression level.  Compile it with -DFRIBIDI_TAB_CHAR_TYPE_LEVEL=n
+ *  for n from 2 to 9, linking fribidi_types.c only; `make
+ *  benchmark-char-types' does so for every level.
+ *----------------------------------------------------------------------*/
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif /* HAVE_CONFIG_H */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/times.h>
+#ifdef HAVE_LINUX_PERF_EVENT_H
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+#include "fribidi.h"
+
+#ifndef FRIBIDI_TAB_CHAR_TYPE_LEVEL
+#define FRIBIDI_TAB_CHAR_TYPE_LEVEL 2
+#endif
+
+#if   FRIBIDI_TAB_CHAR_TYPE_LEVEL == 2
+#include "fribidi_tab_char_type_2.i"
+#elif FRIBIDI_TAB_CHAR_TYPE_LEVEL == 3
+#include "fribidi_tab_char_type_3.i"
+#elif FRIBIDI_TAB_CHAR_TYPE_LEVEL == 4
+#include "fribidi_tab_char_type_4.i"
+#elif FRIBIDI_TAB_CHAR_TYPE_LEVEL == 5
+#include "fribidi_tab_char_type_5.i"
+#elif FRIBIDI_TAB_CHAR_TYPE_LEVEL == 6
+#include "fribidi_tab_char_type_6.i"
+#elif FRIBIDI_TAB_CHAR_TYPE_LEVEL == 7
+#include "fribidi_tab_char_type_7.i"
+#elif FRIBIDI_TAB_CHAR_TYPE_LEVEL == 8
+#include "fribidi_tab_char_type_8.i"
+#elif FRIBIDI_TAB_CHAR_TYPE_LEVEL == 9
+#include "fribidi_tab_char_type_9.i"
+#else
+#error FRIBIDI_TAB_CHAR_TYPE_LEVEL should be between 2 and 9
+#endif
+
+/* The tables of a level n file are Level0 to Level(n-1). */
+#define TABLE_BYTES (sizeof (FriBidiPropertyBlockLevel0)	\
+	+ sizeof (FriBidiPropertyBlockLevel1) + LEVEL_BYTES_2)
+#if FRIBIDI_TAB_CHAR_TYPE_LEVEL > 2
+#define LEVEL_BYTES_2 (sizeof (FriBidiPropertyBlockLevel2) + LEVEL_BYTES_3)
+#else
+#define LEVEL_BYTES_2 0
+#endif
+#if FRIBIDI_TAB_CHAR_TYPE_LEVEL > 3
+#define LEVEL_BYTES_3 (sizeof (FriBidiPropertyBlockLevel3) + LEVEL_BYTES_4)
+#else
+#define LEVEL_BYTES_3 0
+#endif
+#if FRIBIDI_TAB_CHAR_TYPE_LEVEL > 4
+#define LEVEL_BYTES_4 (sizeof (FriBidiPropertyBlockLevel4) + LEVEL_BYTES_5)
+#else
+#define LEVEL_BYTES_4 0
+#endif
+#if FRIBIDI_TAB_CHAR_TYPE_LEVEL > 5
+#define LEVEL_BYTES_5 (sizeof (FriBidiPropertyBlockLevel5) + LEVEL_BYTES_6)
+#else
+#define LEVEL_BYTES_5 0
+#endif
+#if FRIBIDI_TAB_CHAR_TYPE_LEVEL > 6
+#define LEVEL_BYTES_6 (sizeof (FriBidiPropertyBlockLevel6) + LEVEL_BYTES_7)
+#else
+#define LEVEL_BYTES_6 0
+#endif
+#if FRIBIDI_TAB_CHAR_TYPE_LEVEL > 7
+#define LEVEL_BYTES_7 (sizeof (FriBidiPropertyBlockLevel7) + LEVEL_BYTES_8)
+#else
+#define LEVEL_BYTES_7 0
+#endif
+#if FRIBIDI_TAB_CHAR_TYPE_LEVEL > 8
+#define LEVEL_BYTES_8 sizeof (FriBidiPropertyBlockLevel8)
+#else
+#define LEVEL_BYTES_8 0
+#endif
+
+#define STREAM_LEN 0x10000
+
+static struct
+{
+  char *name;
+  FriBidiChar first, last;	/* Letters are picked from first..last. */
+  int space_every;		/* A space after every that many letters. */
+}
+streams[] =
+{
+  {"ASCII", 0x0021, 0x007E, 6},
+  {"Hebrew", 0x05D0, 0x05EA, 5},
+  {"Arabic", 0x0621, 0x064A, 5},
+  {"CJK", 0x4E00, 0x9FA5, 0},
+  {"random BMP", 0x0000, 0xFFFF, 0},
+};
+
+#define streams_count (sizeof (streams) / sizeof (streams[0]))
+
+static double
+utime (void)
+{
+  struct tms tb;
+  times (&tb);
+  return 0.01 * tb.tms_utime;
+}
+
+static void
+fill_stream (FriBidiChar *str,
+	     int k)
+{
+  /* A fixed linear congruential generator, so that every level sees
+     the same text. */
+  unsigned long seed = 12345;
+  int i;
+
+  for (i = 0; i < STREAM_LEN; i++)
+    {
+      seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF;
+      if (streams[k].space_every && (i + 1) % (streams[k].space_every + 1)
+	  == 0)
+	str[i] = ' ';
+      else
+	str[i] = streams[k].first + (seed >> 8)
+	  % (streams[k].last - streams[k].first + 1);
+    }
+}
+
+static unsigned long
+lookup_stream (const FriBidiChar *str,
+	       int npass)
+{
+  unsigned long sum = 0;
+  int i, j;
+
+  for (j = 0; j < npass; j++)
+    for (i = 0; i < STREAM_LEN; i++)
+      sum += FRIBIDI_GET_TYPE (str[i]);
+
+  return sum;
+}
+
+/*======================================================================
+ *  Cache miss counters, where the kernel lets us have them.
+ *----------------------------------------------------------------------*/
+
+typedef struct
+{
+  int fd[4];
+}
+Counters;
+
+#ifdef HAVE_LINUX_PERF_EVENT_H
+
+static int
+open_counter (unsigned long cache,
+	      unsigned long result)
+{
+  struct perf_event_attr attr;
+
+  memset (&attr, 0, sizeof attr);
+  attr.type = PERF_TYPE_HW_CACHE;
+  attr.size = sizeof attr;
+  attr.config = cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (result << 16);
+  attr.disabled = 1;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  return syscall (__NR_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+static void
+start_counters (Counters *c)
+{
+  int i;
+
+  c->fd[0] = open_counter (PERF_COUNT_HW_CACHE_L1D,
+			   PERF_COUNT_HW_CACHE_RESULT_ACCESS);
+  c->fd[1] = open_counter (PERF_COUNT_HW_CACHE_L1D,
+			   PERF_COUNT_HW_CACHE_RESULT_MISS);
+  c->fd[2] = open_counter (PERF_COUNT_HW_CACHE_LL,
+			   PERF_COUNT_HW_CACHE_RESULT_ACCESS);
+  c->fd[3] = open_counter (PERF_COUNT_HW_CACHE_LL,
+			   PERF_COUNT_HW_CACHE_RESULT_MISS);
+  for (i = 0; i < 4; i++)
+    if (c->fd[i] >= 0)
+      {
+	ioctl (c->fd[i], PERF_EVENT_IOC_RESET, 0);
+	ioctl (c->fd[i], PERF_EVENT_IOC_ENABLE, 0);
+      }
+}
+
+static void
+stop_counters (Counters *c,
+	       char *l1,
+	       char *ll)
+{
+  unsigned long long count[4];
+  int i;
+
+  for (i = 0; i < 4; i++)
+    if (c->fd[i] >= 0)
+      {
+	ioctl (c->fd[i], PERF_EVENT_IOC_DISABLE, 0);
+	if (read (c->fd[i], &count[i], sizeof count[i]) != sizeof count[i])
+	  count[i] = 0;
+	close (c->fd[i]);
+      }
+    else
+      count[i] = 0;
+
+  strcpy (l1, "n/a");
+  strcpy (ll, "n/a");
+  if (count[0])
+    sprintf (l1, "%.2f%%", 100.0 * count[1] / count[0]);
+  if (count[2])
+    sprintf (ll, "%.2f%%", 100.0 * count[3] / count[2]);
+}
+
+#else /* !HAVE_LINUX_PERF_EVENT_H */
+
+static void
+start_counters (Counters *c)
+{
+}
+
+static void
+stop_counters (Counters *c,
+	       char *l1,
+	       char *ll)
+{
+  strcpy (l1, "n/a");
+  strcpy (ll, "n/a");
+}
+
+#endif /* !HAVE_LINUX_PERF_EVENT_H */
+
+int
+main (int argc,
+      char *argv[])
+{
+  static FriBidiChar str[STREAM_LEN];
+  unsigned long sum = 0;
+  int k, npass;
+
+  npass = argc >= 2 ? atoi (argv[1]) : 1000;
+  if (npass <= 0)
+    {
+      fprintf (stderr, "usage: %s [passes]\n", argv[0]);
+      return 1;
+    }
+
+  printf ("* Level %d: %lu table bytes, %d lookups per character\n",
+	  FRIBIDI_TAB_CHAR_TYPE_LEVEL, (unsigned long) TABLE_BYTES,
+	  FRIBIDI_TAB_CHAR_TYPE_LEVEL);
+  printf ("  %-12s %10s %10s %10s\n", "stream", "ns/lookup", "L1d miss",
+	  "LL miss");
+  for (k = 0; k < streams_count; k++)
+    {
+      Counters c;
+      char l1[20], ll[20];
+      double time0, time1;
+
+      fill_stream (str, k);
+      /* Warm up the caches. */
+      sum += lookup_stream (str, 1);
+
+      start_counters (&c);
+      time0 = utime ();
+      sum += lookup_stream (str, npass);
+      time1 = utime ();
+      stop_counters (&c, l1, ll);
+
+      printf ("  %-12s %10.3f %10s %10s\n", streams[k].name,
+	      (time1 - time0) * 1e9 / ((double) npass * STREAM_LEN), l1, ll);
+    }
+
+  /* Keep the compiler from dropping the lookups. */
+  if (sum == 1)
+    printf ("\n");
+
+  return 0;
+}
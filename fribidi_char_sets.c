@@ -24,7 +24,12 @@
 #include "fribidi_config.h"
 #ifndef FRIBIDI_NO_CHARSETS
 
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
 #include "fribidi_char_sets.h"
+#include "fribidi_char_sets_8bit.h"
+#include "fribidi_probes.h"
 
 typedef struct
 {
@@ -47,12 +52,29 @@ typedef struct
   /* Comments, if any. */
   char *(*desc) (void);
   /* Some charsets like CapRTL may need to change some fribidis tables, by
-     calling this function, they can do this changes. */
+     calling this function, they can do this changes.  The conversions do
+     not call it, so the conversion functions must set up whatever they
+     need themselves, once, and be safe to call from several threads. */
   fribidi_boolean (*enter) (void);
   /* Some charsets like CapRTL may need to change some fribidis tables, by
      calling this function, they can undo their changes, perhaps to enter
      another mode. */
   fribidi_boolean (*leave) (void);
+  /* The number of bytes at the end of s that start a sequence which more
+     bytes may complete, always less than FRIBIDI_CHAR_SET_CARRY_MAX.
+     NULL for the charsets with no multi-byte sequences. */
+  int (*incomplete_length) (const char *s,
+			    int length);
+  /* The exact number of characters charset_to_unicode writes, and of
+     bytes unicode_to_charset writes, not counting the terminating 0.
+     NULL for the charsets that map each byte to a single character. */
+  int (*charset_to_unicode_size) (char *s,
+				  int length);
+  int (*unicode_to_charset_size) (FriBidiChar *us,
+				  int length);
+  /* The tables of a charset loaded by fribidi_char_set_load(), which is
+     converted by fribidi_char_sets_8bit.c, or NULL. */
+  FriBidiCharSet8bit *table;
 }
 FriBidiCharSetHandler;
 
@@ -68,6 +90,9 @@ FriBidiCharSetHandler;
     fribidi_char_set_desc_##char_set, \
     fribidi_char_set_enter_##char_set, \
     fribidi_char_set_leave_##char_set, \
+    fribidi_##char_set##_incomplete_length, \
+    fribidi_##char_set##_to_unicode_size, \
+    fribidi_unicode_to_##char_set##_size, \
   },
 
 FriBidiCharSetHandler fribidi_char_sets[FRIBIDI_CHAR_SETS_NUM + 1] = {
@@ -77,6 +102,61 @@ FriBidiCharSetHandler fribidi_char_sets[FRIBIDI_CHAR_SETS_NUM + 1] = {
 
 #undef _FRIBIDI_ADD_CHAR_SET
 
+/* The charsets loaded by fribidi_char_set_load(), numbered after the
+   compiled-in ones. */
+typedef struct
+{
+  FriBidiCharSetHandler handler;
+  FriBidiCharSet8bit table;
+  FriBidiChar to_unicode[256];
+}
+LoadedCharSet;
+
+static LoadedCharSet *loaded_char_sets[FRIBIDI_CHAR_SETS_LOADED_MAX];
+static int loaded_char_sets_num = 0;
+
+/* The handler of char_set, or the "Not Implemented" one. */
+static FriBidiCharSetHandler *
+get_handler (FriBidiCharSet char_set)
+{
+  int i = char_set - FRIBIDI_CHAR_SETS_NUM - 1;
+
+  if (char_set >= 0 && char_set <= FRIBIDI_CHAR_SETS_NUM)
+    return &fribidi_char_sets[char_set];
+  else if (i >= 0 && i < loaded_char_sets_num)
+    return &loaded_char_sets[i]->handler;
+  else
+    return &fribidi_char_sets[FRIBIDI_CHAR_SET_NOT_FOUND];
+}
+
+static int
+handler_to_unicode (FriBidiCharSetHandler *h,
+		    char *s,
+		    int length,
+		    /* output */
+		    FriBidiChar *us)
+{
+  if (h->table)
+    return fribidi_8bit_to_unicode (h->table, s, length, us);
+  else
+    return h->charset_to_unicode == NULL ? 0 :
+      (*h->charset_to_unicode) (s, length, us);
+}
+
+static int
+handler_unicode_to (FriBidiCharSetHandler *h,
+		    FriBidiChar *us,
+		    int length,
+		    /* output */
+		    char *s)
+{
+  if (h->table)
+    return fribidi_unicode_to_8bit (h->table, us, length, s);
+  else
+    return h->unicode_to_charset == NULL ? 0 :
+      (*h->unicode_to_charset) (us, length, s);
+}
+
 static char
 toupper (char c)
 {
@@ -101,8 +181,8 @@ fribidi_parse_charset (char *s)
 {
   int i;
 
-  for (i = FRIBIDI_CHAR_SETS_NUM; i; i--)
-    if (fribidi_strcasecmp (s, fribidi_char_sets[i].name) == 0)
+  for (i = FRIBIDI_CHAR_SETS_NUM + loaded_char_sets_num; i; i--)
+    if (fribidi_strcasecmp (s, get_handler (i)->name) == 0)
       return i;
 
   return FRIBIDI_CHAR_SET_NOT_FOUND;
@@ -118,9 +198,12 @@ fribidi_charset_to_unicode (FriBidiCharSet char_set,
 			    /* output */
 			    FriBidiChar *us)
 {
-  fribidi_char_set_enter (char_set);
-  return fribidi_char_sets[char_set].charset_to_unicode == NULL ? 0 :
-    (*fribidi_char_sets[char_set].charset_to_unicode) (s, length, us);
+  int out_len;
+
+  FRIBIDI_PROBE2 (charset_to_unicode__entry, char_set, length);
+  out_len = handler_to_unicode (get_handler (char_set), s, length, us);
+  FRIBIDI_PROBE3 (charset_to_unicode__return, char_set, length, out_len);
+  return out_len;
 }
 
 /* Convert the unicode string "us" with length "length" to character
@@ -132,33 +215,148 @@ fribidi_unicode_to_charset (FriBidiCharSet char_set,
 			    /* output */
 			    char *s)
 {
-  fribidi_char_set_enter (char_set);
-  return fribidi_char_sets[char_set].unicode_to_charset == NULL ? 0 :
-    (*fribidi_char_sets[char_set].unicode_to_charset) (us, length, s);
+  int out_len;
+
+  FRIBIDI_PROBE2 (unicode_to_charset__entry, char_set, length);
+  out_len = handler_unicode_to (get_handler (char_set), us, length, s);
+  FRIBIDI_PROBE3 (unicode_to_charset__return, char_set, length, out_len);
+  return out_len;
+}
+
+/* The exact number of characters fribidi_charset_to_unicode() writes
+   for "s", not counting the terminating 0. */
+FRIBIDI_API int
+fribidi_charset_to_unicode_size (FriBidiCharSet char_set,
+				 char *s,
+				 int length)
+{
+  FriBidiCharSetHandler *h = get_handler (char_set);
+
+  if (h->charset_to_unicode_size)
+    return (*h->charset_to_unicode_size) (s, length);
+  else
+    return h->charset_to_unicode || h->table ? length : 0;
+}
+
+/* The exact number of bytes fribidi_unicode_to_charset() writes for
+   "us", not counting the terminating 0. */
+FRIBIDI_API int
+fribidi_unicode_to_charset_size (FriBidiCharSet char_set,
+				 FriBidiChar *us,
+				 int length)
+{
+  FriBidiCharSetHandler *h = get_handler (char_set);
+
+  if (h->unicode_to_charset_size)
+    return (*h->unicode_to_charset_size) (us, length);
+  else
+    return h->unicode_to_charset || h->table ? length : 0;
+}
+
+FRIBIDI_API void
+fribidi_char_set_converter_init (FriBidiCharSetConverter *conv,
+				 FriBidiCharSet char_set)
+{
+  conv->char_set = char_set;
+  conv->carry_length = 0;
+}
+
+/* Every charset decodes at most one character from each byte, so n bytes
+   always fit in n characters of us. */
+FRIBIDI_API int
+fribidi_char_set_converter_to_unicode (FriBidiCharSetConverter *conv,
+				       const char *s,
+				       int length,
+				       /* output */
+				       FriBidiChar *us,
+				       int us_size,
+				       int *consumed)
+{
+  FriBidiCharSetHandler *h = get_handler (conv->char_set);
+  int room = us_size - 1, out = 0, pos = 0;
+
+  if (h->charset_to_unicode == NULL && h->table == NULL)
+    {
+      *consumed = length;
+      return 0;
+    }
+
+  /* Complete the carried sequence first, a byte at a time. */
+  while (conv->carry_length && pos < length
+	 && room - out > conv->carry_length)
+    {
+      int tail;
+
+      conv->carry[conv->carry_length++] = s[pos++];
+      tail = h->incomplete_length (conv->carry, conv->carry_length);
+      if (tail < conv->carry_length)
+	{
+	  out += handler_to_unicode (h, conv->carry,
+				     conv->carry_length - tail, us + out);
+	  memmove (conv->carry, conv->carry + conv->carry_length - tail,
+		   tail);
+	  conv->carry_length = tail;
+	}
+    }
+
+  /* Then convert as much of the rest as fits, and carry its tail. */
+  if (!conv->carry_length)
+    {
+      int n = length - pos < room - out ? length - pos : room - out;
+      int tail = h->incomplete_length ?
+	h->incomplete_length (s + pos, n) : 0;
+
+      out += handler_to_unicode (h, (char *) s + pos, n - tail, us + out);
+      memcpy (conv->carry, s + pos + n - tail, tail);
+      conv->carry_length = tail;
+      pos += n;
+    }
+
+  us[out] = 0;
+  *consumed = pos;
+  return out;
+}
+
+FRIBIDI_API int
+fribidi_char_set_converter_flush (FriBidiCharSetConverter *conv,
+				  /* output */
+				  FriBidiChar *us)
+{
+  FriBidiCharSetHandler *h = get_handler (conv->char_set);
+  int out = 0;
+
+  if (conv->carry_length)
+    out = handler_to_unicode (h, conv->carry, conv->carry_length, us);
+  us[out] = 0;
+  conv->carry_length = 0;
+  return out;
 }
 
 /* Return the string containing the name of the charset. */
 FRIBIDI_API char *
 fribidi_char_set_name (FriBidiCharSet char_set)
 {
-  return fribidi_char_sets[char_set].name == NULL ? (char *) "" :
-    fribidi_char_sets[char_set].name;
+  FriBidiCharSetHandler *h = get_handler (char_set);
+
+  return h->name == NULL ? (char *) "" : h->name;
 }
 
 /* Return the string containing the title of the charset. */
 FRIBIDI_API char *
 fribidi_char_set_title (FriBidiCharSet char_set)
 {
-  return fribidi_char_sets[char_set].title == NULL ?
-    fribidi_char_set_name (char_set) : fribidi_char_sets[char_set].title;
+  FriBidiCharSetHandler *h = get_handler (char_set);
+
+  return h->title == NULL ? fribidi_char_set_name (char_set) : h->title;
 }
 
 /* Return the string containing the comments about the charset, if any. */
 FRIBIDI_API char *
 fribidi_char_set_desc (FriBidiCharSet char_set)
 {
-  return fribidi_char_sets[char_set].desc == NULL ?
-    NULL : fribidi_char_sets[char_set].desc ();
+  FriBidiCharSetHandler *h = get_handler (char_set);
+
+  return h->desc == NULL ? NULL : h->desc ();
 }
 
 static FriBidiCharSet current_char_set = FRIBIDI_CHAR_SET_DEFAULT;
@@ -168,11 +366,11 @@ static FriBidiCharSet current_char_set = FRIBIDI_CHAR_SET_DEFAULT;
 FRIBIDI_API fribidi_boolean
 fribidi_char_set_enter (FriBidiCharSet char_set)
 {
-  if (char_set != current_char_set && fribidi_char_sets[char_set].enter)
+  if (char_set != current_char_set && get_handler (char_set)->enter)
     {
       fribidi_char_set_leave (current_char_set);
       current_char_set = char_set;
-      return (*fribidi_char_sets[char_set].enter) ();
+      return (*get_handler (char_set)->enter) ();
     }
   else
     return FRIBIDI_TRUE;
@@ -184,16 +382,104 @@ fribidi_char_set_enter (FriBidiCharSet char_set)
 FRIBIDI_API fribidi_boolean
 fribidi_char_set_leave (FriBidiCharSet char_set)
 {
-  if (char_set == current_char_set && fribidi_char_sets[char_set].leave)
-    return (*fribidi_char_sets[char_set].leave) ();
+  if (char_set == current_char_set && get_handler (char_set)->leave)
+    return (*get_handler (char_set)->leave) ();
   else
     return FRIBIDI_TRUE;
 }
 
+static char *
+copy_string (const char *s)
+{
+  char *t = (char *) malloc (strlen (s) + 1);
 
-/* Interface version 1, deprecated, just for compatibility. */
+  if (t)
+    strcpy (t, s);
+  return t;
+}
 
-#include <string.h>
+/* Parse the mapping lines into to_unicode, which already maps each byte
+   to itself, as the undefined bytes are left. */
+static fribidi_boolean
+read_mapping (FILE *f,
+	      FriBidiChar *to_unicode)
+{
+  char line[256];
+
+  while (fgets (line, sizeof line, f))
+    {
+      char *p = line, *end;
+      unsigned long ch, uch;
+      int c;
+
+      /* Drop the rest of a long line, which can only be a comment. */
+      if (!strchr (line, '\n'))
+	while ((c = getc (f)) != EOF && c != '\n');
+
+      while (*p == ' ' || *p == '\t')
+	p++;
+      if (*p == '#' || *p == '\n' || *p == '\r' || !*p)
+	continue;
+      ch = strtoul (p, &end, 0);
+      if (end == p || ch > 0xFF)
+	return FRIBIDI_FALSE;
+      for (p = end; *p == ' ' || *p == '\t'; p++);
+      if (*p == '#' || *p == '\n' || *p == '\r' || !*p)
+	continue;		/* Undefined. */
+      uch = strtoul (p, &end, 0);
+      if (end == p || uch >= FRIBIDI_UNICODE_CHARS)
+	return FRIBIDI_FALSE;
+      to_unicode[ch] = uch;
+    }
+
+  return !ferror (f);
+}
+
+FRIBIDI_API FriBidiCharSet
+fribidi_char_set_load (const char *filename,
+		       const char *name,
+		       const char *title)
+{
+  LoadedCharSet *cs;
+  FILE *f;
+  int i;
+
+  if (loaded_char_sets_num == FRIBIDI_CHAR_SETS_LOADED_MAX
+      || fribidi_parse_charset ((char *) name) != FRIBIDI_CHAR_SET_NOT_FOUND)
+    return FRIBIDI_CHAR_SET_NOT_FOUND;
+  if (!(cs = (LoadedCharSet *) calloc (1, sizeof (LoadedCharSet))))
+    return FRIBIDI_CHAR_SET_NOT_FOUND;
+  if (!(f = fopen (filename, "r")))
+    {
+      free (cs);
+      return FRIBIDI_CHAR_SET_NOT_FOUND;
+    }
+  for (i = 0; i < 256; i++)
+    cs->to_unicode[i] = i;
+  if (!read_mapping (f, cs->to_unicode)
+      || !(cs->handler.name = copy_string (name))
+      || (title && !(cs->handler.title = copy_string (title))))
+    {
+      fclose (f);
+      free (cs->handler.name);
+      free (cs);
+      return FRIBIDI_CHAR_SET_NOT_FOUND;
+    }
+  fclose (f);
+
+  /* The bytes up to the first one that is not itself are written as
+     themselves, with no lookup. */
+  for (i = 0; i < 256 && cs->to_unicode[i] == (FriBidiChar) i; i++);
+  cs->table.to_unicode = cs->to_unicode;
+  cs->table.identity_below = i;
+  fribidi_8bit_build (&cs->table);
+  cs->handler.table = &cs->table;
+
+  loaded_char_sets[loaded_char_sets_num] = cs;
+  return FRIBIDI_CHAR_SETS_NUM + 1 + loaded_char_sets_num++;
+}
+
+/* Interface version 1, deprecated, just for compatibility. */
 
 FRIBIDI_API int
 fribidi_charset_to_unicode_1 (FriBidiCharSet char_set,
@@ -63,7 +63,9 @@ extern "C"
 #define FRIBIDI_CHAR_SETS_NUM (FRIBIDI_CHAR_SETS_NUM_PLUS_ONE - 1)
 
 /* Convert the character string "s" in charset "char_set" to unicode
-   string "us" and return it's length. */
+   string "us" and return it's length.  The conversions change no global
+   state: every charset sets its tables up once, on first use, so they
+   can run in parallel threads, on any mix of charsets. */
   FRIBIDI_API int fribidi_charset_to_unicode (FriBidiCharSet char_set,
 					      char *s,
 					      int length,
@@ -78,6 +80,73 @@ extern "C"
 					      /* output */
 					      char *s);
 
+/*======================================================================
+ *  Streaming conversion to Unicode.
+ *
+ *  A FriBidiCharSetConverter converts text that comes in buffers of any
+ *  size, like blocks read from a file or a socket.  A sequence cut at
+ *  the end of a buffer, like a multi-byte UTF-8 character or a CapRTL
+ *  `_x' escape, is carried in the converter and completed by the next
+ *  buffer, so the text converts the same as if it came in one buffer.
+ *  A converter needs no freeing, and the converters of different
+ *  threads are independent.
+ *----------------------------------------------------------------------*/
+
+/* The most bytes a converter carries between buffers. */
+#define FRIBIDI_CHAR_SET_CARRY_MAX 4
+
+  typedef struct _FriBidiCharSetConverter
+  {
+    FriBidiCharSet char_set;
+    char carry[FRIBIDI_CHAR_SET_CARRY_MAX];
+    int carry_length;
+  }
+  FriBidiCharSetConverter;
+
+/* Start converting a new text in charset "char_set". */
+  FRIBIDI_API void fribidi_char_set_converter_init (FriBidiCharSetConverter
+						    *conv,
+						    FriBidiCharSet char_set);
+
+/* Convert as much of the "length" bytes of "s" as fits in "us", which
+   has room for "us_size" characters, the terminating 0 included.
+   Returns the number of characters written, not counting the 0, and
+   sets "consumed" to the number of bytes of "s" used up, including those
+   carried to the next call.  "us_size" must be more than FRIBIDI_CHAR_SET_CARRY_MAX for
+   every call to make progress, and with "us_size" at least "length" +
+   FRIBIDI_CHAR_SET_CARRY_MAX + 1 the whole of "s" is always consumed. */
+  FRIBIDI_API int fribidi_char_set_converter_to_unicode (FriBidiCharSetConverter
+							 *conv,
+							 const char *s,
+							 int length,
+							 /* output */
+							 FriBidiChar *us,
+							 int us_size,
+							 int *consumed);
+
+/* At the end of the text, convert what the converter still carries, an
+   incomplete sequence, the way fribidi_charset_to_unicode() would
+   convert it at the end of a string, and start over.  Returns the number
+   of characters written to "us", which must have room for
+   FRIBIDI_CHAR_SET_CARRY_MAX + 1 characters, followed by a 0. */
+  FRIBIDI_API int fribidi_char_set_converter_flush (FriBidiCharSetConverter
+						    *conv,
+						    /* output */
+						    FriBidiChar *us);
+
+/* Return the exact number of characters fribidi_charset_to_unicode()
+   writes for "s", not counting the terminating 0, so that "us" can be
+   allocated before converting.  It writes nothing. */
+  FRIBIDI_API int fribidi_charset_to_unicode_size (FriBidiCharSet char_set,
+						   char *s,
+						   int length);
+
+/* Return the exact number of bytes fribidi_unicode_to_charset() writes
+   for "us", not counting the terminating 0.  It writes nothing. */
+  FRIBIDI_API int fribidi_unicode_to_charset_size (FriBidiCharSet char_set,
+						   FriBidiChar *us,
+						   int length);
+
 /* Return the string containing the name of the charset. */
   FRIBIDI_API char *fribidi_char_set_name (FriBidiCharSet char_set);
 
@@ -89,19 +158,37 @@ extern "C"
   FRIBIDI_API char *fribidi_char_set_desc (FriBidiCharSet char_set);
 
 /* Some charsets like CapRTL may need to change some fribidis tables, by
-   calling this function, they can do this changes. */
+   calling this function, they can do this changes.  None of the charsets
+   needs it anymore, and the conversions do not call it; it is kept for
+   compatibility. */
   FRIBIDI_API fribidi_boolean fribidi_char_set_enter (FriBidiCharSet
 						      char_set);
 
 /* Some charsets like CapRTL may need to change some fribidis tables, by
    calling this function, they can undo their changes, perhaps to enter
-   another mode. */
+   another mode.  Kept for compatibility, as fribidi_char_set_enter(). */
   FRIBIDI_API fribidi_boolean fribidi_char_set_leave (FriBidiCharSet
 						      char_set);
 
 /* Return the charset which name is "s". */
   FRIBIDI_API FriBidiCharSet fribidi_parse_charset (char *s);
 
+/* The most charsets fribidi_char_set_load() can add. */
+#define FRIBIDI_CHAR_SETS_LOADED_MAX 64
+
+/* Add an 8-bit charset from a mapping file in the format of the ones at
+   ftp://ftp.unicode.org/Public/MAPPINGS/: a line for each byte, with
+   the byte and its character as hexadecimal numbers, and `#' comments.
+   The bytes the file leaves undefined read as themselves.  The charset
+   converts by table lookups, as fast as the compiled-in 8-bit ones, and
+   is found by fribidi_parse_charset() under "name".  "title" may be
+   NULL.  Returns the new charset, or FRIBIDI_CHAR_SET_NOT_FOUND if the
+   file cannot be read or the name is taken.  Load the charsets before
+   converting in other threads. */
+  FRIBIDI_API FriBidiCharSet fribidi_char_set_load (const char *filename,
+						    const char *name,
+						    const char *title);
+
 
 #ifdef FRIBIDI_INTERFACE_1
 /* Interface version 1, deprecated, just for compatibility. */
@@ -0,0 +1,117 @@
+/* FriBidi - Library of BiDi algorithm
+ * Copyright (C) 1999,2000 Dov Grobgeld, and
+ * Copyright (C) 2001,2002 Behdad Esfahbod. 
+ * 
+ * This library is free software; you can redistribute it and/or 
+ * modify it under the terms of the GNU Lesser General Public 
+ * License as published by the Free Software Foundation; either 
+ * version 2.1 of the License, or (at your option) any later version. 
+ * 
+ * This library is distributed in the hope that it will be useful, 
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of 
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU 
+ * Lesser General Public License for more details. 
+ * 
+ * You should have received a copy of the GNU Lesser General Public License 
+ * along with this library, in a file named COPYING; if not, write to the 
+ * Free Software Foundation, Inc., 59 Temple Place, Suite 330, 
+ * Boston, MA 02111-1307, USA  
+ * 
+ * For licensing issues, contact <dov@imagic.weizmann.ac.il> and 
+ * <fwpg@sharif.edu>. 
+ */
+
+#include "fribidi_config.h"
+#ifndef FRIBIDI_NO_CHARSETS
+
+#include <stdlib.h>
+#include "fribidi.h"
+#include "fribidi_char_sets_8bit.h"
+
+#define UNKNOWN '\277'
+
+int
+fribidi_8bit_to_unicode (const FriBidiCharSet8bit *cs,
+			 const char *s,
+			 int len,
+			 FriBidiChar *us)
+{
+  const FriBidiChar *tab = cs->to_unicode;
+  const unsigned char *p = (const unsigned char *) s;
+  int i;
+
+  for (i = 0; i + 4 <= len; i += 4)
+    {
+      us[i] = tab[p[i]];
+      us[i + 1] = tab[p[i + 1]];
+      us[i + 2] = tab[p[i + 2]];
+      us[i + 3] = tab[p[i + 3]];
+    }
+  for (; i < len; i++)
+    us[i] = tab[p[i]];
+  us[len] = 0;
+
+  return len;
+}
+
+void
+fribidi_8bit_build (FriBidiCharSet8bit *cs)
+{
+  int ch;
+
+  /* Going down, the lowest byte of a character wins. */
+  for (ch = 255; ch > 0; ch--)
+    {
+      FriBidiChar uch = cs->to_unicode[ch];
+      unsigned char **block = &cs->from_unicode[uch >> 8];
+
+      if (uch < cs->identity_below || uch > 0xFFFF)
+	continue;
+      if (!*block && !(*block = calloc (256, 1)))
+	return;
+      (*block)[uch & 0xFF] = ch;
+    }
+}
+
+char
+fribidi_unicode_to_8bit_c (const FriBidiCharSet8bit *cs,
+			   FriBidiChar uch)
+{
+  const unsigned char *block;
+
+  if (uch < cs->identity_below)
+    return (char) uch;
+  if (uch <= 0xFFFF && (block = cs->from_unicode[uch >> 8])
+      && block[uch & 0xFF])
+    return (char) block[uch & 0xFF];
+  else
+    return UNKNOWN;
+}
+
+int
+fribidi_unicode_to_8bit (const FriBidiCharSet8bit *cs,
+			 const FriBidiChar *us,
+			 int len,
+			 char *s)
+{
+  int i;
+
+  for (i = 0; i < len; i++)
+    {
+      FriBidiChar uch = us[i];
+      const unsigned char *block;
+
+      if (uch < cs->identity_below)
+	s[i] = (char) uch;
+      else if (uch <= 0xFFFF && (block = cs->from_unicode[uch >> 8])
+	       && block[uch & 0xFF])
+	s[i] = (char) block[uch & 0xFF];
+      else
+	s[i] = UNKNOWN;
+    }
+  s[i] = 0;
+
+  return len;
+}
+
+#endif
@@ -0,0 +1,74 @@
+/* FriBidi - Library of BiDi algorithm
+ * Copyright (C) 1999,2000 Dov Grobgeld, and
+ * Copyright (C) 2001,2002 Behdad Esfahbod. 
+ * 
+ * This library is free software; you can redistribute it and/or 
+ * modify it under the terms of the GNU Lesser General Public 
+ * License as published by the Free Software Foundation; either 
+ * version 2.1 of the License, or (at your option) any later version. 
+ * 
+ * This library is distributed in the hope that it will be useful, 
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of 
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU 
+ * Lesser General Public License for more details. 
+ * 
+ * You should have received a copy of the GNU Lesser General Public License 
+ * along with this library, in a file named COPYING; if not, write to the 
+ * Free Software Foundation, Inc., 59 Temple Place, Suite 330, 
+ * Boston, MA 02111-1307, USA  
+ * 
+ * For licensing issues, contact <dov@imagic.weizmann.ac.il> and 
+ * <fwpg@sharif.edu>. 
+ */
+
+#include "fribidi_config.h"
+#ifndef FRIBIDI_NO_CHARSETS
+
+#ifndef FRIBIDI_CHAR_SETS_8BIT_H
+#define FRIBIDI_CHAR_SETS_8BIT_H
+
+#include "fribidi_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* The common part of the 8-bit charsets, that map each byte to a single
+   character: a 256 entry table to Unicode, and a two level table back,
+   built from it by fribidi_8bit_build(), which each charset calls once
+   under FRIBIDI_ONCE before converting from Unicode.  Characters below
+   identity_below are written as themselves, and characters not in
+   either as '\277'. */
+  typedef struct _FriBidiCharSet8bit
+  {
+    const FriBidiChar *to_unicode;	/* 256 entries. */
+    FriBidiChar identity_below;
+    /* Blocks of 256 characters of the BMP, NULL for the ones with no
+       character in the charset.  0 is not in the charset either. */
+    unsigned char *from_unicode[256];
+  }
+  FriBidiCharSet8bit;
+
+  void fribidi_8bit_build (FriBidiCharSet8bit *cs);
+
+  int fribidi_8bit_to_unicode (const FriBidiCharSet8bit *cs,
+			       const char *s,
+			       int length,
+			       /* Output */
+			       FriBidiChar *us);
+  char fribidi_unicode_to_8bit_c (const FriBidiCharSet8bit *cs,
+				  FriBidiChar uch);
+  int fribidi_unicode_to_8bit (const FriBidiCharSet8bit *cs,
+			       const FriBidiChar *us,
+			       int length,
+			       /* Output */
+			       char *s);
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif				/* FRIBIDI_CHAR_SETS_8BIT_H */
+
+#endif
@@ -21,6 +21,9 @@
  * <fwpg@sharif.edu>.
  */
 
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
 #include "fribidi_config.h"
 #ifndef FRIBIDI_NO_CHARSETS
 
@@ -28,6 +31,8 @@
 #include <string.h>
 #include <stdio.h>
 #include "fribidi.h"
+#include "fribidi_inline.h"
+#include "fribidi_once.h"
 
 FRIBIDI_API FriBidiCharType fribidi_get_type_internal (FriBidiChar uch);
 
@@ -90,16 +95,80 @@ static FriBidiPropCharType CapRTLCharTypes[] = {
 
 #define CAPRTL_CHARS (sizeof CapRTLCharTypes / sizeof CapRTLCharTypes[0])
 
-static FriBidiChar *caprtl_to_unicode = NULL;
+static FriBidiChar caprtl_to_unicode[CAPRTL_CHARS];
+
+/* The way back, in blocks of 256 characters of the BMP, NULL for the
+   blocks with no CapRTL character.  The entries are one more than the
+   CapRTL characters, 0 for none.  There are no more blocks than CapRTL
+   characters, so all of them fit in caprtl_blocks. */
+static unsigned char caprtl_blocks[CAPRTL_CHARS][256];
+static unsigned char *unicode_to_caprtl[256];
+
+FRIBIDI_ONCE_DEFINE (caprtl_once);
+
+/* Give each CapRTL character the first BMP character of its type that
+   has no mirror, or itself if it has a mirror. */
+static void
+build_caprtl_maps (void)
+{
+  int next[CAPRTL_CHARS], first[FRIBIDI_TYPES_COUNT];
+  int *last[FRIBIDI_TYPES_COUNT];
+  int i, count, blocks = 0;
+
+  /* Chain the characters of each type to be assigned, in order. */
+  for (i = 0; i < FRIBIDI_TYPES_COUNT; i++)
+    {
+      first[i] = -1;
+      last[i] = &first[i];
+    }
+  for (count = 0, i = 0; i < CAPRTL_CHARS; i++)
+    if (fribidi_get_mirror_char (NULL, i, NULL))
+      caprtl_to_unicode[i] = i;
+    else
+      {
+	int type = (unsigned char) CapRTLCharTypes[i];
+
+	*last[type] = i;
+	last[type] = &next[i];
+	next[i] = -1;
+	count++;
+      }
+
+  for (i = 1; i < 0x10000 && count; i++)
+    {
+      FriBidiProps props = fribidi_get_props_inline (i);
+      int type = props & FRIBIDI_PROPS_TYPE_MASK;
+
+      if (first[type] >= 0 && !FRIBIDI_PROPS_HAS_MIRROR (props))
+	{
+	  caprtl_to_unicode[first[type]] = i;
+	  first[type] = next[first[type]];
+	  count--;
+	}
+    }
+
+  for (i = CAPRTL_CHARS - 1; i >= 0; i--)
+    {
+      FriBidiChar uch = caprtl_to_unicode[i];
+      unsigned char **block = &unicode_to_caprtl[uch >> 8];
+
+      if (!*block)
+	*block = caprtl_blocks[blocks++];
+      (*block)[uch & 0xFF] = i + 1;
+    }
+}
 
 char
 fribidi_unicode_to_cap_rtl_c (FriBidiChar uch)
 {
-  int i;
-  for (i = 0; i < CAPRTL_CHARS; i++)
-    if (uch == caprtl_to_unicode[i])
-      return (char) i;
-  return '?';
+  const unsigned char *block;
+
+  FRIBIDI_ONCE (caprtl_once, build_caprtl_maps);
+  if (uch <= 0xFFFF && (block = unicode_to_caprtl[uch >> 8])
+      && block[uch & 0xFF])
+    return (char) (block[uch & 0xFF] - 1);
+  else
+    return '?';
 }
 
 int
@@ -109,13 +178,14 @@ fribidi_cap_rtl_to_unicode (char *s,
 {
   int i, j;
 
+  FRIBIDI_ONCE (caprtl_once, build_caprtl_maps);
   j = 0;
   for (i = 0; i < len; i++)
     {
       char ch;
 
       ch = s[i];
-      if (ch == '_')
+      if (ch == '_' && i + 1 < len)
 	{
 	  switch (ch = s[++i])
 	    {
@@ -149,13 +219,74 @@ fribidi_cap_rtl_to_unicode (char *s,
 	      break;
 	    }
 	}
+      else if (ch == '_')
+	us[j++] = '_';		/* A `_' at the end escapes nothing. */
+      else if ((unsigned char) ch < CAPRTL_CHARS)
+	us[j++] = caprtl_to_unicode[(unsigned char) ch];
       else
-	us[j++] = caprtl_to_unicode[(int) s[i]];
+	us[j++] = UNI_REPLACEMENT_CHAR;	/* Not a CapRTL byte. */
     }
 
   return j;
 }
 
+/* Every byte is a character, but the escape sequences. */
+int
+fribidi_cap_rtl_to_unicode_size (char *s,
+				 int len)
+{
+  int i, size = len;
+
+  for (i = 0; i + 1 < len; i++)
+    if (s[i] == '_' && s[i + 1] && strchr ("><lroLR_", s[i + 1]))
+      {
+	size--;
+	i++;
+      }
+
+  return size;
+}
+
+/* Every character is a byte, but the ones written escaped. */
+int
+fribidi_unicode_to_cap_rtl_size (FriBidiChar *us,
+				 int length)
+{
+  int i, size = length;
+
+  for (i = 0; i < length; i++)
+    switch (us[i])
+      {
+      case UNI_LRM:
+      case UNI_RLM:
+      case UNI_LRE:
+      case UNI_RLE:
+      case UNI_PDF:
+      case UNI_LRO:
+      case UNI_RLO:
+      case '_':
+	size++;
+	break;
+      }
+
+  return size;
+}
+
+/* A `_' escapes the character after it, so a run of `_' at the end is
+   pairs of `__', and one `_' still waiting for its character if the run
+   is odd. */
+int
+fribidi_cap_rtl_incomplete_length (const char *s,
+				   int length)
+{
+  int i = length;
+
+  while (i > 0 && s[i - 1] == '_')
+    i--;
+
+  return (length - i) & 1;
+}
+
 int
 fribidi_unicode_to_cap_rtl (FriBidiChar *us,
 			    int length,
@@ -262,47 +393,7 @@ fribidi_char_set_desc_cap_rtl (void)
 fribidi_boolean
 fribidi_char_set_enter_cap_rtl (void)
 {
-  if (!caprtl_to_unicode)
-    {
-      int request[FRIBIDI_TYPES_COUNT + 1];
-      int i, count;
-
-      caprtl_to_unicode =
-	(FriBidiChar *) fribidi_malloc (NULL,
-					CAPRTL_CHARS *
-					sizeof caprtl_to_unicode[0]);
-      for (i = 0; i < FRIBIDI_TYPES_COUNT; i++)
-	request[i] = 0;
-      for (i = 0; i < CAPRTL_CHARS; i++)
-	if (fribidi_get_mirror_char (NULL, i, NULL))
-	  caprtl_to_unicode[i] = i;
-      for (count = 0, i = 0; i < CAPRTL_CHARS; i++)
-	if (caprtl_to_unicode[i] == 0)
-	  {
-	    request[(unsigned char) CapRTLCharTypes[i]]++;
-	    count++;
-	  }
-      for (i = 1; i < 0x10000 && count; i++)	/* Assign BMP chars to CapRTL entries */
-	if (!fribidi_get_mirror_char (NULL, i, NULL))
-	  {
-	    int j, k;
-	    for (j = 0; j < FRIBIDI_TYPES_COUNT; j++)
-	      if (fribidi_prop_to_type[j] == fribidi_get_type_internal (i))
-		break;
-	    if (!request[j])	/* Do not need this type */
-	      continue;
-	    for (k = 0; k < CAPRTL_CHARS; k++)
-	      if (!caprtl_to_unicode[k] && j == CapRTLCharTypes[k])
-		break;
-	    if (k < CAPRTL_CHARS)
-	      {
-		request[j]--;
-		count--;
-		caprtl_to_unicode[k] = i;
-	      }
-	  }
-    }
-
+  FRIBIDI_ONCE (caprtl_once, build_caprtl_maps);
   return FRIBIDI_TRUE;
 }
 
@@ -48,6 +48,12 @@ extern "C"
 				  int length,
 				  /* Output */
 				  char *s);
+  int fribidi_cap_rtl_incomplete_length (const char *s,
+					 int length);
+  int fribidi_cap_rtl_to_unicode_size (char *s,
+				       int length);
+  int fribidi_unicode_to_cap_rtl_size (FriBidiChar *us,
+				       int length);
 
 #ifdef	__cplusplus
 }
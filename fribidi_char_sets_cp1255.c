@@ -21,52 +21,66 @@
  * <fwpg@sharif.edu>. 
  */
 
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
 #include "fribidi_config.h"
 #ifndef FRIBIDI_NO_CHARSETS
 
-#include <string.h>
 #include "fribidi.h"
+#include "fribidi_char_sets_8bit.h"
+#include "fribidi_once.h"
 
-#define ISO_ALEF 224
-#define ISO_TAV 250
-#define CP1255_SHEVA 0xC0
-#define CP1255_SOF_PASUQ 0xD3
-#define CP1255_DOUBLE_VAV 0xD4
-#define CP1255_GERSHAYIM 0xD8
-
-#define UNI_ALEF 0x05D0
-#define UNI_TAV 0x05EA
-#define UNI_SHEVA 0x05B0
-#define UNI_SOF_PASUQ 0x05C3
-#define UNI_DOUBLE_VAV 0x05F0
-#define UNI_GERSHAYIM 0x05F4
-
-FriBidiChar fribidi_cp1255_to_unicode_tab[] = {	/* 0x80-0xBF */
-  0x20AC, 0x81, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021,
-  0x02C6, 0x2030, 0x8a, 0x2039, 0x8c, 0x8d, 0x8e, 0x8f,
-  0x90, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
-  0x02DC, 0x2122, 0x9a, 0x203A, 0x9c, 0x9d, 0x9e, 0x9f,
+/* Windows-1255.  The undefined bytes read as themselves. */
+static const FriBidiChar to_unicode[256] = {
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+  0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+  0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+  0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+  0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+  0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+  0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+  0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+  0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+  0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+  0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+  0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+  0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+  0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+  0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+  0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+  0x20AC, 0x0081, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021,
+  0x02C6, 0x2030, 0x008A, 0x2039, 0x008C, 0x008D, 0x008E, 0x008F,
+  0x0090, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
+  0x02DC, 0x2122, 0x009A, 0x203A, 0x009C, 0x009D, 0x009E, 0x009F,
   0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x20AA, 0x00A5, 0x00A6, 0x00A7,
   0x00A8, 0x00A9, 0x00D7, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF,
   0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7,
-  0x00B8, 0x00B9, 0x00F7, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF
+  0x00B8, 0x00B9, 0x00F7, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF,
+  0x05B0, 0x05B1, 0x05B2, 0x05B3, 0x05B4, 0x05B5, 0x05B6, 0x05B7,
+  0x05B8, 0x05B9, 0x05BA, 0x05BB, 0x05BC, 0x05BD, 0x05BE, 0x05BF,
+  0x05C0, 0x05C1, 0x05C2, 0x05C3, 0x05F0, 0x05F1, 0x05F2, 0x05F3,
+  0x05F4, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x00DD, 0x00DE, 0x00DF,
+  0x05D0, 0x05D1, 0x05D2, 0x05D3, 0x05D4, 0x05D5, 0x05D6, 0x05D7,
+  0x05D8, 0x05D9, 0x05DA, 0x05DB, 0x05DC, 0x05DD, 0x05DE, 0x05DF,
+  0x05E0, 0x05E1, 0x05E2, 0x05E3, 0x05E4, 0x05E5, 0x05E6, 0x05E7,
+  0x05E8, 0x05E9, 0x05EA, 0x00FB, 0x00FC, 0x00FD, 0x00FE, 0x00FF
 };
 
+static FriBidiCharSet8bit cp1255 = { to_unicode, 0x80 };
+
+FRIBIDI_ONCE_DEFINE (cp1255_once);
+
+static void
+build_cp1255 (void)
+{
+  fribidi_8bit_build (&cp1255);
+}
+
 FriBidiChar
-fribidi_cp1255_to_unicode_c (char sch)
+fribidi_cp1255_to_unicode_c (char ch)
 {
-  unsigned char ch = (unsigned char) sch;
-  if (ch >= ISO_ALEF && ch <= ISO_TAV)
-    return ch - ISO_ALEF + UNI_ALEF;
-  else if (ch >= CP1255_SHEVA && ch <= CP1255_SOF_PASUQ)
-    return ch - CP1255_SHEVA + UNI_SHEVA;
-  else if (ch >= CP1255_DOUBLE_VAV && ch <= CP1255_GERSHAYIM)
-    return ch - CP1255_DOUBLE_VAV + UNI_DOUBLE_VAV;
-  /* cp1256 specific chars */
-  else if (ch >= 0x80 && ch <= 0xbf)
-    return fribidi_cp1255_to_unicode_tab[ch - 0x80];
-  else
-    return ch;
+  return to_unicode[(unsigned char) ch];
 }
 
 int
@@ -74,28 +88,14 @@ fribidi_cp1255_to_unicode (char *s,
 			   int len,
 			   FriBidiChar *us)
 {
-  int i;
-
-  for (i = 0; i < len + 1; i++)
-    us[i] = fribidi_cp1255_to_unicode_c (s[i]);
-
-  return len;
+  return fribidi_8bit_to_unicode (&cp1255, s, len, us);
 }
 
 char
 fribidi_unicode_to_cp1255_c (FriBidiChar uch)
 {
-  if (uch >= UNI_ALEF && uch <= UNI_TAV)
-    return (char) (uch - UNI_ALEF + ISO_ALEF);
-  if (uch >= UNI_SHEVA && uch <= UNI_SOF_PASUQ)
-    return (char) (uch - UNI_SHEVA + CP1255_SHEVA);
-  if (uch >= UNI_DOUBLE_VAV && uch <= UNI_GERSHAYIM)
-    return (char) (uch - UNI_DOUBLE_VAV + CP1255_DOUBLE_VAV);
-  /* TODO: handle pre-composed and presentation chars */
-  else if (uch < 256)
-    return (char) uch;
-  else
-    return '';
+  FRIBIDI_ONCE (cp1255_once, build_cp1255);
+  return fribidi_unicode_to_8bit_c (&cp1255, uch);
 }
 
 int
@@ -103,13 +103,8 @@ fribidi_unicode_to_cp1255 (FriBidiChar *us,
 			   int length,
 			   char *s)
 {
-  int i;
-
-  for (i = 0; i < length; i++)
-    s[i] = fribidi_unicode_to_cp1255_c (us[i]);
-  s[i] = 0;
-
-  return length;
+  FRIBIDI_ONCE (cp1255_once, build_cp1255);
+  return fribidi_unicode_to_8bit (&cp1255, us, length, s);
 }
 
 #endif
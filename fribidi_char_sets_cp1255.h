@@ -39,6 +39,9 @@ extern "C"
 #define fribidi_char_set_desc_cp1255 NULL
 #define fribidi_char_set_enter_cp1255 NULL
 #define fribidi_char_set_leave_cp1255 NULL
+#define fribidi_cp1255_incomplete_length NULL
+#define fribidi_cp1255_to_unicode_size NULL
+#define fribidi_unicode_to_cp1255_size NULL
 
   FriBidiChar fribidi_cp1255_to_unicode_c (char ch);
   int fribidi_cp1255_to_unicode (char *s,
@@ -21,21 +21,34 @@
  * <fwpg@sharif.edu>. 
  */
 
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
 #include "fribidi_config.h"
 #ifndef FRIBIDI_NO_CHARSETS
 
-#include <string.h>
 #include "fribidi.h"
+#include "fribidi_char_sets_8bit.h"
+#include "fribidi_once.h"
 
-#define ISO_ALEF 224
-#define ISO_TAV 250
-#define ISO_HAMZA 0xc1
-#define CP1256_DAD 0xD6
-
-#define UNI_HAMZA 0x0621
-#define UNI_DAD 0x0636
-
-FriBidiChar fribidi_cp1256_to_unicode_tab[] = {	/* 0x80-0xFF */
+/* Windows-1256. */
+static const FriBidiChar to_unicode[256] = {
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+  0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+  0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+  0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+  0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+  0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+  0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+  0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+  0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+  0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+  0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+  0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+  0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+  0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+  0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+  0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
   0x20AC, 0x067E, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021,
   0x02C6, 0x2030, 0x0679, 0x2039, 0x0152, 0x0686, 0x0698, 0x0688,
   0x06AF, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
@@ -51,17 +64,23 @@ FriBidiChar fribidi_cp1256_to_unicode_tab[] = {	/* 0x80-0xFF */
   0x00E0, 0x0644, 0x00E2, 0x0645, 0x0646, 0x0647, 0x0648, 0x00E7,
   0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x0649, 0x064A, 0x00EE, 0x00EF,
   0x064B, 0x064C, 0x064D, 0x064E, 0x00F4, 0x064F, 0x0650, 0x00F7,
-  0x0651, 0x00F9, 0x0652, 0x00FB, 0x00FC, 0x200E, 0x200F, 0x00ff
+  0x0651, 0x00F9, 0x0652, 0x00FB, 0x00FC, 0x200E, 0x200F, 0x00FF
 };
 
+static FriBidiCharSet8bit cp1256 = { to_unicode, 0x80 };
+
+FRIBIDI_ONCE_DEFINE (cp1256_once);
+
+static void
+build_cp1256 (void)
+{
+  fribidi_8bit_build (&cp1256);
+}
+
 FriBidiChar
-fribidi_cp1256_to_unicode_c (char sch)
+fribidi_cp1256_to_unicode_c (char ch)
 {
-  unsigned char ch = (unsigned char) sch;
-  if (ch >= 0x80 && ch <= 0xff)
-    return fribidi_cp1256_to_unicode_tab[ch - 0x80];
-  else
-    return ch;
+  return to_unicode[(unsigned char) ch];
 }
 
 int
@@ -69,152 +88,14 @@ fribidi_cp1256_to_unicode (char *s,
 			   int len,
 			   FriBidiChar *us)
 {
-  int i;
-
-  for (i = 0; i < len + 1; i++)
-    us[i] = fribidi_cp1256_to_unicode_c (s[i]);
-
-  return len;
+  return fribidi_8bit_to_unicode (&cp1256, s, len, us);
 }
 
 char
 fribidi_unicode_to_cp1256_c (FriBidiChar uch)
 {
-  if (uch < 256)
-    return (char) uch;
-  if (uch >= UNI_HAMZA && uch <= UNI_DAD)
-    return (char) (uch - UNI_HAMZA + ISO_HAMZA);
-  else
-    switch (uch)
-      {
-      case 0x0152:
-	return (char) 0x8c;
-      case 0x0153:
-	return (char) 0x9c;
-      case 0x0192:
-	return (char) 0x83;
-      case 0x02C6:
-	return (char) 0x88;
-      case 0x060C:
-	return (char) 0xA1;
-      case 0x061B:
-	return (char) 0xBA;
-      case 0x061F:
-	return (char) 0xBF;
-      case 0x0637:
-	return (char) 0xD8;
-      case 0x0638:
-	return (char) 0xD9;
-      case 0x0639:
-	return (char) 0xDA;
-      case 0x063A:
-	return (char) 0xDB;
-      case 0x0640:
-	return (char) 0xDC;
-      case 0x0641:
-	return (char) 0xDD;
-      case 0x0642:
-	return (char) 0xDE;
-      case 0x0643:
-	return (char) 0xDF;
-      case 0x0644:
-	return (char) 0xE1;
-      case 0x0645:
-	return (char) 0xE3;
-      case 0x0646:
-	return (char) 0xE4;
-      case 0x0647:
-	return (char) 0xE5;
-      case 0x0648:
-	return (char) 0xE6;
-      case 0x0649:
-	return (char) 0xEC;
-      case 0x064A:
-	return (char) 0xED;
-      case 0x064B:
-	return (char) 0xF0;
-      case 0x064C:
-	return (char) 0xF1;
-      case 0x064D:
-	return (char) 0xF2;
-      case 0x064E:
-	return (char) 0xF3;
-      case 0x064F:
-	return (char) 0xF5;
-      case 0x0650:
-	return (char) 0xF6;
-      case 0x0651:
-	return (char) 0xF8;
-      case 0x0652:
-	return (char) 0xFA;
-      case 0x0679:
-	return (char) 0x8A;
-      case 0x067E:
-	return (char) 0x81;
-      case 0x0686:
-	return (char) 0x8D;
-      case 0x0688:
-	return (char) 0x8F;
-      case 0x0691:
-	return (char) 0x9A;
-      case 0x0698:
-	return (char) 0x8E;
-      case 0x06A9:
-	return (char) 0x98;
-      case 0x06AF:
-	return (char) 0x90;
-      case 0x06BA:
-	return (char) 0x9F;
-      case 0x06BE:
-	return (char) 0xAA;
-      case 0x06C1:
-	return (char) 0xC0;
-      case 0x200C:
-	return (char) 0x9D;
-      case 0x200D:
-	return (char) 0x9E;
-      case 0x200E:
-	return (char) 0xFD;
-      case 0x200F:
-	return (char) 0xFE;
-      case 0x2013:
-	return (char) 0x96;
-      case 0x2014:
-	return (char) 0x97;
-      case 0x2018:
-	return (char) 0x91;
-      case 0x2019:
-	return (char) 0x92;
-      case 0x201A:
-	return (char) 0x82;
-      case 0x201C:
-	return (char) 0x93;
-      case 0x201D:
-	return (char) 0x94;
-      case 0x201E:
-	return (char) 0x84;
-      case 0x2020:
-	return (char) 0x86;
-      case 0x2021:
-	return (char) 0x87;
-      case 0x2022:
-	return (char) 0x95;
-      case 0x2026:
-	return (char) 0x85;
-      case 0x2030:
-	return (char) 0x89;
-      case 0x2039:
-	return (char) 0x8B;
-      case 0x203A:
-	return (char) 0x9B;
-      case 0x20AC:
-	return (char) 0x80;
-      case 0x2122:
-	return (char) 0x99;
-
-      default:
-	return '';
-      }
+  FRIBIDI_ONCE (cp1256_once, build_cp1256);
+  return fribidi_unicode_to_8bit_c (&cp1256, uch);
 }
 
 int
@@ -222,13 +103,8 @@ fribidi_unicode_to_cp1256 (FriBidiChar *us,
 			   int length,
 			   char *s)
 {
-  int i;
-
-  for (i = 0; i < length; i++)
-    s[i] = fribidi_unicode_to_cp1256_c (us[i]);
-  s[i] = 0;
-
-  return length;
+  FRIBIDI_ONCE (cp1256_once, build_cp1256);
+  return fribidi_unicode_to_8bit (&cp1256, us, length, s);
 }
 
 #endif
@@ -39,6 +39,9 @@ extern "C"
 #define fribidi_char_set_desc_cp1256 NULL
 #define fribidi_char_set_enter_cp1256 NULL
 #define fribidi_char_set_leave_cp1256 NULL
+#define fribidi_cp1256_incomplete_length NULL
+#define fribidi_cp1256_to_unicode_size NULL
+#define fribidi_unicode_to_cp1256_size NULL
 
   FriBidiChar fribidi_cp1256_to_unicode_c (char ch);
   int fribidi_cp1256_to_unicode (char *s,
@@ -21,13 +21,39 @@
  * <fwpg@sharif.edu>. 
  */
 
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
 #include "fribidi_config.h"
 #ifndef FRIBIDI_NO_CHARSETS
 
-#include <string.h>
 #include "fribidi.h"
+#include "fribidi_char_sets_8bit.h"
+#include "fribidi_once.h"
 
-FriBidiChar fribidi_isiri_3342_to_unicode_tab[] = {	/* 0xA0-0xFF */
+/* ISIRI 3342.  0x80-0xA0 and 0xFF read as the ASCII characters 0x80 below
+   them, and the undefined 0xEC-0xEF as themselves. */
+static const FriBidiChar to_unicode[256] = {
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+  0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+  0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+  0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+  0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+  0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+  0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+  0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+  0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+  0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+  0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+  0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+  0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+  0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+  0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+  0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+  0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+  0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+  0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
   0x0020, 0x200C, 0x200D, 0x0021, 0x00A4, 0x066A, 0x002E, 0x066C,
   0x0029, 0x0028, 0x00D7, 0x002B, 0x060C, 0x002D, 0x066B, 0x002F,
   0x06F0, 0x06F1, 0x06F2, 0x06F3, 0x06F4, 0x06F5, 0x06F6, 0x06F7,
@@ -37,23 +63,25 @@ FriBidiChar fribidi_isiri_3342_to_unicode_tab[] = {	/* 0xA0-0xFF */
   0x0633, 0x0634, 0x0635, 0x0636, 0x0637, 0x0638, 0x0639, 0x063A,
   0x0641, 0x0642, 0x06A9, 0x06AF, 0x0644, 0x0645, 0x0646, 0x0648,
   0x0647, 0x06CC, 0x005D, 0x005B, 0x007D, 0x007B, 0x00AB, 0x00BB,
-  /* 0xec,0xed,0xee,0xef not defined */
-  0x002A, 0x0640, 0x007C, 0x005C, 0xec, 0xed, 0xee, 0xef,
+  0x002A, 0x0640, 0x007C, 0x005C, 0x00EC, 0x00ED, 0x00EE, 0x00EF,
   0x064E, 0x0650, 0x064F, 0x064B, 0x064D, 0x064C, 0x0651, 0x0652,
   0x0623, 0x0624, 0x0625, 0x0626, 0x0629, 0x0643, 0x064A, 0x007F
 };
 
+static FriBidiCharSet8bit isiri_3342 = { to_unicode, 0x80 };
+
+FRIBIDI_ONCE_DEFINE (isiri_3342_once);
+
+static void
+build_isiri_3342 (void)
+{
+  fribidi_8bit_build (&isiri_3342);
+}
+
 FriBidiChar
-fribidi_isiri_3342_to_unicode_c (char sch)
+fribidi_isiri_3342_to_unicode_c (char ch)
 {
-  unsigned char ch = (unsigned char) sch;
-  if ((ch >= 0x80 && ch <= 0xa0) || ch == 0xff)
-    return (ch - 0x80);		/* FIXME: but they are strong typed RTL ! */
-  else if (ch >= 0xa1 && ch <= 0xfe)
-    return fribidi_isiri_3342_to_unicode_tab[ch - 0xa0];
-  /* TODO */
-  else
-    return (char) ch;
+  return to_unicode[(unsigned char) ch];
 }
 
 int
@@ -61,162 +89,14 @@ fribidi_isiri_3342_to_unicode (char *s,
 			       int len,
 			       FriBidiChar *us)
 {
-  int i;
-
-  for (i = 0; i < len + 1; i++)
-    us[i] = fribidi_isiri_3342_to_unicode_c (s[i]);
-
-  return len;
+  return fribidi_8bit_to_unicode (&isiri_3342, s, len, us);
 }
 
 char
 fribidi_unicode_to_isiri_3342_c (FriBidiChar uch)
 {
-  /* TODO */
-  if (uch < 256)
-    return (char) uch;
-  else
-    switch (uch)
-      {
-      case 0x060C:
-	return (char) 0xAC;
-      case 0x061B:
-	return (char) 0xBB;
-      case 0x061F:
-	return (char) 0xBF;
-      case 0x0621:
-	return (char) 0xC2;
-      case 0x0622:
-	return (char) 0xC0;
-      case 0x0623:
-	return (char) 0xF8;
-      case 0x0624:
-	return (char) 0xF9;
-      case 0x0625:
-	return (char) 0xFA;
-      case 0x0626:
-	return (char) 0xFB;
-      case 0x0627:
-	return (char) 0xC1;
-      case 0x0628:
-	return (char) 0xC3;
-      case 0x0629:
-	return (char) 0xFC;
-      case 0x062A:
-	return (char) 0xC5;
-      case 0x062B:
-	return (char) 0xC6;
-      case 0x062C:
-	return (char) 0xC7;
-      case 0x062D:
-	return (char) 0xC9;
-      case 0x062E:
-	return (char) 0xCA;
-      case 0x062F:
-	return (char) 0xCB;
-      case 0x0630:
-	return (char) 0xCC;
-      case 0x0631:
-	return (char) 0xCD;
-      case 0x0632:
-	return (char) 0xCE;
-      case 0x0633:
-	return (char) 0xD0;
-      case 0x0634:
-	return (char) 0xD1;
-      case 0x0635:
-	return (char) 0xD2;
-      case 0x0636:
-	return (char) 0xD3;
-      case 0x0637:
-	return (char) 0xD4;
-      case 0x0638:
-	return (char) 0xD5;
-      case 0x0639:
-	return (char) 0xD6;
-      case 0x063A:
-	return (char) 0xD7;
-      case 0x0640:
-	return (char) 0xE9;
-      case 0x0641:
-	return (char) 0xD8;
-      case 0x0642:
-	return (char) 0xD9;
-      case 0x0643:
-	return (char) 0xFD;
-      case 0x0644:
-	return (char) 0xDC;
-      case 0x0645:
-	return (char) 0xDD;
-      case 0x0646:
-	return (char) 0xDE;
-      case 0x0647:
-	return (char) 0xE0;
-      case 0x0648:
-	return (char) 0xDF;
-      case 0x064A:
-	return (char) 0xFE;
-      case 0x064B:
-	return (char) 0xF3;
-      case 0x064C:
-	return (char) 0xF5;
-      case 0x064D:
-	return (char) 0xF4;
-      case 0x064E:
-	return (char) 0xF0;
-      case 0x064F:
-	return (char) 0xF2;
-      case 0x0650:
-	return (char) 0xF1;
-      case 0x0651:
-	return (char) 0xF6;
-      case 0x0652:
-	return (char) 0xF7;
-      case 0x066A:
-	return (char) 0xA5;
-      case 0x066B:
-	return (char) 0xAE;
-      case 0x066C:
-	return (char) 0xA7;
-      case 0x067E:
-	return (char) 0xC4;
-      case 0x0686:
-	return (char) 0xC8;
-      case 0x0698:
-	return (char) 0xCF;
-      case 0x06A9:
-	return (char) 0xDA;
-      case 0x06AF:
-	return (char) 0xDB;
-      case 0x06CC:
-	return (char) 0xE1;
-      case 0x06F0:
-	return (char) 0xB0;
-      case 0x06F1:
-	return (char) 0xB1;
-      case 0x06F2:
-	return (char) 0xB2;
-      case 0x06F3:
-	return (char) 0xB3;
-      case 0x06F4:
-	return (char) 0xB4;
-      case 0x06F5:
-	return (char) 0xB5;
-      case 0x06F6:
-	return (char) 0xB6;
-      case 0x06F7:
-	return (char) 0xB7;
-      case 0x06F8:
-	return (char) 0xB8;
-      case 0x06F9:
-	return (char) 0xB9;
-      case 0x200C:
-	return (char) 0xA1;
-      case 0x200D:
-	return (char) 0xA2;
-      default:
-	return '';
-      }
+  FRIBIDI_ONCE (isiri_3342_once, build_isiri_3342);
+  return fribidi_unicode_to_8bit_c (&isiri_3342, uch);
 }
 
 int
@@ -224,13 +104,8 @@ fribidi_unicode_to_isiri_3342 (FriBidiChar *us,
 			       int length,
 			       char *s)
 {
-  int i;
-
-  for (i = 0; i < length; i++)
-    s[i] = fribidi_unicode_to_isiri_3342_c (us[i]);
-  s[i] = 0;
-
-  return length;
+  FRIBIDI_ONCE (isiri_3342_once, build_isiri_3342);
+  return fribidi_unicode_to_8bit (&isiri_3342, us, length, s);
 }
 
 #endif
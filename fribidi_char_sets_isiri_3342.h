@@ -39,6 +39,9 @@ extern "C"
 #define fribidi_char_set_desc_isiri_3342 NULL
 #define fribidi_char_set_enter_isiri_3342 NULL
 #define fribidi_char_set_leave_isiri_3342 NULL
+#define fribidi_isiri_3342_incomplete_length NULL
+#define fribidi_isiri_3342_to_unicode_size NULL
+#define fribidi_unicode_to_isiri_3342_size NULL
 
   FriBidiChar fribidi_isiri_3342_to_unicode_c (char ch);
   int fribidi_isiri_3342_to_unicode (char *s,
@@ -21,26 +21,66 @@
  * <fwpg@sharif.edu>. 
  */
 
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
 #include "fribidi_config.h"
 #ifndef FRIBIDI_NO_CHARSETS
 
-#include <string.h>
 #include "fribidi.h"
+#include "fribidi_char_sets_8bit.h"
+#include "fribidi_once.h"
+
+/* ISO-8859-6.  The undefined bytes read as themselves. */
+static const FriBidiChar to_unicode[256] = {
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+  0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+  0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+  0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+  0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+  0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+  0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+  0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+  0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+  0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+  0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+  0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+  0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+  0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+  0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+  0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+  0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+  0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F,
+  0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+  0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F,
+  0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7,
+  0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x060C, 0x00AD, 0x00AE, 0x00AF,
+  0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7,
+  0x00B8, 0x00B9, 0x00BA, 0x061B, 0x00BC, 0x00BD, 0x00BE, 0x061F,
+  0x00C0, 0x0621, 0x0622, 0x0623, 0x0624, 0x0625, 0x0626, 0x0627,
+  0x0628, 0x0629, 0x062A, 0x062B, 0x062C, 0x062D, 0x062E, 0x062F,
+  0x0630, 0x0631, 0x0632, 0x0633, 0x0634, 0x0635, 0x0636, 0x0637,
+  0x0638, 0x0639, 0x063A, 0x063B, 0x063C, 0x063D, 0x063E, 0x063F,
+  0x0640, 0x0641, 0x0642, 0x0643, 0x0644, 0x0645, 0x0646, 0x0647,
+  0x0648, 0x0649, 0x064A, 0x064B, 0x064C, 0x064D, 0x064E, 0x064F,
+  0x0650, 0x0651, 0x0652, 0x00F3, 0x00F4, 0x00F5, 0x00F6, 0x00F7,
+  0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x00FD, 0x00FE, 0x00FF
+};
+
+static FriBidiCharSet8bit iso8859_6 = { to_unicode, 0x80 };
 
-#define ISO_HAMZA 0xc1
-#define ISO_SUKUN 0xf2
+FRIBIDI_ONCE_DEFINE (iso8859_6_once);
 
-#define UNI_HAMZA 0x0621
-#define UNI_SUKUN 0x0652
+static void
+build_iso8859_6 (void)
+{
+  fribidi_8bit_build (&iso8859_6);
+}
 
 FriBidiChar
-fribidi_iso8859_6_to_unicode_c (char sch)
+fribidi_iso8859_6_to_unicode_c (char ch)
 {
-  unsigned char ch = (unsigned char) sch;
-  if (ch >= ISO_HAMZA && ch <= ISO_SUKUN)
-    return ch - ISO_HAMZA + UNI_HAMZA;
-  else
-    return ch;
+  return to_unicode[(unsigned char) ch];
 }
 
 int
@@ -48,30 +88,14 @@ fribidi_iso8859_6_to_unicode (char *s,
 			      int len,
 			      FriBidiChar *us)
 {
-  int i;
-
-  for (i = 0; i < len + 1; i++)
-    us[i] = fribidi_iso8859_6_to_unicode_c (s[i]);
-
-  return len;
+  return fribidi_8bit_to_unicode (&iso8859_6, s, len, us);
 }
 
 char
 fribidi_unicode_to_iso8859_6_c (FriBidiChar uch)
 {
-  if (uch >= UNI_HAMZA && uch <= UNI_SUKUN)
-    return (char) (uch - UNI_HAMZA + ISO_HAMZA);
-  /* TODO: handle pre-composed and presentation chars */
-  else if (uch < 256)
-    return (char) uch;
-  else if (uch == 0x060c)
-    return (char) 0xac;
-  else if (uch == 0x061b)
-    return (char) 0xbb;
-  else if (uch == 0x061f)
-    return (char) 0xbf;
-  else
-    return '';
+  FRIBIDI_ONCE (iso8859_6_once, build_iso8859_6);
+  return fribidi_unicode_to_8bit_c (&iso8859_6, uch);
 }
 
 int
@@ -79,13 +103,8 @@ fribidi_unicode_to_iso8859_6 (FriBidiChar *us,
 			      int length,
 			      char *s)
 {
-  int i;
-
-  for (i = 0; i < length; i++)
-    s[i] = fribidi_unicode_to_iso8859_6_c (us[i]);
-  s[i] = 0;
-
-  return length;
+  FRIBIDI_ONCE (iso8859_6_once, build_iso8859_6);
+  return fribidi_unicode_to_8bit (&iso8859_6, us, length, s);
 }
 
 #endif
@@ -39,6 +39,9 @@ extern "C"
 #define fribidi_char_set_desc_iso8859_6 NULL
 #define fribidi_char_set_enter_iso8859_6 NULL
 #define fribidi_char_set_leave_iso8859_6 NULL
+#define fribidi_iso8859_6_incomplete_length NULL
+#define fribidi_iso8859_6_to_unicode_size NULL
+#define fribidi_unicode_to_iso8859_6_size NULL
 
   FriBidiChar fribidi_iso8859_6_to_unicode_c (char ch);
   int fribidi_iso8859_6_to_unicode (char *s,
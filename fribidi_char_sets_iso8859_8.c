@@ -21,54 +21,68 @@
  * <fwpg@sharif.edu>.
  */
 
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
 #include "fribidi_config.h"
 #ifndef FRIBIDI_NO_CHARSETS
 
-#include <string.h>
 #include "fribidi.h"
+#include "fribidi_char_sets_8bit.h"
+#include "fribidi_once.h"
+
+/* ISO-8859-8, with the proposed extensions for the bidi marks at 0xDB-0xDD
+   and 0xFB-0xFE.  0x80-0xDA read as themselves, and the rest of the
+   undefined bytes as '?'. */
+static const FriBidiChar to_unicode[256] = {
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+  0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+  0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+  0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+  0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+  0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+  0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+  0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+  0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+  0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+  0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+  0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+  0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+  0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+  0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+  0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+  0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+  0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F,
+  0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+  0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F,
+  0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7,
+  0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF,
+  0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7,
+  0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF,
+  0x00C0, 0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x00C6, 0x00C7,
+  0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF,
+  0x00D0, 0x00D1, 0x00D2, 0x00D3, 0x00D4, 0x00D5, 0x00D6, 0x00D7,
+  0x00D8, 0x00D9, 0x00DA, 0x202D, 0x202E, 0x202C, 0x003F, 0x003F,
+  0x05D0, 0x05D1, 0x05D2, 0x05D3, 0x05D4, 0x05D5, 0x05D6, 0x05D7,
+  0x05D8, 0x05D9, 0x05DA, 0x05DB, 0x05DC, 0x05DD, 0x05DE, 0x05DF,
+  0x05E0, 0x05E1, 0x05E2, 0x05E3, 0x05E4, 0x05E5, 0x05E6, 0x05E7,
+  0x05E8, 0x05E9, 0x05EA, 0x202A, 0x202B, 0x200E, 0x200F, 0x003F
+};
+
+static FriBidiCharSet8bit iso8859_8 = { to_unicode, 0x80 };
 
-/* The following are proposed extensions to iso-8859-8. */
-#define ISO_8859_8_LRM 253
-#define ISO_8859_8_RLM 254
-#define ISO_8859_8_LRE 251
-#define ISO_8859_8_RLE 252
-#define ISO_8859_8_PDF 221
-#define ISO_8859_8_LRO 219
-#define ISO_8859_8_RLO 220
-#define ISO_ALEF 224
-#define ISO_TAV 250
+FRIBIDI_ONCE_DEFINE (iso8859_8_once);
 
-#define UNI_ALEF 0x05D0
-#define UNI_TAV 0x05EA
+static void
+build_iso8859_8 (void)
+{
+  fribidi_8bit_build (&iso8859_8);
+}
 
 FriBidiChar
-fribidi_iso8859_8_to_unicode_c (char sch)
+fribidi_iso8859_8_to_unicode_c (char ch)
 {
-  unsigned char ch = (unsigned char) sch;
-  /* optimization */
-  if (ch < ISO_8859_8_LRO)
-    return ch;
-  else if (ch >= ISO_ALEF && ch <= ISO_TAV)
-    return ch - ISO_ALEF + UNI_ALEF;
-  switch (ch)
-    {
-    case ISO_8859_8_RLM:
-      return UNI_RLM;
-    case ISO_8859_8_LRM:
-      return UNI_LRM;
-    case ISO_8859_8_RLO:
-      return UNI_RLO;
-    case ISO_8859_8_LRO:
-      return UNI_LRO;
-    case ISO_8859_8_RLE:
-      return UNI_RLE;
-    case ISO_8859_8_LRE:
-      return UNI_LRE;
-    case ISO_8859_8_PDF:
-      return UNI_PDF;
-    default:
-      return '?';		/* This shouldn't happen! */
-    }
+  return to_unicode[(unsigned char) ch];
 }
 
 int
@@ -76,39 +90,14 @@ fribidi_iso8859_8_to_unicode (char *s,
 			      int len,
 			      FriBidiChar *us)
 {
-  int i;
-
-  for (i = 0; i < len + 1; i++)
-    us[i] = fribidi_iso8859_8_to_unicode_c (s[i]);
-
-  return len;
+  return fribidi_8bit_to_unicode (&iso8859_8, s, len, us);
 }
 
 char
 fribidi_unicode_to_iso8859_8_c (FriBidiChar uch)
 {
-  if (uch < 128)
-    return (char) uch;
-  if (uch >= UNI_ALEF && uch <= UNI_TAV)
-    return (char) (uch - UNI_ALEF + ISO_ALEF);
-  switch (uch)
-    {
-    case UNI_RLM:
-      return (char) ISO_8859_8_RLM;
-    case UNI_LRM:
-      return (char) ISO_8859_8_LRM;
-    case UNI_RLO:
-      return (char) ISO_8859_8_RLO;
-    case UNI_LRO:
-      return (char) ISO_8859_8_LRO;
-    case UNI_RLE:
-      return (char) ISO_8859_8_RLE;
-    case UNI_LRE:
-      return (char) ISO_8859_8_LRE;
-    case UNI_PDF:
-      return (char) ISO_8859_8_PDF;
-    }
-  return '';
+  FRIBIDI_ONCE (iso8859_8_once, build_iso8859_8);
+  return fribidi_unicode_to_8bit_c (&iso8859_8, uch);
 }
 
 int
@@ -116,13 +105,8 @@ fribidi_unicode_to_iso8859_8 (FriBidiChar *us,
 			      int length,
 			      char *s)
 {
-  int i;
-
-  for (i = 0; i < length; i++)
-    s[i] = fribidi_unicode_to_iso8859_8_c (us[i]);
-  s[i] = 0;
-
-  return length;
+  FRIBIDI_ONCE (iso8859_8_once, build_iso8859_8);
+  return fribidi_unicode_to_8bit (&iso8859_8, us, length, s);
 }
 
 #endif
@@ -21,55 +21,236 @@
  * <fwpg@sharif.edu>. 
  */
 
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
 #include "fribidi_config.h"
 #ifndef FRIBIDI_NO_CHARSETS
 
+#if defined (HAVE_PTHREAD_H) && defined (HAVE_LIBPTHREAD)
+#include <pthread.h>
+#endif
 #include "fribidi.h"
+#include "fribidi_utf8.h"
 
 /* the following added by Raphael Finkel <raphael@cs.uky.edu> 12/1999 */
 
+/* Decode p up to end into t, with no terminating 0, and return the end
+   of the characters written. */
+static FriBidiChar *
+decode (const unsigned char *p,
+	const unsigned char *end,
+	FriBidiChar *t)
+{
+  while (p < end)
+    {
+      /* Fast path: eight ASCII bytes at a time. */
+      if (end - p >= 8 && ARE_ASCII8 (p))
+	{
+	  t[0] = p[0];
+	  t[1] = p[1];
+	  t[2] = p[2];
+	  t[3] = p[3];
+	  t[4] = p[4];
+	  t[5] = p[5];
+	  t[6] = p[6];
+	  t[7] = p[7];
+	  t += 8;
+	  p += 8;
+	}
+      else
+	p += fribidi_utf8_get_char ((const char *) p, end - p, t++);
+    }
+
+  return t;
+}
+
 int
 fribidi_utf8_to_unicode (char *s,
 			 int len,
 			 FriBidiChar *us)
-/* warning: the length of input string may exceed the length of the output */
 {
-  int length;
-  char *t = s;
+  const unsigned char *p = (const unsigned char *) s;
+  FriBidiChar *t = decode (p, p + len, us);
+
+  *t = 0;
+
+  return t - us;
+}
+
+/* The most threads, and the fewest bytes for each thread, that
+   fribidi_utf8_to_unicode_parallel() uses. */
+#define PARALLEL_THREADS_MAX 64
+#define PARALLEL_CHUNK_MIN (256 * 1024)
+
+#if defined (HAVE_PTHREAD_H) && defined (HAVE_LIBPTHREAD)
+
+typedef struct
+{
+  const unsigned char *start, *end;
+  FriBidiChar *us;
+  int size;
+}
+Utf8Chunk;
+
+static void *
+count_chunk (void *data)
+{
+  Utf8Chunk *chunk = (Utf8Chunk *) data;
+
+  chunk->size = fribidi_utf8_to_unicode_size ((char *) chunk->start,
+					      chunk->end - chunk->start);
+  return NULL;
+}
+
+static void *
+decode_chunk (void *data)
+{
+  Utf8Chunk *chunk = (Utf8Chunk *) data;
+
+  decode (chunk->start, chunk->end, chunk->us);
+  return NULL;
+}
+
+/* Run work on every chunk, the first one in this thread and each other
+   in a thread of its own, or in this thread too if it cannot start. */
+static void
+run_chunks (Utf8Chunk *chunks,
+	    int n,
+	    void *(*work) (void *))
+{
+  pthread_t thread[PARALLEL_THREADS_MAX];
+  fribidi_boolean started[PARALLEL_THREADS_MAX];
+  int i;
+
+  for (i = 1; i < n; i++)
+    started[i] = pthread_create (&thread[i], NULL, work, &chunks[i]) == 0;
+  work (&chunks[0]);
+  for (i = 1; i < n; i++)
+    if (started[i])
+      pthread_join (thread[i], NULL);
+    else
+      work (&chunks[i]);
+}
+
+#endif /* HAVE_PTHREAD_H && HAVE_LIBPTHREAD */
+
+int
+fribidi_utf8_to_unicode_parallel (char *s,
+				  int len,
+				  FriBidiChar *us,
+				  int threads)
+{
+#if defined (HAVE_PTHREAD_H) && defined (HAVE_LIBPTHREAD)
+  int n = threads < PARALLEL_THREADS_MAX ? threads : PARALLEL_THREADS_MAX;
+
+  if (n > len / PARALLEL_CHUNK_MIN)
+    n = len / PARALLEL_CHUNK_MIN;
+  if (n > 1)
+    {
+      Utf8Chunk chunks[PARALLEL_THREADS_MAX];
+      const unsigned char *p = (const unsigned char *) s, *end = p + len;
+      int i, size;
+
+      /* No sequence goes on over a byte that is not a continuation
+         byte, so chunks that start at such bytes decode the same alone
+         as within the whole string. */
+      chunks[0].start = p;
+      for (i = 1; i < n; i++)
+	{
+	  const unsigned char *q = p + len / n * i;
+
+	  if (q < chunks[i - 1].start)
+	    q = chunks[i - 1].start;
+	  while (q < end && (*q & 0xC0) == 0x80)
+	    q++;
+	  chunks[i - 1].end = chunks[i].start = q;
+	}
+      chunks[n - 1].end = end;
+
+      /* Count the characters of each chunk, to know where each one goes
+         in us, then decode them all in place. */
+      run_chunks (chunks, n, count_chunk);
+      for (i = 0, size = 0; i < n; i++)
+	{
+	  chunks[i].us = us + size;
+	  size += chunks[i].size;
+	}
+      run_chunks (chunks, n, decode_chunk);
+      us[size] = 0;
+
+      return size;
+    }
+#endif /* HAVE_PTHREAD_H && HAVE_LIBPTHREAD */
+
+  return fribidi_utf8_to_unicode (s, len, us);
+}
+
+int
+fribidi_utf8_to_unicode_size (char *s,
+			      int len)
+{
+  const unsigned char *p = (const unsigned char *) s, *end = p + len;
+  int size = 0;
 
-  length = 0;
-  while (s - t < len)
+  while (p < end)
     {
-      if (*(unsigned char *) s <= 0x7f)	/* one byte */
+      FriBidiChar ch;
+
+      /* Fast path: eight ASCII bytes at a time. */
+      if (end - p >= 8 && ARE_ASCII8 (p))
 	{
-	  *us++ = *s++;		/* expand with 0s */
+	  size += 8;
+	  p += 8;
 	}
-      else if (*(unsigned char *) s <= 0xdf)	/* 2 byte */
+      else
 	{
-	  *us++ =
-	    ((*(unsigned char *) s & 0x1f) << 6) +
-	    ((*(unsigned char *) (s + 1)) & 0x3f);
-	  s += 2;
+	  p += fribidi_utf8_get_char ((const char *) p, end - p, &ch);
+	  size++;
 	}
-      else			/* 3 byte */
+    }
+
+  return size;
+}
+
+int
+fribidi_utf8_to_unicode_bound (int len)
+{
+  /* Every byte is at most one character. */
+  return len;
+}
+
+int
+fribidi_utf8_incomplete_length (const char *s,
+				int length)
+{
+  int k;
+
+  /* Find the last lead byte, at most three bytes back. */
+  for (k = 1; k <= 3 && k <= length; k++)
+    {
+      unsigned char c = s[length - k];
+      FriBidiChar ch;
+
+      if (c < 0x80)
+	return 0;
+      else if (c >= 0xC0)
 	{
-	  *us++ =
-	    ((int) (*(unsigned char *) s & 0x0f) << 12) +
-	    ((*(unsigned char *) (s + 1) & 0x3f) << 6) +
-	    (*(unsigned char *) (s + 2) & 0x3f);
-	  s += 3;
+	  int n = c < 0xC2 ? 1 : c < 0xE0 ? 2 : c < 0xF0 ? 3 : c < 0xF5 ? 4 : 1;
+
+	  /* Incomplete if it is cut short with no ill-formed byte. */
+	  return n > k && fribidi_utf8_get_char (s + length - k, k, &ch) == k ?
+	    k : 0;
 	}
-      length++;
     }
-  *us = 0;
-  return (length);
+
+  return 0;
 }
 
 int
 fribidi_unicode_to_utf8 (FriBidiChar *us,
 			 int length,
 			 char *s)
-/* warning: the length of output string may exceed the length of the input */
 {
   int i;
   char *t;
@@ -78,7 +259,22 @@ fribidi_unicode_to_utf8 (FriBidiChar *us,
   for (i = 0; i < length; i++)
     {
       FriBidiChar mychar = us[i];
-      if (mychar <= 0x7F)
+
+      /* Fast path: eight ASCII characters at a time. */
+      if (i + 8 <= length && ARE_ASCII8 (us + i))
+	{
+	  t[0] = us[i];
+	  t[1] = us[i + 1];
+	  t[2] = us[i + 2];
+	  t[3] = us[i + 3];
+	  t[4] = us[i + 4];
+	  t[5] = us[i + 5];
+	  t[6] = us[i + 6];
+	  t[7] = us[i + 7];
+	  t += 8;
+	  i += 7;
+	}
+      else if (mychar <= 0x7F)
 	{			/* 7 sig bits */
 	  *t++ = mychar;
 	}
@@ -106,4 +302,23 @@ fribidi_unicode_to_utf8 (FriBidiChar *us,
   return (t - s);
 }
 
+int
+fribidi_unicode_to_utf8_size (FriBidiChar *us,
+			      int length)
+{
+  int i, size = 0;
+
+  for (i = 0; i < length; i++)
+    if (us[i] <= 0x7F)
+      size++;
+    else if (us[i] <= 0x7FF)
+      size += 2;
+    else if (us[i] <= 0xFFFF)
+      size += 3;
+    else if (us[i] < FRIBIDI_UNICODE_CHARS)
+      size += 4;
+
+  return size;
+}
+
 #endif
@@ -40,18 +40,59 @@ extern "C"
 #define fribidi_char_set_enter_utf8 NULL
 #define fribidi_char_set_leave_utf8 NULL
 
+/* Encodes length characters of us to s, followed by a 0, and returns the
+   number of bytes written, not counting the 0.  Characters above Unicode
+   are dropped.  s must have room for
+   fribidi_unicode_to_utf8_size (us, length) + 1 bytes. */
   int fribidi_unicode_to_utf8 (FriBidiChar *us,
 			       int length,
 			       /* Output */
 			       char *s);
 
-/* warning: the length of output string may exceed the length of the input */
-/* the length of the string is returned */
+/* The number of bytes fribidi_unicode_to_utf8() writes for us, not
+   counting the terminating 0. */
+  int fribidi_unicode_to_utf8_size (FriBidiChar *us,
+				    int length);
+
+/* Decodes length bytes of s, which need not be NUL terminated, and returns
+   the number of characters written to us, followed by a 0.  Ill-formed
+   sequences, including one cut at the end of s, are replaced by
+   UNI_REPLACEMENT_CHAR.  us must have room for
+   fribidi_utf8_to_unicode_bound (length) + 1 characters. */
   int fribidi_utf8_to_unicode (char *s,
 			       int length,
 			       /* Output */
 			       FriBidiChar *us);
 
+/* fribidi_utf8_to_unicode() on several threads, for very long strings:
+   the string is cut in up to "threads" chunks, at least 256KB each, at
+   bytes that start no sequence in the middle.  Each thread counts the
+   characters of its chunk, so that all of them can then decode their
+   chunk in place in us.  Without POSIX threads, or for a short string,
+   this is fribidi_utf8_to_unicode().  The length and the result are int
+   like those of every other charset function, so a string has to be
+   shorter than 2GB; the caller has to cut a longer one between
+   sequences. */
+  int fribidi_utf8_to_unicode_parallel (char *s,
+					int length,
+					/* Output */
+					FriBidiChar *us,
+					int threads);
+
+/* The most characters fribidi_utf8_to_unicode() can return for length
+   bytes. */
+  int fribidi_utf8_to_unicode_bound (int length);
+
+/* The number of characters fribidi_utf8_to_unicode() writes for s, not
+   counting the terminating 0. */
+  int fribidi_utf8_to_unicode_size (char *s,
+				    int length);
+
+/* The number of bytes at the end of s that start a well-formed sequence
+   but do not complete it. */
+  int fribidi_utf8_incomplete_length (const char *s,
+				      int length);
+
 #ifdef	__cplusplus
 }
 #endif
@@ -23,6 +23,18 @@
 #include <config.h>
 #endif
 #include "fribidi.h"
+#include "fribidi_inline.h"
+
+#include "fribidi_tab_props.i"
+
+/* The tables used by fribidi_inline.h. */
+FRIBIDI_API const FriBidiCharType fribidi_ascii_types[128] = {
+  FRIBIDI_ASCII_TYPES
+};
+FRIBIDI_API const fribidi_uint16 *const fribidi_props_index =
+  FriBidiPropsBlockLevel0;
+FRIBIDI_API const FriBidiProps *const fribidi_props_data =
+  FriBidiPropsBlockLevel1;
 
 /*======================================================================
  *  fribidi_get_type() returns the bidi type of a character.
@@ -33,7 +45,15 @@ FRIBIDI_API FriBidiCharType
 fribidi_get_type (FriBidiEnv *env,
 		  FriBidiChar uch)
 {
-  return fribidi_get_type_internal (uch);
+  FriBidiTables *tables = fribidi_get_tables (env);
+
+  /* Tables loaded at runtime take precedence over the compiled-in ones. */
+  if (tables && uch < tables->chars)
+    return FRIBIDI_PROPS_TYPE (FRIBIDI_TABLES_GET_PROPS (tables, uch));
+  else if (uch < 128)
+    return fribidi_ascii_types[uch];
+  else
+    return fribidi_get_type_internal (uch);
 }
 
 FRIBIDI_API void
@@ -46,8 +66,25 @@ fribidi_get_types (FriBidiEnv *env,
 {
   FriBidiStrIndex i;
 
-  for (i = 0; i < len; i++)
-    type[i] = fribidi_get_type (env, str[i]);
+  if (fribidi_get_tables (env))
+    for (i = 0; i < len; i++)
+      type[i] = fribidi_get_type (env, str[i]);
+  else
+    for (i = 0; i < len; i++)
+      type[i] = str[i] < 128 ? fribidi_ascii_types[str[i]]
+	: fribidi_get_type_internal (str[i]);
+}
+
+FRIBIDI_API FriBidiProps
+fribidi_get_props (FriBidiEnv *env,
+		   FriBidiChar uch)
+{
+  FriBidiTables *tables = fribidi_get_tables (env);
+
+  if (tables && uch < tables->chars)
+    return FRIBIDI_TABLES_GET_PROPS (tables, uch);
+  else
+    return fribidi_get_props_inline (uch);
 }
 
 #ifdef MEM_OPTIMIZED
@@ -0,0 +1,706 @@
+/* FriBidi - Library of BiDi algorithm
+ * Copyright (C) 2002 FriBidi Project (http://fribidi.sf.net/).
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library, in a file named COPYING; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307, USA
+ *
+ * For licensing issues, contact <dov@imagic.weizmann.ac.il> and
+ * <fwpg@sharif.edu>.
+ */
+
+/*======================================================================
+ *  Checks of the library functions that the fribidi command line tool,
+ *  and so run.tests, does not reach.  Each check compares a function
+ *  against the plain UCS-4 one it is meant to agree with, on fixed and
+ *  on pseudo-random strings.
+ *----------------------------------------------------------------------*/
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif /* HAVE_CONFIG_H */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fribidi.h"
+
+#define MAX_STR_LEN 64
+
+/* Reported failures per check, the rest are only counted. */
+#define MAX_REPORTS 10
+
+static int failures, failed_checks;
+
+#define CHECK(cond) \
+	((cond) ? (void) 0 : check_failed (__FILE__, __LINE__, #cond))
+
+static void
+check_failed (const char *file,
+	      int line,
+	      const char *cond)
+{
+  if (failures++ < MAX_REPORTS)
+    fprintf (stderr, "%s:%d: check failed: %s\n", file, line, cond);
+}
+
+static void
+run_check (const char *name,
+	   void (*check) (void))
+{
+  failures = 0;
+  printf ("=== %s === ", name);
+  fflush (stdout);
+  check ();
+  printf (" [%s]\n", failures ? "Failed" : "Passed");
+  if (failures)
+    failed_checks++;
+}
+
+/* A small generator of our own, so the strings are the same everywhere. */
+static unsigned long random_state = 1;
+
+static unsigned long
+random_next (void)
+{
+  random_state = random_state * 1103515245 + 12345;
+  return (random_state >> 16) & 0x7FFF;
+}
+
+/* Letters, digits, neutrals, marks and explicit codes of every
+   direction, in and out of the BMP. */
+static const FriBidiChar random_chars[] = {
+  'a', 'B', '1', '2', ' ', '(', ')', '<', '-', '.',
+  0x05D0, 0x05D1, 0x05B8, 0x0627, 0x0644, 0x0661, 0x064B, 0x0300,
+  0x202A, 0x202B, 0x202C, 0x202D, 0x202E, 0x200E, 0x200F, 0x2029,
+  0x10900, 0x10915, 0x1D400, 0x1D7CE, 0x1D167, 0x1F600, 0x20000,
+};
+
+#define RANDOM_CHARS (sizeof random_chars / sizeof random_chars[0])
+
+static FriBidiStrIndex
+random_string (FriBidiChar *us)
+{
+  FriBidiStrIndex i, len = random_next () % MAX_STR_LEN;
+
+  for (i = 0; i < len; i++)
+    us[i] = random_chars[random_next () % RANDOM_CHARS];
+  us[len] = 0;
+  return len;
+}
+
+static const FriBidiCharType base_dirs[] = {
+  FRIBIDI_TYPE_ON, FRIBIDI_TYPE_WL, FRIBIDI_TYPE_WR,
+  FRIBIDI_TYPE_L, FRIBIDI_TYPE_R
+};
+
+#define BASE_DIRS (sizeof base_dirs / sizeof base_dirs[0])
+
+/* Encode len characters as UTF-8, with the offset of each character's
+   sequence in unit[0..len]. */
+static FriBidiStrIndex
+utf8_encode (const FriBidiChar *us,
+	     FriBidiStrIndex len,
+	     char *s,
+	     FriBidiStrIndex *unit)
+{
+  FriBidiStrIndex i, pos = 0;
+
+  for (i = 0; i < len; i++)
+    {
+      unit[i] = pos;
+      pos += fribidi_utf8_put_char (us[i], s + pos);
+    }
+  unit[len] = pos;
+  s[pos] = 0;
+  return pos;
+}
+
+
+/*======================================================================
+ *  fribidi_log2vis_utf16() against fribidi_log2vis() on the same text.
+ *----------------------------------------------------------------------*/
+static void
+check_log2vis_utf16 (void)
+{
+  int n;
+
+  for (n = 0; n < 2000; n++)
+    {
+      FriBidiChar us[MAX_STR_LEN + 1], visual[MAX_STR_LEN + 1];
+      FriBidiStrIndex l2v[MAX_STR_LEN], v2l[MAX_STR_LEN];
+      FriBidiLevel levels[MAX_STR_LEN];
+      fribidi_uint16 us16[2 * MAX_STR_LEN + 1], visual16[2 * MAX_STR_LEN + 1];
+      FriBidiStrIndex l2v16[2 * MAX_STR_LEN], v2l16[2 * MAX_STR_LEN];
+      FriBidiLevel levels16[2 * MAX_STR_LEN];
+      /* The first code unit of each character, logical and visual. */
+      FriBidiStrIndex unit[MAX_STR_LEN + 1], vunit[MAX_STR_LEN + 1];
+      FriBidiCharType base, base16;
+      FriBidiStrIndex i, len, len16;
+
+      len = random_string (us);
+      for (i = 0, len16 = 0; i < len; i++)
+	{
+	  unit[i] = len16;
+	  if (us[i] > 0xFFFF)
+	    {
+	      us16[len16++] = 0xD800 + ((us[i] - 0x10000) >> 10);
+	      us16[len16++] = 0xDC00 + ((us[i] - 0x10000) & 0x3FF);
+	    }
+	  else
+	    us16[len16++] = us[i];
+	}
+      unit[len] = len16;
+
+      base = base16 = base_dirs[n % BASE_DIRS];
+      CHECK (fribidi_log2vis (NULL, us, len, &base,
+			      visual, l2v, v2l, levels));
+      CHECK (fribidi_log2vis_utf16 (NULL, us16, len16, &base16,
+				    visual16, l2v16, v2l16, levels16));
+      if (len == 0)
+	continue;
+      CHECK (base16 == base);
+
+      /* The same visual text, each character in one piece. */
+      for (i = 0; i < len; i++)
+	{
+	  FriBidiStrIndex u = i ? vunit[i - 1] + (visual[i - 1] > 0xFFFF ?
+						  2 : 1) : 0;
+
+	  vunit[i] = u;
+	  if (visual[i] > 0xFFFF)
+	    CHECK (visual16[u] == 0xD800 + ((visual[i] - 0x10000) >> 10)
+		   && visual16[u + 1] == 0xDC00 + ((visual[i] - 0x10000)
+						   & 0x3FF));
+	  else
+	    CHECK (visual16[u] == visual[i]);
+	}
+      CHECK (visual16[len16] == 0);
+
+      /* Maps and levels of the code units follow their characters. */
+      for (i = 0; i < len; i++)
+	{
+	  FriBidiStrIndex u = unit[i], v = vunit[l2v[i]];
+
+	  CHECK (l2v16[u] == v && v2l16[v] == u);
+	  CHECK (levels16[u] == levels[i]);
+	  if (us[i] > 0xFFFF)
+	    {
+	      CHECK (l2v16[u + 1] == v + 1 && v2l16[v + 1] == u + 1);
+	      CHECK (levels16[u + 1] == levels[i]);
+	    }
+	}
+      for (i = 0; i < len16; i++)
+	CHECK (v2l16[l2v16[i]] == i);
+    }
+}
+
+
+/*======================================================================
+ *  fribidi_log2vis_utf8() against fribidi_log2vis() on the same text,
+ *  and on ill-formed bytes, whose sequences have to be moved whole.
+ *----------------------------------------------------------------------*/
+static const char *ill_formed[] = {
+  "\x80", "\xBF", "\xC0", "\xC3", "\xE0\x80", "\xE1\x80", "\xED\xA0",
+  "\xF0\x90", "\xF4\x90", "\xF8", "\xFF", "a", "1", " ",
+  "\xD7\x90", "\xD8\xA7", "\xE2\x80\xAB", "\xF0\x90\xA4\x80",
+  "abcdefgh ij"
+};
+
+#define ILL_FORMED (sizeof ill_formed / sizeof ill_formed[0])
+
+/* Up to MAX_STR_LEN of the pieces above, as many as fit in size - 1
+   bytes. */
+static int
+random_utf8 (char *s,
+	     int size)
+{
+  int len = 0, pieces = random_next () % MAX_STR_LEN;
+
+  while (pieces--)
+    {
+      const char *piece = ill_formed[random_next () % ILL_FORMED];
+      int piece_len = strlen (piece);
+
+      if (len + piece_len >= size)
+	break;
+      memcpy (s + len, piece, piece_len);
+      len += piece_len;
+    }
+  s[len] = 0;
+  return len;
+}
+
+static void
+check_log2vis_utf8 (void)
+{
+  int n;
+
+  for (n = 0; n < 2000; n++)
+    {
+      FriBidiChar us[MAX_STR_LEN + 1], visual[MAX_STR_LEN + 1];
+      FriBidiStrIndex l2v[MAX_STR_LEN], v2l[MAX_STR_LEN];
+      FriBidiLevel levels[MAX_STR_LEN], levels8[MAX_STR_LEN * 4];
+      char s[4 * MAX_STR_LEN + 1], visual8[4 * MAX_STR_LEN + 1];
+      FriBidiStrIndex l2v8[4 * MAX_STR_LEN], v2l8[4 * MAX_STR_LEN];
+      FriBidiStrIndex unit[MAX_STR_LEN + 1], vunit;
+      FriBidiCharType base, base8;
+      FriBidiStrIndex i, len, len8, char_len;
+
+      len = random_string (us);
+      len8 = utf8_encode (us, len, s, unit);
+
+      base = base8 = base_dirs[n % BASE_DIRS];
+      CHECK (fribidi_log2vis (NULL, us, len, &base,
+			      visual, l2v, v2l, levels));
+      CHECK (fribidi_log2vis_utf8 (NULL, s, len8, &base8,
+				   visual8, l2v8, v2l8, levels8, &char_len));
+      CHECK (char_len == len);
+      if (len == 0)
+	continue;
+      CHECK (base8 == base);
+
+      /* The visual bytes decode to the visual string. */
+      for (i = 0, vunit = 0; i < len; i++)
+	{
+	  FriBidiChar ch;
+
+	  vunit += fribidi_utf8_get_char (visual8 + vunit, len8 - vunit, &ch);
+	  CHECK (ch == visual[i]);
+	}
+      CHECK (vunit == len8 && visual8[len8] == 0);
+
+      /* Every byte of a character maps to the same byte of its place in
+         the visual string. */
+      for (i = 0; i < len; i++)
+	{
+	  FriBidiStrIndex j, v = 0;
+
+	  for (j = 0; j < l2v[i]; j++)
+	    v += unit[v2l[j] + 1] - unit[v2l[j]];
+	  for (j = unit[i]; j < unit[i + 1]; j++)
+	    CHECK (l2v8[j] == v + j - unit[i] && v2l8[l2v8[j]] == j);
+	  CHECK (levels8[i] == levels[i]);
+	}
+    }
+
+  for (n = 0; n < 2000; n++)
+    {
+      char s[4 * MAX_STR_LEN + 1], visual8[4 * MAX_STR_LEN + 1];
+      FriBidiStrIndex l2v8[4 * MAX_STR_LEN], v2l8[4 * MAX_STR_LEN];
+      FriBidiLevel levels8[4 * MAX_STR_LEN];
+      FriBidiCharType base8 = base_dirs[n % BASE_DIRS];
+      FriBidiStrIndex i, len8, count, char_len;
+
+      len8 = random_utf8 (s, sizeof s);
+
+      CHECK (fribidi_log2vis_utf8 (NULL, s, len8, &base8,
+				   visual8, l2v8, v2l8, levels8, &char_len));
+      for (i = 0, count = 0; i < len8; count++)
+	{
+	  FriBidiChar ch;
+
+	  i += fribidi_utf8_get_char (s + i, len8 - i, &ch);
+	}
+      CHECK (char_len == count);
+
+      /* The maps are inverses and the bytes are only moved. */
+      for (i = 0; i < len8; i++)
+	CHECK (v2l8[l2v8[i]] == i && visual8[l2v8[i]] == s[i]);
+      if (len8)
+	CHECK (visual8[len8] == 0);
+    }
+}
+
+
+/*======================================================================
+ *  fribidi_get_par_direction() and fribidi_utf8_get_par_direction()
+ *  against the base direction fribidi_log2vis() resolves from
+ *  FRIBIDI_TYPE_ON, which is LTR when there is no letter.  The fixed
+ *  strings put the first letter inside an embedding, which is not
+ *  skipped.
+ *----------------------------------------------------------------------*/
+static void
+check_par_direction (void)
+{
+  static const FriBidiChar fixed[][4] = {
+    {0x202B, 'a', 0x05D0, 0},	/* RLE a alef */
+    {0x202E, 'a', 0x202C, 0},	/* RLO a PDF */
+    {0x202A, 0x05D0, 'a', 0},	/* LRE alef a */
+    {0x202D, 0x0627, 0x202C, 0},	/* LRO alef PDF */
+    {'1', 0x0661, ' ', 0},	/* only numbers and neutrals */
+    {0x200F, 'a', 0, 0},	/* RLM a */
+  };
+  int n;
+
+  for (n = 0; n < 2000 + (int) (sizeof fixed / sizeof fixed[0]); n++)
+    {
+      FriBidiChar us[MAX_STR_LEN + 1], visual[MAX_STR_LEN + 1];
+      char s[4 * MAX_STR_LEN + 1];
+      FriBidiStrIndex unit[MAX_STR_LEN + 1];
+      FriBidiCharType base = FRIBIDI_TYPE_ON, par, par8;
+      FriBidiStrIndex len, len8;
+
+      if (n < (int) (sizeof fixed / sizeof fixed[0]))
+	{
+	  for (len = 0; fixed[n][len]; len++)
+	    us[len] = fixed[n][len];
+	  us[len] = 0;
+	}
+      else
+	len = random_string (us);
+      len8 = utf8_encode (us, len, s, unit);
+
+      par = fribidi_get_par_direction (NULL, us, len);
+      par8 = fribidi_utf8_get_par_direction (NULL, s, len8);
+      CHECK (par8 == par);
+      if (len == 0)
+	{
+	  CHECK (par == FRIBIDI_TYPE_ON);
+	  continue;
+	}
+      CHECK (fribidi_log2vis (NULL, us, len, &base, visual, NULL, NULL,
+			      NULL));
+      CHECK (base == (par == FRIBIDI_TYPE_ON ? FRIBIDI_TYPE_LTR : par));
+    }
+}
+
+
+/*======================================================================
+ *  fribidi_utf8_may_need_bidi() may not miss any character that needs
+ *  the algorithm, anywhere in the string.  It works on the bytes alone,
+ *  so this has to hold again whenever the tables are regenerated.
+ *----------------------------------------------------------------------*/
+static void
+check_utf8_may_need_bidi (void)
+{
+  FriBidiChar ch;
+
+  for (ch = 1; ch <= 0x10FFFF; ch++)
+    {
+      FriBidiCharType type = fribidi_get_type (NULL, ch);
+      char s[8 + 4 + 8];
+      int offset, size;
+
+      if (ch >= 0xD800 && ch <= 0xDFFF)
+	continue;
+      if (!FRIBIDI_IS_RTL (type) && !FRIBIDI_IS_ARABIC (type)
+	  && !FRIBIDI_IS_EXPLICIT (type))
+	continue;
+
+      /* After 0 to 8 ASCII bytes, at the end or followed by more. */
+      for (offset = 0; offset <= 8; offset++)
+	{
+	  memset (s, 'a', sizeof s);
+	  size = fribidi_utf8_put_char (ch, s + offset);
+	  CHECK (fribidi_utf8_may_need_bidi (s, offset + size));
+	  CHECK (fribidi_utf8_may_need_bidi (s, sizeof s));
+	}
+    }
+}
+
+
+#ifndef FRIBIDI_NO_CHARSETS
+
+/* Random text for charset char_set: UTF-8 with ill-formed bytes, CapRTL
+   with runs of escapes and bytes past it, or any bytes for the others. */
+static int
+random_text (FriBidiCharSet char_set,
+	     char *s,
+	     int size)
+{
+  static const char cap_rtl[] = "aB1 _<>^lLrRo__\x80\xFF";
+  int len = 0;
+
+  if (char_set == FRIBIDI_CHAR_SET_UTF8)
+    return random_utf8 (s, size);
+  while (len < size - 1 && random_next () % 64)
+    if (char_set == FRIBIDI_CHAR_SET_CAP_RTL)
+      s[len++] = cap_rtl[random_next () % (sizeof cap_rtl - 1)];
+    else
+      s[len++] = 1 + random_next () % 255;
+  s[len] = 0;
+  return len;
+}
+
+/*======================================================================
+ *  The streaming converters, fed 1 to 7 bytes at a time into a few
+ *  characters of room, against one fribidi_charset_to_unicode() call.
+ *----------------------------------------------------------------------*/
+static void
+check_char_set_converter (void)
+{
+  FriBidiCharSet char_set;
+
+  for (char_set = 1; char_set <= FRIBIDI_CHAR_SETS_NUM; char_set++)
+    {
+      int n;
+
+      for (n = 0; n < 500; n++)
+	{
+	  char s[4 * MAX_STR_LEN + 1];
+	  FriBidiChar whole[4 * MAX_STR_LEN + 1], joined[4 * MAX_STR_LEN + 1];
+	  FriBidiChar us[FRIBIDI_CHAR_SET_CARRY_MAX + 9];
+	  FriBidiCharSetConverter conv;
+	  int len, whole_len, joined_len = 0, pos = 0;
+	  int us_size = FRIBIDI_CHAR_SET_CARRY_MAX + 1 + random_next () % 8;
+
+	  len = random_text (char_set, s, sizeof s);
+	  whole_len = fribidi_charset_to_unicode (char_set, s, len, whole);
+
+	  fribidi_char_set_converter_init (&conv, char_set);
+	  while (pos < len)
+	    {
+	      int chunk = 1 + random_next () % 7, consumed = 0;
+
+	      if (chunk > len - pos)
+		chunk = len - pos;
+	      /* Feed the chunk until all of it is used up. */
+	      while (chunk)
+		{
+		  int out;
+
+		  us[us_size] = 0xDEAD;
+		  out = fribidi_char_set_converter_to_unicode (&conv, s + pos,
+							       chunk, us,
+							       us_size,
+							       &consumed);
+		  CHECK (out < us_size && us[out] == 0
+			 && us[us_size] == 0xDEAD);
+		  CHECK (consumed <= chunk && (out || consumed));
+		  if (!out && !consumed)
+		    break;
+		  memcpy (joined + joined_len, us, out * sizeof us[0]);
+		  joined_len += out;
+		  pos += consumed;
+		  chunk -= consumed;
+		}
+	      if (chunk)
+		break;
+	    }
+	  joined_len += fribidi_char_set_converter_flush (&conv,
+							  joined +
+							  joined_len);
+
+	  CHECK (pos == len);
+	  CHECK (joined_len == whole_len);
+	  CHECK (!memcmp (joined, whole, whole_len * sizeof whole[0]));
+	}
+    }
+}
+
+/*======================================================================
+ *  fribidi_charset_to_unicode_size() and fribidi_unicode_to_charset_size()
+ *  against what the conversions write, for every charset, with the
+ *  characters no charset can write, and the ones CapRTL escapes.
+ *----------------------------------------------------------------------*/
+static const FriBidiChar odd_chars[] = {
+  '_', 0x202A, 0x200F, 0x0080, 0x00FF, 0x07FF, 0x0800, 0xD800, 0xFFFF,
+  0x10000, 0x10FFFF, 0x110000, 0x7FFFFFFF, 0xFFFFFFFF
+};
+
+#define ODD_CHARS (sizeof odd_chars / sizeof odd_chars[0])
+
+static void
+check_char_set_sizes (void)
+{
+  FriBidiCharSet char_set;
+
+  for (char_set = 1; char_set <= FRIBIDI_CHAR_SETS_NUM; char_set++)
+    {
+      int n;
+
+      for (n = 0; n < 500; n++)
+	{
+	  char s[8 * MAX_STR_LEN + 2];
+	  FriBidiChar us[MAX_STR_LEN + 2];
+	  int i, len, size;
+
+	  len = random_text (char_set, s, MAX_STR_LEN);
+	  /* CapRTL writes no terminating 0, the others do. */
+	  size = fribidi_charset_to_unicode_size (char_set, s, len);
+	  us[size + 1] = 0xDEAD;
+	  CHECK (fribidi_charset_to_unicode (char_set, s, len, us) == size);
+	  CHECK (us[size + 1] == 0xDEAD);
+
+	  len = random_string (us);
+	  for (i = 0; i < len; i++)
+	    if (random_next () % 3 == 0)
+	      us[i] = odd_chars[random_next () % ODD_CHARS];
+	    else if (random_next () % 5 == 0)
+	      us[i] = 0x110000 + random_next () * random_next ();
+	  size = fribidi_unicode_to_charset_size (char_set, us, len);
+	  s[size + 1] = '\x55';
+	  CHECK (fribidi_unicode_to_charset (char_set, us, len, s) == size);
+	  CHECK (s[size] == 0 && s[size + 1] == '\x55');
+	}
+    }
+
+  /* The bytes past CapRTL are no characters of it. */
+  {
+    char s[] = "a\x80_\xFF";
+    FriBidiChar us[5];
+
+    CHECK (fribidi_charset_to_unicode_size (FRIBIDI_CHAR_SET_CAP_RTL, s, 4)
+	   == 4);
+    CHECK (fribidi_charset_to_unicode (FRIBIDI_CHAR_SET_CAP_RTL, s, 4, us)
+	   == 4);
+    CHECK (us[1] == UNI_REPLACEMENT_CHAR && us[2] == '_'
+	   && us[3] == UNI_REPLACEMENT_CHAR);
+  }
+}
+
+/*======================================================================
+ *  fribidi_utf8_to_unicode_parallel() on several MB of ill-formed text,
+ *  on 1 to 8 threads and a few more, against fribidi_utf8_to_unicode().
+ *  The text has room for more than 64 chunks of 256KB, so the last
+ *  thread counts go past the most threads the decoder uses.
+ *----------------------------------------------------------------------*/
+#define PARALLEL_LEN (17 * 1024 * 1024)
+
+static const int parallel_threads[] = {
+  1, 2, 3, 4, 5, 6, 7, 8, 16, 63, 64, 65, 1000
+};
+
+#define PARALLEL_THREADS \
+	(sizeof parallel_threads / sizeof parallel_threads[0])
+
+static void
+check_utf8_to_unicode_parallel (void)
+{
+  char *s = malloc (PARALLEL_LEN + 1);
+  FriBidiChar *expected = malloc ((PARALLEL_LEN + 1) * sizeof *expected);
+  FriBidiChar *us = malloc ((PARALLEL_LEN + 1) * sizeof *us);
+  int len, size, i;
+
+  if (!s || !expected || !us)
+    {
+      CHECK (!"out of memory");
+      free (s);
+      free (expected);
+      free (us);
+      return;
+    }
+
+  /* Up to the last few bytes, which may not fit one more piece. */
+  for (len = 0; len < PARALLEL_LEN - 64;)
+    len += random_utf8 (s + len, PARALLEL_LEN + 1 - len);
+  size = fribidi_utf8_to_unicode (s, len, expected);
+  CHECK (expected[size] == 0);
+
+  for (i = 0; i < PARALLEL_THREADS; i++)
+    {
+      memset (us, 0x55, (PARALLEL_LEN + 1) * sizeof *us);
+      CHECK (fribidi_utf8_to_unicode_parallel (s, len, us,
+					       parallel_threads[i]) == size);
+      CHECK (!memcmp (us, expected, (size + 1) * sizeof *us));
+    }
+
+  free (s);
+  free (expected);
+  free (us);
+}
+
+/*======================================================================
+ *  fribidi_char_set_load() on the mapping files in tests/: comments,
+ *  undefined bytes, the bytes below the first one that is not itself,
+ *  and the charset numbers past the loaded ones.
+ *----------------------------------------------------------------------*/
+static const char *
+test_file (const char *name)
+{
+  static char path[1024];
+  const char *srcdir = getenv ("srcdir");
+
+  sprintf (path, "%.900s/tests/%s", srcdir ? srcdir : ".", name);
+  return path;
+}
+
+static void
+check_char_set_load (void)
+{
+  FriBidiCharSet char_set;
+  FriBidiChar us[4];
+  char s[4];
+  int ch;
+
+  char_set = fribidi_char_set_load (test_file ("charset_test.txt"),
+				    "Test-8bit", "Test 8-bit");
+  CHECK (char_set > FRIBIDI_CHAR_SETS_NUM);
+  if (char_set == FRIBIDI_CHAR_SET_NOT_FOUND)
+    return;
+  CHECK (fribidi_parse_charset ("test-8BIT") == char_set);
+  CHECK (!strcmp (fribidi_char_set_title (char_set), "Test 8-bit"));
+  CHECK (fribidi_char_set_load (test_file ("charset_test.txt"), "Test-8bit",
+				NULL) == FRIBIDI_CHAR_SET_NOT_FOUND);
+  CHECK (fribidi_char_set_load (test_file ("charset_test_bad.txt"),
+				"Test-8bit-bad", NULL) ==
+	 FRIBIDI_CHAR_SET_NOT_FOUND);
+  CHECK (fribidi_char_set_load (test_file ("no_such_file.txt"),
+				"Test-8bit-none", NULL) ==
+	 FRIBIDI_CHAR_SET_NOT_FOUND);
+  CHECK (fribidi_parse_charset ("Test-8bit-bad") ==
+	 FRIBIDI_CHAR_SET_NOT_FOUND);
+
+  /* Every byte reads as its mapping, or as itself, and back. */
+  for (ch = 1; ch < 256; ch++)
+    {
+      s[0] = ch;
+      CHECK (fribidi_charset_to_unicode (char_set, s, 1, us) == 1);
+      CHECK (fribidi_unicode_to_charset (char_set, us, 1, s) == 1
+	     && (unsigned char) s[0] == ch);
+    }
+  s[0] = '\x24';
+  s[1] = '\xE1';
+  s[2] = '\x81';
+  fribidi_charset_to_unicode (char_set, s, 3, us);
+  CHECK (us[0] == 0x20AA && us[1] == 0x05D1 && us[2] == 0x0081);
+  s[0] = '\x80';
+  s[1] = '\xFE';
+  fribidi_charset_to_unicode (char_set, s, 2, us);
+  CHECK (us[0] == 0x20AC && us[1] == 0x200F);
+
+  /* Below 0x24 the characters are written as themselves, from there on
+     they are looked up, and '$' is not in the charset any more. */
+  us[0] = '#';
+  us[1] = '$';
+  us[2] = 0x05D3;
+  CHECK (fribidi_unicode_to_charset (char_set, us, 3, s) == 3
+	 && !memcmp (s, "#\277\277", 3));
+
+  /* Past the loaded charsets is the one that converts nothing. */
+  CHECK (!strcmp (fribidi_char_set_name (char_set + 1), "Not Implemented"));
+  CHECK (fribidi_charset_to_unicode (char_set + 1, s, 1, us) == 0);
+  CHECK (fribidi_unicode_to_charset (char_set + 1, us, 1, s) == 0);
+}
+
+#endif /* !FRIBIDI_NO_CHARSETS */
+
+
+int
+main (int argc,
+      char *argv[])
+{
+  run_check ("log2vis_utf16", check_log2vis_utf16);
+  run_check ("log2vis_utf8", check_log2vis_utf8);
+  run_check ("par_direction", check_par_direction);
+  run_check ("utf8_may_need_bidi", check_utf8_may_need_bidi);
+#ifndef FRIBIDI_NO_CHARSETS
+  run_check ("char_set_converter", check_char_set_converter);
+  run_check ("char_set_sizes", check_char_set_sizes);
+  run_check ("utf8_to_unicode_parallel", check_utf8_to_unicode_parallel);
+  run_check ("char_set_load", check_char_set_load);
+#endif
+
+  return failed_checks ? 1 : 0;
+}
@@ -26,7 +26,7 @@
 #ifdef HAVE_CONFIG_H
 #include "config.h"
 #endif
-#include "fribidi_unicode.h"
+#include "fribidi.h"
 
 #ifndef SIZEOF_CHAR
 #define SIZEOF_CHAR sizeof (char)
@@ -83,7 +83,7 @@ type_names[] =
 
 static char *names[type_names_count];
 
-static char *unidata_file;
+static char *unidata_file, *bidi_mirroring_file;
 
 static char
 get_type (char *s)
@@ -155,6 +155,103 @@ read_unicode_data ()
   fclose (f);
 }
 
+/*======================================================================
+ *  The combined property table, see FriBidiProps in fribidi_types.h.
+ *----------------------------------------------------------------------*/
+
+#define props_table_name "FriBidiPropsBlock"
+#define props_key_type_name "FriBidiProps"
+#define props_macro_name "FRIBIDI_GET_PROPS"
+#define props_max_depth 2
+
+int fribidi_wcwidth_reference (FriBidiChar ucs);
+int fribidi_wcwidth_cjk_reference (FriBidiChar ucs);
+
+static int props[FRIBIDI_UNICODE_CHARS];
+
+/* The names of the FRIBIDI_PROP_TYPE_* values, in order. */
+static char *prop_type_names[] = {
+#define _FRIBIDI_ADD_TYPE(TYPE) #TYPE,
+#include "fribidi_types.i"
+#undef _FRIBIDI_ADD_TYPE
+};
+
+static int
+get_prop_type (int key)
+{
+  int i;
+
+  for (i = 0; i < FRIBIDI_TYPES_COUNT; i++)
+    if (!strcmp (names[key], prop_type_names[i]))
+      return i;
+  err2 ("type name `%s' is not a FriBidiPropCharType", names[key]);
+  return 0;
+}
+
+static void
+read_props ()
+{
+  char s[500], gc[10];
+  unsigned int i, j;
+  int prop_type[type_names_count];
+  FILE *f;
+
+  /* Bidi types, from the table already read.  The props table holds the
+     values themselves, not the names the type tables are written with. */
+  for (i = 0; i < type_names_count; i++)
+    if (names[i])
+      prop_type[i] = get_prop_type (i);
+  for (i = 0; i < FRIBIDI_UNICODE_CHARS; i++)
+    props[i] = prop_type[table[i]];
+
+  /* Combining marks. */
+  printf ("Reading `UnicodeData.txt' for combining marks\n");
+  if (!(f = fopen (unidata_file, "rt")))
+    err2 ("error: cannot open `%s' for reading", unidata_file);
+  while (fgets (s, sizeof s, f))
+    {
+      sscanf (s, "%x;%*[^;];%[^;]", &i, gc);
+      if (i < FRIBIDI_UNICODE_CHARS && gc[0] == 'M')
+	props[i] |= FRIBIDI_PROPS_COMBINING;
+    }
+  fclose (f);
+
+  /* Mirrors. */
+  printf ("Reading `BidiMirroring.txt'\n");
+  if (!(f = fopen (bidi_mirroring_file, "rt")))
+    err2 ("error: cannot open `%s' for reading", bidi_mirroring_file);
+  while (fgets (s, sizeof s, f))
+    {
+      if (s[0] == '#' || s[0] == '\0' || s[0] == '\n')
+	continue;
+      sscanf (s, "%x; %x", &i, &j);
+      if (i < FRIBIDI_UNICODE_CHARS)
+	props[i] |= FRIBIDI_PROPS_MIRROR;
+      if (j < FRIBIDI_UNICODE_CHARS)
+	props[j] |= FRIBIDI_PROPS_MIRROR;
+    }
+  fclose (f);
+
+  /* Width classes, from the same reference as fribidi_create_wcwidth. */
+  for (i = 0; i < FRIBIDI_UNICODE_CHARS; i++)
+    {
+      int w = fribidi_wcwidth_reference (i),
+	w_cjk = fribidi_wcwidth_cjk_reference (i), k;
+
+      if (w < 0)
+	k = FRIBIDI_WIDTH_CLASS_CONTROL;
+      else if (w == 0)
+	k = FRIBIDI_WIDTH_CLASS_ZERO;
+      else if (w == 2)
+	k = FRIBIDI_WIDTH_CLASS_WIDE;
+      else if (w_cjk == 2)
+	k = FRIBIDI_WIDTH_CLASS_AMBIGUOUS;
+      else
+	k = FRIBIDI_WIDTH_CLASS_NARROW;
+      props[i] |= k << FRIBIDI_PROPS_WIDTH_SHIFT;
+    }
+}
+
 static char *
 headermacro (char *file)
 {
@@ -179,7 +276,7 @@ write_char_type (char *file,
   FILE *f;
   char *FILENAME = headermacro (file);
 
-  printf ("Writing `%s', it may take a few minutes\n", file);
+  printf ("Writing `%s'\n", file);
   if (!(f = fopen (file, "wt")))
     err2 ("error: cannot open `%s' for writing", file);
   fprintf (f, "/*\n"
@@ -229,6 +326,118 @@ write_char_type (char *file,
   fclose (f);
 }
 
+static void
+write_props (char *file)
+{
+  int i;
+  FILE *f;
+  char *FILENAME = headermacro (file);
+
+  printf ("Writing `%s'\n", file);
+  if (!(f = fopen (file, "wt")))
+    err2 ("error: cannot open `%s' for writing", file);
+  fprintf (f, "/*\n"
+	   "  This file was automatically created from UnicodeData.txt and\n"
+	   "  BidiMirroring.txt version %s, and fribidi_wcwidth.c\n"
+	   "  by fribidi_create_char_types\n*/\n\n", FRIBIDI_UNICODE_VERSION);
+
+  fprintf (f, "#ifndef %s\n#define %s\n\n#include \"fribidi.h\"\n\n",
+	   FILENAME, FILENAME);
+
+  fprintf (f, "#define PACKTAB_UINT8 fribidi_uint8\n");
+  fprintf (f, "#define PACKTAB_UINT16 fribidi_uint16\n");
+  fprintf (f, "#define PACKTAB_UINT32 fribidi_uint32\n");
+
+  if (!pack_table
+      (props, FRIBIDI_UNICODE_CHARS, 2, props_max_depth, 4, NULL,
+       props_key_type_name, props_table_name, props_macro_name, f))
+    err ("error: insufficient memory for pack_table");
+
+  fprintf (f, "\n/* The bidi types of the ASCII characters, directly. */\n");
+  fprintf (f, "#define FRIBIDI_ASCII_TYPES");
+  for (i = 0; i < 128; i++)
+    fprintf (f, "%s FRIBIDI_TYPE_%s,", i % 4 ? "" : " \\\n ",
+	     prop_type_names[props[i] & FRIBIDI_PROPS_TYPE_MASK]);
+  fprintf (f, "\n");
+
+  fprintf (f, "\n#endif /* %s */\n", FILENAME);
+
+  fclose (f);
+}
+
+/* The same as fribidi_tables_checksum(), which is not linked in. */
+static fribidi_uint32
+checksum (const unsigned char *p,
+	  unsigned long len)
+{
+  fribidi_uint32 a = 1, b = 0;
+
+  while (len-- > 0)
+    {
+      a = (a + *p++) % 65521;
+      b = (b + a) % 65521;
+    }
+
+  return (b << 16) | a;
+}
+
+static void
+write_tables (char *file)
+{
+  static FriBidiProps data[FRIBIDI_UNICODE_CHARS];
+  static fribidi_uint16 index[FRIBIDI_UNICODE_CHARS /
+			      FRIBIDI_TABLES_BLOCK_SIZE];
+  unsigned char *buf;
+  FriBidiTablesHeader h;
+  unsigned long i, j, blocks = 0, size;
+  FILE *f;
+
+  /* Share identical blocks. */
+  for (i = 0; i < FRIBIDI_UNICODE_CHARS; i += FRIBIDI_TABLES_BLOCK_SIZE)
+    {
+      FriBidiProps block[FRIBIDI_TABLES_BLOCK_SIZE];
+
+      for (j = 0; j < FRIBIDI_TABLES_BLOCK_SIZE; j++)
+	block[j] = props[i + j];
+      for (j = 0; j < blocks; j++)
+	if (!memcmp (data + j * FRIBIDI_TABLES_BLOCK_SIZE, block,
+		     sizeof block))
+	  break;
+      if (j == blocks)
+	memcpy (data + blocks++ * FRIBIDI_TABLES_BLOCK_SIZE, block,
+		sizeof block);
+      index[i / FRIBIDI_TABLES_BLOCK_SIZE] = j;
+    }
+
+  memset (&h, 0, sizeof h);
+  memcpy (h.magic, FRIBIDI_TABLES_MAGIC, sizeof h.magic);
+  h.format_version = FRIBIDI_TABLES_FORMAT_VERSION;
+  h.byte_order = FRIBIDI_TABLES_BYTE_ORDER;
+  strncpy (h.unicode_version, FRIBIDI_UNICODE_VERSION,
+	   sizeof h.unicode_version - 1);
+  h.chars = FRIBIDI_UNICODE_CHARS;
+  h.block_size = FRIBIDI_TABLES_BLOCK_SIZE;
+  h.blocks = blocks;
+  h.index_offset = sizeof h;
+  h.data_offset = h.index_offset + sizeof index;
+  h.file_size = size = h.data_offset
+    + blocks * FRIBIDI_TABLES_BLOCK_SIZE * sizeof (FriBidiProps);
+
+  if (!(buf = malloc (size)))
+    err ("error: insufficient memory");
+  memcpy (buf + h.index_offset, index, sizeof index);
+  memcpy (buf + h.data_offset, data, size - h.data_offset);
+  h.checksum = checksum (buf + sizeof h, size - sizeof h);
+  memcpy (buf, &h, sizeof h);
+
+  printf ("Writing `%s'\n", file);
+  if (!(f = fopen (file, "wb")))
+    err2 ("error: cannot open `%s' for writing", file);
+  if (fwrite (buf, 1, size, f) != size || fclose (f))
+    err2 ("error: cannot write `%s'", file);
+  free (buf);
+}
+
 int
 main (int argc,
       char **argv)
@@ -236,10 +445,32 @@ main (int argc,
   int max_depth;
   char file[50], *p;
   if (argc < 2)
-    err ("usage: fribidi_create_char_types max_depth [UnicodeData.txt path]");
+    err
+      ("usage: fribidi_create_char_types max_depth|props|tables [unidata path [byte budget]]");
   p = (argc >= 3) ? argv[2] : "unidata";
   unidata_file = malloc (50 + strlen (p));
   sprintf (unidata_file, "%s/UnicodeData.txt", p);
+  bidi_mirroring_file = malloc (50 + strlen (p));
+  sprintf (bidi_mirroring_file, "%s/BidiMirroring.txt", p);
+  /* Stop the search at the first table that fits in the budget. */
+  if (argc >= 4)
+    pack_table_set_budget (atoi (argv[3]));
+  if (!strcmp (argv[1], "props"))
+    {
+      init_table ();
+      read_unicode_data ();
+      read_props ();
+      write_props ("fribidi_tab_props.i");
+      return 0;
+    }
+  if (!strcmp (argv[1], "tables"))
+    {
+      init_table ();
+      read_unicode_data ();
+      read_props ();
+      write_tables ("fribidi_props.tab");
+      return 0;
+    }
   max_depth = atoi (argv[1]);
   if (!max_depth)
     err ("invalid depth");
@@ -22,6 +22,7 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include "packtab.h"
 #ifdef HAVE_CONFIG_H
 #include "config.h"
 #endif
@@ -37,10 +38,16 @@ err2 (char *fmt,
   exit (1);
 }
 
+#define table_name "FriBidiMirroringBlock"
+#define key_type_name "fribidi_int16"
+#define macro_name "FRIBIDI_GET_MIRRORING_DELTA"
+#define max_depth 2
+
 static int table[0x110000];
+static int delta[0x110000];
 static char *bidi_mirroring_file;
 
-static int mirroring_count;
+static int mirroring_count, max_mirrored_char;
 
 static void
 read_bidi_mirroring ()
@@ -50,8 +57,9 @@ read_bidi_mirroring ()
   FILE *f;
 
   for (i = 0; i < 0x110000; i++)
-    table[i] = 0;
+    table[i] = delta[i] = 0;
   mirroring_count = 0;
+  max_mirrored_char = 0;
   printf ("Reading `BidiMirroring.txt'\n");
   if (!(f = fopen (bidi_mirroring_file, "rt")))
     err2 ("cannot open `%s' for reading", bidi_mirroring_file);
@@ -64,6 +72,12 @@ read_bidi_mirroring ()
       sscanf (s, "%x; %x", &i, &j);
       table[i] = j;
       table[j] = i;
+      delta[i] = j - i;
+      delta[j] = i - j;
+      if (i > max_mirrored_char)
+	max_mirrored_char = i;
+      if (j > max_mirrored_char)
+	max_mirrored_char = j;
       mirroring_count++;
     }
   fclose (f);
@@ -124,6 +138,43 @@ write_mirror (char *file)
   fprintf (f, "} ;\n\n");
   fprintf (f, "/* *INDE" "NT-ON* */\n\n");
   fprintf (f, "static const int nFriBidiMirroredChars = %d;\n\n", mirroring_count);
+
+  fprintf (f, "/*\n"
+	   "  The same data as a table of deltas, mirrored_ch - ch, or 0 if ch\n"
+	   "  has no mirror, compressed by packtab for a lookup in %d loads.\n"
+	   "  FriBidiMirroredChars above is kept as the reference.\n"
+	   "*/\n\n", max_depth);
+  fprintf (f, "#define PACKTAB_UINT8 fribidi_uint8\n");
+  fprintf (f, "#define PACKTAB_UINT16 fribidi_uint16\n");
+  fprintf (f, "#define PACKTAB_UINT32 fribidi_uint32\n");
+  if (!pack_table
+      (delta, 0x110000, 2, max_depth, 5, NULL, key_type_name, table_name,
+       macro_name, f))
+    err2 ("%s", "insufficient memory for pack_table");
+
+  fprintf (f, "/*\n"
+	   "  One bit for each block of 256 characters, set if any character in\n"
+	   "  the block has a mirror.  Used to skip most characters without\n"
+	   "  looking them up.\n"
+	   "*/\n\n");
+  fprintf (f, "#define FRIBIDI_MIRRORING_MAX_CHAR 0x%04X\n\n",
+	   max_mirrored_char);
+  fprintf (f, "static const fribidi_uint32 FriBidiMirroringBlockMask[%d] = {",
+	   (max_mirrored_char >> 13) + 1);
+  for (i = 0; i <= max_mirrored_char >> 13; i++)
+    {
+      unsigned long mask = 0;
+      int j;
+
+      for (j = 0; j < 0x2000; j++)
+	if (table[(i << 13) + j])
+	  mask |= 1UL << (j >> 8);
+      fprintf (f, "%s0x%08lX,", i % 4 ? " " : "\n  ", mask);
+    }
+  fprintf (f, "\n};\n\n");
+  fprintf (f, "#define FRIBIDI_MAY_HAVE_MIRROR(x)\t\\\n"
+	   "\t((x) <= FRIBIDI_MIRRORING_MAX_CHAR &&\t\\\n"
+	   "\t (FriBidiMirroringBlockMask[(x) >> 13] >> ((x) >> 8 & 31) & 1))\n");
   fprintf (f, "\n#endif /* %s */\n", FILENAME);
   fclose (f);
 }
@@ -0,0 +1,181 @@
+/* FriBidi - Library of BiDi algorithm
+ * Copyright (C) 2002 FriBidi Project (http://fribidi.sf.net/).
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library, in a file named COPYING; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307, USA
+ *
+ * For licensing issues, contact <dov@imagic.weizmann.ac.il> and
+ * <fwpg@sharif.edu>.
+ */
+
+/*======================================================================
+ *  Creates fribidi_tab_wcwidth.i, a packtab compressed table of column
+ *  width classes, from Markus Kuhn's wcwidth implementation in
+ *  fribidi_wcwidth.c.
+ *----------------------------------------------------------------------*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "packtab.h"
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+#include "fribidi.h"
+
+#define table_name "FriBidiWidthBlock"
+#define key_type_name "fribidi_uint8"
+#define macro_name "FRIBIDI_GET_WIDTH_CLASS"
+#define max_depth 2
+
+int fribidi_wcwidth_reference (FriBidiChar ucs);
+int fribidi_wcwidth_cjk_reference (FriBidiChar ucs);
+
+static void
+err (char *msg)
+{
+  fprintf (stderr, "fribidi_create_wcwidth: %s\n", msg);
+  exit (1);
+}
+
+static void
+err2 (char *fmt,
+      char *p)
+{
+  fprintf (stderr, "fribidi_create_wcwidth: ");
+  fprintf (stderr, fmt, p);
+  fprintf (stderr, "\n");
+  exit (1);
+}
+
+/* *INDENT-OFF* */
+static struct
+{
+  char *name;
+  int width, width_cjk;
+}
+classes[FRIBIDI_WIDTH_CLASSES_COUNT] =
+{
+  /* Must be in the order of the FRIBIDI_WIDTH_CLASS_* values. */
+  {"CONTROL", -1, -1},
+  {"ZERO", 0, 0},
+  {"NARROW", 1, 1},
+  {"WIDE", 2, 2},
+  {"AMBIGUOUS", 1, 2},
+};
+/* *INDENT-ON* */
+
+static int table[0x110000];
+static char *names[FRIBIDI_WIDTH_CLASSES_COUNT];
+
+static void
+init_table ()
+{
+  int i, k;
+
+  for (k = 0; k < FRIBIDI_WIDTH_CLASSES_COUNT; k++)
+    names[k] = classes[k].name;
+
+  for (i = 0; i < 0x110000; i++)
+    {
+      int w = fribidi_wcwidth_reference (i),
+	w_cjk = fribidi_wcwidth_cjk_reference (i);
+
+      for (k = 0; k < FRIBIDI_WIDTH_CLASSES_COUNT; k++)
+	if (classes[k].width == w && classes[k].width_cjk == w_cjk)
+	  break;
+      if (k == FRIBIDI_WIDTH_CLASSES_COUNT)
+	{
+	  char s[100];
+	  sprintf (s, "U+%04X has widths %d, %d, which is not a known class",
+		   i, w, w_cjk);
+	  err (s);
+	}
+      table[i] = k;
+    }
+}
+
+static char *
+headermacro (char *file)
+{
+  char *t = strdup (file);
+  char *p = t;
+  while (*p)
+    {
+      if (*p >= 'a' && *p <= 'z')
+	*p += 'A' - 'a';
+      else if ((*p < 'A' || *p > 'Z') && (*p < '0' || *p > '9'))
+	*p = '_';
+      p++;
+    }
+  return t;
+}
+
+static void
+write_wcwidth (char *file)
+{
+  int i;
+  FILE *f;
+  char *FILENAME = headermacro (file);
+
+  printf ("Writing `%s'\n", file);
+  if (!(f = fopen (file, "wt")))
+    err2 ("cannot open `%s' for writing", file);
+  fprintf (f, "/*\n"
+	   "  This file was automatically created from fribidi_wcwidth.c\n"
+	   "  by fribidi_create_wcwidth\n*/\n\n");
+  fprintf (f, "#ifndef %s\n#define %s\n\n#include \"fribidi.h\"\n\n",
+	   FILENAME, FILENAME);
+
+  for (i = 0; i < FRIBIDI_WIDTH_CLASSES_COUNT; i++)
+    fprintf (f, "#define %s FRIBIDI_WIDTH_CLASS_%s\n", names[i], names[i]);
+  fprintf (f, "\n");
+
+  fprintf (f, "#define PACKTAB_UINT8 fribidi_uint8\n");
+  fprintf (f, "#define PACKTAB_UINT16 fribidi_uint16\n");
+  fprintf (f, "#define PACKTAB_UINT32 fribidi_uint32\n");
+
+  if (!pack_table
+      (table, 0x110000, 1, max_depth, 9, names, key_type_name, table_name,
+       macro_name, f))
+    err ("insufficient memory for pack_table");
+
+  for (i = FRIBIDI_WIDTH_CLASSES_COUNT - 1; i >= 0; i--)
+    fprintf (f, "#undef %s\n", names[i]);
+
+  fprintf (f, "\n/* Column width of each class, normal and CJK. */\n");
+  fprintf (f, "static const signed char FriBidiWidthOfClass[%d] = {",
+	   FRIBIDI_WIDTH_CLASSES_COUNT);
+  for (i = 0; i < FRIBIDI_WIDTH_CLASSES_COUNT; i++)
+    fprintf (f, "%s%d", i ? ", " : "", classes[i].width);
+  fprintf (f, "};\n");
+  fprintf (f, "static const signed char FriBidiWidthOfClassCJK[%d] = {",
+	   FRIBIDI_WIDTH_CLASSES_COUNT);
+  for (i = 0; i < FRIBIDI_WIDTH_CLASSES_COUNT; i++)
+    fprintf (f, "%s%d", i ? ", " : "", classes[i].width_cjk);
+  fprintf (f, "};\n");
+
+  fprintf (f, "\n#endif /* %s */\n", FILENAME);
+  fclose (f);
+}
+
+int
+main (int argc,
+      char **argv)
+{
+  init_table ();
+  write_wcwidth ("fribidi_tab_wcwidth.i");
+  return 0;
+}
@@ -61,7 +61,7 @@ init_fribidienv (FriBidiEnv *fribidienv,
   VALIDATE_FRIBIDIENV (fribidienv);
   fribidienv->iAllocatedMemoryChunks = NULL;
   fribidienv->iFlags = aFlags;
-  /* fribidienv->iReserved3 = NULL; */
+  fribidienv->iExtension = NULL;
 }
 
 /*======================================================================
@@ -86,6 +86,35 @@ destroy_fribidienv (FriBidiEnv *fribidienv)
       lChunkPtr = lChunkNext;
     }
   fribidienv->iAllocatedMemoryChunks = NULL;
+  /* The extension was one of the chunks. */
+  fribidienv->iExtension = NULL;
+}
+
+
+/*======================================================================
+ * Return the extension of this FriBidiEnv instance, allocating and
+ * linking it to the instance on first use.  Returns NULL if out of
+ * memory.  The extension is freed by destroy_fribidienv().
+ *----------------------------------------------------------------------*/
+FriBidiEnvExtension *
+fribidi_env_extension (FriBidiEnv *fribidienv)
+{
+  FriBidiEnvExtension *lExtension;
+
+  VALIDATE_FRIBIDIENV (fribidienv);
+
+  if (NULL != fribidienv->iExtension)
+    return fribidienv->iExtension;
+
+  lExtension = (FriBidiEnvExtension *) fribidi_malloc (fribidienv,
+							sizeof
+							(FriBidiEnvExtension));
+  if (NULL == lExtension)
+    return NULL;
+  lExtension->iStats = NULL;
+  lExtension->iTables = NULL;
+  fribidienv->iExtension = lExtension;
+  return lExtension;
 }
 
 
@@ -113,6 +113,18 @@ extern "C"
  */
 /* typedef struct _FriBidiEnv FriBidiEnv; */
 
+/* Optional per-environment state, allocated on demand by
+ * fribidi_env_extension() so that FriBidiEnv itself keeps its size.
+ */
+  typedef struct _FriBidiEnvExtension
+  {
+    struct _FriBidiStats *iStats;
+    /* Statistics aggregator set by fribidi_set_stats(), or NULL. */
+    struct _FriBidiTables *iTables;
+    /* Property tables set by fribidi_set_tables(), or NULL. */
+  }
+  FriBidiEnvExtension;
+
   typedef struct _FriBidiEnv
   {
     FriBidiMemChunkPrefix *iAllocatedMemoryChunks;
@@ -137,7 +149,7 @@ extern "C"
      */
     fribidi_uint32 iReserved1;
     fribidi_uint32 iReserved2;
-    void *iReserved3;		/* If necessary, will point at extension to FriBidiEnv. */
+    FriBidiEnvExtension *iExtension;	/* NULL until fribidi_env_extension(). */
   }
   FriBidiEnv;
 
@@ -161,6 +173,14 @@ extern "C"
   void destroy_fribidienv (FriBidiEnv *fribidienv);
 
 
+/*======================================================================
+ * Return the extension of this FriBidiEnv instance, allocating and
+ * linking it to the instance on first use.  Returns NULL if out of
+ * memory.  The extension is freed by destroy_fribidienv().
+ *----------------------------------------------------------------------*/
+  FriBidiEnvExtension *fribidi_env_extension (FriBidiEnv *fribidienv);
+
+
 /*======================================================================
  * Allocate memory and link it to this FriBidiEnv instance.
  * This function may throw an Out-Of-Memory exception in
@@ -0,0 +1,86 @@
+/* FriBidi - Library of BiDi algorithm
+ * Copyright (C) 2002 FriBidi Project (http://fribidi.sf.net/).
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library, in a file named COPYING; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307, USA
+ *
+ * For licensing issues, contact <dov@imagic.weizmann.ac.il> and
+ * <fwpg@sharif.edu>.
+ */
+
+#ifndef FRIBIDI_INLINE_H
+#define FRIBIDI_INLINE_H
+
+#include "fribidi.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*======================================================================
+ *  Inline character property lookups.
+ *
+ *  These do the same lookups as fribidi_get_type() and
+ *  fribidi_get_props() without a function call, straight from the
+ *  tables the library exports below, with a direct table for ASCII.
+ *  They use the compiled-in tables only: under an environment with
+ *  tables set by fribidi_set_tables(), call the functions instead.
+ *----------------------------------------------------------------------*/
+
+#ifndef FRIBIDI_INLINE
+#if defined (__cplusplus) || \
+    (defined (__STDC_VERSION__) && __STDC_VERSION__ >= 199901L)
+#define FRIBIDI_INLINE inline
+#elif defined (__GNUC__)
+#define FRIBIDI_INLINE __inline__
+#else
+#define FRIBIDI_INLINE
+#endif
+#endif				/* !FRIBIDI_INLINE */
+
+/* The bidi types of the characters 0 to 127. */
+  extern FRIBIDI_API const FriBidiCharType fribidi_ascii_types[128];
+
+/* The properties table, a two level table of 256 character blocks:
+   the properties of ch are
+   fribidi_props_data[fribidi_props_index[ch / 256] + ch % 256]. */
+  extern FRIBIDI_API const fribidi_uint16 *const fribidi_props_index;
+  extern FRIBIDI_API const FriBidiProps *const fribidi_props_data;
+
+  static FRIBIDI_INLINE FriBidiProps
+    fribidi_get_props_inline (FriBidiChar ch)
+  {
+    if (ch < FRIBIDI_UNICODE_CHARS)
+      return fribidi_props_data[fribidi_props_index[ch / 256] + ch % 256];
+    else
+      return FRIBIDI_PROP_TYPE_LTR
+	| FRIBIDI_WIDTH_CLASS_NARROW << FRIBIDI_PROPS_WIDTH_SHIFT;
+  }
+
+  static FRIBIDI_INLINE FriBidiCharType
+    fribidi_get_type_inline (FriBidiChar ch)
+  {
+    if (ch < 128)
+      return fribidi_ascii_types[ch];
+    else
+      return FRIBIDI_PROPS_TYPE (fribidi_get_props_inline (ch));
+  }
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif				/* FRIBIDI_INLINE_H */
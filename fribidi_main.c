@@ -66,6 +66,7 @@ die (char *fmt,
 fribidi_boolean do_break, do_pad, do_mirror, do_reorder_nsm, do_clean,
   show_input, show_changes;
 fribidi_boolean show_visual, show_basedir, show_ltov, show_vtol, show_levels;
+fribidi_boolean show_stats;
 int text_width;
 char *char_set;
 char *bol_text, *eol_text;
@@ -129,7 +130,10 @@ help (void)
 	  "      --changes         Output information about changes between \\\n"
 	  "                        logical and visual string (start, length)\n"
 	  "      --novisual        Do not output the visual string, to be used with \\\n"
-	  "                        --basedir, --ltov, --vtol, --levels, --changes\n");
+	  "                        --basedir, --ltov, --vtol, --levels, --changes\n"
+	  "      --stats           Output input shape statistics to stderr at exit\n"
+	  "      --tables FILE     Use the property tables in FILE, as written by \\\n"
+	  "                        fribidi_create_char_types tables\n");
   printf ("  All string indexes are zero based\n" "\n" "Output:\n"
 	  "  For each line of input, output something like this:\n"
 	  "    [input-str` => '][BOL][[padding space]visual-str][EOL]\n"
@@ -153,6 +157,25 @@ help (void)
   exit (0);
 }
 
+static void
+print_stats (FriBidiStats *stats)
+{
+  int i, last;
+
+  fprintf (stderr, "Strings: %lu, pure LTR: %lu, pure RTL: %lu\n",
+	   stats->calls, stats->pure_ltr, stats->pure_rtl);
+  for (last = FRIBIDI_STATS_BUCKETS - 1; last > 0; last--)
+    if (stats->length[last] || stats->runs[last]
+	|| stats->max_level[last] || stats->explicits[last])
+      break;
+  fprintf (stderr, "%12s %10s %10s %10s %10s\n",
+	   "From", "Length", "Runs", "Max level", "Explicits");
+  for (i = 0; i <= last; i++)
+    fprintf (stderr, "%12lu %10lu %10lu %10lu %10lu\n",
+	     i ? 1UL << (i - 1) : 0UL, stats->length[i], stats->runs[i],
+	     stats->max_level[i], stats->explicits[i]);
+}
+
 static void
 version (void)
 {
@@ -168,6 +191,9 @@ main (int argc,
   fribidi_boolean file_found;
   char *s;
   FILE *IN;
+  FriBidiStats stats;
+  char *tables_file;
+  FriBidiTables *tables;
 
   text_width = 80;
   do_break = FRIBIDI_TRUE;
@@ -182,6 +208,8 @@ main (int argc,
   show_vtol = FRIBIDI_FALSE;
   show_levels = FRIBIDI_FALSE;
   show_changes = FRIBIDI_FALSE;
+  show_stats = FRIBIDI_FALSE;
+  tables_file = NULL;
   char_set = "UTF-8";
   bol_text = NULL;
   eol_text = NULL;
@@ -198,6 +226,7 @@ main (int argc,
 
 #define CHARSETDESC 257
 #define CAPRTL 258
+#define TABLES 259
 
   /* Parse the command line with getopt library */
   /* Must set argv[0], getopt uses it to generate error messages */
@@ -235,6 +264,8 @@ main (int argc,
 	{"levels", 0, &show_levels, FRIBIDI_TRUE},
 	{"changes", 0, &show_changes, FRIBIDI_TRUE},
 	{"novisual", 0, &show_visual, FRIBIDI_FALSE},
+	{"stats", 0, &show_stats, FRIBIDI_TRUE},
+	{"tables", 1, 0, TABLES},
 	{0, 0, 0, 0}
       };
 
@@ -287,6 +318,9 @@ main (int argc,
 	case 'c':
 	  char_set = strdup (optarg);
 	  break;
+	case TABLES:
+	  tables_file = optarg;
+	  break;
 #ifndef FRIBIDI_NO_CHARSETS
 	case CAPRTL:
 	  char_set = "CapRTL";
@@ -331,6 +365,20 @@ main (int argc,
 
   fribidi_set_mirroring (NULL, do_mirror);
   fribidi_set_reorder_nsm (NULL, do_reorder_nsm);
+  if (show_stats)
+    {
+      fribidi_stats_init (&stats);
+      if (!fribidi_set_stats (NULL, &stats))
+	die ("cannot allocate statistics\n");
+    }
+  tables = NULL;
+  if (tables_file)
+    {
+      if (!(tables = fribidi_tables_open (tables_file)))
+	die ("cannot load property tables from `%s'\n", tables_file);
+      if (!fribidi_set_tables (NULL, tables))
+	die ("cannot allocate property tables\n");
+    }
   exit_val = 0;
   file_found = FRIBIDI_FALSE;
   while (optind < argc || !file_found)
@@ -368,8 +416,8 @@ main (int argc,
 	while (fgets (S_, sizeof (S_) - 1, IN))
 	  {
 	    char *new_line, *nl_found;
-	    FriBidiChar logical[MAX_STR_LEN];
-	    char outstring[MAX_STR_LEN];
+	    FriBidiChar *logical;
+	    char *outstring;
 	    FriBidiCharType base;
 	    FriBidiStrIndex len;
 
@@ -388,13 +436,21 @@ main (int argc,
 
 #ifdef FRIBIDI_NO_CHARSETS
 	    {
-	      char *st = S_, *ust = (char *) logical;
+	      char *st, *ust;
 	      int in_len = (int) len;
-	      len = sizeof logical;
+
+	      /* No charset has more characters than bytes. */
+	      logical = ALLOCATE (NULL, FriBidiChar, in_len + 1);
+	      st = S_;
+	      ust = (char *) logical;
+	      len = (in_len + 1) * sizeof logical[0];
 	      iconv (to_ucs4, &st, &in_len, &ust, (int *) &len);
 	      len = (FriBidiChar *) ust - logical;
 	    }
 #else
+	    logical = ALLOCATE (NULL, FriBidiChar,
+				fribidi_charset_to_unicode_size (char_set_num,
+								 S_, len) + 1);
 	    len = fribidi_charset_to_unicode (char_set_num, S_, len, logical);
 #endif
 
@@ -402,7 +458,7 @@ main (int argc,
 	      FriBidiChar *visual;
 	      FriBidiStrIndex *ltov, *vtol;
 	      FriBidiLevel *levels;
-	      FriBidiStrIndex new_len;
+	      FriBidiStrIndex old_len;
 	      fribidi_boolean log2vis;
 
 	      visual = show_visual ? ALLOCATE (NULL, FriBidiChar,
@@ -425,7 +481,8 @@ main (int argc,
 		  if (show_input)
 		    printf ("%-*s => ", padding_width, S_);
 
-		  new_len = len;
+		  /* The logical length; len becomes the visual one. */
+		  old_len = len;
 
 		  /* Remove explicit marks, if asked for. */
 		  if (do_clean)
@@ -443,45 +500,50 @@ main (int argc,
 		      /* Convert it to input charset and print. */
 		      {
 			FriBidiStrIndex idx, st;
+			int *widths = ALLOCATE (NULL, int, len + 1);
+
+#ifndef FRIBIDI_NO_CHARSETS
+			if (char_set_num == FRIBIDI_CHAR_SET_CAP_RTL)
+			  for (idx = 0; idx <= len; idx++)
+			    widths[idx] = idx;
+			else
+#endif
+			  fribidi_wcswidth_prefix (visual, len, widths);
+
 			for (idx = 0; idx < len;)
 			  {
 			    FriBidiStrIndex wid, inlen;
 
-			    wid = break_width;
 			    st = idx;
-#ifndef FRIBIDI_NO_CHARSETS
-			    if (char_set_num != FRIBIDI_CHAR_SET_CAP_RTL)
-#endif
-			      while (wid > 0 && idx < len)
-				wid -= fribidi_wcwidth (visual[idx++]);
-#ifndef FRIBIDI_NO_CHARSETS
-			    else
-			      while (wid > 0 && idx < len)
-				{
-				  wid--;
-				  idx++;
-				}
-#endif
-			    if (wid < 0 && idx > st + 1)
-			      idx--;
+			    idx = fribidi_width_fit (widths, st, len,
+						     break_width);
+			    /* Take at least one character per line. */
+			    if (idx == st)
+			      idx++;
+			    wid = break_width - (widths[idx] - widths[st]);
 			    inlen = idx - st;
 
 #ifdef FRIBIDI_NO_CHARSETS
 			    {
-			      char *str = outstring, *ust =
-				(char *) (visual + st);
+			      char *str, *ust = (char *) (visual + st);
 			      int in_len = inlen * sizeof visual[0];
-			      new_len = sizeof outstring;
-			      iconv (from_ucs4, &ust, &in_len, &str,
-				     (int *) &new_len);
+			      int out_len = inlen * 8;
+
+			      /* iconv cannot tell the size beforehand. */
+			      outstring = ALLOCATE (NULL, char, out_len + 1);
+			      str = outstring;
+			      iconv (from_ucs4, &ust, &in_len, &str, &out_len);
 			      *str = '\0';
-			      new_len = str - outstring;
 			    }
 #else
-			    new_len =
-			      fribidi_unicode_to_charset (char_set_num,
-							  visual + st, inlen,
-							  outstring);
+			    outstring =
+			      ALLOCATE (NULL, char,
+					fribidi_unicode_to_charset_size
+					(char_set_num, visual + st,
+					 inlen) + 1);
+			    fribidi_unicode_to_charset (char_set_num,
+							visual + st, inlen,
+							outstring);
 #endif
 			    if (FRIBIDI_IS_RTL (base))
 			      printf ("%*s",
@@ -492,9 +554,11 @@ main (int argc,
 				      outstring);
 			    else
 			      printf ("%s", outstring);
+			    fribidi_free (NULL, outstring);
 			    if (idx < len)
 			      printf ("\n");
 			  }
+			fribidi_free (NULL, widths);
 		      }
 		      if (eol_text)
 			printf ("%s", eol_text);
@@ -538,8 +602,8 @@ main (int argc,
 		  if (show_changes)
 		    {
 		      FriBidiStrIndex change_start, change_len;
-		      fribidi_find_string_changes (NULL, logical, len,
-						   visual, new_len,
+		      fribidi_find_string_changes (NULL, logical, old_len,
+						   visual, len,
 						   &change_start,
 						   &change_len);
 		      printf ("%sChange start[length] = %d[%d]", nl_found,
@@ -561,6 +625,7 @@ main (int argc,
 	      if (show_levels)
 		fribidi_free (NULL, levels);
 	    }
+	    fribidi_free (NULL, logical);
 
 	    if (*nl_found)
 	      printf (new_line);
@@ -568,5 +633,13 @@ main (int argc,
       }
     }
 
+  if (show_stats)
+    print_stats (&stats);
+  if (tables)
+    {
+      fribidi_set_tables (NULL, NULL);
+      fribidi_tables_close (tables);
+    }
+
   return exit_val;
 }
@@ -35,6 +35,49 @@ fribidi_get_mirror_char (FriBidiEnv *fribidienv,
 			 FriBidiChar ch,
 			 /* Output */
 			 FriBidiChar *mirrored_ch)
+{
+  FriBidiChar result;
+
+  result = ch < FRIBIDI_UNICODE_CHARS ?
+    ch + FRIBIDI_GET_MIRRORING_DELTA (ch) : ch;
+  if (mirrored_ch)
+    *mirrored_ch = result;
+
+  return result != ch;
+}
+
+FRIBIDI_API FriBidiStrIndex
+fribidi_mirror_string (FriBidiEnv *fribidienv,
+		       FriBidiChar *str,
+		       FriBidiStrIndex len)
+{
+  FriBidiStrIndex i, count = 0;
+
+  for (i = 0; i < len; i++)
+    {
+      FriBidiChar ch = str[i];
+
+      if (FRIBIDI_MAY_HAVE_MIRROR (ch))
+	{
+	  FriBidiChar mirrored_ch = ch + FRIBIDI_GET_MIRRORING_DELTA (ch);
+
+	  if (mirrored_ch != ch)
+	    {
+	      str[i] = mirrored_ch;
+	      count++;
+	    }
+	}
+    }
+
+  return count;
+}
+
+FRIBIDI_API fribidi_boolean
+fribidi_get_mirror_char_bsearch (FriBidiEnv *fribidienv,
+				 /* Input */
+				 FriBidiChar ch,
+				 /* Output */
+				 FriBidiChar *mirrored_ch)
 {
   int pos, step;
   fribidi_boolean found;
@@ -0,0 +1,41 @@
+/* FriBidi - Library of BiDi algorithm
+ * Copyright (C) 2002 FriBidi Project (http://fribidi.sf.net/).
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library, in a file named COPYING; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307, USA
+ *
+ * For licensing issues, contact <dov@imagic.weizmann.ac.il> and
+ * <fwpg@sharif.edu>.
+ */
+
+#ifndef FRIBIDI_ONCE_H
+#define FRIBIDI_ONCE_H
+
+/* FRIBIDI_ONCE (once, init) calls init () the first time it is reached
+   for a once defined by FRIBIDI_ONCE_DEFINE.  Where there are POSIX
+   threads, other threads reaching it meanwhile wait for init to
+   return. */
+#if defined (HAVE_PTHREAD_H) && defined (HAVE_LIBPTHREAD)
+#include <pthread.h>
+#define FRIBIDI_ONCE_DEFINE(once) \
+	static pthread_once_t once = PTHREAD_ONCE_INIT
+#define FRIBIDI_ONCE(once, init) pthread_once (&(once), (init))
+#else
+#define FRIBIDI_ONCE_DEFINE(once) static int once = 0
+#define FRIBIDI_ONCE(once, init) \
+	do { if (!(once)) { (once) = 1; (init) (); } } while (0)
+#endif
+
+#endif /* FRIBIDI_ONCE_H */
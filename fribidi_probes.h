@@ -0,0 +1,116 @@
+/* FriBidi - Library of BiDi algorithm
+ * Copyright (C) 2002 FriBidi Project (http://fribidi.sf.net/).
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library, in a file named COPYING; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307, USA
+ *
+ * For licensing issues, contact <dov@imagic.weizmann.ac.il> and
+ * <fwpg@sharif.edu>.
+ */
+
+#ifndef FRIBIDI_PROBES_H
+#define FRIBIDI_PROBES_H
+
+/*======================================================================
+ *  Static tracepoints (USDT) on the library's entry points.
+ *
+ *  When configured with --enable-probes and <sys/sdt.h> is available,
+ *  each FRIBIDI_PROBEn() expands to a DTRACE_PROBEn() in the "fribidi"
+ *  provider, which costs a single nop until a tracer (SystemTap, perf,
+ *  bpftrace, ...) attaches to it.  Otherwise they expand to nothing.
+ *
+ *  Every probe has a semaphore that the tracer raises while attached.
+ *  Arguments that take work to compute are guarded by
+ *  FRIBIDI_PROBE_ENABLED(name), which tests it, so that they cost
+ *  nothing when no one is listening.
+ *
+ *  The probes are:
+ *
+ *    log2vis__entry                 (len, base_dir)
+ *    log2vis__return                (len, base_dir, run_count, max_level)
+ *    get_embedding_levels__entry    (len, base_dir)
+ *    get_embedding_levels__return   (len, base_dir, run_count, max_level)
+ *    types_get_embedding_levels__entry   (len, base_dir)
+ *    types_get_embedding_levels__return  (len, base_dir, run_count,
+ *                                         max_level)
+ *    log2vis_utf16__entry           (len, base_dir)
+ *    log2vis_utf16__return          (len, base_dir, run_count, max_level)
+ *    log2vis_utf8__entry            (len, base_dir)
+ *    log2vis_utf8__return           (len, base_dir, run_count, max_level)
+ *    remove_bidi_marks__entry       (len)
+ *    remove_bidi_marks__return      (len, new_len)
+ *    charset_to_unicode__entry      (char_set, len)
+ *    charset_to_unicode__return     (char_set, len, out_len)
+ *    unicode_to_charset__entry      (char_set, len)
+ *    unicode_to_charset__return     (char_set, len, out_len)
+ *
+ *  base_dir is the requested direction on entry and the resolved one on
+ *  return; run_count is the number of resolved level runs.  len is in
+ *  code units for log2vis_utf16 and in bytes for log2vis_utf8.
+ *----------------------------------------------------------------------*/
+
+#ifdef FRIBIDI_PROBES
+
+#define _SDT_HAS_SEMAPHORES 1
+#include <sys/sdt.h>
+
+#define FRIBIDI_PROBE_SEMAPHORE(name) fribidi_##name##_semaphore
+#define FRIBIDI_PROBE_ENABLED(name) (FRIBIDI_PROBE_SEMAPHORE (name) != 0)
+
+/* The semaphores themselves are defined in fribidi.c. */
+#define FRIBIDI_PROBE_DECLARE(name) \
+	extern unsigned short FRIBIDI_PROBE_SEMAPHORE (name)
+#define FRIBIDI_PROBE_DEFINE(name) \
+	unsigned short FRIBIDI_PROBE_SEMAPHORE (name) \
+	  __attribute__ ((section (".probes"))) = 0
+
+FRIBIDI_PROBE_DECLARE (log2vis__entry);
+FRIBIDI_PROBE_DECLARE (log2vis__return);
+FRIBIDI_PROBE_DECLARE (get_embedding_levels__entry);
+FRIBIDI_PROBE_DECLARE (get_embedding_levels__return);
+FRIBIDI_PROBE_DECLARE (types_get_embedding_levels__entry);
+FRIBIDI_PROBE_DECLARE (types_get_embedding_levels__return);
+FRIBIDI_PROBE_DECLARE (log2vis_utf16__entry);
+FRIBIDI_PROBE_DECLARE (log2vis_utf16__return);
+FRIBIDI_PROBE_DECLARE (log2vis_utf8__entry);
+FRIBIDI_PROBE_DECLARE (log2vis_utf8__return);
+FRIBIDI_PROBE_DECLARE (remove_bidi_marks__entry);
+FRIBIDI_PROBE_DECLARE (remove_bidi_marks__return);
+FRIBIDI_PROBE_DECLARE (charset_to_unicode__entry);
+FRIBIDI_PROBE_DECLARE (charset_to_unicode__return);
+FRIBIDI_PROBE_DECLARE (unicode_to_charset__entry);
+FRIBIDI_PROBE_DECLARE (unicode_to_charset__return);
+
+#define FRIBIDI_PROBE1(name, a1) \
+	DTRACE_PROBE1 (fribidi, name, a1)
+#define FRIBIDI_PROBE2(name, a1, a2) \
+	DTRACE_PROBE2 (fribidi, name, a1, a2)
+#define FRIBIDI_PROBE3(name, a1, a2, a3) \
+	DTRACE_PROBE3 (fribidi, name, a1, a2, a3)
+#define FRIBIDI_PROBE4(name, a1, a2, a3, a4) \
+	DTRACE_PROBE4 (fribidi, name, a1, a2, a3, a4)
+
+#else /* !FRIBIDI_PROBES */
+
+#define FRIBIDI_PROBE_ENABLED(name) 0
+
+#define FRIBIDI_PROBE1(name, a1)
+#define FRIBIDI_PROBE2(name, a1, a2)
+#define FRIBIDI_PROBE3(name, a1, a2, a3)
+#define FRIBIDI_PROBE4(name, a1, a2, a3, a4)
+
+#endif /* !FRIBIDI_PROBES */
+
+#endif /* FRIBIDI_PROBES_H */
@@ -0,0 +1,97 @@
+/* FriBidi - Library of BiDi algorithm
+ * Copyright (C) 2002 FriBidi Project (http://fribidi.sf.net/).
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library, in a file named COPYING; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307, USA
+ *
+ * For licensing issues, contact <dov@imagic.weizmann.ac.il> and
+ * <fwpg@sharif.edu>.
+ */
+
+#include <stdlib.h>
+
+#include "fribidi_stats.h"
+
+FRIBIDI_API void
+fribidi_stats_init (FriBidiStats *stats)
+{
+  int i;
+
+  stats->calls = 0;
+  stats->pure_ltr = 0;
+  stats->pure_rtl = 0;
+  for (i = 0; i < FRIBIDI_STATS_BUCKETS; i++)
+    {
+      stats->length[i] = 0;
+      stats->runs[i] = 0;
+      stats->max_level[i] = 0;
+      stats->explicits[i] = 0;
+    }
+}
+
+FRIBIDI_API fribidi_boolean
+fribidi_set_stats (FriBidiEnv *fribidienv,
+		   FriBidiStats *stats)
+{
+  FriBidiEnvExtension *extension;
+
+  VALIDATE_FRIBIDIENV (fribidienv);
+
+  if (!stats && !fribidienv->iExtension)
+    return FRIBIDI_TRUE;
+
+  extension = fribidi_env_extension (fribidienv);
+  if (!extension)
+    return FRIBIDI_FALSE;
+  extension->iStats = stats;
+  return FRIBIDI_TRUE;
+}
+
+FRIBIDI_API FriBidiStats *
+fribidi_get_stats (FriBidiEnv *fribidienv)
+{
+  VALIDATE_FRIBIDIENV (fribidienv);
+
+  return fribidienv->iExtension ? fribidienv->iExtension->iStats : NULL;
+}
+
+FRIBIDI_API void
+fribidi_stats_merge (FriBidiStats *dst,
+		     const FriBidiStats *src)
+{
+  int i;
+
+  dst->calls += src->calls;
+  dst->pure_ltr += src->pure_ltr;
+  dst->pure_rtl += src->pure_rtl;
+  for (i = 0; i < FRIBIDI_STATS_BUCKETS; i++)
+    {
+      dst->length[i] += src->length[i];
+      dst->runs[i] += src->runs[i];
+      dst->max_level[i] += src->max_level[i];
+      dst->explicits[i] += src->explicits[i];
+    }
+}
+
+FRIBIDI_API int
+fribidi_stats_bucket (unsigned long value)
+{
+  int bucket;
+
+  for (bucket = 0; value && bucket < FRIBIDI_STATS_BUCKETS - 1; bucket++)
+    value >>= 1;
+
+  return bucket;
+}
@@ -0,0 +1,103 @@
+/* FriBidi - Library of BiDi algorithm
+ * Copyright (C) 2002 FriBidi Project (http://fribidi.sf.net/).
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library, in a file named COPYING; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307, USA
+ *
+ * For licensing issues, contact <dov@imagic.weizmann.ac.il> and
+ * <fwpg@sharif.edu>.
+ */
+
+#ifndef FRIBIDI_STATS_H
+#define FRIBIDI_STATS_H
+
+#include "fribidi_config.h"
+#include "fribidi_types.h"
+#include "fribidi_env.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*======================================================================
+ *  Input shape statistics.
+ *
+ *  A FriBidiStats attached to a FriBidiEnv with fribidi_set_stats()
+ *  is updated by every string analysed under that environment.  The
+ *  counters are plain integers without any locking, so use one
+ *  FriBidiStats (and one FriBidiEnv) per thread, and add them up with
+ *  fribidi_stats_merge() when a snapshot is wanted.
+ *
+ *  Histograms are indexed by fribidi_stats_bucket(): bucket 0 counts
+ *  the value 0, and bucket b > 0 counts values in [2^(b-1), 2^b).
+ *----------------------------------------------------------------------*/
+
+#define FRIBIDI_STATS_BUCKETS 32
+
+  typedef struct _FriBidiStats
+  {
+    unsigned long calls;
+    /* Number of strings analysed. */
+    unsigned long pure_ltr;
+    /* Strings resolved entirely to level 0. */
+    unsigned long pure_rtl;
+    /* Strings resolved entirely to level 1. */
+    unsigned long length[FRIBIDI_STATS_BUCKETS];
+    /* String length, in characters. */
+    unsigned long runs[FRIBIDI_STATS_BUCKETS];
+    /* Number of runs after removing explicits and merging (X10). */
+    unsigned long max_level[FRIBIDI_STATS_BUCKETS];
+    /* Highest resolved embedding level. */
+    unsigned long explicits[FRIBIDI_STATS_BUCKETS];
+    /* Number of LRE, RLE, LRO, RLO and PDF codes. */
+  }
+  FriBidiStats;
+
+/*======================================================================
+ *  fribidi_stats_init() zeroes all the counters of stats.
+ *----------------------------------------------------------------------*/
+  FRIBIDI_API void fribidi_stats_init (FriBidiStats *stats);
+
+/*======================================================================
+ *  fribidi_set_stats() attaches stats to the environment, or detaches
+ *  it if stats is NULL.  The caller keeps the ownership of stats.
+ *  Returns FRIBIDI_FALSE if out of memory.
+ *----------------------------------------------------------------------*/
+  FRIBIDI_API fribidi_boolean fribidi_set_stats (FriBidiEnv *fribidienv,
+						 FriBidiStats *stats);
+
+/*======================================================================
+ *  fribidi_get_stats() returns the stats attached to the environment,
+ *  or NULL if none.
+ *----------------------------------------------------------------------*/
+  FRIBIDI_API FriBidiStats *fribidi_get_stats (FriBidiEnv *fribidienv);
+
+/*======================================================================
+ *  fribidi_stats_merge() adds all the counters of src to dst.
+ *----------------------------------------------------------------------*/
+  FRIBIDI_API void fribidi_stats_merge (FriBidiStats *dst,
+					const FriBidiStats *src);
+
+/*======================================================================
+ *  fribidi_stats_bucket() returns the histogram bucket of value.
+ *----------------------------------------------------------------------*/
+  FRIBIDI_API int fribidi_stats_bucket (unsigned long value);
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif				/* FRIBIDI_STATS_H */
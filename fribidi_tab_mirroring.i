@@ -354,5 +354,2838 @@ FriBidiMirroredChars[] =
 
 static const int nFriBidiMirroredChars = 318;
 
+/*
+  The same data as a table of deltas, mirrored_ch - ch, or 0 if ch
+  has no mirror, compressed by packtab for a lookup in 2 loads.
+  FriBidiMirroredChars above is kept as the reference.
+*/
+
+#define PACKTAB_UINT8 fribidi_uint8
+#define PACKTAB_UINT16 fribidi_uint16
+#define PACKTAB_UINT32 fribidi_uint32
+/*
+  Automatically generated by packtab.c version 2
+
+  just use FRIBIDI_GET_MIRRORING_DELTA(key)
+
+  assumed sizeof(fribidi_int16) == 2
+  required memory: 13568
+  lookups: 2
+  partition shape: FriBidiMirroringBlock[2176][512]
+  different table entries: 1 9
+*/
+
+/* *INDENT-OFF* */
+
+static const fribidi_int16 FriBidiMirroringBlockLevel1[512*9] = {
+
+#define FriBidiMirroringBlockLevel1_0000 0x0
+
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      1,   -1,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    2,    0,   -2,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    2,    0,   -2,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    2,    0,   -2,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,   16,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,  -16,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+
+#define FriBidiMirroringBlockLevel1_0200 0x200
+
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+
+#define FriBidiMirroringBlockLevel1_2000 0x400
+
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    1,   -1,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    1,   -1,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    1,   -1,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    1,   -1,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+
+#define FriBidiMirroringBlockLevel1_2200 0x600
+
+      0,    0,    0,    0,    0,    0,    0,    0,
+      3,    3,    3,   -3,   -3,   -3,    0,    0,
+      0,    0,    0,    0,    0, 2016,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    1,   -1,    0,    0,
+      0,    0,    0,  138,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    1,   -1,    1,   -1,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    1,   -1,    1,   -1,
+      1,   -1,    1,   -1,    0,    0,    1,   -1,
+      1,   -1,    1,   -1,    1,   -1,    1,   -1,
+      1,   -1,    1,   -1,    1,   -1,    1,   -1,
+      1,   -1,    1,   -1,    1,   -1,    1,   -1,
+      1,   -1,    1,   -1,    0,    0,    0,    1,
+     -1,    1,   -1,    0,    0,    0,    0,    0,
+   1824,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    1,   -1,    0,    0, 2104,    0,
+   2108, 2106,    0, 2106,    0,    0,    0,    0,
+      1,   -1,    1,   -1,    1,   -1,    1,   -1,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    1,   -1,    1,   -1, -138,    0,    0,
+      1,   -1,    0,    0,    0,    0,    1,   -1,
+      1,   -1,    1,   -1,    1,   -1,    1,   -1,
+      1,   -1,    1,   -1,    1,   -1,    1,   -1,
+      1,   -1,    1,   -1,    1,   -1,    0,    0,
+      1,   -1,    8,    8,    8,    0,    7,    7,
+      0,    0,   -8,   -8,   -8,   -7,   -7,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      1,   -1,    1,   -1,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    1,   -1,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+
+#define FriBidiMirroringBlockLevel1_2600 0x800
+
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      1,   -1,    1,   -1,    1,   -1,    1,   -1,
+      1,   -1,    1,   -1,    1,   -1,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    1,   -1,    0,
+      0,    0,    0,    0,    0,    1,   -1,    0,
+      0,    0,    1,   -1,    1,   -1,    1,   -1,
+      1,   -1,    1,   -1,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+
+#define FriBidiMirroringBlockLevel1_2800 0xA00
+
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    1,   -1,    1,   -1,    1,
+     -1,    1,   -1,    1,   -1,    3,    1,   -1,
+     -3,    1,   -1,    1,   -1,    1,   -1,    1,
+     -1,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+  -1824,    0,    0,    0,    0,    0,    0,    0,
+      1,   -1,    0,    0,    1,   -1,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    1,
+     -1,    1,   -1,    0,    1,   -1,    0,    0,
+      1,   -1,    1,   -1,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,-2016,    0,    0,
+      1,   -1,    0,    0,    1,   -1,    0,    0,
+
+#define FriBidiMirroringBlockLevel1_2A00 0xC00
+
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    1,    1,    1,   -1,    0,
+      0,    0,    0,    0,    1,   -1,    0,    0,
+      0,    0,    0,    0,    1,   -1,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    1,   -1,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    1,   -1,    0,    0,    1,   -1,    1,
+     -1,    1,   -1,    1,   -1,    0,    0,    0,
+      0,    0,    0,    1,   -1,    0,    0,    0,
+      0,    1,   -1,    1,   -1,    1,   -1,    1,
+     -1,    1,   -1,    1,   -1,    0,    0,    0,
+      0,    1,   -1,    0,    0,    0,    1,   -1,
+      1,   -1,    1,   -1,    1,   -1,    0,    1,
+     -1,    0,    0,    1,   -1,    0,    0,    0,
+      0,    0,    0,    1,   -1,    1,   -1,    1,
+     -1,    1,   -1,    1,   -1,    1,   -1,    0,
+      0,    0,    0,    0,    0,    1,   -1,    1,
+     -1,    1,   -1,    1,   -1,    1,   -1,    0,
+      0,    0,    0,    0,    0,    0,-2104,    0,
+      0,    0,    0,-2106,-2108,-2106,    0,    0,
+      0,    0,    0,    0,    1,   -1,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    1,
+     -1,    1,   -1,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+
+#define FriBidiMirroringBlockLevel1_3000 0xE00
+
+      0,    0,    0,    0,    0,    0,    0,    0,
+      1,   -1,    1,   -1,    1,   -1,    1,   -1,
+      1,   -1,    0,    0,    1,   -1,    1,   -1,
+      1,   -1,    1,   -1,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+
+#define FriBidiMirroringBlockLevel1_FE00 0x1000
+
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      1,   -1,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    2,    0,   -2,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    2,    0,   -2,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    2,    0,   -2,    0,    1,
+     -1,    0,    1,   -1,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0,    0,    0,    0,
+};
+
+static const PACKTAB_UINT16 FriBidiMirroringBlockLevel0[2176*1] = {
+
+#define FriBidiMirroringBlockLevel0_0000 0x0
+
+  FriBidiMirroringBlockLevel1_0000,  /* 0000..01FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 0200..03FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 0400..05FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 0600..07FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 0800..09FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 0A00..0BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 0C00..0DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 0E00..0FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 1000..11FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 1200..13FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 1400..15FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 1600..17FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 1800..19FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 1A00..1BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 1C00..1DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 1E00..1FFF */
+  FriBidiMirroringBlockLevel1_2000,  /* 2000..21FF */
+  FriBidiMirroringBlockLevel1_2200,  /* 2200..23FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 2400..25FF */
+  FriBidiMirroringBlockLevel1_2600,  /* 2600..27FF */
+  FriBidiMirroringBlockLevel1_2800,  /* 2800..29FF */
+  FriBidiMirroringBlockLevel1_2A00,  /* 2A00..2BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 2C00..2DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 2E00..2FFF */
+  FriBidiMirroringBlockLevel1_3000,  /* 3000..31FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 3200..33FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 3400..35FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 3600..37FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 3800..39FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 3A00..3BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 3C00..3DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 3E00..3FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 4000..41FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 4200..43FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 4400..45FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 4600..47FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 4800..49FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 4A00..4BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 4C00..4DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 4E00..4FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 5000..51FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 5200..53FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 5400..55FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 5600..57FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 5800..59FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 5A00..5BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 5C00..5DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 5E00..5FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 6000..61FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 6200..63FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 6400..65FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 6600..67FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 6800..69FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 6A00..6BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 6C00..6DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 6E00..6FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 7000..71FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 7200..73FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 7400..75FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 7600..77FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 7800..79FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 7A00..7BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 7C00..7DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 7E00..7FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 8000..81FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 8200..83FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 8400..85FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 8600..87FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 8800..89FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 8A00..8BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 8C00..8DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 8E00..8FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 9000..91FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 9200..93FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 9400..95FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 9600..97FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 9800..99FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 9A00..9BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 9C00..9DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 9E00..9FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* A000..A1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* A200..A3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* A400..A5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* A600..A7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* A800..A9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* AA00..ABFF */
+  FriBidiMirroringBlockLevel1_0200,  /* AC00..ADFF */
+  FriBidiMirroringBlockLevel1_0200,  /* AE00..AFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* B000..B1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* B200..B3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* B400..B5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* B600..B7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* B800..B9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* BA00..BBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* BC00..BDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* BE00..BFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* C000..C1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* C200..C3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* C400..C5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* C600..C7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* C800..C9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* CA00..CBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* CC00..CDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* CE00..CFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* D000..D1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* D200..D3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* D400..D5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* D600..D7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* D800..D9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* DA00..DBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* DC00..DDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* DE00..DFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* E000..E1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* E200..E3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* E400..E5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* E600..E7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* E800..E9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* EA00..EBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* EC00..EDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* EE00..EFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* F000..F1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* F200..F3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* F400..F5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* F600..F7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* F800..F9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* FA00..FBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* FC00..FDFF */
+  FriBidiMirroringBlockLevel1_FE00,  /* FE00..FFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 10000..101FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 10200..103FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 10400..105FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 10600..107FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 10800..109FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 10A00..10BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 10C00..10DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 10E00..10FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 11000..111FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 11200..113FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 11400..115FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 11600..117FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 11800..119FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 11A00..11BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 11C00..11DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 11E00..11FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 12000..121FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 12200..123FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 12400..125FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 12600..127FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 12800..129FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 12A00..12BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 12C00..12DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 12E00..12FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 13000..131FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 13200..133FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 13400..135FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 13600..137FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 13800..139FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 13A00..13BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 13C00..13DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 13E00..13FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 14000..141FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 14200..143FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 14400..145FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 14600..147FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 14800..149FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 14A00..14BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 14C00..14DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 14E00..14FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 15000..151FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 15200..153FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 15400..155FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 15600..157FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 15800..159FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 15A00..15BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 15C00..15DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 15E00..15FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 16000..161FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 16200..163FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 16400..165FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 16600..167FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 16800..169FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 16A00..16BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 16C00..16DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 16E00..16FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 17000..171FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 17200..173FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 17400..175FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 17600..177FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 17800..179FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 17A00..17BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 17C00..17DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 17E00..17FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 18000..181FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 18200..183FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 18400..185FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 18600..187FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 18800..189FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 18A00..18BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 18C00..18DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 18E00..18FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 19000..191FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 19200..193FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 19400..195FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 19600..197FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 19800..199FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 19A00..19BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 19C00..19DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 19E00..19FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 1A000..1A1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 1A200..1A3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 1A400..1A5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 1A600..1A7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 1A800..1A9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 1AA00..1ABFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 1AC00..1ADFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 1AE00..1AFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 1B000..1B1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 1B200..1B3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 1B400..1B5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 1B600..1B7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 1B800..1B9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 1BA00..1BBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 1BC00..1BDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 1BE00..1BFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 1C000..1C1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 1C200..1C3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 1C400..1C5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 1C600..1C7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 1C800..1C9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 1CA00..1CBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 1CC00..1CDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 1CE00..1CFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 1D000..1D1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 1D200..1D3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 1D400..1D5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 1D600..1D7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 1D800..1D9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 1DA00..1DBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 1DC00..1DDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 1DE00..1DFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 1E000..1E1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 1E200..1E3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 1E400..1E5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 1E600..1E7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 1E800..1E9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 1EA00..1EBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 1EC00..1EDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 1EE00..1EFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 1F000..1F1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 1F200..1F3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 1F400..1F5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 1F600..1F7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 1F800..1F9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 1FA00..1FBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 1FC00..1FDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 1FE00..1FFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 20000..201FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 20200..203FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 20400..205FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 20600..207FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 20800..209FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 20A00..20BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 20C00..20DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 20E00..20FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 21000..211FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 21200..213FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 21400..215FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 21600..217FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 21800..219FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 21A00..21BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 21C00..21DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 21E00..21FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 22000..221FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 22200..223FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 22400..225FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 22600..227FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 22800..229FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 22A00..22BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 22C00..22DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 22E00..22FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 23000..231FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 23200..233FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 23400..235FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 23600..237FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 23800..239FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 23A00..23BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 23C00..23DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 23E00..23FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 24000..241FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 24200..243FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 24400..245FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 24600..247FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 24800..249FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 24A00..24BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 24C00..24DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 24E00..24FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 25000..251FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 25200..253FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 25400..255FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 25600..257FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 25800..259FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 25A00..25BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 25C00..25DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 25E00..25FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 26000..261FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 26200..263FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 26400..265FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 26600..267FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 26800..269FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 26A00..26BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 26C00..26DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 26E00..26FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 27000..271FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 27200..273FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 27400..275FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 27600..277FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 27800..279FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 27A00..27BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 27C00..27DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 27E00..27FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 28000..281FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 28200..283FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 28400..285FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 28600..287FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 28800..289FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 28A00..28BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 28C00..28DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 28E00..28FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 29000..291FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 29200..293FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 29400..295FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 29600..297FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 29800..299FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 29A00..29BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 29C00..29DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 29E00..29FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 2A000..2A1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 2A200..2A3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 2A400..2A5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 2A600..2A7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 2A800..2A9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 2AA00..2ABFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 2AC00..2ADFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 2AE00..2AFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 2B000..2B1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 2B200..2B3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 2B400..2B5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 2B600..2B7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 2B800..2B9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 2BA00..2BBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 2BC00..2BDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 2BE00..2BFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 2C000..2C1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 2C200..2C3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 2C400..2C5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 2C600..2C7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 2C800..2C9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 2CA00..2CBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 2CC00..2CDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 2CE00..2CFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 2D000..2D1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 2D200..2D3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 2D400..2D5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 2D600..2D7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 2D800..2D9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 2DA00..2DBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 2DC00..2DDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 2DE00..2DFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 2E000..2E1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 2E200..2E3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 2E400..2E5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 2E600..2E7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 2E800..2E9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 2EA00..2EBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 2EC00..2EDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 2EE00..2EFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 2F000..2F1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 2F200..2F3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 2F400..2F5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 2F600..2F7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 2F800..2F9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 2FA00..2FBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 2FC00..2FDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 2FE00..2FFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 30000..301FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 30200..303FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 30400..305FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 30600..307FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 30800..309FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 30A00..30BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 30C00..30DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 30E00..30FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 31000..311FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 31200..313FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 31400..315FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 31600..317FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 31800..319FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 31A00..31BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 31C00..31DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 31E00..31FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 32000..321FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 32200..323FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 32400..325FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 32600..327FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 32800..329FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 32A00..32BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 32C00..32DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 32E00..32FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 33000..331FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 33200..333FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 33400..335FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 33600..337FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 33800..339FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 33A00..33BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 33C00..33DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 33E00..33FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 34000..341FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 34200..343FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 34400..345FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 34600..347FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 34800..349FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 34A00..34BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 34C00..34DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 34E00..34FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 35000..351FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 35200..353FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 35400..355FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 35600..357FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 35800..359FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 35A00..35BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 35C00..35DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 35E00..35FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 36000..361FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 36200..363FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 36400..365FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 36600..367FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 36800..369FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 36A00..36BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 36C00..36DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 36E00..36FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 37000..371FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 37200..373FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 37400..375FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 37600..377FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 37800..379FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 37A00..37BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 37C00..37DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 37E00..37FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 38000..381FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 38200..383FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 38400..385FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 38600..387FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 38800..389FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 38A00..38BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 38C00..38DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 38E00..38FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 39000..391FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 39200..393FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 39400..395FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 39600..397FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 39800..399FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 39A00..39BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 39C00..39DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 39E00..39FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 3A000..3A1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 3A200..3A3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 3A400..3A5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 3A600..3A7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 3A800..3A9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 3AA00..3ABFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 3AC00..3ADFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 3AE00..3AFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 3B000..3B1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 3B200..3B3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 3B400..3B5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 3B600..3B7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 3B800..3B9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 3BA00..3BBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 3BC00..3BDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 3BE00..3BFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 3C000..3C1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 3C200..3C3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 3C400..3C5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 3C600..3C7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 3C800..3C9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 3CA00..3CBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 3CC00..3CDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 3CE00..3CFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 3D000..3D1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 3D200..3D3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 3D400..3D5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 3D600..3D7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 3D800..3D9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 3DA00..3DBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 3DC00..3DDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 3DE00..3DFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 3E000..3E1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 3E200..3E3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 3E400..3E5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 3E600..3E7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 3E800..3E9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 3EA00..3EBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 3EC00..3EDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 3EE00..3EFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 3F000..3F1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 3F200..3F3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 3F400..3F5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 3F600..3F7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 3F800..3F9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 3FA00..3FBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 3FC00..3FDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 3FE00..3FFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 40000..401FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 40200..403FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 40400..405FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 40600..407FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 40800..409FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 40A00..40BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 40C00..40DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 40E00..40FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 41000..411FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 41200..413FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 41400..415FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 41600..417FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 41800..419FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 41A00..41BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 41C00..41DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 41E00..41FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 42000..421FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 42200..423FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 42400..425FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 42600..427FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 42800..429FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 42A00..42BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 42C00..42DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 42E00..42FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 43000..431FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 43200..433FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 43400..435FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 43600..437FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 43800..439FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 43A00..43BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 43C00..43DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 43E00..43FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 44000..441FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 44200..443FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 44400..445FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 44600..447FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 44800..449FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 44A00..44BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 44C00..44DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 44E00..44FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 45000..451FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 45200..453FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 45400..455FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 45600..457FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 45800..459FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 45A00..45BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 45C00..45DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 45E00..45FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 46000..461FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 46200..463FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 46400..465FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 46600..467FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 46800..469FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 46A00..46BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 46C00..46DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 46E00..46FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 47000..471FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 47200..473FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 47400..475FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 47600..477FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 47800..479FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 47A00..47BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 47C00..47DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 47E00..47FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 48000..481FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 48200..483FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 48400..485FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 48600..487FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 48800..489FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 48A00..48BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 48C00..48DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 48E00..48FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 49000..491FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 49200..493FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 49400..495FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 49600..497FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 49800..499FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 49A00..49BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 49C00..49DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 49E00..49FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 4A000..4A1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 4A200..4A3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 4A400..4A5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 4A600..4A7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 4A800..4A9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 4AA00..4ABFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 4AC00..4ADFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 4AE00..4AFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 4B000..4B1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 4B200..4B3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 4B400..4B5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 4B600..4B7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 4B800..4B9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 4BA00..4BBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 4BC00..4BDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 4BE00..4BFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 4C000..4C1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 4C200..4C3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 4C400..4C5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 4C600..4C7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 4C800..4C9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 4CA00..4CBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 4CC00..4CDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 4CE00..4CFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 4D000..4D1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 4D200..4D3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 4D400..4D5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 4D600..4D7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 4D800..4D9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 4DA00..4DBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 4DC00..4DDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 4DE00..4DFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 4E000..4E1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 4E200..4E3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 4E400..4E5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 4E600..4E7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 4E800..4E9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 4EA00..4EBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 4EC00..4EDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 4EE00..4EFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 4F000..4F1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 4F200..4F3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 4F400..4F5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 4F600..4F7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 4F800..4F9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 4FA00..4FBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 4FC00..4FDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 4FE00..4FFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 50000..501FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 50200..503FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 50400..505FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 50600..507FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 50800..509FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 50A00..50BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 50C00..50DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 50E00..50FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 51000..511FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 51200..513FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 51400..515FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 51600..517FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 51800..519FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 51A00..51BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 51C00..51DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 51E00..51FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 52000..521FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 52200..523FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 52400..525FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 52600..527FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 52800..529FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 52A00..52BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 52C00..52DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 52E00..52FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 53000..531FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 53200..533FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 53400..535FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 53600..537FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 53800..539FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 53A00..53BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 53C00..53DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 53E00..53FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 54000..541FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 54200..543FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 54400..545FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 54600..547FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 54800..549FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 54A00..54BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 54C00..54DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 54E00..54FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 55000..551FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 55200..553FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 55400..555FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 55600..557FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 55800..559FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 55A00..55BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 55C00..55DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 55E00..55FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 56000..561FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 56200..563FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 56400..565FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 56600..567FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 56800..569FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 56A00..56BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 56C00..56DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 56E00..56FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 57000..571FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 57200..573FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 57400..575FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 57600..577FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 57800..579FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 57A00..57BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 57C00..57DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 57E00..57FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 58000..581FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 58200..583FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 58400..585FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 58600..587FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 58800..589FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 58A00..58BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 58C00..58DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 58E00..58FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 59000..591FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 59200..593FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 59400..595FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 59600..597FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 59800..599FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 59A00..59BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 59C00..59DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 59E00..59FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 5A000..5A1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 5A200..5A3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 5A400..5A5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 5A600..5A7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 5A800..5A9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 5AA00..5ABFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 5AC00..5ADFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 5AE00..5AFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 5B000..5B1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 5B200..5B3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 5B400..5B5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 5B600..5B7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 5B800..5B9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 5BA00..5BBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 5BC00..5BDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 5BE00..5BFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 5C000..5C1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 5C200..5C3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 5C400..5C5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 5C600..5C7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 5C800..5C9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 5CA00..5CBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 5CC00..5CDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 5CE00..5CFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 5D000..5D1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 5D200..5D3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 5D400..5D5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 5D600..5D7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 5D800..5D9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 5DA00..5DBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 5DC00..5DDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 5DE00..5DFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 5E000..5E1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 5E200..5E3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 5E400..5E5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 5E600..5E7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 5E800..5E9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 5EA00..5EBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 5EC00..5EDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 5EE00..5EFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 5F000..5F1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 5F200..5F3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 5F400..5F5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 5F600..5F7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 5F800..5F9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 5FA00..5FBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 5FC00..5FDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 5FE00..5FFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 60000..601FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 60200..603FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 60400..605FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 60600..607FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 60800..609FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 60A00..60BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 60C00..60DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 60E00..60FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 61000..611FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 61200..613FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 61400..615FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 61600..617FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 61800..619FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 61A00..61BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 61C00..61DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 61E00..61FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 62000..621FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 62200..623FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 62400..625FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 62600..627FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 62800..629FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 62A00..62BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 62C00..62DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 62E00..62FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 63000..631FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 63200..633FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 63400..635FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 63600..637FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 63800..639FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 63A00..63BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 63C00..63DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 63E00..63FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 64000..641FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 64200..643FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 64400..645FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 64600..647FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 64800..649FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 64A00..64BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 64C00..64DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 64E00..64FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 65000..651FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 65200..653FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 65400..655FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 65600..657FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 65800..659FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 65A00..65BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 65C00..65DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 65E00..65FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 66000..661FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 66200..663FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 66400..665FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 66600..667FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 66800..669FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 66A00..66BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 66C00..66DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 66E00..66FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 67000..671FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 67200..673FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 67400..675FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 67600..677FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 67800..679FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 67A00..67BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 67C00..67DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 67E00..67FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 68000..681FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 68200..683FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 68400..685FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 68600..687FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 68800..689FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 68A00..68BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 68C00..68DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 68E00..68FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 69000..691FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 69200..693FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 69400..695FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 69600..697FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 69800..699FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 69A00..69BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 69C00..69DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 69E00..69FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 6A000..6A1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 6A200..6A3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 6A400..6A5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 6A600..6A7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 6A800..6A9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 6AA00..6ABFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 6AC00..6ADFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 6AE00..6AFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 6B000..6B1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 6B200..6B3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 6B400..6B5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 6B600..6B7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 6B800..6B9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 6BA00..6BBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 6BC00..6BDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 6BE00..6BFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 6C000..6C1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 6C200..6C3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 6C400..6C5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 6C600..6C7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 6C800..6C9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 6CA00..6CBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 6CC00..6CDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 6CE00..6CFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 6D000..6D1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 6D200..6D3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 6D400..6D5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 6D600..6D7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 6D800..6D9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 6DA00..6DBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 6DC00..6DDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 6DE00..6DFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 6E000..6E1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 6E200..6E3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 6E400..6E5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 6E600..6E7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 6E800..6E9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 6EA00..6EBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 6EC00..6EDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 6EE00..6EFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 6F000..6F1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 6F200..6F3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 6F400..6F5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 6F600..6F7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 6F800..6F9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 6FA00..6FBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 6FC00..6FDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 6FE00..6FFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 70000..701FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 70200..703FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 70400..705FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 70600..707FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 70800..709FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 70A00..70BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 70C00..70DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 70E00..70FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 71000..711FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 71200..713FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 71400..715FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 71600..717FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 71800..719FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 71A00..71BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 71C00..71DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 71E00..71FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 72000..721FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 72200..723FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 72400..725FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 72600..727FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 72800..729FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 72A00..72BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 72C00..72DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 72E00..72FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 73000..731FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 73200..733FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 73400..735FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 73600..737FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 73800..739FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 73A00..73BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 73C00..73DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 73E00..73FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 74000..741FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 74200..743FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 74400..745FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 74600..747FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 74800..749FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 74A00..74BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 74C00..74DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 74E00..74FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 75000..751FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 75200..753FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 75400..755FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 75600..757FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 75800..759FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 75A00..75BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 75C00..75DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 75E00..75FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 76000..761FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 76200..763FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 76400..765FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 76600..767FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 76800..769FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 76A00..76BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 76C00..76DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 76E00..76FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 77000..771FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 77200..773FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 77400..775FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 77600..777FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 77800..779FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 77A00..77BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 77C00..77DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 77E00..77FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 78000..781FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 78200..783FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 78400..785FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 78600..787FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 78800..789FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 78A00..78BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 78C00..78DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 78E00..78FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 79000..791FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 79200..793FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 79400..795FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 79600..797FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 79800..799FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 79A00..79BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 79C00..79DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 79E00..79FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 7A000..7A1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 7A200..7A3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 7A400..7A5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 7A600..7A7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 7A800..7A9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 7AA00..7ABFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 7AC00..7ADFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 7AE00..7AFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 7B000..7B1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 7B200..7B3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 7B400..7B5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 7B600..7B7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 7B800..7B9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 7BA00..7BBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 7BC00..7BDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 7BE00..7BFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 7C000..7C1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 7C200..7C3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 7C400..7C5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 7C600..7C7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 7C800..7C9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 7CA00..7CBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 7CC00..7CDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 7CE00..7CFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 7D000..7D1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 7D200..7D3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 7D400..7D5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 7D600..7D7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 7D800..7D9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 7DA00..7DBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 7DC00..7DDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 7DE00..7DFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 7E000..7E1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 7E200..7E3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 7E400..7E5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 7E600..7E7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 7E800..7E9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 7EA00..7EBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 7EC00..7EDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 7EE00..7EFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 7F000..7F1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 7F200..7F3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 7F400..7F5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 7F600..7F7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 7F800..7F9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 7FA00..7FBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 7FC00..7FDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 7FE00..7FFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 80000..801FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 80200..803FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 80400..805FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 80600..807FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 80800..809FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 80A00..80BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 80C00..80DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 80E00..80FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 81000..811FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 81200..813FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 81400..815FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 81600..817FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 81800..819FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 81A00..81BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 81C00..81DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 81E00..81FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 82000..821FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 82200..823FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 82400..825FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 82600..827FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 82800..829FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 82A00..82BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 82C00..82DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 82E00..82FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 83000..831FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 83200..833FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 83400..835FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 83600..837FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 83800..839FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 83A00..83BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 83C00..83DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 83E00..83FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 84000..841FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 84200..843FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 84400..845FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 84600..847FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 84800..849FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 84A00..84BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 84C00..84DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 84E00..84FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 85000..851FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 85200..853FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 85400..855FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 85600..857FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 85800..859FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 85A00..85BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 85C00..85DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 85E00..85FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 86000..861FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 86200..863FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 86400..865FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 86600..867FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 86800..869FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 86A00..86BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 86C00..86DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 86E00..86FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 87000..871FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 87200..873FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 87400..875FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 87600..877FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 87800..879FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 87A00..87BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 87C00..87DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 87E00..87FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 88000..881FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 88200..883FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 88400..885FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 88600..887FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 88800..889FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 88A00..88BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 88C00..88DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 88E00..88FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 89000..891FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 89200..893FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 89400..895FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 89600..897FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 89800..899FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 89A00..89BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 89C00..89DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 89E00..89FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 8A000..8A1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 8A200..8A3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 8A400..8A5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 8A600..8A7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 8A800..8A9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 8AA00..8ABFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 8AC00..8ADFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 8AE00..8AFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 8B000..8B1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 8B200..8B3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 8B400..8B5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 8B600..8B7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 8B800..8B9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 8BA00..8BBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 8BC00..8BDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 8BE00..8BFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 8C000..8C1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 8C200..8C3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 8C400..8C5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 8C600..8C7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 8C800..8C9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 8CA00..8CBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 8CC00..8CDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 8CE00..8CFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 8D000..8D1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 8D200..8D3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 8D400..8D5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 8D600..8D7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 8D800..8D9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 8DA00..8DBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 8DC00..8DDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 8DE00..8DFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 8E000..8E1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 8E200..8E3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 8E400..8E5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 8E600..8E7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 8E800..8E9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 8EA00..8EBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 8EC00..8EDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 8EE00..8EFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 8F000..8F1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 8F200..8F3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 8F400..8F5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 8F600..8F7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 8F800..8F9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 8FA00..8FBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 8FC00..8FDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 8FE00..8FFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 90000..901FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 90200..903FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 90400..905FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 90600..907FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 90800..909FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 90A00..90BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 90C00..90DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 90E00..90FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 91000..911FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 91200..913FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 91400..915FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 91600..917FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 91800..919FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 91A00..91BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 91C00..91DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 91E00..91FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 92000..921FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 92200..923FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 92400..925FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 92600..927FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 92800..929FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 92A00..92BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 92C00..92DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 92E00..92FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 93000..931FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 93200..933FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 93400..935FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 93600..937FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 93800..939FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 93A00..93BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 93C00..93DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 93E00..93FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 94000..941FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 94200..943FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 94400..945FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 94600..947FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 94800..949FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 94A00..94BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 94C00..94DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 94E00..94FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 95000..951FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 95200..953FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 95400..955FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 95600..957FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 95800..959FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 95A00..95BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 95C00..95DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 95E00..95FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 96000..961FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 96200..963FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 96400..965FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 96600..967FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 96800..969FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 96A00..96BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 96C00..96DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 96E00..96FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 97000..971FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 97200..973FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 97400..975FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 97600..977FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 97800..979FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 97A00..97BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 97C00..97DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 97E00..97FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 98000..981FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 98200..983FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 98400..985FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 98600..987FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 98800..989FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 98A00..98BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 98C00..98DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 98E00..98FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 99000..991FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 99200..993FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 99400..995FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 99600..997FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 99800..999FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 99A00..99BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 99C00..99DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 99E00..99FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 9A000..9A1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 9A200..9A3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 9A400..9A5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 9A600..9A7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 9A800..9A9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 9AA00..9ABFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 9AC00..9ADFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 9AE00..9AFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 9B000..9B1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 9B200..9B3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 9B400..9B5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 9B600..9B7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 9B800..9B9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 9BA00..9BBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 9BC00..9BDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 9BE00..9BFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 9C000..9C1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 9C200..9C3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 9C400..9C5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 9C600..9C7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 9C800..9C9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 9CA00..9CBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 9CC00..9CDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 9CE00..9CFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 9D000..9D1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 9D200..9D3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 9D400..9D5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 9D600..9D7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 9D800..9D9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 9DA00..9DBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 9DC00..9DDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 9DE00..9DFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 9E000..9E1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 9E200..9E3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 9E400..9E5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 9E600..9E7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 9E800..9E9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 9EA00..9EBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 9EC00..9EDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 9EE00..9EFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 9F000..9F1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 9F200..9F3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 9F400..9F5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 9F600..9F7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 9F800..9F9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 9FA00..9FBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 9FC00..9FDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 9FE00..9FFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* A0000..A01FF */
+  FriBidiMirroringBlockLevel1_0200,  /* A0200..A03FF */
+  FriBidiMirroringBlockLevel1_0200,  /* A0400..A05FF */
+  FriBidiMirroringBlockLevel1_0200,  /* A0600..A07FF */
+  FriBidiMirroringBlockLevel1_0200,  /* A0800..A09FF */
+  FriBidiMirroringBlockLevel1_0200,  /* A0A00..A0BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* A0C00..A0DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* A0E00..A0FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* A1000..A11FF */
+  FriBidiMirroringBlockLevel1_0200,  /* A1200..A13FF */
+  FriBidiMirroringBlockLevel1_0200,  /* A1400..A15FF */
+  FriBidiMirroringBlockLevel1_0200,  /* A1600..A17FF */
+  FriBidiMirroringBlockLevel1_0200,  /* A1800..A19FF */
+  FriBidiMirroringBlockLevel1_0200,  /* A1A00..A1BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* A1C00..A1DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* A1E00..A1FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* A2000..A21FF */
+  FriBidiMirroringBlockLevel1_0200,  /* A2200..A23FF */
+  FriBidiMirroringBlockLevel1_0200,  /* A2400..A25FF */
+  FriBidiMirroringBlockLevel1_0200,  /* A2600..A27FF */
+  FriBidiMirroringBlockLevel1_0200,  /* A2800..A29FF */
+  FriBidiMirroringBlockLevel1_0200,  /* A2A00..A2BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* A2C00..A2DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* A2E00..A2FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* A3000..A31FF */
+  FriBidiMirroringBlockLevel1_0200,  /* A3200..A33FF */
+  FriBidiMirroringBlockLevel1_0200,  /* A3400..A35FF */
+  FriBidiMirroringBlockLevel1_0200,  /* A3600..A37FF */
+  FriBidiMirroringBlockLevel1_0200,  /* A3800..A39FF */
+  FriBidiMirroringBlockLevel1_0200,  /* A3A00..A3BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* A3C00..A3DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* A3E00..A3FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* A4000..A41FF */
+  FriBidiMirroringBlockLevel1_0200,  /* A4200..A43FF */
+  FriBidiMirroringBlockLevel1_0200,  /* A4400..A45FF */
+  FriBidiMirroringBlockLevel1_0200,  /* A4600..A47FF */
+  FriBidiMirroringBlockLevel1_0200,  /* A4800..A49FF */
+  FriBidiMirroringBlockLevel1_0200,  /* A4A00..A4BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* A4C00..A4DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* A4E00..A4FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* A5000..A51FF */
+  FriBidiMirroringBlockLevel1_0200,  /* A5200..A53FF */
+  FriBidiMirroringBlockLevel1_0200,  /* A5400..A55FF */
+  FriBidiMirroringBlockLevel1_0200,  /* A5600..A57FF */
+  FriBidiMirroringBlockLevel1_0200,  /* A5800..A59FF */
+  FriBidiMirroringBlockLevel1_0200,  /* A5A00..A5BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* A5C00..A5DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* A5E00..A5FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* A6000..A61FF */
+  FriBidiMirroringBlockLevel1_0200,  /* A6200..A63FF */
+  FriBidiMirroringBlockLevel1_0200,  /* A6400..A65FF */
+  FriBidiMirroringBlockLevel1_0200,  /* A6600..A67FF */
+  FriBidiMirroringBlockLevel1_0200,  /* A6800..A69FF */
+  FriBidiMirroringBlockLevel1_0200,  /* A6A00..A6BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* A6C00..A6DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* A6E00..A6FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* A7000..A71FF */
+  FriBidiMirroringBlockLevel1_0200,  /* A7200..A73FF */
+  FriBidiMirroringBlockLevel1_0200,  /* A7400..A75FF */
+  FriBidiMirroringBlockLevel1_0200,  /* A7600..A77FF */
+  FriBidiMirroringBlockLevel1_0200,  /* A7800..A79FF */
+  FriBidiMirroringBlockLevel1_0200,  /* A7A00..A7BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* A7C00..A7DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* A7E00..A7FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* A8000..A81FF */
+  FriBidiMirroringBlockLevel1_0200,  /* A8200..A83FF */
+  FriBidiMirroringBlockLevel1_0200,  /* A8400..A85FF */
+  FriBidiMirroringBlockLevel1_0200,  /* A8600..A87FF */
+  FriBidiMirroringBlockLevel1_0200,  /* A8800..A89FF */
+  FriBidiMirroringBlockLevel1_0200,  /* A8A00..A8BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* A8C00..A8DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* A8E00..A8FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* A9000..A91FF */
+  FriBidiMirroringBlockLevel1_0200,  /* A9200..A93FF */
+  FriBidiMirroringBlockLevel1_0200,  /* A9400..A95FF */
+  FriBidiMirroringBlockLevel1_0200,  /* A9600..A97FF */
+  FriBidiMirroringBlockLevel1_0200,  /* A9800..A99FF */
+  FriBidiMirroringBlockLevel1_0200,  /* A9A00..A9BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* A9C00..A9DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* A9E00..A9FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* AA000..AA1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* AA200..AA3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* AA400..AA5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* AA600..AA7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* AA800..AA9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* AAA00..AABFF */
+  FriBidiMirroringBlockLevel1_0200,  /* AAC00..AADFF */
+  FriBidiMirroringBlockLevel1_0200,  /* AAE00..AAFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* AB000..AB1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* AB200..AB3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* AB400..AB5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* AB600..AB7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* AB800..AB9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* ABA00..ABBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* ABC00..ABDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* ABE00..ABFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* AC000..AC1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* AC200..AC3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* AC400..AC5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* AC600..AC7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* AC800..AC9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* ACA00..ACBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* ACC00..ACDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* ACE00..ACFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* AD000..AD1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* AD200..AD3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* AD400..AD5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* AD600..AD7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* AD800..AD9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* ADA00..ADBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* ADC00..ADDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* ADE00..ADFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* AE000..AE1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* AE200..AE3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* AE400..AE5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* AE600..AE7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* AE800..AE9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* AEA00..AEBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* AEC00..AEDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* AEE00..AEFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* AF000..AF1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* AF200..AF3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* AF400..AF5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* AF600..AF7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* AF800..AF9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* AFA00..AFBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* AFC00..AFDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* AFE00..AFFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* B0000..B01FF */
+  FriBidiMirroringBlockLevel1_0200,  /* B0200..B03FF */
+  FriBidiMirroringBlockLevel1_0200,  /* B0400..B05FF */
+  FriBidiMirroringBlockLevel1_0200,  /* B0600..B07FF */
+  FriBidiMirroringBlockLevel1_0200,  /* B0800..B09FF */
+  FriBidiMirroringBlockLevel1_0200,  /* B0A00..B0BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* B0C00..B0DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* B0E00..B0FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* B1000..B11FF */
+  FriBidiMirroringBlockLevel1_0200,  /* B1200..B13FF */
+  FriBidiMirroringBlockLevel1_0200,  /* B1400..B15FF */
+  FriBidiMirroringBlockLevel1_0200,  /* B1600..B17FF */
+  FriBidiMirroringBlockLevel1_0200,  /* B1800..B19FF */
+  FriBidiMirroringBlockLevel1_0200,  /* B1A00..B1BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* B1C00..B1DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* B1E00..B1FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* B2000..B21FF */
+  FriBidiMirroringBlockLevel1_0200,  /* B2200..B23FF */
+  FriBidiMirroringBlockLevel1_0200,  /* B2400..B25FF */
+  FriBidiMirroringBlockLevel1_0200,  /* B2600..B27FF */
+  FriBidiMirroringBlockLevel1_0200,  /* B2800..B29FF */
+  FriBidiMirroringBlockLevel1_0200,  /* B2A00..B2BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* B2C00..B2DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* B2E00..B2FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* B3000..B31FF */
+  FriBidiMirroringBlockLevel1_0200,  /* B3200..B33FF */
+  FriBidiMirroringBlockLevel1_0200,  /* B3400..B35FF */
+  FriBidiMirroringBlockLevel1_0200,  /* B3600..B37FF */
+  FriBidiMirroringBlockLevel1_0200,  /* B3800..B39FF */
+  FriBidiMirroringBlockLevel1_0200,  /* B3A00..B3BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* B3C00..B3DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* B3E00..B3FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* B4000..B41FF */
+  FriBidiMirroringBlockLevel1_0200,  /* B4200..B43FF */
+  FriBidiMirroringBlockLevel1_0200,  /* B4400..B45FF */
+  FriBidiMirroringBlockLevel1_0200,  /* B4600..B47FF */
+  FriBidiMirroringBlockLevel1_0200,  /* B4800..B49FF */
+  FriBidiMirroringBlockLevel1_0200,  /* B4A00..B4BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* B4C00..B4DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* B4E00..B4FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* B5000..B51FF */
+  FriBidiMirroringBlockLevel1_0200,  /* B5200..B53FF */
+  FriBidiMirroringBlockLevel1_0200,  /* B5400..B55FF */
+  FriBidiMirroringBlockLevel1_0200,  /* B5600..B57FF */
+  FriBidiMirroringBlockLevel1_0200,  /* B5800..B59FF */
+  FriBidiMirroringBlockLevel1_0200,  /* B5A00..B5BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* B5C00..B5DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* B5E00..B5FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* B6000..B61FF */
+  FriBidiMirroringBlockLevel1_0200,  /* B6200..B63FF */
+  FriBidiMirroringBlockLevel1_0200,  /* B6400..B65FF */
+  FriBidiMirroringBlockLevel1_0200,  /* B6600..B67FF */
+  FriBidiMirroringBlockLevel1_0200,  /* B6800..B69FF */
+  FriBidiMirroringBlockLevel1_0200,  /* B6A00..B6BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* B6C00..B6DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* B6E00..B6FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* B7000..B71FF */
+  FriBidiMirroringBlockLevel1_0200,  /* B7200..B73FF */
+  FriBidiMirroringBlockLevel1_0200,  /* B7400..B75FF */
+  FriBidiMirroringBlockLevel1_0200,  /* B7600..B77FF */
+  FriBidiMirroringBlockLevel1_0200,  /* B7800..B79FF */
+  FriBidiMirroringBlockLevel1_0200,  /* B7A00..B7BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* B7C00..B7DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* B7E00..B7FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* B8000..B81FF */
+  FriBidiMirroringBlockLevel1_0200,  /* B8200..B83FF */
+  FriBidiMirroringBlockLevel1_0200,  /* B8400..B85FF */
+  FriBidiMirroringBlockLevel1_0200,  /* B8600..B87FF */
+  FriBidiMirroringBlockLevel1_0200,  /* B8800..B89FF */
+  FriBidiMirroringBlockLevel1_0200,  /* B8A00..B8BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* B8C00..B8DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* B8E00..B8FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* B9000..B91FF */
+  FriBidiMirroringBlockLevel1_0200,  /* B9200..B93FF */
+  FriBidiMirroringBlockLevel1_0200,  /* B9400..B95FF */
+  FriBidiMirroringBlockLevel1_0200,  /* B9600..B97FF */
+  FriBidiMirroringBlockLevel1_0200,  /* B9800..B99FF */
+  FriBidiMirroringBlockLevel1_0200,  /* B9A00..B9BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* B9C00..B9DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* B9E00..B9FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* BA000..BA1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* BA200..BA3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* BA400..BA5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* BA600..BA7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* BA800..BA9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* BAA00..BABFF */
+  FriBidiMirroringBlockLevel1_0200,  /* BAC00..BADFF */
+  FriBidiMirroringBlockLevel1_0200,  /* BAE00..BAFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* BB000..BB1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* BB200..BB3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* BB400..BB5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* BB600..BB7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* BB800..BB9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* BBA00..BBBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* BBC00..BBDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* BBE00..BBFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* BC000..BC1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* BC200..BC3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* BC400..BC5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* BC600..BC7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* BC800..BC9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* BCA00..BCBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* BCC00..BCDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* BCE00..BCFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* BD000..BD1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* BD200..BD3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* BD400..BD5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* BD600..BD7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* BD800..BD9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* BDA00..BDBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* BDC00..BDDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* BDE00..BDFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* BE000..BE1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* BE200..BE3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* BE400..BE5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* BE600..BE7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* BE800..BE9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* BEA00..BEBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* BEC00..BEDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* BEE00..BEFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* BF000..BF1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* BF200..BF3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* BF400..BF5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* BF600..BF7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* BF800..BF9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* BFA00..BFBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* BFC00..BFDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* BFE00..BFFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* C0000..C01FF */
+  FriBidiMirroringBlockLevel1_0200,  /* C0200..C03FF */
+  FriBidiMirroringBlockLevel1_0200,  /* C0400..C05FF */
+  FriBidiMirroringBlockLevel1_0200,  /* C0600..C07FF */
+  FriBidiMirroringBlockLevel1_0200,  /* C0800..C09FF */
+  FriBidiMirroringBlockLevel1_0200,  /* C0A00..C0BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* C0C00..C0DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* C0E00..C0FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* C1000..C11FF */
+  FriBidiMirroringBlockLevel1_0200,  /* C1200..C13FF */
+  FriBidiMirroringBlockLevel1_0200,  /* C1400..C15FF */
+  FriBidiMirroringBlockLevel1_0200,  /* C1600..C17FF */
+  FriBidiMirroringBlockLevel1_0200,  /* C1800..C19FF */
+  FriBidiMirroringBlockLevel1_0200,  /* C1A00..C1BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* C1C00..C1DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* C1E00..C1FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* C2000..C21FF */
+  FriBidiMirroringBlockLevel1_0200,  /* C2200..C23FF */
+  FriBidiMirroringBlockLevel1_0200,  /* C2400..C25FF */
+  FriBidiMirroringBlockLevel1_0200,  /* C2600..C27FF */
+  FriBidiMirroringBlockLevel1_0200,  /* C2800..C29FF */
+  FriBidiMirroringBlockLevel1_0200,  /* C2A00..C2BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* C2C00..C2DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* C2E00..C2FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* C3000..C31FF */
+  FriBidiMirroringBlockLevel1_0200,  /* C3200..C33FF */
+  FriBidiMirroringBlockLevel1_0200,  /* C3400..C35FF */
+  FriBidiMirroringBlockLevel1_0200,  /* C3600..C37FF */
+  FriBidiMirroringBlockLevel1_0200,  /* C3800..C39FF */
+  FriBidiMirroringBlockLevel1_0200,  /* C3A00..C3BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* C3C00..C3DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* C3E00..C3FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* C4000..C41FF */
+  FriBidiMirroringBlockLevel1_0200,  /* C4200..C43FF */
+  FriBidiMirroringBlockLevel1_0200,  /* C4400..C45FF */
+  FriBidiMirroringBlockLevel1_0200,  /* C4600..C47FF */
+  FriBidiMirroringBlockLevel1_0200,  /* C4800..C49FF */
+  FriBidiMirroringBlockLevel1_0200,  /* C4A00..C4BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* C4C00..C4DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* C4E00..C4FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* C5000..C51FF */
+  FriBidiMirroringBlockLevel1_0200,  /* C5200..C53FF */
+  FriBidiMirroringBlockLevel1_0200,  /* C5400..C55FF */
+  FriBidiMirroringBlockLevel1_0200,  /* C5600..C57FF */
+  FriBidiMirroringBlockLevel1_0200,  /* C5800..C59FF */
+  FriBidiMirroringBlockLevel1_0200,  /* C5A00..C5BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* C5C00..C5DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* C5E00..C5FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* C6000..C61FF */
+  FriBidiMirroringBlockLevel1_0200,  /* C6200..C63FF */
+  FriBidiMirroringBlockLevel1_0200,  /* C6400..C65FF */
+  FriBidiMirroringBlockLevel1_0200,  /* C6600..C67FF */
+  FriBidiMirroringBlockLevel1_0200,  /* C6800..C69FF */
+  FriBidiMirroringBlockLevel1_0200,  /* C6A00..C6BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* C6C00..C6DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* C6E00..C6FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* C7000..C71FF */
+  FriBidiMirroringBlockLevel1_0200,  /* C7200..C73FF */
+  FriBidiMirroringBlockLevel1_0200,  /* C7400..C75FF */
+  FriBidiMirroringBlockLevel1_0200,  /* C7600..C77FF */
+  FriBidiMirroringBlockLevel1_0200,  /* C7800..C79FF */
+  FriBidiMirroringBlockLevel1_0200,  /* C7A00..C7BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* C7C00..C7DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* C7E00..C7FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* C8000..C81FF */
+  FriBidiMirroringBlockLevel1_0200,  /* C8200..C83FF */
+  FriBidiMirroringBlockLevel1_0200,  /* C8400..C85FF */
+  FriBidiMirroringBlockLevel1_0200,  /* C8600..C87FF */
+  FriBidiMirroringBlockLevel1_0200,  /* C8800..C89FF */
+  FriBidiMirroringBlockLevel1_0200,  /* C8A00..C8BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* C8C00..C8DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* C8E00..C8FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* C9000..C91FF */
+  FriBidiMirroringBlockLevel1_0200,  /* C9200..C93FF */
+  FriBidiMirroringBlockLevel1_0200,  /* C9400..C95FF */
+  FriBidiMirroringBlockLevel1_0200,  /* C9600..C97FF */
+  FriBidiMirroringBlockLevel1_0200,  /* C9800..C99FF */
+  FriBidiMirroringBlockLevel1_0200,  /* C9A00..C9BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* C9C00..C9DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* C9E00..C9FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* CA000..CA1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* CA200..CA3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* CA400..CA5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* CA600..CA7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* CA800..CA9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* CAA00..CABFF */
+  FriBidiMirroringBlockLevel1_0200,  /* CAC00..CADFF */
+  FriBidiMirroringBlockLevel1_0200,  /* CAE00..CAFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* CB000..CB1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* CB200..CB3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* CB400..CB5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* CB600..CB7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* CB800..CB9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* CBA00..CBBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* CBC00..CBDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* CBE00..CBFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* CC000..CC1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* CC200..CC3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* CC400..CC5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* CC600..CC7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* CC800..CC9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* CCA00..CCBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* CCC00..CCDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* CCE00..CCFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* CD000..CD1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* CD200..CD3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* CD400..CD5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* CD600..CD7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* CD800..CD9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* CDA00..CDBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* CDC00..CDDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* CDE00..CDFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* CE000..CE1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* CE200..CE3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* CE400..CE5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* CE600..CE7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* CE800..CE9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* CEA00..CEBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* CEC00..CEDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* CEE00..CEFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* CF000..CF1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* CF200..CF3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* CF400..CF5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* CF600..CF7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* CF800..CF9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* CFA00..CFBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* CFC00..CFDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* CFE00..CFFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* D0000..D01FF */
+  FriBidiMirroringBlockLevel1_0200,  /* D0200..D03FF */
+  FriBidiMirroringBlockLevel1_0200,  /* D0400..D05FF */
+  FriBidiMirroringBlockLevel1_0200,  /* D0600..D07FF */
+  FriBidiMirroringBlockLevel1_0200,  /* D0800..D09FF */
+  FriBidiMirroringBlockLevel1_0200,  /* D0A00..D0BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* D0C00..D0DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* D0E00..D0FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* D1000..D11FF */
+  FriBidiMirroringBlockLevel1_0200,  /* D1200..D13FF */
+  FriBidiMirroringBlockLevel1_0200,  /* D1400..D15FF */
+  FriBidiMirroringBlockLevel1_0200,  /* D1600..D17FF */
+  FriBidiMirroringBlockLevel1_0200,  /* D1800..D19FF */
+  FriBidiMirroringBlockLevel1_0200,  /* D1A00..D1BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* D1C00..D1DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* D1E00..D1FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* D2000..D21FF */
+  FriBidiMirroringBlockLevel1_0200,  /* D2200..D23FF */
+  FriBidiMirroringBlockLevel1_0200,  /* D2400..D25FF */
+  FriBidiMirroringBlockLevel1_0200,  /* D2600..D27FF */
+  FriBidiMirroringBlockLevel1_0200,  /* D2800..D29FF */
+  FriBidiMirroringBlockLevel1_0200,  /* D2A00..D2BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* D2C00..D2DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* D2E00..D2FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* D3000..D31FF */
+  FriBidiMirroringBlockLevel1_0200,  /* D3200..D33FF */
+  FriBidiMirroringBlockLevel1_0200,  /* D3400..D35FF */
+  FriBidiMirroringBlockLevel1_0200,  /* D3600..D37FF */
+  FriBidiMirroringBlockLevel1_0200,  /* D3800..D39FF */
+  FriBidiMirroringBlockLevel1_0200,  /* D3A00..D3BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* D3C00..D3DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* D3E00..D3FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* D4000..D41FF */
+  FriBidiMirroringBlockLevel1_0200,  /* D4200..D43FF */
+  FriBidiMirroringBlockLevel1_0200,  /* D4400..D45FF */
+  FriBidiMirroringBlockLevel1_0200,  /* D4600..D47FF */
+  FriBidiMirroringBlockLevel1_0200,  /* D4800..D49FF */
+  FriBidiMirroringBlockLevel1_0200,  /* D4A00..D4BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* D4C00..D4DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* D4E00..D4FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* D5000..D51FF */
+  FriBidiMirroringBlockLevel1_0200,  /* D5200..D53FF */
+  FriBidiMirroringBlockLevel1_0200,  /* D5400..D55FF */
+  FriBidiMirroringBlockLevel1_0200,  /* D5600..D57FF */
+  FriBidiMirroringBlockLevel1_0200,  /* D5800..D59FF */
+  FriBidiMirroringBlockLevel1_0200,  /* D5A00..D5BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* D5C00..D5DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* D5E00..D5FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* D6000..D61FF */
+  FriBidiMirroringBlockLevel1_0200,  /* D6200..D63FF */
+  FriBidiMirroringBlockLevel1_0200,  /* D6400..D65FF */
+  FriBidiMirroringBlockLevel1_0200,  /* D6600..D67FF */
+  FriBidiMirroringBlockLevel1_0200,  /* D6800..D69FF */
+  FriBidiMirroringBlockLevel1_0200,  /* D6A00..D6BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* D6C00..D6DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* D6E00..D6FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* D7000..D71FF */
+  FriBidiMirroringBlockLevel1_0200,  /* D7200..D73FF */
+  FriBidiMirroringBlockLevel1_0200,  /* D7400..D75FF */
+  FriBidiMirroringBlockLevel1_0200,  /* D7600..D77FF */
+  FriBidiMirroringBlockLevel1_0200,  /* D7800..D79FF */
+  FriBidiMirroringBlockLevel1_0200,  /* D7A00..D7BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* D7C00..D7DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* D7E00..D7FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* D8000..D81FF */
+  FriBidiMirroringBlockLevel1_0200,  /* D8200..D83FF */
+  FriBidiMirroringBlockLevel1_0200,  /* D8400..D85FF */
+  FriBidiMirroringBlockLevel1_0200,  /* D8600..D87FF */
+  FriBidiMirroringBlockLevel1_0200,  /* D8800..D89FF */
+  FriBidiMirroringBlockLevel1_0200,  /* D8A00..D8BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* D8C00..D8DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* D8E00..D8FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* D9000..D91FF */
+  FriBidiMirroringBlockLevel1_0200,  /* D9200..D93FF */
+  FriBidiMirroringBlockLevel1_0200,  /* D9400..D95FF */
+  FriBidiMirroringBlockLevel1_0200,  /* D9600..D97FF */
+  FriBidiMirroringBlockLevel1_0200,  /* D9800..D99FF */
+  FriBidiMirroringBlockLevel1_0200,  /* D9A00..D9BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* D9C00..D9DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* D9E00..D9FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* DA000..DA1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* DA200..DA3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* DA400..DA5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* DA600..DA7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* DA800..DA9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* DAA00..DABFF */
+  FriBidiMirroringBlockLevel1_0200,  /* DAC00..DADFF */
+  FriBidiMirroringBlockLevel1_0200,  /* DAE00..DAFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* DB000..DB1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* DB200..DB3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* DB400..DB5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* DB600..DB7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* DB800..DB9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* DBA00..DBBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* DBC00..DBDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* DBE00..DBFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* DC000..DC1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* DC200..DC3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* DC400..DC5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* DC600..DC7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* DC800..DC9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* DCA00..DCBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* DCC00..DCDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* DCE00..DCFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* DD000..DD1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* DD200..DD3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* DD400..DD5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* DD600..DD7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* DD800..DD9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* DDA00..DDBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* DDC00..DDDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* DDE00..DDFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* DE000..DE1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* DE200..DE3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* DE400..DE5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* DE600..DE7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* DE800..DE9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* DEA00..DEBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* DEC00..DEDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* DEE00..DEFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* DF000..DF1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* DF200..DF3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* DF400..DF5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* DF600..DF7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* DF800..DF9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* DFA00..DFBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* DFC00..DFDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* DFE00..DFFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* E0000..E01FF */
+  FriBidiMirroringBlockLevel1_0200,  /* E0200..E03FF */
+  FriBidiMirroringBlockLevel1_0200,  /* E0400..E05FF */
+  FriBidiMirroringBlockLevel1_0200,  /* E0600..E07FF */
+  FriBidiMirroringBlockLevel1_0200,  /* E0800..E09FF */
+  FriBidiMirroringBlockLevel1_0200,  /* E0A00..E0BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* E0C00..E0DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* E0E00..E0FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* E1000..E11FF */
+  FriBidiMirroringBlockLevel1_0200,  /* E1200..E13FF */
+  FriBidiMirroringBlockLevel1_0200,  /* E1400..E15FF */
+  FriBidiMirroringBlockLevel1_0200,  /* E1600..E17FF */
+  FriBidiMirroringBlockLevel1_0200,  /* E1800..E19FF */
+  FriBidiMirroringBlockLevel1_0200,  /* E1A00..E1BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* E1C00..E1DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* E1E00..E1FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* E2000..E21FF */
+  FriBidiMirroringBlockLevel1_0200,  /* E2200..E23FF */
+  FriBidiMirroringBlockLevel1_0200,  /* E2400..E25FF */
+  FriBidiMirroringBlockLevel1_0200,  /* E2600..E27FF */
+  FriBidiMirroringBlockLevel1_0200,  /* E2800..E29FF */
+  FriBidiMirroringBlockLevel1_0200,  /* E2A00..E2BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* E2C00..E2DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* E2E00..E2FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* E3000..E31FF */
+  FriBidiMirroringBlockLevel1_0200,  /* E3200..E33FF */
+  FriBidiMirroringBlockLevel1_0200,  /* E3400..E35FF */
+  FriBidiMirroringBlockLevel1_0200,  /* E3600..E37FF */
+  FriBidiMirroringBlockLevel1_0200,  /* E3800..E39FF */
+  FriBidiMirroringBlockLevel1_0200,  /* E3A00..E3BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* E3C00..E3DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* E3E00..E3FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* E4000..E41FF */
+  FriBidiMirroringBlockLevel1_0200,  /* E4200..E43FF */
+  FriBidiMirroringBlockLevel1_0200,  /* E4400..E45FF */
+  FriBidiMirroringBlockLevel1_0200,  /* E4600..E47FF */
+  FriBidiMirroringBlockLevel1_0200,  /* E4800..E49FF */
+  FriBidiMirroringBlockLevel1_0200,  /* E4A00..E4BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* E4C00..E4DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* E4E00..E4FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* E5000..E51FF */
+  FriBidiMirroringBlockLevel1_0200,  /* E5200..E53FF */
+  FriBidiMirroringBlockLevel1_0200,  /* E5400..E55FF */
+  FriBidiMirroringBlockLevel1_0200,  /* E5600..E57FF */
+  FriBidiMirroringBlockLevel1_0200,  /* E5800..E59FF */
+  FriBidiMirroringBlockLevel1_0200,  /* E5A00..E5BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* E5C00..E5DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* E5E00..E5FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* E6000..E61FF */
+  FriBidiMirroringBlockLevel1_0200,  /* E6200..E63FF */
+  FriBidiMirroringBlockLevel1_0200,  /* E6400..E65FF */
+  FriBidiMirroringBlockLevel1_0200,  /* E6600..E67FF */
+  FriBidiMirroringBlockLevel1_0200,  /* E6800..E69FF */
+  FriBidiMirroringBlockLevel1_0200,  /* E6A00..E6BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* E6C00..E6DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* E6E00..E6FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* E7000..E71FF */
+  FriBidiMirroringBlockLevel1_0200,  /* E7200..E73FF */
+  FriBidiMirroringBlockLevel1_0200,  /* E7400..E75FF */
+  FriBidiMirroringBlockLevel1_0200,  /* E7600..E77FF */
+  FriBidiMirroringBlockLevel1_0200,  /* E7800..E79FF */
+  FriBidiMirroringBlockLevel1_0200,  /* E7A00..E7BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* E7C00..E7DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* E7E00..E7FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* E8000..E81FF */
+  FriBidiMirroringBlockLevel1_0200,  /* E8200..E83FF */
+  FriBidiMirroringBlockLevel1_0200,  /* E8400..E85FF */
+  FriBidiMirroringBlockLevel1_0200,  /* E8600..E87FF */
+  FriBidiMirroringBlockLevel1_0200,  /* E8800..E89FF */
+  FriBidiMirroringBlockLevel1_0200,  /* E8A00..E8BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* E8C00..E8DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* E8E00..E8FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* E9000..E91FF */
+  FriBidiMirroringBlockLevel1_0200,  /* E9200..E93FF */
+  FriBidiMirroringBlockLevel1_0200,  /* E9400..E95FF */
+  FriBidiMirroringBlockLevel1_0200,  /* E9600..E97FF */
+  FriBidiMirroringBlockLevel1_0200,  /* E9800..E99FF */
+  FriBidiMirroringBlockLevel1_0200,  /* E9A00..E9BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* E9C00..E9DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* E9E00..E9FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* EA000..EA1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* EA200..EA3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* EA400..EA5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* EA600..EA7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* EA800..EA9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* EAA00..EABFF */
+  FriBidiMirroringBlockLevel1_0200,  /* EAC00..EADFF */
+  FriBidiMirroringBlockLevel1_0200,  /* EAE00..EAFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* EB000..EB1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* EB200..EB3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* EB400..EB5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* EB600..EB7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* EB800..EB9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* EBA00..EBBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* EBC00..EBDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* EBE00..EBFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* EC000..EC1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* EC200..EC3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* EC400..EC5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* EC600..EC7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* EC800..EC9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* ECA00..ECBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* ECC00..ECDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* ECE00..ECFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* ED000..ED1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* ED200..ED3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* ED400..ED5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* ED600..ED7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* ED800..ED9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* EDA00..EDBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* EDC00..EDDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* EDE00..EDFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* EE000..EE1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* EE200..EE3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* EE400..EE5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* EE600..EE7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* EE800..EE9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* EEA00..EEBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* EEC00..EEDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* EEE00..EEFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* EF000..EF1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* EF200..EF3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* EF400..EF5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* EF600..EF7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* EF800..EF9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* EFA00..EFBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* EFC00..EFDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* EFE00..EFFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* F0000..F01FF */
+  FriBidiMirroringBlockLevel1_0200,  /* F0200..F03FF */
+  FriBidiMirroringBlockLevel1_0200,  /* F0400..F05FF */
+  FriBidiMirroringBlockLevel1_0200,  /* F0600..F07FF */
+  FriBidiMirroringBlockLevel1_0200,  /* F0800..F09FF */
+  FriBidiMirroringBlockLevel1_0200,  /* F0A00..F0BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* F0C00..F0DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* F0E00..F0FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* F1000..F11FF */
+  FriBidiMirroringBlockLevel1_0200,  /* F1200..F13FF */
+  FriBidiMirroringBlockLevel1_0200,  /* F1400..F15FF */
+  FriBidiMirroringBlockLevel1_0200,  /* F1600..F17FF */
+  FriBidiMirroringBlockLevel1_0200,  /* F1800..F19FF */
+  FriBidiMirroringBlockLevel1_0200,  /* F1A00..F1BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* F1C00..F1DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* F1E00..F1FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* F2000..F21FF */
+  FriBidiMirroringBlockLevel1_0200,  /* F2200..F23FF */
+  FriBidiMirroringBlockLevel1_0200,  /* F2400..F25FF */
+  FriBidiMirroringBlockLevel1_0200,  /* F2600..F27FF */
+  FriBidiMirroringBlockLevel1_0200,  /* F2800..F29FF */
+  FriBidiMirroringBlockLevel1_0200,  /* F2A00..F2BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* F2C00..F2DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* F2E00..F2FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* F3000..F31FF */
+  FriBidiMirroringBlockLevel1_0200,  /* F3200..F33FF */
+  FriBidiMirroringBlockLevel1_0200,  /* F3400..F35FF */
+  FriBidiMirroringBlockLevel1_0200,  /* F3600..F37FF */
+  FriBidiMirroringBlockLevel1_0200,  /* F3800..F39FF */
+  FriBidiMirroringBlockLevel1_0200,  /* F3A00..F3BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* F3C00..F3DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* F3E00..F3FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* F4000..F41FF */
+  FriBidiMirroringBlockLevel1_0200,  /* F4200..F43FF */
+  FriBidiMirroringBlockLevel1_0200,  /* F4400..F45FF */
+  FriBidiMirroringBlockLevel1_0200,  /* F4600..F47FF */
+  FriBidiMirroringBlockLevel1_0200,  /* F4800..F49FF */
+  FriBidiMirroringBlockLevel1_0200,  /* F4A00..F4BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* F4C00..F4DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* F4E00..F4FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* F5000..F51FF */
+  FriBidiMirroringBlockLevel1_0200,  /* F5200..F53FF */
+  FriBidiMirroringBlockLevel1_0200,  /* F5400..F55FF */
+  FriBidiMirroringBlockLevel1_0200,  /* F5600..F57FF */
+  FriBidiMirroringBlockLevel1_0200,  /* F5800..F59FF */
+  FriBidiMirroringBlockLevel1_0200,  /* F5A00..F5BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* F5C00..F5DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* F5E00..F5FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* F6000..F61FF */
+  FriBidiMirroringBlockLevel1_0200,  /* F6200..F63FF */
+  FriBidiMirroringBlockLevel1_0200,  /* F6400..F65FF */
+  FriBidiMirroringBlockLevel1_0200,  /* F6600..F67FF */
+  FriBidiMirroringBlockLevel1_0200,  /* F6800..F69FF */
+  FriBidiMirroringBlockLevel1_0200,  /* F6A00..F6BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* F6C00..F6DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* F6E00..F6FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* F7000..F71FF */
+  FriBidiMirroringBlockLevel1_0200,  /* F7200..F73FF */
+  FriBidiMirroringBlockLevel1_0200,  /* F7400..F75FF */
+  FriBidiMirroringBlockLevel1_0200,  /* F7600..F77FF */
+  FriBidiMirroringBlockLevel1_0200,  /* F7800..F79FF */
+  FriBidiMirroringBlockLevel1_0200,  /* F7A00..F7BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* F7C00..F7DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* F7E00..F7FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* F8000..F81FF */
+  FriBidiMirroringBlockLevel1_0200,  /* F8200..F83FF */
+  FriBidiMirroringBlockLevel1_0200,  /* F8400..F85FF */
+  FriBidiMirroringBlockLevel1_0200,  /* F8600..F87FF */
+  FriBidiMirroringBlockLevel1_0200,  /* F8800..F89FF */
+  FriBidiMirroringBlockLevel1_0200,  /* F8A00..F8BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* F8C00..F8DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* F8E00..F8FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* F9000..F91FF */
+  FriBidiMirroringBlockLevel1_0200,  /* F9200..F93FF */
+  FriBidiMirroringBlockLevel1_0200,  /* F9400..F95FF */
+  FriBidiMirroringBlockLevel1_0200,  /* F9600..F97FF */
+  FriBidiMirroringBlockLevel1_0200,  /* F9800..F99FF */
+  FriBidiMirroringBlockLevel1_0200,  /* F9A00..F9BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* F9C00..F9DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* F9E00..F9FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* FA000..FA1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* FA200..FA3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* FA400..FA5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* FA600..FA7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* FA800..FA9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* FAA00..FABFF */
+  FriBidiMirroringBlockLevel1_0200,  /* FAC00..FADFF */
+  FriBidiMirroringBlockLevel1_0200,  /* FAE00..FAFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* FB000..FB1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* FB200..FB3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* FB400..FB5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* FB600..FB7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* FB800..FB9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* FBA00..FBBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* FBC00..FBDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* FBE00..FBFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* FC000..FC1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* FC200..FC3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* FC400..FC5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* FC600..FC7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* FC800..FC9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* FCA00..FCBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* FCC00..FCDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* FCE00..FCFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* FD000..FD1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* FD200..FD3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* FD400..FD5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* FD600..FD7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* FD800..FD9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* FDA00..FDBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* FDC00..FDDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* FDE00..FDFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* FE000..FE1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* FE200..FE3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* FE400..FE5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* FE600..FE7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* FE800..FE9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* FEA00..FEBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* FEC00..FEDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* FEE00..FEFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* FF000..FF1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* FF200..FF3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* FF400..FF5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* FF600..FF7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* FF800..FF9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* FFA00..FFBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* FFC00..FFDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* FFE00..FFFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 100000..1001FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 100200..1003FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 100400..1005FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 100600..1007FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 100800..1009FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 100A00..100BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 100C00..100DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 100E00..100FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 101000..1011FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 101200..1013FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 101400..1015FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 101600..1017FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 101800..1019FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 101A00..101BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 101C00..101DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 101E00..101FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 102000..1021FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 102200..1023FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 102400..1025FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 102600..1027FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 102800..1029FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 102A00..102BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 102C00..102DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 102E00..102FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 103000..1031FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 103200..1033FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 103400..1035FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 103600..1037FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 103800..1039FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 103A00..103BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 103C00..103DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 103E00..103FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 104000..1041FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 104200..1043FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 104400..1045FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 104600..1047FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 104800..1049FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 104A00..104BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 104C00..104DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 104E00..104FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 105000..1051FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 105200..1053FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 105400..1055FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 105600..1057FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 105800..1059FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 105A00..105BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 105C00..105DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 105E00..105FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 106000..1061FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 106200..1063FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 106400..1065FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 106600..1067FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 106800..1069FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 106A00..106BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 106C00..106DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 106E00..106FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 107000..1071FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 107200..1073FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 107400..1075FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 107600..1077FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 107800..1079FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 107A00..107BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 107C00..107DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 107E00..107FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 108000..1081FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 108200..1083FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 108400..1085FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 108600..1087FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 108800..1089FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 108A00..108BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 108C00..108DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 108E00..108FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 109000..1091FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 109200..1093FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 109400..1095FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 109600..1097FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 109800..1099FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 109A00..109BFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 109C00..109DFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 109E00..109FFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 10A000..10A1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 10A200..10A3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 10A400..10A5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 10A600..10A7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 10A800..10A9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 10AA00..10ABFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 10AC00..10ADFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 10AE00..10AFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 10B000..10B1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 10B200..10B3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 10B400..10B5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 10B600..10B7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 10B800..10B9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 10BA00..10BBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 10BC00..10BDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 10BE00..10BFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 10C000..10C1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 10C200..10C3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 10C400..10C5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 10C600..10C7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 10C800..10C9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 10CA00..10CBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 10CC00..10CDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 10CE00..10CFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 10D000..10D1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 10D200..10D3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 10D400..10D5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 10D600..10D7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 10D800..10D9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 10DA00..10DBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 10DC00..10DDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 10DE00..10DFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 10E000..10E1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 10E200..10E3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 10E400..10E5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 10E600..10E7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 10E800..10E9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 10EA00..10EBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 10EC00..10EDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 10EE00..10EFFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 10F000..10F1FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 10F200..10F3FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 10F400..10F5FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 10F600..10F7FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 10F800..10F9FF */
+  FriBidiMirroringBlockLevel1_0200,  /* 10FA00..10FBFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 10FC00..10FDFF */
+  FriBidiMirroringBlockLevel1_0200,  /* 10FE00..10FFFF */
+};
+
+/* *INDENT-ON* */
+
+#define FRIBIDI_GET_MIRRORING_DELTA(x)	\
+	FriBidiMirroringBlockLevel1[(x)%512 +	\
+	FriBidiMirroringBlockLevel0[(x)/512]]
+
+/*
+  One bit for each block of 256 characters, set if any character in
+  the block has a mirror.  Used to skip most characters without
+  looking them up.
+*/
+
+#define FRIBIDI_MIRRORING_MAX_CHAR 0xFF63
+
+static const fribidi_uint32 FriBidiMirroringBlockMask[8] = {
+  0x00000001, 0x0001068D, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x80000000,
+};
+
+#define FRIBIDI_MAY_HAVE_MIRROR(x)	\
+	((x) <= FRIBIDI_MIRRORING_MAX_CHAR &&	\
+	 (FriBidiMirroringBlockMask[(x) >> 13] >> ((x) >> 8 & 31) & 1))
 
 #endif /* FRIBIDI_TAB_MIRRORING_I */
@@ -0,0 +1,6112 @@
+/*
+  This file was automatically created from UnicodeData.txt and
+  BidiMirroring.txt version 3.2.0, and fribidi_wcwidth.c
+  by fribidi_create_char_types
+*/
+
+#ifndef FRIBIDI_TAB_PROPS_I
+#define FRIBIDI_TAB_PROPS_I
+
+#include "fribidi.h"
+
+#define PACKTAB_UINT8 fribidi_uint8
+#define PACKTAB_UINT16 fribidi_uint16
+#define PACKTAB_UINT32 fribidi_uint32
+/*
+  Automatically generated by packtab.c version 2
+
+  just use FRIBIDI_GET_PROPS(key)
+
+  assumed sizeof(FriBidiProps) == 2
+  required memory: 33280
+  lookups: 2
+  partition shape: FriBidiPropsBlock[4352][256]
+  different table entries: 1 48
+*/
+
+/* *INDENT-OFF* */
+
+static const FriBidiProps FriBidiPropsBlockLevel1[256*48] = {
+
+#define FriBidiPropsBlockLevel1_0000 0x0
+
+    78,  14,  14,  14,  14,  14,  14,  14,
+    14,  16,  15,  16,  17,  15,  14,  14,
+    14,  14,  14,  14,  14,  14,  14,  14,
+    14,  14,  14,  14,  15,  15,  15,  16,
+   145, 146, 146, 139, 139, 139, 146, 146,
+   178, 178, 146, 139, 140, 139, 140, 138,
+   136, 136, 136, 136, 136, 136, 136, 136,
+   136, 136, 140, 146, 178, 146, 178, 146,
+   146, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 178, 146, 178, 146, 146,
+   146, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 178, 146, 178, 146,  14,
+    14,  14,  14,  14,  14,  15,  14,  14,
+    14,  14,  14,  14,  14,  14,  14,  14,
+    14,  14,  14,  14,  14,  14,  14,  14,
+    14,  14,  14,  14,  14,  14,  14,  14,
+   140, 274, 139, 139, 267, 139, 146, 274,
+   274, 146, 256, 178, 146, 274, 274, 146,
+   267, 267, 264, 264, 274, 128, 274, 274,
+   274, 264, 256, 178, 274, 274, 274, 274,
+   128, 128, 128, 128, 128, 128, 256, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   256, 128, 128, 128, 128, 128, 128, 274,
+   256, 128, 128, 128, 128, 128, 256, 256,
+   256, 256, 128, 128, 128, 128, 256, 128,
+   256, 256, 256, 128, 256, 256, 128, 128,
+   256, 128, 256, 256, 128, 128, 128, 274,
+   256, 256, 256, 128, 256, 128, 256, 128,
+
+#define FriBidiPropsBlockLevel1_0100 0x100
+
+   128, 256, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 256, 128, 256, 128, 128, 128, 128,
+   128, 128, 128, 256, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 256, 256,
+   128, 128, 128, 256, 128, 128, 128, 128,
+   128, 256, 256, 256, 128, 128, 128, 128,
+   256, 128, 128, 128, 128, 128, 128, 256,
+   256, 256, 256, 128, 256, 128, 128, 128,
+   256, 256, 256, 256, 128, 256, 128, 128,
+   128, 128, 256, 256, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 256, 256,
+   128, 128, 128, 256, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 256, 128,
+   256, 128, 256, 128, 256, 128, 256, 128,
+   256, 128, 256, 128, 256, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+
+#define FriBidiPropsBlockLevel1_0200 0x200
+
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 256, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 256, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 146, 146, 128, 128, 128, 128, 128,
+   128, 128, 146, 146, 274, 146, 146, 274,
+   146, 274, 274, 274, 146, 274, 146, 146,
+   256, 128, 146, 146, 146, 146, 146, 146,
+   274, 274, 274, 274, 146, 274, 146, 274,
+   128, 128, 128, 128, 128, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+
+#define FriBidiPropsBlockLevel1_0300 0x300
+
+   589, 589, 589, 589, 589, 589, 589, 589,
+   589, 589, 589, 589, 589, 589, 589, 589,
+   589, 589, 589, 589, 589, 589, 589, 589,
+   589, 589, 589, 589, 589, 589, 589, 589,
+   589, 589, 589, 589, 589, 589, 589, 589,
+   589, 589, 589, 589, 589, 589, 589, 589,
+   589, 589, 589, 589, 589, 589, 589, 589,
+   589, 589, 589, 589, 589, 589, 589, 589,
+   589, 589, 589, 589, 589, 589, 589, 589,
+   589, 589, 589, 589, 589, 589, 589, 589,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   589, 589, 589, 589, 589, 589, 589, 589,
+   589, 589, 589, 589, 589, 589, 589, 589,
+   128, 128, 128, 128, 146, 146, 128, 128,
+   128, 128, 128, 128, 128, 128, 146, 128,
+   128, 128, 128, 128, 146, 146, 128, 146,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 256, 256, 256, 256, 256, 256, 256,
+   256, 256, 256, 256, 256, 256, 256, 256,
+   256, 256, 128, 256, 256, 256, 256, 256,
+   256, 256, 128, 128, 128, 128, 128, 128,
+   128, 256, 256, 256, 256, 256, 256, 256,
+   256, 256, 256, 256, 256, 256, 256, 256,
+   256, 256, 128, 256, 256, 256, 256, 256,
+   256, 256, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 146, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+
+#define FriBidiPropsBlockLevel1_0400 0x400
+
+   128, 256, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   256, 256, 256, 256, 256, 256, 256, 256,
+   256, 256, 256, 256, 256, 256, 256, 256,
+   256, 256, 256, 256, 256, 256, 256, 256,
+   256, 256, 256, 256, 256, 256, 256, 256,
+   256, 256, 256, 256, 256, 256, 256, 256,
+   256, 256, 256, 256, 256, 256, 256, 256,
+   256, 256, 256, 256, 256, 256, 256, 256,
+   256, 256, 256, 256, 256, 256, 256, 256,
+   128, 256, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 589, 589, 589, 589, 128,
+   589, 589, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+
+#define FriBidiPropsBlockLevel1_0500 0x500
+
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 146, 128, 128, 128, 128, 128,
+   129, 589, 589, 589, 589, 589, 589, 589,
+   589, 589, 589, 589, 589, 589, 589, 589,
+   589, 589, 129, 589, 589, 589, 589, 589,
+   589, 589, 589, 589, 589, 589, 589, 589,
+   589, 589, 589, 589, 589, 589, 589, 589,
+   589, 589, 129, 589, 589, 589, 129, 589,
+   129, 589, 589, 129, 589, 129, 129, 129,
+   129, 129, 129, 129, 129, 129, 129, 129,
+   129, 129, 129, 129, 129, 129, 129, 129,
+   129, 129, 129, 129, 129, 129, 129, 129,
+   129, 129, 129, 129, 129, 129, 129, 129,
+   129, 129, 129, 129, 129, 129, 129, 129,
+   129, 129, 129, 129, 129, 129, 129, 129,
+   129, 129, 129, 129, 129, 129, 129, 129,
+
+#define FriBidiPropsBlockLevel1_0600 0x600
+
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 140, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 589, 589, 589, 589, 589,
+   589, 589, 589, 589, 589, 589, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   137, 137, 137, 137, 137, 137, 137, 137,
+   137, 137, 139, 137, 137, 130, 130, 130,
+   589, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 589, 589,
+   589, 589, 589, 589, 589,  66, 589, 589,
+   589, 589, 589, 589, 589, 130, 130, 589,
+   589, 146, 589, 589, 589, 589, 130, 130,
+   136, 136, 136, 136, 136, 136, 136, 136,
+   136, 136, 130, 130, 130, 130, 130, 130,
+
+#define FriBidiPropsBlockLevel1_0700 0x700
+
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130,  78,
+   130, 589, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   589, 589, 589, 589, 589, 589, 589, 589,
+   589, 589, 589, 589, 589, 589, 589, 589,
+   589, 589, 589, 589, 589, 589, 589, 589,
+   589, 589, 589, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 589, 589,
+   589, 589, 589, 589, 589, 589, 589, 589,
+   589, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+
+#define FriBidiPropsBlockLevel1_0800 0x800
+
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+
+#define FriBidiPropsBlockLevel1_0900 0x900
+
+   128, 589, 589, 640, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 589, 128, 640, 640,
+   640, 589, 589, 589, 589, 589, 589, 589,
+   589, 640, 640, 640, 640, 589, 128, 128,
+   128, 589, 589, 589, 589, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 589, 589, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 589, 640, 640, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 589, 128, 640, 640,
+   640, 589, 589, 589, 589, 128, 128, 640,
+   640, 128, 128, 640, 640, 589, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 640,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 589, 589, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 139, 139, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+
+#define FriBidiPropsBlockLevel1_0A00 0xA00
+
+   128, 128, 589, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 589, 128, 640, 640,
+   640, 589, 589, 128, 128, 128, 128, 589,
+   589, 128, 128, 589, 589, 589, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   589, 589, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 589, 589, 640, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 589, 128, 640, 640,
+   640, 589, 589, 589, 589, 589, 128, 589,
+   589, 640, 128, 640, 640, 589, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+
+#define FriBidiPropsBlockLevel1_0B00 0xB00
+
+   128, 589, 640, 640, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 589, 128, 640, 589,
+   640, 589, 589, 589, 128, 128, 128, 640,
+   640, 128, 128, 640, 640, 589, 128, 128,
+   128, 128, 128, 128, 128, 128, 589, 640,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 589, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 640, 640,
+   589, 640, 640, 128, 128, 128, 640, 640,
+   640, 128, 640, 640, 640, 589, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 640,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+
+#define FriBidiPropsBlockLevel1_0C00 0xC00
+
+   128, 640, 640, 640, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 589, 589,
+   589, 640, 640, 640, 640, 128, 589, 589,
+   589, 128, 589, 589, 589, 589, 128, 128,
+   128, 128, 128, 128, 128, 589, 589, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 640, 640, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 640, 589,
+   640, 640, 640, 640, 640, 128, 589, 640,
+   640, 128, 640, 640, 589, 589, 128, 128,
+   128, 128, 128, 128, 128, 640, 640, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+
+#define FriBidiPropsBlockLevel1_0D00 0xD00
+
+   128, 128, 640, 640, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 640, 640,
+   640, 589, 589, 589, 128, 128, 640, 640,
+   640, 128, 640, 640, 640, 589, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 640,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 640, 640, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 589, 128, 128, 128, 128, 640,
+   640, 640, 589, 589, 589, 128, 589, 128,
+   640, 640, 640, 640, 640, 640, 640, 640,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 640, 640, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+
+#define FriBidiPropsBlockLevel1_0E00 0xE00
+
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 589, 128, 128, 589, 589, 589, 589,
+   589, 589, 589, 128, 128, 128, 128, 139,
+   128, 128, 128, 128, 128, 128, 128, 589,
+   589, 589, 589, 589, 589, 589, 589, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 589, 128, 128, 589, 589, 589, 589,
+   589, 589, 128, 589, 589, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   589, 589, 589, 589, 589, 589, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+
+#define FriBidiPropsBlockLevel1_0F00 0xF00
+
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   589, 589, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 589, 128, 589,
+   128, 589, 146, 146, 146, 146, 640, 640,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 589, 589, 589, 589, 589, 589, 589,
+   589, 589, 589, 589, 589, 589, 589, 640,
+   589, 589, 589, 589, 589, 128, 589, 589,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   589, 589, 589, 589, 589, 589, 589, 589,
+   128, 589, 589, 589, 589, 589, 589, 589,
+   589, 589, 589, 589, 589, 589, 589, 589,
+   589, 589, 589, 589, 589, 589, 589, 589,
+   589, 589, 589, 589, 589, 589, 589, 589,
+   589, 589, 589, 589, 589, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 589, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+
+#define FriBidiPropsBlockLevel1_1000 0x1000
+
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 640, 589, 589, 589,
+   589, 640, 589, 128, 128, 128, 589, 589,
+   640, 589, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 640, 640,
+   589, 589, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+
+#define FriBidiPropsBlockLevel1_1100 0x1100
+
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+    64,  64,  64,  64,  64,  64,  64,  64,
+    64,  64,  64,  64,  64,  64,  64,  64,
+    64,  64,  64,  64,  64,  64,  64,  64,
+    64,  64,  64,  64,  64,  64,  64,  64,
+    64,  64,  64,  64,  64,  64,  64,  64,
+    64,  64,  64,  64,  64,  64,  64,  64,
+    64,  64,  64,  64,  64,  64,  64,  64,
+    64,  64,  64,  64,  64,  64,  64,  64,
+    64,  64,  64,  64,  64,  64,  64,  64,
+    64,  64,  64,  64,  64,  64,  64,  64,
+    64,  64,  64,  64,  64,  64,  64,  64,
+    64,  64,  64,  64,  64,  64,  64,  64,
+    64,  64,  64,  64,  64,  64,  64,  64,
+    64,  64,  64,  64,  64,  64,  64,  64,
+    64,  64,  64,  64,  64,  64,  64,  64,
+    64,  64,  64,  64,  64,  64,  64,  64,
+    64,  64,  64,  64,  64,  64,  64,  64,
+    64,  64,  64,  64,  64,  64,  64,  64,
+    64,  64,  64,  64,  64,  64,  64,  64,
+    64,  64,  64,  64,  64,  64,  64,  64,
+
+#define FriBidiPropsBlockLevel1_1600 0x1200
+
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   145, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 146, 146, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+
+#define FriBidiPropsBlockLevel1_1700 0x1300
+
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 589, 589, 589, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 589, 589, 589, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 589, 589, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 589, 589, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 640, 640, 640, 589,
+   589, 589, 589, 589, 589, 589, 640, 640,
+   640, 640, 640, 640, 640, 640, 589, 640,
+   640, 589, 589, 589, 589, 589, 589, 589,
+   589, 589, 589, 589, 128, 128, 128, 128,
+   128, 128, 128, 139, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+
+#define FriBidiPropsBlockLevel1_1800 0x1400
+
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 589, 589, 589,  78, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 589, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+
+#define FriBidiPropsBlockLevel1_1F00 0x1500
+
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 146, 128, 146,
+   146, 146, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 146, 146, 146,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 146, 146, 146,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 146, 146, 146,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 146, 146, 128,
+
+#define FriBidiPropsBlockLevel1_2000 0x1600
+
+   145, 145, 145, 145, 145, 145, 145, 145,
+   145, 145, 145,  78,  78,  78,  64,  65,
+   274, 146, 146, 274, 274, 274, 274, 146,
+   274, 274, 146, 146, 274, 274, 146, 146,
+   274, 274, 274, 146, 274, 274, 274, 274,
+   145, 143,  67,  68,  71,  69,  70, 145,
+   267, 139, 267, 267, 139, 274, 146, 146,
+   146, 178, 178, 274, 146, 146, 274, 146,
+   146, 146, 146, 146, 146, 178, 178, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 128, 128, 128, 128, 146,
+   128, 128, 128, 128, 128, 128, 128, 145,
+    78,  78,  78,  78, 128, 128, 128, 128,
+   128, 128,  78,  78,  78,  78,  78,  78,
+   136, 128, 128, 128, 264, 136, 136, 136,
+   136, 136, 139, 139, 146, 178, 178, 256,
+   136, 264, 264, 264, 264, 136, 136, 136,
+   136, 136, 139, 139, 146, 178, 178, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   139, 139, 139, 139, 139, 139, 139, 139,
+   139, 139, 139, 139, 267, 139, 139, 139,
+   139, 139, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   589, 589, 589, 589, 589, 589, 589, 589,
+   589, 589, 589, 589, 589, 589, 589, 589,
+   589, 589, 589, 589, 589, 589, 589, 589,
+   589, 589, 589, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+
+#define FriBidiPropsBlockLevel1_2100 0x1700
+
+   146, 146, 128, 274, 146, 274, 146, 128,
+   146, 274, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 256, 146, 128, 274, 146,
+   146, 128, 128, 128, 128, 128, 146, 146,
+   146, 274, 274, 146, 128, 146, 256, 146,
+   128, 146, 128, 256, 128, 128, 139, 128,
+   128, 128, 146, 128, 128, 128, 128, 128,
+   128, 128, 146, 128, 128, 128, 128, 128,
+   146, 146, 146, 146, 146, 128, 128, 128,
+   128, 128, 146, 146, 128, 128, 128, 128,
+   128, 128, 128, 274, 274, 146, 146, 146,
+   146, 146, 146, 274, 274, 274, 274, 146,
+   256, 256, 256, 256, 256, 256, 256, 256,
+   256, 256, 256, 256, 128, 128, 128, 128,
+   256, 256, 256, 256, 256, 256, 256, 256,
+   256, 256, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   274, 274, 274, 274, 274, 274, 274, 274,
+   274, 274, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   274, 274, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 274, 146, 274, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 274,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+
+#define FriBidiPropsBlockLevel1_2200 0x1800
+
+   274, 146, 274, 274, 146, 146, 146, 274,
+   306, 178, 178, 306, 178, 178, 146, 274,
+   146, 274, 139, 139, 146, 306, 146, 146,
+   146, 146, 274, 146, 146, 274, 274, 274,
+   274, 146, 146, 274, 146, 274, 146, 274,
+   274, 274, 274, 274, 274, 146, 274, 146,
+   146, 146, 146, 146, 274, 274, 274, 274,
+   146, 146, 146, 146, 306, 306, 146, 146,
+   146, 146, 146, 178, 146, 146, 146, 146,
+   274, 146, 146, 146, 274, 146, 146, 146,
+   146, 146, 306, 178, 178, 178, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   274, 274, 146, 146, 306, 306, 306, 306,
+   178, 178, 306, 306, 146, 146, 306, 306,
+   178, 178, 178, 178, 178, 178, 178, 178,
+   178, 178, 178, 178, 178, 178, 178, 178,
+   178, 178, 306, 306, 178, 178, 306, 306,
+   178, 178, 178, 178, 146, 146, 146, 178,
+   178, 178, 178, 146, 146, 274, 146, 146,
+   178, 274, 146, 146, 146, 146, 146, 146,
+   146, 146, 178, 178, 146, 274, 178, 146,
+   178, 178, 146, 178, 146, 146, 146, 146,
+   178, 178, 178, 178, 178, 178, 178, 178,
+   146, 146, 146, 146, 146, 146, 146, 274,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 178, 178, 178, 178, 178, 146, 146,
+   178, 178, 146, 146, 146, 146, 178, 178,
+   178, 178, 178, 178, 178, 178, 178, 178,
+   178, 178, 178, 178, 178, 178, 178, 178,
+   178, 178, 178, 178, 178, 178, 146, 146,
+   178, 178, 178, 178, 178, 146, 178, 178,
+   146, 146, 178, 178, 178, 178, 178, 146,
+
+#define FriBidiPropsBlockLevel1_2300 0x1900
+
+   146, 146, 146, 146, 146, 146, 146, 146,
+   178, 178, 178, 178, 146, 146, 146, 146,
+   146, 146, 274, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 242, 242, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 128, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+
+#define FriBidiPropsBlockLevel1_2400 0x1A00
+
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   264, 264, 264, 264, 264, 264, 264, 264,
+   264, 264, 264, 264, 264, 264, 264, 264,
+   264, 264, 264, 264, 264, 264, 264, 264,
+   264, 264, 264, 264, 264, 264, 264, 264,
+   264, 264, 264, 264, 264, 264, 264, 264,
+   264, 264, 264, 264, 264, 264, 264, 264,
+   264, 264, 264, 264, 264, 264, 264, 264,
+   264, 264, 264, 264, 256, 256, 256, 256,
+   256, 256, 256, 256, 256, 256, 256, 256,
+   256, 256, 256, 256, 256, 256, 256, 256,
+   256, 256, 256, 256, 256, 256, 256, 256,
+   256, 256, 256, 256, 256, 256, 256, 256,
+   256, 256, 256, 256, 256, 256, 256, 256,
+   256, 256, 256, 256, 256, 256, 256, 256,
+   256, 256, 256, 256, 256, 256, 256, 256,
+   256, 256, 256, 256, 256, 256, 256, 256,
+   256, 256, 256, 256, 256, 256, 256, 256,
+   256, 256, 136, 274, 274, 274, 274, 274,
+   274, 274, 274, 274, 274, 274, 274, 274,
+   274, 274, 274, 274, 274, 274, 274, 128,
+
+#define FriBidiPropsBlockLevel1_2500 0x1B00
+
+   274, 274, 274, 274, 274, 274, 274, 274,
+   274, 274, 274, 274, 274, 274, 274, 274,
+   274, 274, 274, 274, 274, 274, 274, 274,
+   274, 274, 274, 274, 274, 274, 274, 274,
+   274, 274, 274, 274, 274, 274, 274, 274,
+   274, 274, 274, 274, 274, 274, 274, 274,
+   274, 274, 274, 274, 274, 274, 274, 274,
+   274, 274, 274, 274, 274, 274, 274, 274,
+   274, 274, 274, 274, 274, 274, 274, 274,
+   274, 274, 274, 274, 146, 146, 146, 146,
+   274, 274, 274, 274, 274, 274, 274, 274,
+   274, 274, 274, 274, 274, 274, 274, 274,
+   274, 274, 274, 274, 274, 274, 274, 274,
+   274, 274, 274, 274, 274, 274, 274, 274,
+   274, 274, 274, 274, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   274, 274, 274, 274, 274, 274, 274, 274,
+   274, 274, 274, 274, 274, 274, 274, 274,
+   146, 146, 274, 274, 274, 274, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   274, 274, 146, 274, 274, 274, 274, 274,
+   274, 274, 146, 146, 146, 146, 146, 146,
+   146, 146, 274, 274, 146, 146, 274, 274,
+   146, 146, 146, 146, 274, 274, 146, 146,
+   274, 274, 146, 146, 146, 146, 274, 274,
+   274, 146, 146, 274, 146, 146, 274, 274,
+   274, 274, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 274, 274, 274, 274, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 274,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+
+#define FriBidiPropsBlockLevel1_2600 0x1C00
+
+   146, 146, 146, 146, 146, 274, 274, 146,
+   146, 274, 146, 146, 146, 146, 274, 274,
+   146, 146, 146, 146, 128, 128, 146, 146,
+   128, 146, 146, 146, 274, 146, 274, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   274, 146, 274, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   274, 274, 146, 274, 274, 274, 146, 274,
+   274, 274, 274, 146, 274, 274, 146, 274,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 128, 128,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+
+#define FriBidiPropsBlockLevel1_2700 0x1D00
+
+   128, 146, 146, 146, 146, 128, 146, 146,
+   146, 146, 128, 128, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   128, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 274, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 128, 146, 128, 146,
+   146, 146, 146, 128, 128, 128, 146, 128,
+   146, 146, 146, 146, 146, 146, 146, 128,
+   128, 146, 146, 146, 146, 146, 146, 146,
+   178, 178, 178, 178, 178, 178, 178, 178,
+   178, 178, 178, 178, 178, 178, 274, 274,
+   274, 274, 274, 274, 274, 274, 274, 274,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 128, 128, 128,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   128, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   146, 146, 146, 146, 146, 178, 178, 146,
+   146, 146, 146, 146, 146, 178, 178, 146,
+   146, 146, 178, 178, 178, 178, 178, 178,
+   178, 178, 178, 178, 128, 128, 128, 128,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+
+#define FriBidiPropsBlockLevel1_2800 0x1E00
+
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+
+#define FriBidiPropsBlockLevel1_2900 0x1F00
+
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 178, 178, 178, 178, 178,
+   178, 178, 178, 178, 178, 178, 178, 178,
+   178, 178, 178, 178, 178, 178, 178, 178,
+   178, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   178, 146, 146, 146, 146, 146, 146, 146,
+   178, 178, 146, 146, 178, 178, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 178,
+   178, 178, 178, 146, 178, 178, 146, 146,
+   178, 178, 178, 178, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 178, 146, 146,
+   178, 178, 146, 146, 178, 178, 146, 146,
+
+#define FriBidiPropsBlockLevel1_2A00 0x2000
+
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 178, 178, 178, 178, 146,
+   146, 146, 146, 146, 178, 178, 146, 146,
+   146, 146, 146, 146, 178, 178, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 178, 178, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 146,
+   146, 178, 178, 146, 146, 178, 178, 178,
+   178, 178, 178, 178, 178, 146, 146, 146,
+   146, 146, 146, 178, 178, 146, 146, 146,
+   146, 178, 178, 178, 178, 178, 178, 178,
+   178, 178, 178, 178, 178, 146, 146, 146,
+   146, 178, 178, 146, 146, 146, 178, 178,
+   178, 178, 178, 178, 178, 178, 146, 178,
+   178, 146, 146, 178, 178, 146, 146, 146,
+   146, 146, 146, 178, 178, 178, 178, 178,
+   178, 178, 178, 178, 178, 178, 178, 146,
+   146, 146, 146, 146, 146, 178, 178, 178,
+   178, 178, 178, 178, 178, 178, 178, 146,
+   146, 146, 146, 146, 146, 146, 178, 146,
+   146, 146, 146, 178, 178, 178, 146, 146,
+   146, 146, 146, 146, 178, 178, 146, 146,
+   146, 146, 146, 146, 146, 146, 146, 178,
+   178, 178, 178, 146, 146, 146, 146, 146,
+
+#define FriBidiPropsBlockLevel1_2E00 0x2100
+
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   210, 210, 210, 210, 210, 210, 210, 210,
+   210, 210, 210, 210, 210, 210, 210, 210,
+   210, 210, 210, 210, 210, 210, 210, 210,
+   210, 210, 192, 210, 210, 210, 210, 210,
+   210, 210, 210, 210, 210, 210, 210, 210,
+   210, 210, 210, 210, 210, 210, 210, 210,
+   210, 210, 210, 210, 210, 210, 210, 210,
+   210, 210, 210, 210, 210, 210, 210, 210,
+   210, 210, 210, 210, 210, 210, 210, 210,
+   210, 210, 210, 210, 210, 210, 210, 210,
+   210, 210, 210, 210, 210, 210, 210, 210,
+   210, 210, 210, 210, 210, 210, 210, 210,
+   210, 210, 210, 210, 210, 210, 210, 210,
+   210, 210, 210, 210, 210, 210, 210, 210,
+   210, 210, 210, 210, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+
+#define FriBidiPropsBlockLevel1_2F00 0x2200
+
+   210, 210, 210, 210, 210, 210, 210, 210,
+   210, 210, 210, 210, 210, 210, 210, 210,
+   210, 210, 210, 210, 210, 210, 210, 210,
+   210, 210, 210, 210, 210, 210, 210, 210,
+   210, 210, 210, 210, 210, 210, 210, 210,
+   210, 210, 210, 210, 210, 210, 210, 210,
+   210, 210, 210, 210, 210, 210, 210, 210,
+   210, 210, 210, 210, 210, 210, 210, 210,
+   210, 210, 210, 210, 210, 210, 210, 210,
+   210, 210, 210, 210, 210, 210, 210, 210,
+   210, 210, 210, 210, 210, 210, 210, 210,
+   210, 210, 210, 210, 210, 210, 210, 210,
+   210, 210, 210, 210, 210, 210, 210, 210,
+   210, 210, 210, 210, 210, 210, 210, 210,
+   210, 210, 210, 210, 210, 210, 210, 210,
+   210, 210, 210, 210, 210, 210, 210, 210,
+   210, 210, 210, 210, 210, 210, 210, 210,
+   210, 210, 210, 210, 210, 210, 210, 210,
+   210, 210, 210, 210, 210, 210, 210, 210,
+   210, 210, 210, 210, 210, 210, 210, 210,
+   210, 210, 210, 210, 210, 210, 210, 210,
+   210, 210, 210, 210, 210, 210, 210, 210,
+   210, 210, 210, 210, 210, 210, 210, 210,
+   210, 210, 210, 210, 210, 210, 210, 210,
+   210, 210, 210, 210, 210, 210, 210, 210,
+   210, 210, 210, 210, 210, 210, 210, 210,
+   210, 210, 210, 210, 210, 210, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   210, 210, 210, 210, 210, 210, 210, 210,
+   210, 210, 210, 210, 192, 192, 192, 192,
+
+#define FriBidiPropsBlockLevel1_3000 0x2300
+
+   209, 210, 210, 210, 210, 192, 192, 192,
+   242, 242, 242, 242, 242, 242, 242, 242,
+   242, 242, 210, 210, 242, 242, 242, 242,
+   242, 242, 242, 242, 210, 210, 210, 210,
+   210, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 589, 589, 589, 589, 589, 589,
+   210, 192, 192, 192, 192, 192, 210, 210,
+   192, 192, 192, 192, 192, 210, 210, 146,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 589, 589, 210, 210, 192, 192, 192,
+   210, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 210, 192, 192, 192, 192,
+
+#define FriBidiPropsBlockLevel1_3100 0x2400
+
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+
+#define FriBidiPropsBlockLevel1_3200 0x2500
+
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 210, 210, 210, 210, 210, 210, 210,
+   210, 210, 210, 210, 210, 210, 210, 210,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 210, 210, 210, 210, 210, 210, 210,
+   210, 210, 210, 210, 210, 210, 210, 210,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+
+#define FriBidiPropsBlockLevel1_A400 0x2600
+
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   210, 210, 210, 210, 210, 210, 210, 210,
+   210, 210, 210, 210, 210, 210, 210, 210,
+   210, 210, 210, 210, 210, 210, 210, 210,
+   210, 210, 210, 210, 210, 210, 210, 210,
+   210, 210, 210, 210, 210, 210, 210, 210,
+   210, 210, 210, 210, 210, 210, 210, 210,
+   210, 210, 210, 210, 210, 210, 210, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+
+#define FriBidiPropsBlockLevel1_D700 0x2700
+
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+
+#define FriBidiPropsBlockLevel1_FB00 0x2800
+
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 129, 589, 129,
+   129, 129, 129, 129, 129, 129, 129, 129,
+   129, 139, 129, 129, 129, 129, 129, 129,
+   129, 129, 129, 129, 129, 129, 129, 129,
+   129, 129, 129, 129, 129, 129, 129, 129,
+   129, 129, 129, 129, 129, 129, 129, 129,
+   129, 129, 129, 129, 129, 129, 129, 129,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+
+#define FriBidiPropsBlockLevel1_FC00 0x2900
+
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+
+#define FriBidiPropsBlockLevel1_FD00 0x2A00
+
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 146, 146,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+
+#define FriBidiPropsBlockLevel1_FE00 0x2B00
+
+   589, 589, 589, 589, 589, 589, 589, 589,
+   589, 589, 589, 589, 589, 589, 589, 589,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   589, 589, 589, 589, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   210, 210, 210, 210, 210, 210, 210, 210,
+   210, 210, 210, 210, 210, 210, 210, 210,
+   210, 210, 210, 210, 210, 210, 210, 192,
+   192, 210, 210, 210, 210, 210, 210, 210,
+   204, 210, 204, 192, 210, 204, 210, 210,
+   210, 210, 210, 210, 210, 210, 210, 203,
+   210, 210, 203, 203, 210, 210, 210, 192,
+   210, 203, 203, 210, 192, 192, 192, 192,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130,  78,
+
+#define FriBidiPropsBlockLevel1_FF00 0x2C00
+
+   192, 210, 210, 203, 203, 203, 210, 210,
+   242, 242, 210, 203, 204, 203, 204, 202,
+   200, 200, 200, 200, 200, 200, 200, 200,
+   200, 200, 204, 210, 242, 210, 242, 210,
+   210, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 242, 210, 242, 210, 210,
+   210, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 192, 192, 192, 192, 192,
+   192, 192, 192, 242, 210, 242, 210, 242,
+   242, 146, 178, 178, 146, 146, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   203, 203, 210, 210, 210, 203, 203, 128,
+   146, 146, 146, 146, 146, 146, 146, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128,  78,  78,  78, 146, 274, 128, 128,
+
+#define FriBidiPropsBlockLevel1_1D100 0x2D00
+
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 640, 640, 589,
+   589, 589, 128, 128, 128, 640, 640, 640,
+   640, 640, 640,  78,  78,  78,  78,  78,
+    78,  78,  78, 589, 589, 589, 589, 589,
+   589, 589, 589, 128, 128, 589, 589, 589,
+   589, 589, 589, 589, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 589, 589, 589, 589, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+
+#define FriBidiPropsBlockLevel1_1D700 0x2E00
+
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 136, 136,
+   136, 136, 136, 136, 136, 136, 136, 136,
+   136, 136, 136, 136, 136, 136, 136, 136,
+   136, 136, 136, 136, 136, 136, 136, 136,
+   136, 136, 136, 136, 136, 136, 136, 136,
+   136, 136, 136, 136, 136, 136, 136, 136,
+   136, 136, 136, 136, 136, 136, 136, 136,
+
+#define FriBidiPropsBlockLevel1_E0000 0x2F00
+
+   128,  78, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+    78,  78,  78,  78,  78,  78,  78,  78,
+    78,  78,  78,  78,  78,  78,  78,  78,
+    78,  78,  78,  78,  78,  78,  78,  78,
+    78,  78,  78,  78,  78,  78,  78,  78,
+    78,  78,  78,  78,  78,  78,  78,  78,
+    78,  78,  78,  78,  78,  78,  78,  78,
+    78,  78,  78,  78,  78,  78,  78,  78,
+    78,  78,  78,  78,  78,  78,  78,  78,
+    78,  78,  78,  78,  78,  78,  78,  78,
+    78,  78,  78,  78,  78,  78,  78,  78,
+    78,  78,  78,  78,  78,  78,  78,  78,
+    78,  78,  78,  78,  78,  78,  78,  78,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128,
+};
+
+static const PACKTAB_UINT16 FriBidiPropsBlockLevel0[4352*1] = {
+
+#define FriBidiPropsBlockLevel0_0000 0x0
+
+  FriBidiPropsBlockLevel1_0000,  /* 0000..00FF */
+  FriBidiPropsBlockLevel1_0100,  /* 0100..01FF */
+  FriBidiPropsBlockLevel1_0200,  /* 0200..02FF */
+  FriBidiPropsBlockLevel1_0300,  /* 0300..03FF */
+  FriBidiPropsBlockLevel1_0400,  /* 0400..04FF */
+  FriBidiPropsBlockLevel1_0500,  /* 0500..05FF */
+  FriBidiPropsBlockLevel1_0600,  /* 0600..06FF */
+  FriBidiPropsBlockLevel1_0700,  /* 0700..07FF */
+  FriBidiPropsBlockLevel1_0800,  /* 0800..08FF */
+  FriBidiPropsBlockLevel1_0900,  /* 0900..09FF */
+  FriBidiPropsBlockLevel1_0A00,  /* 0A00..0AFF */
+  FriBidiPropsBlockLevel1_0B00,  /* 0B00..0BFF */
+  FriBidiPropsBlockLevel1_0C00,  /* 0C00..0CFF */
+  FriBidiPropsBlockLevel1_0D00,  /* 0D00..0DFF */
+  FriBidiPropsBlockLevel1_0E00,  /* 0E00..0EFF */
+  FriBidiPropsBlockLevel1_0F00,  /* 0F00..0FFF */
+  FriBidiPropsBlockLevel1_1000,  /* 1000..10FF */
+  FriBidiPropsBlockLevel1_1100,  /* 1100..11FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1200..12FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1300..13FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1400..14FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1500..15FF */
+  FriBidiPropsBlockLevel1_1600,  /* 1600..16FF */
+  FriBidiPropsBlockLevel1_1700,  /* 1700..17FF */
+  FriBidiPropsBlockLevel1_1800,  /* 1800..18FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1900..19FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1A00..1AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 1B00..1BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 1C00..1CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 1D00..1DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 1E00..1EFF */
+  FriBidiPropsBlockLevel1_1F00,  /* 1F00..1FFF */
+  FriBidiPropsBlockLevel1_2000,  /* 2000..20FF */
+  FriBidiPropsBlockLevel1_2100,  /* 2100..21FF */
+  FriBidiPropsBlockLevel1_2200,  /* 2200..22FF */
+  FriBidiPropsBlockLevel1_2300,  /* 2300..23FF */
+  FriBidiPropsBlockLevel1_2400,  /* 2400..24FF */
+  FriBidiPropsBlockLevel1_2500,  /* 2500..25FF */
+  FriBidiPropsBlockLevel1_2600,  /* 2600..26FF */
+  FriBidiPropsBlockLevel1_2700,  /* 2700..27FF */
+  FriBidiPropsBlockLevel1_2800,  /* 2800..28FF */
+  FriBidiPropsBlockLevel1_2900,  /* 2900..29FF */
+  FriBidiPropsBlockLevel1_2A00,  /* 2A00..2AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 2B00..2BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 2C00..2CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 2D00..2DFF */
+  FriBidiPropsBlockLevel1_2E00,  /* 2E00..2EFF */
+  FriBidiPropsBlockLevel1_2F00,  /* 2F00..2FFF */
+  FriBidiPropsBlockLevel1_3000,  /* 3000..30FF */
+  FriBidiPropsBlockLevel1_3100,  /* 3100..31FF */
+  FriBidiPropsBlockLevel1_3200,  /* 3200..32FF */
+  FriBidiPropsBlockLevel1_3100,  /* 3300..33FF */
+  FriBidiPropsBlockLevel1_3100,  /* 3400..34FF */
+  FriBidiPropsBlockLevel1_3100,  /* 3500..35FF */
+  FriBidiPropsBlockLevel1_3100,  /* 3600..36FF */
+  FriBidiPropsBlockLevel1_3100,  /* 3700..37FF */
+  FriBidiPropsBlockLevel1_3100,  /* 3800..38FF */
+  FriBidiPropsBlockLevel1_3100,  /* 3900..39FF */
+  FriBidiPropsBlockLevel1_3100,  /* 3A00..3AFF */
+  FriBidiPropsBlockLevel1_3100,  /* 3B00..3BFF */
+  FriBidiPropsBlockLevel1_3100,  /* 3C00..3CFF */
+  FriBidiPropsBlockLevel1_3100,  /* 3D00..3DFF */
+  FriBidiPropsBlockLevel1_3100,  /* 3E00..3EFF */
+  FriBidiPropsBlockLevel1_3100,  /* 3F00..3FFF */
+  FriBidiPropsBlockLevel1_3100,  /* 4000..40FF */
+  FriBidiPropsBlockLevel1_3100,  /* 4100..41FF */
+  FriBidiPropsBlockLevel1_3100,  /* 4200..42FF */
+  FriBidiPropsBlockLevel1_3100,  /* 4300..43FF */
+  FriBidiPropsBlockLevel1_3100,  /* 4400..44FF */
+  FriBidiPropsBlockLevel1_3100,  /* 4500..45FF */
+  FriBidiPropsBlockLevel1_3100,  /* 4600..46FF */
+  FriBidiPropsBlockLevel1_3100,  /* 4700..47FF */
+  FriBidiPropsBlockLevel1_3100,  /* 4800..48FF */
+  FriBidiPropsBlockLevel1_3100,  /* 4900..49FF */
+  FriBidiPropsBlockLevel1_3100,  /* 4A00..4AFF */
+  FriBidiPropsBlockLevel1_3100,  /* 4B00..4BFF */
+  FriBidiPropsBlockLevel1_3100,  /* 4C00..4CFF */
+  FriBidiPropsBlockLevel1_3100,  /* 4D00..4DFF */
+  FriBidiPropsBlockLevel1_3100,  /* 4E00..4EFF */
+  FriBidiPropsBlockLevel1_3100,  /* 4F00..4FFF */
+  FriBidiPropsBlockLevel1_3100,  /* 5000..50FF */
+  FriBidiPropsBlockLevel1_3100,  /* 5100..51FF */
+  FriBidiPropsBlockLevel1_3100,  /* 5200..52FF */
+  FriBidiPropsBlockLevel1_3100,  /* 5300..53FF */
+  FriBidiPropsBlockLevel1_3100,  /* 5400..54FF */
+  FriBidiPropsBlockLevel1_3100,  /* 5500..55FF */
+  FriBidiPropsBlockLevel1_3100,  /* 5600..56FF */
+  FriBidiPropsBlockLevel1_3100,  /* 5700..57FF */
+  FriBidiPropsBlockLevel1_3100,  /* 5800..58FF */
+  FriBidiPropsBlockLevel1_3100,  /* 5900..59FF */
+  FriBidiPropsBlockLevel1_3100,  /* 5A00..5AFF */
+  FriBidiPropsBlockLevel1_3100,  /* 5B00..5BFF */
+  FriBidiPropsBlockLevel1_3100,  /* 5C00..5CFF */
+  FriBidiPropsBlockLevel1_3100,  /* 5D00..5DFF */
+  FriBidiPropsBlockLevel1_3100,  /* 5E00..5EFF */
+  FriBidiPropsBlockLevel1_3100,  /* 5F00..5FFF */
+  FriBidiPropsBlockLevel1_3100,  /* 6000..60FF */
+  FriBidiPropsBlockLevel1_3100,  /* 6100..61FF */
+  FriBidiPropsBlockLevel1_3100,  /* 6200..62FF */
+  FriBidiPropsBlockLevel1_3100,  /* 6300..63FF */
+  FriBidiPropsBlockLevel1_3100,  /* 6400..64FF */
+  FriBidiPropsBlockLevel1_3100,  /* 6500..65FF */
+  FriBidiPropsBlockLevel1_3100,  /* 6600..66FF */
+  FriBidiPropsBlockLevel1_3100,  /* 6700..67FF */
+  FriBidiPropsBlockLevel1_3100,  /* 6800..68FF */
+  FriBidiPropsBlockLevel1_3100,  /* 6900..69FF */
+  FriBidiPropsBlockLevel1_3100,  /* 6A00..6AFF */
+  FriBidiPropsBlockLevel1_3100,  /* 6B00..6BFF */
+  FriBidiPropsBlockLevel1_3100,  /* 6C00..6CFF */
+  FriBidiPropsBlockLevel1_3100,  /* 6D00..6DFF */
+  FriBidiPropsBlockLevel1_3100,  /* 6E00..6EFF */
+  FriBidiPropsBlockLevel1_3100,  /* 6F00..6FFF */
+  FriBidiPropsBlockLevel1_3100,  /* 7000..70FF */
+  FriBidiPropsBlockLevel1_3100,  /* 7100..71FF */
+  FriBidiPropsBlockLevel1_3100,  /* 7200..72FF */
+  FriBidiPropsBlockLevel1_3100,  /* 7300..73FF */
+  FriBidiPropsBlockLevel1_3100,  /* 7400..74FF */
+  FriBidiPropsBlockLevel1_3100,  /* 7500..75FF */
+  FriBidiPropsBlockLevel1_3100,  /* 7600..76FF */
+  FriBidiPropsBlockLevel1_3100,  /* 7700..77FF */
+  FriBidiPropsBlockLevel1_3100,  /* 7800..78FF */
+  FriBidiPropsBlockLevel1_3100,  /* 7900..79FF */
+  FriBidiPropsBlockLevel1_3100,  /* 7A00..7AFF */
+  FriBidiPropsBlockLevel1_3100,  /* 7B00..7BFF */
+  FriBidiPropsBlockLevel1_3100,  /* 7C00..7CFF */
+  FriBidiPropsBlockLevel1_3100,  /* 7D00..7DFF */
+  FriBidiPropsBlockLevel1_3100,  /* 7E00..7EFF */
+  FriBidiPropsBlockLevel1_3100,  /* 7F00..7FFF */
+  FriBidiPropsBlockLevel1_3100,  /* 8000..80FF */
+  FriBidiPropsBlockLevel1_3100,  /* 8100..81FF */
+  FriBidiPropsBlockLevel1_3100,  /* 8200..82FF */
+  FriBidiPropsBlockLevel1_3100,  /* 8300..83FF */
+  FriBidiPropsBlockLevel1_3100,  /* 8400..84FF */
+  FriBidiPropsBlockLevel1_3100,  /* 8500..85FF */
+  FriBidiPropsBlockLevel1_3100,  /* 8600..86FF */
+  FriBidiPropsBlockLevel1_3100,  /* 8700..87FF */
+  FriBidiPropsBlockLevel1_3100,  /* 8800..88FF */
+  FriBidiPropsBlockLevel1_3100,  /* 8900..89FF */
+  FriBidiPropsBlockLevel1_3100,  /* 8A00..8AFF */
+  FriBidiPropsBlockLevel1_3100,  /* 8B00..8BFF */
+  FriBidiPropsBlockLevel1_3100,  /* 8C00..8CFF */
+  FriBidiPropsBlockLevel1_3100,  /* 8D00..8DFF */
+  FriBidiPropsBlockLevel1_3100,  /* 8E00..8EFF */
+  FriBidiPropsBlockLevel1_3100,  /* 8F00..8FFF */
+  FriBidiPropsBlockLevel1_3100,  /* 9000..90FF */
+  FriBidiPropsBlockLevel1_3100,  /* 9100..91FF */
+  FriBidiPropsBlockLevel1_3100,  /* 9200..92FF */
+  FriBidiPropsBlockLevel1_3100,  /* 9300..93FF */
+  FriBidiPropsBlockLevel1_3100,  /* 9400..94FF */
+  FriBidiPropsBlockLevel1_3100,  /* 9500..95FF */
+  FriBidiPropsBlockLevel1_3100,  /* 9600..96FF */
+  FriBidiPropsBlockLevel1_3100,  /* 9700..97FF */
+  FriBidiPropsBlockLevel1_3100,  /* 9800..98FF */
+  FriBidiPropsBlockLevel1_3100,  /* 9900..99FF */
+  FriBidiPropsBlockLevel1_3100,  /* 9A00..9AFF */
+  FriBidiPropsBlockLevel1_3100,  /* 9B00..9BFF */
+  FriBidiPropsBlockLevel1_3100,  /* 9C00..9CFF */
+  FriBidiPropsBlockLevel1_3100,  /* 9D00..9DFF */
+  FriBidiPropsBlockLevel1_3100,  /* 9E00..9EFF */
+  FriBidiPropsBlockLevel1_3100,  /* 9F00..9FFF */
+  FriBidiPropsBlockLevel1_3100,  /* A000..A0FF */
+  FriBidiPropsBlockLevel1_3100,  /* A100..A1FF */
+  FriBidiPropsBlockLevel1_3100,  /* A200..A2FF */
+  FriBidiPropsBlockLevel1_3100,  /* A300..A3FF */
+  FriBidiPropsBlockLevel1_A400,  /* A400..A4FF */
+  FriBidiPropsBlockLevel1_0800,  /* A500..A5FF */
+  FriBidiPropsBlockLevel1_0800,  /* A600..A6FF */
+  FriBidiPropsBlockLevel1_0800,  /* A700..A7FF */
+  FriBidiPropsBlockLevel1_0800,  /* A800..A8FF */
+  FriBidiPropsBlockLevel1_0800,  /* A900..A9FF */
+  FriBidiPropsBlockLevel1_0800,  /* AA00..AAFF */
+  FriBidiPropsBlockLevel1_0800,  /* AB00..ABFF */
+  FriBidiPropsBlockLevel1_3100,  /* AC00..ACFF */
+  FriBidiPropsBlockLevel1_3100,  /* AD00..ADFF */
+  FriBidiPropsBlockLevel1_3100,  /* AE00..AEFF */
+  FriBidiPropsBlockLevel1_3100,  /* AF00..AFFF */
+  FriBidiPropsBlockLevel1_3100,  /* B000..B0FF */
+  FriBidiPropsBlockLevel1_3100,  /* B100..B1FF */
+  FriBidiPropsBlockLevel1_3100,  /* B200..B2FF */
+  FriBidiPropsBlockLevel1_3100,  /* B300..B3FF */
+  FriBidiPropsBlockLevel1_3100,  /* B400..B4FF */
+  FriBidiPropsBlockLevel1_3100,  /* B500..B5FF */
+  FriBidiPropsBlockLevel1_3100,  /* B600..B6FF */
+  FriBidiPropsBlockLevel1_3100,  /* B700..B7FF */
+  FriBidiPropsBlockLevel1_3100,  /* B800..B8FF */
+  FriBidiPropsBlockLevel1_3100,  /* B900..B9FF */
+  FriBidiPropsBlockLevel1_3100,  /* BA00..BAFF */
+  FriBidiPropsBlockLevel1_3100,  /* BB00..BBFF */
+  FriBidiPropsBlockLevel1_3100,  /* BC00..BCFF */
+  FriBidiPropsBlockLevel1_3100,  /* BD00..BDFF */
+  FriBidiPropsBlockLevel1_3100,  /* BE00..BEFF */
+  FriBidiPropsBlockLevel1_3100,  /* BF00..BFFF */
+  FriBidiPropsBlockLevel1_3100,  /* C000..C0FF */
+  FriBidiPropsBlockLevel1_3100,  /* C100..C1FF */
+  FriBidiPropsBlockLevel1_3100,  /* C200..C2FF */
+  FriBidiPropsBlockLevel1_3100,  /* C300..C3FF */
+  FriBidiPropsBlockLevel1_3100,  /* C400..C4FF */
+  FriBidiPropsBlockLevel1_3100,  /* C500..C5FF */
+  FriBidiPropsBlockLevel1_3100,  /* C600..C6FF */
+  FriBidiPropsBlockLevel1_3100,  /* C700..C7FF */
+  FriBidiPropsBlockLevel1_3100,  /* C800..C8FF */
+  FriBidiPropsBlockLevel1_3100,  /* C900..C9FF */
+  FriBidiPropsBlockLevel1_3100,  /* CA00..CAFF */
+  FriBidiPropsBlockLevel1_3100,  /* CB00..CBFF */
+  FriBidiPropsBlockLevel1_3100,  /* CC00..CCFF */
+  FriBidiPropsBlockLevel1_3100,  /* CD00..CDFF */
+  FriBidiPropsBlockLevel1_3100,  /* CE00..CEFF */
+  FriBidiPropsBlockLevel1_3100,  /* CF00..CFFF */
+  FriBidiPropsBlockLevel1_3100,  /* D000..D0FF */
+  FriBidiPropsBlockLevel1_3100,  /* D100..D1FF */
+  FriBidiPropsBlockLevel1_3100,  /* D200..D2FF */
+  FriBidiPropsBlockLevel1_3100,  /* D300..D3FF */
+  FriBidiPropsBlockLevel1_3100,  /* D400..D4FF */
+  FriBidiPropsBlockLevel1_3100,  /* D500..D5FF */
+  FriBidiPropsBlockLevel1_3100,  /* D600..D6FF */
+  FriBidiPropsBlockLevel1_D700,  /* D700..D7FF */
+  FriBidiPropsBlockLevel1_0800,  /* D800..D8FF */
+  FriBidiPropsBlockLevel1_0800,  /* D900..D9FF */
+  FriBidiPropsBlockLevel1_0800,  /* DA00..DAFF */
+  FriBidiPropsBlockLevel1_0800,  /* DB00..DBFF */
+  FriBidiPropsBlockLevel1_0800,  /* DC00..DCFF */
+  FriBidiPropsBlockLevel1_0800,  /* DD00..DDFF */
+  FriBidiPropsBlockLevel1_0800,  /* DE00..DEFF */
+  FriBidiPropsBlockLevel1_0800,  /* DF00..DFFF */
+  FriBidiPropsBlockLevel1_0800,  /* E000..E0FF */
+  FriBidiPropsBlockLevel1_0800,  /* E100..E1FF */
+  FriBidiPropsBlockLevel1_0800,  /* E200..E2FF */
+  FriBidiPropsBlockLevel1_0800,  /* E300..E3FF */
+  FriBidiPropsBlockLevel1_0800,  /* E400..E4FF */
+  FriBidiPropsBlockLevel1_0800,  /* E500..E5FF */
+  FriBidiPropsBlockLevel1_0800,  /* E600..E6FF */
+  FriBidiPropsBlockLevel1_0800,  /* E700..E7FF */
+  FriBidiPropsBlockLevel1_0800,  /* E800..E8FF */
+  FriBidiPropsBlockLevel1_0800,  /* E900..E9FF */
+  FriBidiPropsBlockLevel1_0800,  /* EA00..EAFF */
+  FriBidiPropsBlockLevel1_0800,  /* EB00..EBFF */
+  FriBidiPropsBlockLevel1_0800,  /* EC00..ECFF */
+  FriBidiPropsBlockLevel1_0800,  /* ED00..EDFF */
+  FriBidiPropsBlockLevel1_0800,  /* EE00..EEFF */
+  FriBidiPropsBlockLevel1_0800,  /* EF00..EFFF */
+  FriBidiPropsBlockLevel1_0800,  /* F000..F0FF */
+  FriBidiPropsBlockLevel1_0800,  /* F100..F1FF */
+  FriBidiPropsBlockLevel1_0800,  /* F200..F2FF */
+  FriBidiPropsBlockLevel1_0800,  /* F300..F3FF */
+  FriBidiPropsBlockLevel1_0800,  /* F400..F4FF */
+  FriBidiPropsBlockLevel1_0800,  /* F500..F5FF */
+  FriBidiPropsBlockLevel1_0800,  /* F600..F6FF */
+  FriBidiPropsBlockLevel1_0800,  /* F700..F7FF */
+  FriBidiPropsBlockLevel1_0800,  /* F800..F8FF */
+  FriBidiPropsBlockLevel1_3100,  /* F900..F9FF */
+  FriBidiPropsBlockLevel1_3100,  /* FA00..FAFF */
+  FriBidiPropsBlockLevel1_FB00,  /* FB00..FBFF */
+  FriBidiPropsBlockLevel1_FC00,  /* FC00..FCFF */
+  FriBidiPropsBlockLevel1_FD00,  /* FD00..FDFF */
+  FriBidiPropsBlockLevel1_FE00,  /* FE00..FEFF */
+  FriBidiPropsBlockLevel1_FF00,  /* FF00..FFFF */
+  FriBidiPropsBlockLevel1_0800,  /* 10000..100FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10100..101FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10200..102FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10300..103FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10400..104FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10500..105FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10600..106FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10700..107FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10800..108FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10900..109FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10A00..10AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 10B00..10BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 10C00..10CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 10D00..10DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 10E00..10EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 10F00..10FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 11000..110FF */
+  FriBidiPropsBlockLevel1_0800,  /* 11100..111FF */
+  FriBidiPropsBlockLevel1_0800,  /* 11200..112FF */
+  FriBidiPropsBlockLevel1_0800,  /* 11300..113FF */
+  FriBidiPropsBlockLevel1_0800,  /* 11400..114FF */
+  FriBidiPropsBlockLevel1_0800,  /* 11500..115FF */
+  FriBidiPropsBlockLevel1_0800,  /* 11600..116FF */
+  FriBidiPropsBlockLevel1_0800,  /* 11700..117FF */
+  FriBidiPropsBlockLevel1_0800,  /* 11800..118FF */
+  FriBidiPropsBlockLevel1_0800,  /* 11900..119FF */
+  FriBidiPropsBlockLevel1_0800,  /* 11A00..11AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 11B00..11BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 11C00..11CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 11D00..11DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 11E00..11EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 11F00..11FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 12000..120FF */
+  FriBidiPropsBlockLevel1_0800,  /* 12100..121FF */
+  FriBidiPropsBlockLevel1_0800,  /* 12200..122FF */
+  FriBidiPropsBlockLevel1_0800,  /* 12300..123FF */
+  FriBidiPropsBlockLevel1_0800,  /* 12400..124FF */
+  FriBidiPropsBlockLevel1_0800,  /* 12500..125FF */
+  FriBidiPropsBlockLevel1_0800,  /* 12600..126FF */
+  FriBidiPropsBlockLevel1_0800,  /* 12700..127FF */
+  FriBidiPropsBlockLevel1_0800,  /* 12800..128FF */
+  FriBidiPropsBlockLevel1_0800,  /* 12900..129FF */
+  FriBidiPropsBlockLevel1_0800,  /* 12A00..12AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 12B00..12BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 12C00..12CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 12D00..12DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 12E00..12EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 12F00..12FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 13000..130FF */
+  FriBidiPropsBlockLevel1_0800,  /* 13100..131FF */
+  FriBidiPropsBlockLevel1_0800,  /* 13200..132FF */
+  FriBidiPropsBlockLevel1_0800,  /* 13300..133FF */
+  FriBidiPropsBlockLevel1_0800,  /* 13400..134FF */
+  FriBidiPropsBlockLevel1_0800,  /* 13500..135FF */
+  FriBidiPropsBlockLevel1_0800,  /* 13600..136FF */
+  FriBidiPropsBlockLevel1_0800,  /* 13700..137FF */
+  FriBidiPropsBlockLevel1_0800,  /* 13800..138FF */
+  FriBidiPropsBlockLevel1_0800,  /* 13900..139FF */
+  FriBidiPropsBlockLevel1_0800,  /* 13A00..13AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 13B00..13BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 13C00..13CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 13D00..13DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 13E00..13EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 13F00..13FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 14000..140FF */
+  FriBidiPropsBlockLevel1_0800,  /* 14100..141FF */
+  FriBidiPropsBlockLevel1_0800,  /* 14200..142FF */
+  FriBidiPropsBlockLevel1_0800,  /* 14300..143FF */
+  FriBidiPropsBlockLevel1_0800,  /* 14400..144FF */
+  FriBidiPropsBlockLevel1_0800,  /* 14500..145FF */
+  FriBidiPropsBlockLevel1_0800,  /* 14600..146FF */
+  FriBidiPropsBlockLevel1_0800,  /* 14700..147FF */
+  FriBidiPropsBlockLevel1_0800,  /* 14800..148FF */
+  FriBidiPropsBlockLevel1_0800,  /* 14900..149FF */
+  FriBidiPropsBlockLevel1_0800,  /* 14A00..14AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 14B00..14BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 14C00..14CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 14D00..14DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 14E00..14EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 14F00..14FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 15000..150FF */
+  FriBidiPropsBlockLevel1_0800,  /* 15100..151FF */
+  FriBidiPropsBlockLevel1_0800,  /* 15200..152FF */
+  FriBidiPropsBlockLevel1_0800,  /* 15300..153FF */
+  FriBidiPropsBlockLevel1_0800,  /* 15400..154FF */
+  FriBidiPropsBlockLevel1_0800,  /* 15500..155FF */
+  FriBidiPropsBlockLevel1_0800,  /* 15600..156FF */
+  FriBidiPropsBlockLevel1_0800,  /* 15700..157FF */
+  FriBidiPropsBlockLevel1_0800,  /* 15800..158FF */
+  FriBidiPropsBlockLevel1_0800,  /* 15900..159FF */
+  FriBidiPropsBlockLevel1_0800,  /* 15A00..15AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 15B00..15BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 15C00..15CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 15D00..15DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 15E00..15EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 15F00..15FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 16000..160FF */
+  FriBidiPropsBlockLevel1_0800,  /* 16100..161FF */
+  FriBidiPropsBlockLevel1_0800,  /* 16200..162FF */
+  FriBidiPropsBlockLevel1_0800,  /* 16300..163FF */
+  FriBidiPropsBlockLevel1_0800,  /* 16400..164FF */
+  FriBidiPropsBlockLevel1_0800,  /* 16500..165FF */
+  FriBidiPropsBlockLevel1_0800,  /* 16600..166FF */
+  FriBidiPropsBlockLevel1_0800,  /* 16700..167FF */
+  FriBidiPropsBlockLevel1_0800,  /* 16800..168FF */
+  FriBidiPropsBlockLevel1_0800,  /* 16900..169FF */
+  FriBidiPropsBlockLevel1_0800,  /* 16A00..16AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 16B00..16BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 16C00..16CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 16D00..16DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 16E00..16EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 16F00..16FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 17000..170FF */
+  FriBidiPropsBlockLevel1_0800,  /* 17100..171FF */
+  FriBidiPropsBlockLevel1_0800,  /* 17200..172FF */
+  FriBidiPropsBlockLevel1_0800,  /* 17300..173FF */
+  FriBidiPropsBlockLevel1_0800,  /* 17400..174FF */
+  FriBidiPropsBlockLevel1_0800,  /* 17500..175FF */
+  FriBidiPropsBlockLevel1_0800,  /* 17600..176FF */
+  FriBidiPropsBlockLevel1_0800,  /* 17700..177FF */
+  FriBidiPropsBlockLevel1_0800,  /* 17800..178FF */
+  FriBidiPropsBlockLevel1_0800,  /* 17900..179FF */
+  FriBidiPropsBlockLevel1_0800,  /* 17A00..17AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 17B00..17BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 17C00..17CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 17D00..17DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 17E00..17EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 17F00..17FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 18000..180FF */
+  FriBidiPropsBlockLevel1_0800,  /* 18100..181FF */
+  FriBidiPropsBlockLevel1_0800,  /* 18200..182FF */
+  FriBidiPropsBlockLevel1_0800,  /* 18300..183FF */
+  FriBidiPropsBlockLevel1_0800,  /* 18400..184FF */
+  FriBidiPropsBlockLevel1_0800,  /* 18500..185FF */
+  FriBidiPropsBlockLevel1_0800,  /* 18600..186FF */
+  FriBidiPropsBlockLevel1_0800,  /* 18700..187FF */
+  FriBidiPropsBlockLevel1_0800,  /* 18800..188FF */
+  FriBidiPropsBlockLevel1_0800,  /* 18900..189FF */
+  FriBidiPropsBlockLevel1_0800,  /* 18A00..18AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 18B00..18BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 18C00..18CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 18D00..18DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 18E00..18EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 18F00..18FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 19000..190FF */
+  FriBidiPropsBlockLevel1_0800,  /* 19100..191FF */
+  FriBidiPropsBlockLevel1_0800,  /* 19200..192FF */
+  FriBidiPropsBlockLevel1_0800,  /* 19300..193FF */
+  FriBidiPropsBlockLevel1_0800,  /* 19400..194FF */
+  FriBidiPropsBlockLevel1_0800,  /* 19500..195FF */
+  FriBidiPropsBlockLevel1_0800,  /* 19600..196FF */
+  FriBidiPropsBlockLevel1_0800,  /* 19700..197FF */
+  FriBidiPropsBlockLevel1_0800,  /* 19800..198FF */
+  FriBidiPropsBlockLevel1_0800,  /* 19900..199FF */
+  FriBidiPropsBlockLevel1_0800,  /* 19A00..19AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 19B00..19BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 19C00..19CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 19D00..19DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 19E00..19EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 19F00..19FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 1A000..1A0FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1A100..1A1FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1A200..1A2FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1A300..1A3FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1A400..1A4FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1A500..1A5FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1A600..1A6FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1A700..1A7FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1A800..1A8FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1A900..1A9FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1AA00..1AAFF */
+  FriBidiPropsBlockLevel1_0800,  /* 1AB00..1ABFF */
+  FriBidiPropsBlockLevel1_0800,  /* 1AC00..1ACFF */
+  FriBidiPropsBlockLevel1_0800,  /* 1AD00..1ADFF */
+  FriBidiPropsBlockLevel1_0800,  /* 1AE00..1AEFF */
+  FriBidiPropsBlockLevel1_0800,  /* 1AF00..1AFFF */
+  FriBidiPropsBlockLevel1_0800,  /* 1B000..1B0FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1B100..1B1FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1B200..1B2FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1B300..1B3FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1B400..1B4FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1B500..1B5FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1B600..1B6FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1B700..1B7FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1B800..1B8FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1B900..1B9FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1BA00..1BAFF */
+  FriBidiPropsBlockLevel1_0800,  /* 1BB00..1BBFF */
+  FriBidiPropsBlockLevel1_0800,  /* 1BC00..1BCFF */
+  FriBidiPropsBlockLevel1_0800,  /* 1BD00..1BDFF */
+  FriBidiPropsBlockLevel1_0800,  /* 1BE00..1BEFF */
+  FriBidiPropsBlockLevel1_0800,  /* 1BF00..1BFFF */
+  FriBidiPropsBlockLevel1_0800,  /* 1C000..1C0FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1C100..1C1FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1C200..1C2FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1C300..1C3FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1C400..1C4FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1C500..1C5FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1C600..1C6FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1C700..1C7FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1C800..1C8FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1C900..1C9FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1CA00..1CAFF */
+  FriBidiPropsBlockLevel1_0800,  /* 1CB00..1CBFF */
+  FriBidiPropsBlockLevel1_0800,  /* 1CC00..1CCFF */
+  FriBidiPropsBlockLevel1_0800,  /* 1CD00..1CDFF */
+  FriBidiPropsBlockLevel1_0800,  /* 1CE00..1CEFF */
+  FriBidiPropsBlockLevel1_0800,  /* 1CF00..1CFFF */
+  FriBidiPropsBlockLevel1_0800,  /* 1D000..1D0FF */
+  FriBidiPropsBlockLevel1_1D100,  /* 1D100..1D1FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1D200..1D2FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1D300..1D3FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1D400..1D4FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1D500..1D5FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1D600..1D6FF */
+  FriBidiPropsBlockLevel1_1D700,  /* 1D700..1D7FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1D800..1D8FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1D900..1D9FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1DA00..1DAFF */
+  FriBidiPropsBlockLevel1_0800,  /* 1DB00..1DBFF */
+  FriBidiPropsBlockLevel1_0800,  /* 1DC00..1DCFF */
+  FriBidiPropsBlockLevel1_0800,  /* 1DD00..1DDFF */
+  FriBidiPropsBlockLevel1_0800,  /* 1DE00..1DEFF */
+  FriBidiPropsBlockLevel1_0800,  /* 1DF00..1DFFF */
+  FriBidiPropsBlockLevel1_0800,  /* 1E000..1E0FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1E100..1E1FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1E200..1E2FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1E300..1E3FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1E400..1E4FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1E500..1E5FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1E600..1E6FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1E700..1E7FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1E800..1E8FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1E900..1E9FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1EA00..1EAFF */
+  FriBidiPropsBlockLevel1_0800,  /* 1EB00..1EBFF */
+  FriBidiPropsBlockLevel1_0800,  /* 1EC00..1ECFF */
+  FriBidiPropsBlockLevel1_0800,  /* 1ED00..1EDFF */
+  FriBidiPropsBlockLevel1_0800,  /* 1EE00..1EEFF */
+  FriBidiPropsBlockLevel1_0800,  /* 1EF00..1EFFF */
+  FriBidiPropsBlockLevel1_0800,  /* 1F000..1F0FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1F100..1F1FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1F200..1F2FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1F300..1F3FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1F400..1F4FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1F500..1F5FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1F600..1F6FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1F700..1F7FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1F800..1F8FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1F900..1F9FF */
+  FriBidiPropsBlockLevel1_0800,  /* 1FA00..1FAFF */
+  FriBidiPropsBlockLevel1_0800,  /* 1FB00..1FBFF */
+  FriBidiPropsBlockLevel1_0800,  /* 1FC00..1FCFF */
+  FriBidiPropsBlockLevel1_0800,  /* 1FD00..1FDFF */
+  FriBidiPropsBlockLevel1_0800,  /* 1FE00..1FEFF */
+  FriBidiPropsBlockLevel1_0800,  /* 1FF00..1FFFF */
+  FriBidiPropsBlockLevel1_3100,  /* 20000..200FF */
+  FriBidiPropsBlockLevel1_3100,  /* 20100..201FF */
+  FriBidiPropsBlockLevel1_3100,  /* 20200..202FF */
+  FriBidiPropsBlockLevel1_3100,  /* 20300..203FF */
+  FriBidiPropsBlockLevel1_3100,  /* 20400..204FF */
+  FriBidiPropsBlockLevel1_3100,  /* 20500..205FF */
+  FriBidiPropsBlockLevel1_3100,  /* 20600..206FF */
+  FriBidiPropsBlockLevel1_3100,  /* 20700..207FF */
+  FriBidiPropsBlockLevel1_3100,  /* 20800..208FF */
+  FriBidiPropsBlockLevel1_3100,  /* 20900..209FF */
+  FriBidiPropsBlockLevel1_3100,  /* 20A00..20AFF */
+  FriBidiPropsBlockLevel1_3100,  /* 20B00..20BFF */
+  FriBidiPropsBlockLevel1_3100,  /* 20C00..20CFF */
+  FriBidiPropsBlockLevel1_3100,  /* 20D00..20DFF */
+  FriBidiPropsBlockLevel1_3100,  /* 20E00..20EFF */
+  FriBidiPropsBlockLevel1_3100,  /* 20F00..20FFF */
+  FriBidiPropsBlockLevel1_3100,  /* 21000..210FF */
+  FriBidiPropsBlockLevel1_3100,  /* 21100..211FF */
+  FriBidiPropsBlockLevel1_3100,  /* 21200..212FF */
+  FriBidiPropsBlockLevel1_3100,  /* 21300..213FF */
+  FriBidiPropsBlockLevel1_3100,  /* 21400..214FF */
+  FriBidiPropsBlockLevel1_3100,  /* 21500..215FF */
+  FriBidiPropsBlockLevel1_3100,  /* 21600..216FF */
+  FriBidiPropsBlockLevel1_3100,  /* 21700..217FF */
+  FriBidiPropsBlockLevel1_3100,  /* 21800..218FF */
+  FriBidiPropsBlockLevel1_3100,  /* 21900..219FF */
+  FriBidiPropsBlockLevel1_3100,  /* 21A00..21AFF */
+  FriBidiPropsBlockLevel1_3100,  /* 21B00..21BFF */
+  FriBidiPropsBlockLevel1_3100,  /* 21C00..21CFF */
+  FriBidiPropsBlockLevel1_3100,  /* 21D00..21DFF */
+  FriBidiPropsBlockLevel1_3100,  /* 21E00..21EFF */
+  FriBidiPropsBlockLevel1_3100,  /* 21F00..21FFF */
+  FriBidiPropsBlockLevel1_3100,  /* 22000..220FF */
+  FriBidiPropsBlockLevel1_3100,  /* 22100..221FF */
+  FriBidiPropsBlockLevel1_3100,  /* 22200..222FF */
+  FriBidiPropsBlockLevel1_3100,  /* 22300..223FF */
+  FriBidiPropsBlockLevel1_3100,  /* 22400..224FF */
+  FriBidiPropsBlockLevel1_3100,  /* 22500..225FF */
+  FriBidiPropsBlockLevel1_3100,  /* 22600..226FF */
+  FriBidiPropsBlockLevel1_3100,  /* 22700..227FF */
+  FriBidiPropsBlockLevel1_3100,  /* 22800..228FF */
+  FriBidiPropsBlockLevel1_3100,  /* 22900..229FF */
+  FriBidiPropsBlockLevel1_3100,  /* 22A00..22AFF */
+  FriBidiPropsBlockLevel1_3100,  /* 22B00..22BFF */
+  FriBidiPropsBlockLevel1_3100,  /* 22C00..22CFF */
+  FriBidiPropsBlockLevel1_3100,  /* 22D00..22DFF */
+  FriBidiPropsBlockLevel1_3100,  /* 22E00..22EFF */
+  FriBidiPropsBlockLevel1_3100,  /* 22F00..22FFF */
+  FriBidiPropsBlockLevel1_3100,  /* 23000..230FF */
+  FriBidiPropsBlockLevel1_3100,  /* 23100..231FF */
+  FriBidiPropsBlockLevel1_3100,  /* 23200..232FF */
+  FriBidiPropsBlockLevel1_3100,  /* 23300..233FF */
+  FriBidiPropsBlockLevel1_3100,  /* 23400..234FF */
+  FriBidiPropsBlockLevel1_3100,  /* 23500..235FF */
+  FriBidiPropsBlockLevel1_3100,  /* 23600..236FF */
+  FriBidiPropsBlockLevel1_3100,  /* 23700..237FF */
+  FriBidiPropsBlockLevel1_3100,  /* 23800..238FF */
+  FriBidiPropsBlockLevel1_3100,  /* 23900..239FF */
+  FriBidiPropsBlockLevel1_3100,  /* 23A00..23AFF */
+  FriBidiPropsBlockLevel1_3100,  /* 23B00..23BFF */
+  FriBidiPropsBlockLevel1_3100,  /* 23C00..23CFF */
+  FriBidiPropsBlockLevel1_3100,  /* 23D00..23DFF */
+  FriBidiPropsBlockLevel1_3100,  /* 23E00..23EFF */
+  FriBidiPropsBlockLevel1_3100,  /* 23F00..23FFF */
+  FriBidiPropsBlockLevel1_3100,  /* 24000..240FF */
+  FriBidiPropsBlockLevel1_3100,  /* 24100..241FF */
+  FriBidiPropsBlockLevel1_3100,  /* 24200..242FF */
+  FriBidiPropsBlockLevel1_3100,  /* 24300..243FF */
+  FriBidiPropsBlockLevel1_3100,  /* 24400..244FF */
+  FriBidiPropsBlockLevel1_3100,  /* 24500..245FF */
+  FriBidiPropsBlockLevel1_3100,  /* 24600..246FF */
+  FriBidiPropsBlockLevel1_3100,  /* 24700..247FF */
+  FriBidiPropsBlockLevel1_3100,  /* 24800..248FF */
+  FriBidiPropsBlockLevel1_3100,  /* 24900..249FF */
+  FriBidiPropsBlockLevel1_3100,  /* 24A00..24AFF */
+  FriBidiPropsBlockLevel1_3100,  /* 24B00..24BFF */
+  FriBidiPropsBlockLevel1_3100,  /* 24C00..24CFF */
+  FriBidiPropsBlockLevel1_3100,  /* 24D00..24DFF */
+  FriBidiPropsBlockLevel1_3100,  /* 24E00..24EFF */
+  FriBidiPropsBlockLevel1_3100,  /* 24F00..24FFF */
+  FriBidiPropsBlockLevel1_3100,  /* 25000..250FF */
+  FriBidiPropsBlockLevel1_3100,  /* 25100..251FF */
+  FriBidiPropsBlockLevel1_3100,  /* 25200..252FF */
+  FriBidiPropsBlockLevel1_3100,  /* 25300..253FF */
+  FriBidiPropsBlockLevel1_3100,  /* 25400..254FF */
+  FriBidiPropsBlockLevel1_3100,  /* 25500..255FF */
+  FriBidiPropsBlockLevel1_3100,  /* 25600..256FF */
+  FriBidiPropsBlockLevel1_3100,  /* 25700..257FF */
+  FriBidiPropsBlockLevel1_3100,  /* 25800..258FF */
+  FriBidiPropsBlockLevel1_3100,  /* 25900..259FF */
+  FriBidiPropsBlockLevel1_3100,  /* 25A00..25AFF */
+  FriBidiPropsBlockLevel1_3100,  /* 25B00..25BFF */
+  FriBidiPropsBlockLevel1_3100,  /* 25C00..25CFF */
+  FriBidiPropsBlockLevel1_3100,  /* 25D00..25DFF */
+  FriBidiPropsBlockLevel1_3100,  /* 25E00..25EFF */
+  FriBidiPropsBlockLevel1_3100,  /* 25F00..25FFF */
+  FriBidiPropsBlockLevel1_3100,  /* 26000..260FF */
+  FriBidiPropsBlockLevel1_3100,  /* 26100..261FF */
+  FriBidiPropsBlockLevel1_3100,  /* 26200..262FF */
+  FriBidiPropsBlockLevel1_3100,  /* 26300..263FF */
+  FriBidiPropsBlockLevel1_3100,  /* 26400..264FF */
+  FriBidiPropsBlockLevel1_3100,  /* 26500..265FF */
+  FriBidiPropsBlockLevel1_3100,  /* 26600..266FF */
+  FriBidiPropsBlockLevel1_3100,  /* 26700..267FF */
+  FriBidiPropsBlockLevel1_3100,  /* 26800..268FF */
+  FriBidiPropsBlockLevel1_3100,  /* 26900..269FF */
+  FriBidiPropsBlockLevel1_3100,  /* 26A00..26AFF */
+  FriBidiPropsBlockLevel1_3100,  /* 26B00..26BFF */
+  FriBidiPropsBlockLevel1_3100,  /* 26C00..26CFF */
+  FriBidiPropsBlockLevel1_3100,  /* 26D00..26DFF */
+  FriBidiPropsBlockLevel1_3100,  /* 26E00..26EFF */
+  FriBidiPropsBlockLevel1_3100,  /* 26F00..26FFF */
+  FriBidiPropsBlockLevel1_3100,  /* 27000..270FF */
+  FriBidiPropsBlockLevel1_3100,  /* 27100..271FF */
+  FriBidiPropsBlockLevel1_3100,  /* 27200..272FF */
+  FriBidiPropsBlockLevel1_3100,  /* 27300..273FF */
+  FriBidiPropsBlockLevel1_3100,  /* 27400..274FF */
+  FriBidiPropsBlockLevel1_3100,  /* 27500..275FF */
+  FriBidiPropsBlockLevel1_3100,  /* 27600..276FF */
+  FriBidiPropsBlockLevel1_3100,  /* 27700..277FF */
+  FriBidiPropsBlockLevel1_3100,  /* 27800..278FF */
+  FriBidiPropsBlockLevel1_3100,  /* 27900..279FF */
+  FriBidiPropsBlockLevel1_3100,  /* 27A00..27AFF */
+  FriBidiPropsBlockLevel1_3100,  /* 27B00..27BFF */
+  FriBidiPropsBlockLevel1_3100,  /* 27C00..27CFF */
+  FriBidiPropsBlockLevel1_3100,  /* 27D00..27DFF */
+  FriBidiPropsBlockLevel1_3100,  /* 27E00..27EFF */
+  FriBidiPropsBlockLevel1_3100,  /* 27F00..27FFF */
+  FriBidiPropsBlockLevel1_3100,  /* 28000..280FF */
+  FriBidiPropsBlockLevel1_3100,  /* 28100..281FF */
+  FriBidiPropsBlockLevel1_3100,  /* 28200..282FF */
+  FriBidiPropsBlockLevel1_3100,  /* 28300..283FF */
+  FriBidiPropsBlockLevel1_3100,  /* 28400..284FF */
+  FriBidiPropsBlockLevel1_3100,  /* 28500..285FF */
+  FriBidiPropsBlockLevel1_3100,  /* 28600..286FF */
+  FriBidiPropsBlockLevel1_3100,  /* 28700..287FF */
+  FriBidiPropsBlockLevel1_3100,  /* 28800..288FF */
+  FriBidiPropsBlockLevel1_3100,  /* 28900..289FF */
+  FriBidiPropsBlockLevel1_3100,  /* 28A00..28AFF */
+  FriBidiPropsBlockLevel1_3100,  /* 28B00..28BFF */
+  FriBidiPropsBlockLevel1_3100,  /* 28C00..28CFF */
+  FriBidiPropsBlockLevel1_3100,  /* 28D00..28DFF */
+  FriBidiPropsBlockLevel1_3100,  /* 28E00..28EFF */
+  FriBidiPropsBlockLevel1_3100,  /* 28F00..28FFF */
+  FriBidiPropsBlockLevel1_3100,  /* 29000..290FF */
+  FriBidiPropsBlockLevel1_3100,  /* 29100..291FF */
+  FriBidiPropsBlockLevel1_3100,  /* 29200..292FF */
+  FriBidiPropsBlockLevel1_3100,  /* 29300..293FF */
+  FriBidiPropsBlockLevel1_3100,  /* 29400..294FF */
+  FriBidiPropsBlockLevel1_3100,  /* 29500..295FF */
+  FriBidiPropsBlockLevel1_3100,  /* 29600..296FF */
+  FriBidiPropsBlockLevel1_3100,  /* 29700..297FF */
+  FriBidiPropsBlockLevel1_3100,  /* 29800..298FF */
+  FriBidiPropsBlockLevel1_3100,  /* 29900..299FF */
+  FriBidiPropsBlockLevel1_3100,  /* 29A00..29AFF */
+  FriBidiPropsBlockLevel1_3100,  /* 29B00..29BFF */
+  FriBidiPropsBlockLevel1_3100,  /* 29C00..29CFF */
+  FriBidiPropsBlockLevel1_3100,  /* 29D00..29DFF */
+  FriBidiPropsBlockLevel1_3100,  /* 29E00..29EFF */
+  FriBidiPropsBlockLevel1_3100,  /* 29F00..29FFF */
+  FriBidiPropsBlockLevel1_3100,  /* 2A000..2A0FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2A100..2A1FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2A200..2A2FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2A300..2A3FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2A400..2A4FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2A500..2A5FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2A600..2A6FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2A700..2A7FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2A800..2A8FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2A900..2A9FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2AA00..2AAFF */
+  FriBidiPropsBlockLevel1_3100,  /* 2AB00..2ABFF */
+  FriBidiPropsBlockLevel1_3100,  /* 2AC00..2ACFF */
+  FriBidiPropsBlockLevel1_3100,  /* 2AD00..2ADFF */
+  FriBidiPropsBlockLevel1_3100,  /* 2AE00..2AEFF */
+  FriBidiPropsBlockLevel1_3100,  /* 2AF00..2AFFF */
+  FriBidiPropsBlockLevel1_3100,  /* 2B000..2B0FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2B100..2B1FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2B200..2B2FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2B300..2B3FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2B400..2B4FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2B500..2B5FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2B600..2B6FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2B700..2B7FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2B800..2B8FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2B900..2B9FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2BA00..2BAFF */
+  FriBidiPropsBlockLevel1_3100,  /* 2BB00..2BBFF */
+  FriBidiPropsBlockLevel1_3100,  /* 2BC00..2BCFF */
+  FriBidiPropsBlockLevel1_3100,  /* 2BD00..2BDFF */
+  FriBidiPropsBlockLevel1_3100,  /* 2BE00..2BEFF */
+  FriBidiPropsBlockLevel1_3100,  /* 2BF00..2BFFF */
+  FriBidiPropsBlockLevel1_3100,  /* 2C000..2C0FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2C100..2C1FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2C200..2C2FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2C300..2C3FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2C400..2C4FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2C500..2C5FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2C600..2C6FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2C700..2C7FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2C800..2C8FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2C900..2C9FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2CA00..2CAFF */
+  FriBidiPropsBlockLevel1_3100,  /* 2CB00..2CBFF */
+  FriBidiPropsBlockLevel1_3100,  /* 2CC00..2CCFF */
+  FriBidiPropsBlockLevel1_3100,  /* 2CD00..2CDFF */
+  FriBidiPropsBlockLevel1_3100,  /* 2CE00..2CEFF */
+  FriBidiPropsBlockLevel1_3100,  /* 2CF00..2CFFF */
+  FriBidiPropsBlockLevel1_3100,  /* 2D000..2D0FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2D100..2D1FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2D200..2D2FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2D300..2D3FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2D400..2D4FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2D500..2D5FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2D600..2D6FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2D700..2D7FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2D800..2D8FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2D900..2D9FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2DA00..2DAFF */
+  FriBidiPropsBlockLevel1_3100,  /* 2DB00..2DBFF */
+  FriBidiPropsBlockLevel1_3100,  /* 2DC00..2DCFF */
+  FriBidiPropsBlockLevel1_3100,  /* 2DD00..2DDFF */
+  FriBidiPropsBlockLevel1_3100,  /* 2DE00..2DEFF */
+  FriBidiPropsBlockLevel1_3100,  /* 2DF00..2DFFF */
+  FriBidiPropsBlockLevel1_3100,  /* 2E000..2E0FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2E100..2E1FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2E200..2E2FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2E300..2E3FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2E400..2E4FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2E500..2E5FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2E600..2E6FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2E700..2E7FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2E800..2E8FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2E900..2E9FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2EA00..2EAFF */
+  FriBidiPropsBlockLevel1_3100,  /* 2EB00..2EBFF */
+  FriBidiPropsBlockLevel1_3100,  /* 2EC00..2ECFF */
+  FriBidiPropsBlockLevel1_3100,  /* 2ED00..2EDFF */
+  FriBidiPropsBlockLevel1_3100,  /* 2EE00..2EEFF */
+  FriBidiPropsBlockLevel1_3100,  /* 2EF00..2EFFF */
+  FriBidiPropsBlockLevel1_3100,  /* 2F000..2F0FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2F100..2F1FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2F200..2F2FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2F300..2F3FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2F400..2F4FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2F500..2F5FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2F600..2F6FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2F700..2F7FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2F800..2F8FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2F900..2F9FF */
+  FriBidiPropsBlockLevel1_3100,  /* 2FA00..2FAFF */
+  FriBidiPropsBlockLevel1_3100,  /* 2FB00..2FBFF */
+  FriBidiPropsBlockLevel1_3100,  /* 2FC00..2FCFF */
+  FriBidiPropsBlockLevel1_3100,  /* 2FD00..2FDFF */
+  FriBidiPropsBlockLevel1_3100,  /* 2FE00..2FEFF */
+  FriBidiPropsBlockLevel1_3100,  /* 2FF00..2FFFF */
+  FriBidiPropsBlockLevel1_0800,  /* 30000..300FF */
+  FriBidiPropsBlockLevel1_0800,  /* 30100..301FF */
+  FriBidiPropsBlockLevel1_0800,  /* 30200..302FF */
+  FriBidiPropsBlockLevel1_0800,  /* 30300..303FF */
+  FriBidiPropsBlockLevel1_0800,  /* 30400..304FF */
+  FriBidiPropsBlockLevel1_0800,  /* 30500..305FF */
+  FriBidiPropsBlockLevel1_0800,  /* 30600..306FF */
+  FriBidiPropsBlockLevel1_0800,  /* 30700..307FF */
+  FriBidiPropsBlockLevel1_0800,  /* 30800..308FF */
+  FriBidiPropsBlockLevel1_0800,  /* 30900..309FF */
+  FriBidiPropsBlockLevel1_0800,  /* 30A00..30AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 30B00..30BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 30C00..30CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 30D00..30DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 30E00..30EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 30F00..30FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 31000..310FF */
+  FriBidiPropsBlockLevel1_0800,  /* 31100..311FF */
+  FriBidiPropsBlockLevel1_0800,  /* 31200..312FF */
+  FriBidiPropsBlockLevel1_0800,  /* 31300..313FF */
+  FriBidiPropsBlockLevel1_0800,  /* 31400..314FF */
+  FriBidiPropsBlockLevel1_0800,  /* 31500..315FF */
+  FriBidiPropsBlockLevel1_0800,  /* 31600..316FF */
+  FriBidiPropsBlockLevel1_0800,  /* 31700..317FF */
+  FriBidiPropsBlockLevel1_0800,  /* 31800..318FF */
+  FriBidiPropsBlockLevel1_0800,  /* 31900..319FF */
+  FriBidiPropsBlockLevel1_0800,  /* 31A00..31AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 31B00..31BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 31C00..31CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 31D00..31DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 31E00..31EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 31F00..31FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 32000..320FF */
+  FriBidiPropsBlockLevel1_0800,  /* 32100..321FF */
+  FriBidiPropsBlockLevel1_0800,  /* 32200..322FF */
+  FriBidiPropsBlockLevel1_0800,  /* 32300..323FF */
+  FriBidiPropsBlockLevel1_0800,  /* 32400..324FF */
+  FriBidiPropsBlockLevel1_0800,  /* 32500..325FF */
+  FriBidiPropsBlockLevel1_0800,  /* 32600..326FF */
+  FriBidiPropsBlockLevel1_0800,  /* 32700..327FF */
+  FriBidiPropsBlockLevel1_0800,  /* 32800..328FF */
+  FriBidiPropsBlockLevel1_0800,  /* 32900..329FF */
+  FriBidiPropsBlockLevel1_0800,  /* 32A00..32AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 32B00..32BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 32C00..32CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 32D00..32DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 32E00..32EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 32F00..32FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 33000..330FF */
+  FriBidiPropsBlockLevel1_0800,  /* 33100..331FF */
+  FriBidiPropsBlockLevel1_0800,  /* 33200..332FF */
+  FriBidiPropsBlockLevel1_0800,  /* 33300..333FF */
+  FriBidiPropsBlockLevel1_0800,  /* 33400..334FF */
+  FriBidiPropsBlockLevel1_0800,  /* 33500..335FF */
+  FriBidiPropsBlockLevel1_0800,  /* 33600..336FF */
+  FriBidiPropsBlockLevel1_0800,  /* 33700..337FF */
+  FriBidiPropsBlockLevel1_0800,  /* 33800..338FF */
+  FriBidiPropsBlockLevel1_0800,  /* 33900..339FF */
+  FriBidiPropsBlockLevel1_0800,  /* 33A00..33AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 33B00..33BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 33C00..33CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 33D00..33DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 33E00..33EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 33F00..33FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 34000..340FF */
+  FriBidiPropsBlockLevel1_0800,  /* 34100..341FF */
+  FriBidiPropsBlockLevel1_0800,  /* 34200..342FF */
+  FriBidiPropsBlockLevel1_0800,  /* 34300..343FF */
+  FriBidiPropsBlockLevel1_0800,  /* 34400..344FF */
+  FriBidiPropsBlockLevel1_0800,  /* 34500..345FF */
+  FriBidiPropsBlockLevel1_0800,  /* 34600..346FF */
+  FriBidiPropsBlockLevel1_0800,  /* 34700..347FF */
+  FriBidiPropsBlockLevel1_0800,  /* 34800..348FF */
+  FriBidiPropsBlockLevel1_0800,  /* 34900..349FF */
+  FriBidiPropsBlockLevel1_0800,  /* 34A00..34AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 34B00..34BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 34C00..34CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 34D00..34DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 34E00..34EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 34F00..34FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 35000..350FF */
+  FriBidiPropsBlockLevel1_0800,  /* 35100..351FF */
+  FriBidiPropsBlockLevel1_0800,  /* 35200..352FF */
+  FriBidiPropsBlockLevel1_0800,  /* 35300..353FF */
+  FriBidiPropsBlockLevel1_0800,  /* 35400..354FF */
+  FriBidiPropsBlockLevel1_0800,  /* 35500..355FF */
+  FriBidiPropsBlockLevel1_0800,  /* 35600..356FF */
+  FriBidiPropsBlockLevel1_0800,  /* 35700..357FF */
+  FriBidiPropsBlockLevel1_0800,  /* 35800..358FF */
+  FriBidiPropsBlockLevel1_0800,  /* 35900..359FF */
+  FriBidiPropsBlockLevel1_0800,  /* 35A00..35AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 35B00..35BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 35C00..35CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 35D00..35DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 35E00..35EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 35F00..35FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 36000..360FF */
+  FriBidiPropsBlockLevel1_0800,  /* 36100..361FF */
+  FriBidiPropsBlockLevel1_0800,  /* 36200..362FF */
+  FriBidiPropsBlockLevel1_0800,  /* 36300..363FF */
+  FriBidiPropsBlockLevel1_0800,  /* 36400..364FF */
+  FriBidiPropsBlockLevel1_0800,  /* 36500..365FF */
+  FriBidiPropsBlockLevel1_0800,  /* 36600..366FF */
+  FriBidiPropsBlockLevel1_0800,  /* 36700..367FF */
+  FriBidiPropsBlockLevel1_0800,  /* 36800..368FF */
+  FriBidiPropsBlockLevel1_0800,  /* 36900..369FF */
+  FriBidiPropsBlockLevel1_0800,  /* 36A00..36AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 36B00..36BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 36C00..36CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 36D00..36DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 36E00..36EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 36F00..36FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 37000..370FF */
+  FriBidiPropsBlockLevel1_0800,  /* 37100..371FF */
+  FriBidiPropsBlockLevel1_0800,  /* 37200..372FF */
+  FriBidiPropsBlockLevel1_0800,  /* 37300..373FF */
+  FriBidiPropsBlockLevel1_0800,  /* 37400..374FF */
+  FriBidiPropsBlockLevel1_0800,  /* 37500..375FF */
+  FriBidiPropsBlockLevel1_0800,  /* 37600..376FF */
+  FriBidiPropsBlockLevel1_0800,  /* 37700..377FF */
+  FriBidiPropsBlockLevel1_0800,  /* 37800..378FF */
+  FriBidiPropsBlockLevel1_0800,  /* 37900..379FF */
+  FriBidiPropsBlockLevel1_0800,  /* 37A00..37AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 37B00..37BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 37C00..37CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 37D00..37DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 37E00..37EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 37F00..37FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 38000..380FF */
+  FriBidiPropsBlockLevel1_0800,  /* 38100..381FF */
+  FriBidiPropsBlockLevel1_0800,  /* 38200..382FF */
+  FriBidiPropsBlockLevel1_0800,  /* 38300..383FF */
+  FriBidiPropsBlockLevel1_0800,  /* 38400..384FF */
+  FriBidiPropsBlockLevel1_0800,  /* 38500..385FF */
+  FriBidiPropsBlockLevel1_0800,  /* 38600..386FF */
+  FriBidiPropsBlockLevel1_0800,  /* 38700..387FF */
+  FriBidiPropsBlockLevel1_0800,  /* 38800..388FF */
+  FriBidiPropsBlockLevel1_0800,  /* 38900..389FF */
+  FriBidiPropsBlockLevel1_0800,  /* 38A00..38AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 38B00..38BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 38C00..38CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 38D00..38DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 38E00..38EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 38F00..38FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 39000..390FF */
+  FriBidiPropsBlockLevel1_0800,  /* 39100..391FF */
+  FriBidiPropsBlockLevel1_0800,  /* 39200..392FF */
+  FriBidiPropsBlockLevel1_0800,  /* 39300..393FF */
+  FriBidiPropsBlockLevel1_0800,  /* 39400..394FF */
+  FriBidiPropsBlockLevel1_0800,  /* 39500..395FF */
+  FriBidiPropsBlockLevel1_0800,  /* 39600..396FF */
+  FriBidiPropsBlockLevel1_0800,  /* 39700..397FF */
+  FriBidiPropsBlockLevel1_0800,  /* 39800..398FF */
+  FriBidiPropsBlockLevel1_0800,  /* 39900..399FF */
+  FriBidiPropsBlockLevel1_0800,  /* 39A00..39AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 39B00..39BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 39C00..39CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 39D00..39DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 39E00..39EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 39F00..39FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 3A000..3A0FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3A100..3A1FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3A200..3A2FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3A300..3A3FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3A400..3A4FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3A500..3A5FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3A600..3A6FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3A700..3A7FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3A800..3A8FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3A900..3A9FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3AA00..3AAFF */
+  FriBidiPropsBlockLevel1_0800,  /* 3AB00..3ABFF */
+  FriBidiPropsBlockLevel1_0800,  /* 3AC00..3ACFF */
+  FriBidiPropsBlockLevel1_0800,  /* 3AD00..3ADFF */
+  FriBidiPropsBlockLevel1_0800,  /* 3AE00..3AEFF */
+  FriBidiPropsBlockLevel1_0800,  /* 3AF00..3AFFF */
+  FriBidiPropsBlockLevel1_0800,  /* 3B000..3B0FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3B100..3B1FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3B200..3B2FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3B300..3B3FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3B400..3B4FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3B500..3B5FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3B600..3B6FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3B700..3B7FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3B800..3B8FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3B900..3B9FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3BA00..3BAFF */
+  FriBidiPropsBlockLevel1_0800,  /* 3BB00..3BBFF */
+  FriBidiPropsBlockLevel1_0800,  /* 3BC00..3BCFF */
+  FriBidiPropsBlockLevel1_0800,  /* 3BD00..3BDFF */
+  FriBidiPropsBlockLevel1_0800,  /* 3BE00..3BEFF */
+  FriBidiPropsBlockLevel1_0800,  /* 3BF00..3BFFF */
+  FriBidiPropsBlockLevel1_0800,  /* 3C000..3C0FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3C100..3C1FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3C200..3C2FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3C300..3C3FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3C400..3C4FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3C500..3C5FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3C600..3C6FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3C700..3C7FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3C800..3C8FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3C900..3C9FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3CA00..3CAFF */
+  FriBidiPropsBlockLevel1_0800,  /* 3CB00..3CBFF */
+  FriBidiPropsBlockLevel1_0800,  /* 3CC00..3CCFF */
+  FriBidiPropsBlockLevel1_0800,  /* 3CD00..3CDFF */
+  FriBidiPropsBlockLevel1_0800,  /* 3CE00..3CEFF */
+  FriBidiPropsBlockLevel1_0800,  /* 3CF00..3CFFF */
+  FriBidiPropsBlockLevel1_0800,  /* 3D000..3D0FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3D100..3D1FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3D200..3D2FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3D300..3D3FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3D400..3D4FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3D500..3D5FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3D600..3D6FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3D700..3D7FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3D800..3D8FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3D900..3D9FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3DA00..3DAFF */
+  FriBidiPropsBlockLevel1_0800,  /* 3DB00..3DBFF */
+  FriBidiPropsBlockLevel1_0800,  /* 3DC00..3DCFF */
+  FriBidiPropsBlockLevel1_0800,  /* 3DD00..3DDFF */
+  FriBidiPropsBlockLevel1_0800,  /* 3DE00..3DEFF */
+  FriBidiPropsBlockLevel1_0800,  /* 3DF00..3DFFF */
+  FriBidiPropsBlockLevel1_0800,  /* 3E000..3E0FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3E100..3E1FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3E200..3E2FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3E300..3E3FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3E400..3E4FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3E500..3E5FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3E600..3E6FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3E700..3E7FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3E800..3E8FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3E900..3E9FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3EA00..3EAFF */
+  FriBidiPropsBlockLevel1_0800,  /* 3EB00..3EBFF */
+  FriBidiPropsBlockLevel1_0800,  /* 3EC00..3ECFF */
+  FriBidiPropsBlockLevel1_0800,  /* 3ED00..3EDFF */
+  FriBidiPropsBlockLevel1_0800,  /* 3EE00..3EEFF */
+  FriBidiPropsBlockLevel1_0800,  /* 3EF00..3EFFF */
+  FriBidiPropsBlockLevel1_0800,  /* 3F000..3F0FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3F100..3F1FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3F200..3F2FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3F300..3F3FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3F400..3F4FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3F500..3F5FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3F600..3F6FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3F700..3F7FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3F800..3F8FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3F900..3F9FF */
+  FriBidiPropsBlockLevel1_0800,  /* 3FA00..3FAFF */
+  FriBidiPropsBlockLevel1_0800,  /* 3FB00..3FBFF */
+  FriBidiPropsBlockLevel1_0800,  /* 3FC00..3FCFF */
+  FriBidiPropsBlockLevel1_0800,  /* 3FD00..3FDFF */
+  FriBidiPropsBlockLevel1_0800,  /* 3FE00..3FEFF */
+  FriBidiPropsBlockLevel1_0800,  /* 3FF00..3FFFF */
+  FriBidiPropsBlockLevel1_0800,  /* 40000..400FF */
+  FriBidiPropsBlockLevel1_0800,  /* 40100..401FF */
+  FriBidiPropsBlockLevel1_0800,  /* 40200..402FF */
+  FriBidiPropsBlockLevel1_0800,  /* 40300..403FF */
+  FriBidiPropsBlockLevel1_0800,  /* 40400..404FF */
+  FriBidiPropsBlockLevel1_0800,  /* 40500..405FF */
+  FriBidiPropsBlockLevel1_0800,  /* 40600..406FF */
+  FriBidiPropsBlockLevel1_0800,  /* 40700..407FF */
+  FriBidiPropsBlockLevel1_0800,  /* 40800..408FF */
+  FriBidiPropsBlockLevel1_0800,  /* 40900..409FF */
+  FriBidiPropsBlockLevel1_0800,  /* 40A00..40AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 40B00..40BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 40C00..40CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 40D00..40DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 40E00..40EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 40F00..40FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 41000..410FF */
+  FriBidiPropsBlockLevel1_0800,  /* 41100..411FF */
+  FriBidiPropsBlockLevel1_0800,  /* 41200..412FF */
+  FriBidiPropsBlockLevel1_0800,  /* 41300..413FF */
+  FriBidiPropsBlockLevel1_0800,  /* 41400..414FF */
+  FriBidiPropsBlockLevel1_0800,  /* 41500..415FF */
+  FriBidiPropsBlockLevel1_0800,  /* 41600..416FF */
+  FriBidiPropsBlockLevel1_0800,  /* 41700..417FF */
+  FriBidiPropsBlockLevel1_0800,  /* 41800..418FF */
+  FriBidiPropsBlockLevel1_0800,  /* 41900..419FF */
+  FriBidiPropsBlockLevel1_0800,  /* 41A00..41AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 41B00..41BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 41C00..41CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 41D00..41DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 41E00..41EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 41F00..41FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 42000..420FF */
+  FriBidiPropsBlockLevel1_0800,  /* 42100..421FF */
+  FriBidiPropsBlockLevel1_0800,  /* 42200..422FF */
+  FriBidiPropsBlockLevel1_0800,  /* 42300..423FF */
+  FriBidiPropsBlockLevel1_0800,  /* 42400..424FF */
+  FriBidiPropsBlockLevel1_0800,  /* 42500..425FF */
+  FriBidiPropsBlockLevel1_0800,  /* 42600..426FF */
+  FriBidiPropsBlockLevel1_0800,  /* 42700..427FF */
+  FriBidiPropsBlockLevel1_0800,  /* 42800..428FF */
+  FriBidiPropsBlockLevel1_0800,  /* 42900..429FF */
+  FriBidiPropsBlockLevel1_0800,  /* 42A00..42AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 42B00..42BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 42C00..42CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 42D00..42DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 42E00..42EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 42F00..42FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 43000..430FF */
+  FriBidiPropsBlockLevel1_0800,  /* 43100..431FF */
+  FriBidiPropsBlockLevel1_0800,  /* 43200..432FF */
+  FriBidiPropsBlockLevel1_0800,  /* 43300..433FF */
+  FriBidiPropsBlockLevel1_0800,  /* 43400..434FF */
+  FriBidiPropsBlockLevel1_0800,  /* 43500..435FF */
+  FriBidiPropsBlockLevel1_0800,  /* 43600..436FF */
+  FriBidiPropsBlockLevel1_0800,  /* 43700..437FF */
+  FriBidiPropsBlockLevel1_0800,  /* 43800..438FF */
+  FriBidiPropsBlockLevel1_0800,  /* 43900..439FF */
+  FriBidiPropsBlockLevel1_0800,  /* 43A00..43AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 43B00..43BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 43C00..43CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 43D00..43DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 43E00..43EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 43F00..43FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 44000..440FF */
+  FriBidiPropsBlockLevel1_0800,  /* 44100..441FF */
+  FriBidiPropsBlockLevel1_0800,  /* 44200..442FF */
+  FriBidiPropsBlockLevel1_0800,  /* 44300..443FF */
+  FriBidiPropsBlockLevel1_0800,  /* 44400..444FF */
+  FriBidiPropsBlockLevel1_0800,  /* 44500..445FF */
+  FriBidiPropsBlockLevel1_0800,  /* 44600..446FF */
+  FriBidiPropsBlockLevel1_0800,  /* 44700..447FF */
+  FriBidiPropsBlockLevel1_0800,  /* 44800..448FF */
+  FriBidiPropsBlockLevel1_0800,  /* 44900..449FF */
+  FriBidiPropsBlockLevel1_0800,  /* 44A00..44AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 44B00..44BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 44C00..44CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 44D00..44DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 44E00..44EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 44F00..44FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 45000..450FF */
+  FriBidiPropsBlockLevel1_0800,  /* 45100..451FF */
+  FriBidiPropsBlockLevel1_0800,  /* 45200..452FF */
+  FriBidiPropsBlockLevel1_0800,  /* 45300..453FF */
+  FriBidiPropsBlockLevel1_0800,  /* 45400..454FF */
+  FriBidiPropsBlockLevel1_0800,  /* 45500..455FF */
+  FriBidiPropsBlockLevel1_0800,  /* 45600..456FF */
+  FriBidiPropsBlockLevel1_0800,  /* 45700..457FF */
+  FriBidiPropsBlockLevel1_0800,  /* 45800..458FF */
+  FriBidiPropsBlockLevel1_0800,  /* 45900..459FF */
+  FriBidiPropsBlockLevel1_0800,  /* 45A00..45AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 45B00..45BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 45C00..45CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 45D00..45DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 45E00..45EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 45F00..45FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 46000..460FF */
+  FriBidiPropsBlockLevel1_0800,  /* 46100..461FF */
+  FriBidiPropsBlockLevel1_0800,  /* 46200..462FF */
+  FriBidiPropsBlockLevel1_0800,  /* 46300..463FF */
+  FriBidiPropsBlockLevel1_0800,  /* 46400..464FF */
+  FriBidiPropsBlockLevel1_0800,  /* 46500..465FF */
+  FriBidiPropsBlockLevel1_0800,  /* 46600..466FF */
+  FriBidiPropsBlockLevel1_0800,  /* 46700..467FF */
+  FriBidiPropsBlockLevel1_0800,  /* 46800..468FF */
+  FriBidiPropsBlockLevel1_0800,  /* 46900..469FF */
+  FriBidiPropsBlockLevel1_0800,  /* 46A00..46AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 46B00..46BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 46C00..46CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 46D00..46DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 46E00..46EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 46F00..46FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 47000..470FF */
+  FriBidiPropsBlockLevel1_0800,  /* 47100..471FF */
+  FriBidiPropsBlockLevel1_0800,  /* 47200..472FF */
+  FriBidiPropsBlockLevel1_0800,  /* 47300..473FF */
+  FriBidiPropsBlockLevel1_0800,  /* 47400..474FF */
+  FriBidiPropsBlockLevel1_0800,  /* 47500..475FF */
+  FriBidiPropsBlockLevel1_0800,  /* 47600..476FF */
+  FriBidiPropsBlockLevel1_0800,  /* 47700..477FF */
+  FriBidiPropsBlockLevel1_0800,  /* 47800..478FF */
+  FriBidiPropsBlockLevel1_0800,  /* 47900..479FF */
+  FriBidiPropsBlockLevel1_0800,  /* 47A00..47AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 47B00..47BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 47C00..47CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 47D00..47DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 47E00..47EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 47F00..47FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 48000..480FF */
+  FriBidiPropsBlockLevel1_0800,  /* 48100..481FF */
+  FriBidiPropsBlockLevel1_0800,  /* 48200..482FF */
+  FriBidiPropsBlockLevel1_0800,  /* 48300..483FF */
+  FriBidiPropsBlockLevel1_0800,  /* 48400..484FF */
+  FriBidiPropsBlockLevel1_0800,  /* 48500..485FF */
+  FriBidiPropsBlockLevel1_0800,  /* 48600..486FF */
+  FriBidiPropsBlockLevel1_0800,  /* 48700..487FF */
+  FriBidiPropsBlockLevel1_0800,  /* 48800..488FF */
+  FriBidiPropsBlockLevel1_0800,  /* 48900..489FF */
+  FriBidiPropsBlockLevel1_0800,  /* 48A00..48AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 48B00..48BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 48C00..48CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 48D00..48DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 48E00..48EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 48F00..48FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 49000..490FF */
+  FriBidiPropsBlockLevel1_0800,  /* 49100..491FF */
+  FriBidiPropsBlockLevel1_0800,  /* 49200..492FF */
+  FriBidiPropsBlockLevel1_0800,  /* 49300..493FF */
+  FriBidiPropsBlockLevel1_0800,  /* 49400..494FF */
+  FriBidiPropsBlockLevel1_0800,  /* 49500..495FF */
+  FriBidiPropsBlockLevel1_0800,  /* 49600..496FF */
+  FriBidiPropsBlockLevel1_0800,  /* 49700..497FF */
+  FriBidiPropsBlockLevel1_0800,  /* 49800..498FF */
+  FriBidiPropsBlockLevel1_0800,  /* 49900..499FF */
+  FriBidiPropsBlockLevel1_0800,  /* 49A00..49AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 49B00..49BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 49C00..49CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 49D00..49DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 49E00..49EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 49F00..49FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 4A000..4A0FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4A100..4A1FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4A200..4A2FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4A300..4A3FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4A400..4A4FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4A500..4A5FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4A600..4A6FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4A700..4A7FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4A800..4A8FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4A900..4A9FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4AA00..4AAFF */
+  FriBidiPropsBlockLevel1_0800,  /* 4AB00..4ABFF */
+  FriBidiPropsBlockLevel1_0800,  /* 4AC00..4ACFF */
+  FriBidiPropsBlockLevel1_0800,  /* 4AD00..4ADFF */
+  FriBidiPropsBlockLevel1_0800,  /* 4AE00..4AEFF */
+  FriBidiPropsBlockLevel1_0800,  /* 4AF00..4AFFF */
+  FriBidiPropsBlockLevel1_0800,  /* 4B000..4B0FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4B100..4B1FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4B200..4B2FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4B300..4B3FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4B400..4B4FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4B500..4B5FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4B600..4B6FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4B700..4B7FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4B800..4B8FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4B900..4B9FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4BA00..4BAFF */
+  FriBidiPropsBlockLevel1_0800,  /* 4BB00..4BBFF */
+  FriBidiPropsBlockLevel1_0800,  /* 4BC00..4BCFF */
+  FriBidiPropsBlockLevel1_0800,  /* 4BD00..4BDFF */
+  FriBidiPropsBlockLevel1_0800,  /* 4BE00..4BEFF */
+  FriBidiPropsBlockLevel1_0800,  /* 4BF00..4BFFF */
+  FriBidiPropsBlockLevel1_0800,  /* 4C000..4C0FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4C100..4C1FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4C200..4C2FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4C300..4C3FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4C400..4C4FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4C500..4C5FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4C600..4C6FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4C700..4C7FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4C800..4C8FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4C900..4C9FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4CA00..4CAFF */
+  FriBidiPropsBlockLevel1_0800,  /* 4CB00..4CBFF */
+  FriBidiPropsBlockLevel1_0800,  /* 4CC00..4CCFF */
+  FriBidiPropsBlockLevel1_0800,  /* 4CD00..4CDFF */
+  FriBidiPropsBlockLevel1_0800,  /* 4CE00..4CEFF */
+  FriBidiPropsBlockLevel1_0800,  /* 4CF00..4CFFF */
+  FriBidiPropsBlockLevel1_0800,  /* 4D000..4D0FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4D100..4D1FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4D200..4D2FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4D300..4D3FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4D400..4D4FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4D500..4D5FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4D600..4D6FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4D700..4D7FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4D800..4D8FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4D900..4D9FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4DA00..4DAFF */
+  FriBidiPropsBlockLevel1_0800,  /* 4DB00..4DBFF */
+  FriBidiPropsBlockLevel1_0800,  /* 4DC00..4DCFF */
+  FriBidiPropsBlockLevel1_0800,  /* 4DD00..4DDFF */
+  FriBidiPropsBlockLevel1_0800,  /* 4DE00..4DEFF */
+  FriBidiPropsBlockLevel1_0800,  /* 4DF00..4DFFF */
+  FriBidiPropsBlockLevel1_0800,  /* 4E000..4E0FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4E100..4E1FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4E200..4E2FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4E300..4E3FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4E400..4E4FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4E500..4E5FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4E600..4E6FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4E700..4E7FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4E800..4E8FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4E900..4E9FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4EA00..4EAFF */
+  FriBidiPropsBlockLevel1_0800,  /* 4EB00..4EBFF */
+  FriBidiPropsBlockLevel1_0800,  /* 4EC00..4ECFF */
+  FriBidiPropsBlockLevel1_0800,  /* 4ED00..4EDFF */
+  FriBidiPropsBlockLevel1_0800,  /* 4EE00..4EEFF */
+  FriBidiPropsBlockLevel1_0800,  /* 4EF00..4EFFF */
+  FriBidiPropsBlockLevel1_0800,  /* 4F000..4F0FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4F100..4F1FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4F200..4F2FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4F300..4F3FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4F400..4F4FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4F500..4F5FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4F600..4F6FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4F700..4F7FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4F800..4F8FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4F900..4F9FF */
+  FriBidiPropsBlockLevel1_0800,  /* 4FA00..4FAFF */
+  FriBidiPropsBlockLevel1_0800,  /* 4FB00..4FBFF */
+  FriBidiPropsBlockLevel1_0800,  /* 4FC00..4FCFF */
+  FriBidiPropsBlockLevel1_0800,  /* 4FD00..4FDFF */
+  FriBidiPropsBlockLevel1_0800,  /* 4FE00..4FEFF */
+  FriBidiPropsBlockLevel1_0800,  /* 4FF00..4FFFF */
+  FriBidiPropsBlockLevel1_0800,  /* 50000..500FF */
+  FriBidiPropsBlockLevel1_0800,  /* 50100..501FF */
+  FriBidiPropsBlockLevel1_0800,  /* 50200..502FF */
+  FriBidiPropsBlockLevel1_0800,  /* 50300..503FF */
+  FriBidiPropsBlockLevel1_0800,  /* 50400..504FF */
+  FriBidiPropsBlockLevel1_0800,  /* 50500..505FF */
+  FriBidiPropsBlockLevel1_0800,  /* 50600..506FF */
+  FriBidiPropsBlockLevel1_0800,  /* 50700..507FF */
+  FriBidiPropsBlockLevel1_0800,  /* 50800..508FF */
+  FriBidiPropsBlockLevel1_0800,  /* 50900..509FF */
+  FriBidiPropsBlockLevel1_0800,  /* 50A00..50AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 50B00..50BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 50C00..50CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 50D00..50DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 50E00..50EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 50F00..50FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 51000..510FF */
+  FriBidiPropsBlockLevel1_0800,  /* 51100..511FF */
+  FriBidiPropsBlockLevel1_0800,  /* 51200..512FF */
+  FriBidiPropsBlockLevel1_0800,  /* 51300..513FF */
+  FriBidiPropsBlockLevel1_0800,  /* 51400..514FF */
+  FriBidiPropsBlockLevel1_0800,  /* 51500..515FF */
+  FriBidiPropsBlockLevel1_0800,  /* 51600..516FF */
+  FriBidiPropsBlockLevel1_0800,  /* 51700..517FF */
+  FriBidiPropsBlockLevel1_0800,  /* 51800..518FF */
+  FriBidiPropsBlockLevel1_0800,  /* 51900..519FF */
+  FriBidiPropsBlockLevel1_0800,  /* 51A00..51AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 51B00..51BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 51C00..51CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 51D00..51DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 51E00..51EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 51F00..51FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 52000..520FF */
+  FriBidiPropsBlockLevel1_0800,  /* 52100..521FF */
+  FriBidiPropsBlockLevel1_0800,  /* 52200..522FF */
+  FriBidiPropsBlockLevel1_0800,  /* 52300..523FF */
+  FriBidiPropsBlockLevel1_0800,  /* 52400..524FF */
+  FriBidiPropsBlockLevel1_0800,  /* 52500..525FF */
+  FriBidiPropsBlockLevel1_0800,  /* 52600..526FF */
+  FriBidiPropsBlockLevel1_0800,  /* 52700..527FF */
+  FriBidiPropsBlockLevel1_0800,  /* 52800..528FF */
+  FriBidiPropsBlockLevel1_0800,  /* 52900..529FF */
+  FriBidiPropsBlockLevel1_0800,  /* 52A00..52AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 52B00..52BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 52C00..52CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 52D00..52DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 52E00..52EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 52F00..52FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 53000..530FF */
+  FriBidiPropsBlockLevel1_0800,  /* 53100..531FF */
+  FriBidiPropsBlockLevel1_0800,  /* 53200..532FF */
+  FriBidiPropsBlockLevel1_0800,  /* 53300..533FF */
+  FriBidiPropsBlockLevel1_0800,  /* 53400..534FF */
+  FriBidiPropsBlockLevel1_0800,  /* 53500..535FF */
+  FriBidiPropsBlockLevel1_0800,  /* 53600..536FF */
+  FriBidiPropsBlockLevel1_0800,  /* 53700..537FF */
+  FriBidiPropsBlockLevel1_0800,  /* 53800..538FF */
+  FriBidiPropsBlockLevel1_0800,  /* 53900..539FF */
+  FriBidiPropsBlockLevel1_0800,  /* 53A00..53AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 53B00..53BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 53C00..53CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 53D00..53DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 53E00..53EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 53F00..53FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 54000..540FF */
+  FriBidiPropsBlockLevel1_0800,  /* 54100..541FF */
+  FriBidiPropsBlockLevel1_0800,  /* 54200..542FF */
+  FriBidiPropsBlockLevel1_0800,  /* 54300..543FF */
+  FriBidiPropsBlockLevel1_0800,  /* 54400..544FF */
+  FriBidiPropsBlockLevel1_0800,  /* 54500..545FF */
+  FriBidiPropsBlockLevel1_0800,  /* 54600..546FF */
+  FriBidiPropsBlockLevel1_0800,  /* 54700..547FF */
+  FriBidiPropsBlockLevel1_0800,  /* 54800..548FF */
+  FriBidiPropsBlockLevel1_0800,  /* 54900..549FF */
+  FriBidiPropsBlockLevel1_0800,  /* 54A00..54AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 54B00..54BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 54C00..54CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 54D00..54DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 54E00..54EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 54F00..54FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 55000..550FF */
+  FriBidiPropsBlockLevel1_0800,  /* 55100..551FF */
+  FriBidiPropsBlockLevel1_0800,  /* 55200..552FF */
+  FriBidiPropsBlockLevel1_0800,  /* 55300..553FF */
+  FriBidiPropsBlockLevel1_0800,  /* 55400..554FF */
+  FriBidiPropsBlockLevel1_0800,  /* 55500..555FF */
+  FriBidiPropsBlockLevel1_0800,  /* 55600..556FF */
+  FriBidiPropsBlockLevel1_0800,  /* 55700..557FF */
+  FriBidiPropsBlockLevel1_0800,  /* 55800..558FF */
+  FriBidiPropsBlockLevel1_0800,  /* 55900..559FF */
+  FriBidiPropsBlockLevel1_0800,  /* 55A00..55AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 55B00..55BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 55C00..55CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 55D00..55DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 55E00..55EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 55F00..55FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 56000..560FF */
+  FriBidiPropsBlockLevel1_0800,  /* 56100..561FF */
+  FriBidiPropsBlockLevel1_0800,  /* 56200..562FF */
+  FriBidiPropsBlockLevel1_0800,  /* 56300..563FF */
+  FriBidiPropsBlockLevel1_0800,  /* 56400..564FF */
+  FriBidiPropsBlockLevel1_0800,  /* 56500..565FF */
+  FriBidiPropsBlockLevel1_0800,  /* 56600..566FF */
+  FriBidiPropsBlockLevel1_0800,  /* 56700..567FF */
+  FriBidiPropsBlockLevel1_0800,  /* 56800..568FF */
+  FriBidiPropsBlockLevel1_0800,  /* 56900..569FF */
+  FriBidiPropsBlockLevel1_0800,  /* 56A00..56AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 56B00..56BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 56C00..56CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 56D00..56DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 56E00..56EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 56F00..56FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 57000..570FF */
+  FriBidiPropsBlockLevel1_0800,  /* 57100..571FF */
+  FriBidiPropsBlockLevel1_0800,  /* 57200..572FF */
+  FriBidiPropsBlockLevel1_0800,  /* 57300..573FF */
+  FriBidiPropsBlockLevel1_0800,  /* 57400..574FF */
+  FriBidiPropsBlockLevel1_0800,  /* 57500..575FF */
+  FriBidiPropsBlockLevel1_0800,  /* 57600..576FF */
+  FriBidiPropsBlockLevel1_0800,  /* 57700..577FF */
+  FriBidiPropsBlockLevel1_0800,  /* 57800..578FF */
+  FriBidiPropsBlockLevel1_0800,  /* 57900..579FF */
+  FriBidiPropsBlockLevel1_0800,  /* 57A00..57AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 57B00..57BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 57C00..57CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 57D00..57DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 57E00..57EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 57F00..57FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 58000..580FF */
+  FriBidiPropsBlockLevel1_0800,  /* 58100..581FF */
+  FriBidiPropsBlockLevel1_0800,  /* 58200..582FF */
+  FriBidiPropsBlockLevel1_0800,  /* 58300..583FF */
+  FriBidiPropsBlockLevel1_0800,  /* 58400..584FF */
+  FriBidiPropsBlockLevel1_0800,  /* 58500..585FF */
+  FriBidiPropsBlockLevel1_0800,  /* 58600..586FF */
+  FriBidiPropsBlockLevel1_0800,  /* 58700..587FF */
+  FriBidiPropsBlockLevel1_0800,  /* 58800..588FF */
+  FriBidiPropsBlockLevel1_0800,  /* 58900..589FF */
+  FriBidiPropsBlockLevel1_0800,  /* 58A00..58AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 58B00..58BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 58C00..58CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 58D00..58DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 58E00..58EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 58F00..58FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 59000..590FF */
+  FriBidiPropsBlockLevel1_0800,  /* 59100..591FF */
+  FriBidiPropsBlockLevel1_0800,  /* 59200..592FF */
+  FriBidiPropsBlockLevel1_0800,  /* 59300..593FF */
+  FriBidiPropsBlockLevel1_0800,  /* 59400..594FF */
+  FriBidiPropsBlockLevel1_0800,  /* 59500..595FF */
+  FriBidiPropsBlockLevel1_0800,  /* 59600..596FF */
+  FriBidiPropsBlockLevel1_0800,  /* 59700..597FF */
+  FriBidiPropsBlockLevel1_0800,  /* 59800..598FF */
+  FriBidiPropsBlockLevel1_0800,  /* 59900..599FF */
+  FriBidiPropsBlockLevel1_0800,  /* 59A00..59AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 59B00..59BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 59C00..59CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 59D00..59DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 59E00..59EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 59F00..59FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 5A000..5A0FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5A100..5A1FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5A200..5A2FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5A300..5A3FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5A400..5A4FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5A500..5A5FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5A600..5A6FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5A700..5A7FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5A800..5A8FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5A900..5A9FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5AA00..5AAFF */
+  FriBidiPropsBlockLevel1_0800,  /* 5AB00..5ABFF */
+  FriBidiPropsBlockLevel1_0800,  /* 5AC00..5ACFF */
+  FriBidiPropsBlockLevel1_0800,  /* 5AD00..5ADFF */
+  FriBidiPropsBlockLevel1_0800,  /* 5AE00..5AEFF */
+  FriBidiPropsBlockLevel1_0800,  /* 5AF00..5AFFF */
+  FriBidiPropsBlockLevel1_0800,  /* 5B000..5B0FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5B100..5B1FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5B200..5B2FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5B300..5B3FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5B400..5B4FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5B500..5B5FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5B600..5B6FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5B700..5B7FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5B800..5B8FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5B900..5B9FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5BA00..5BAFF */
+  FriBidiPropsBlockLevel1_0800,  /* 5BB00..5BBFF */
+  FriBidiPropsBlockLevel1_0800,  /* 5BC00..5BCFF */
+  FriBidiPropsBlockLevel1_0800,  /* 5BD00..5BDFF */
+  FriBidiPropsBlockLevel1_0800,  /* 5BE00..5BEFF */
+  FriBidiPropsBlockLevel1_0800,  /* 5BF00..5BFFF */
+  FriBidiPropsBlockLevel1_0800,  /* 5C000..5C0FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5C100..5C1FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5C200..5C2FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5C300..5C3FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5C400..5C4FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5C500..5C5FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5C600..5C6FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5C700..5C7FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5C800..5C8FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5C900..5C9FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5CA00..5CAFF */
+  FriBidiPropsBlockLevel1_0800,  /* 5CB00..5CBFF */
+  FriBidiPropsBlockLevel1_0800,  /* 5CC00..5CCFF */
+  FriBidiPropsBlockLevel1_0800,  /* 5CD00..5CDFF */
+  FriBidiPropsBlockLevel1_0800,  /* 5CE00..5CEFF */
+  FriBidiPropsBlockLevel1_0800,  /* 5CF00..5CFFF */
+  FriBidiPropsBlockLevel1_0800,  /* 5D000..5D0FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5D100..5D1FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5D200..5D2FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5D300..5D3FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5D400..5D4FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5D500..5D5FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5D600..5D6FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5D700..5D7FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5D800..5D8FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5D900..5D9FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5DA00..5DAFF */
+  FriBidiPropsBlockLevel1_0800,  /* 5DB00..5DBFF */
+  FriBidiPropsBlockLevel1_0800,  /* 5DC00..5DCFF */
+  FriBidiPropsBlockLevel1_0800,  /* 5DD00..5DDFF */
+  FriBidiPropsBlockLevel1_0800,  /* 5DE00..5DEFF */
+  FriBidiPropsBlockLevel1_0800,  /* 5DF00..5DFFF */
+  FriBidiPropsBlockLevel1_0800,  /* 5E000..5E0FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5E100..5E1FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5E200..5E2FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5E300..5E3FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5E400..5E4FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5E500..5E5FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5E600..5E6FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5E700..5E7FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5E800..5E8FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5E900..5E9FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5EA00..5EAFF */
+  FriBidiPropsBlockLevel1_0800,  /* 5EB00..5EBFF */
+  FriBidiPropsBlockLevel1_0800,  /* 5EC00..5ECFF */
+  FriBidiPropsBlockLevel1_0800,  /* 5ED00..5EDFF */
+  FriBidiPropsBlockLevel1_0800,  /* 5EE00..5EEFF */
+  FriBidiPropsBlockLevel1_0800,  /* 5EF00..5EFFF */
+  FriBidiPropsBlockLevel1_0800,  /* 5F000..5F0FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5F100..5F1FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5F200..5F2FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5F300..5F3FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5F400..5F4FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5F500..5F5FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5F600..5F6FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5F700..5F7FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5F800..5F8FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5F900..5F9FF */
+  FriBidiPropsBlockLevel1_0800,  /* 5FA00..5FAFF */
+  FriBidiPropsBlockLevel1_0800,  /* 5FB00..5FBFF */
+  FriBidiPropsBlockLevel1_0800,  /* 5FC00..5FCFF */
+  FriBidiPropsBlockLevel1_0800,  /* 5FD00..5FDFF */
+  FriBidiPropsBlockLevel1_0800,  /* 5FE00..5FEFF */
+  FriBidiPropsBlockLevel1_0800,  /* 5FF00..5FFFF */
+  FriBidiPropsBlockLevel1_0800,  /* 60000..600FF */
+  FriBidiPropsBlockLevel1_0800,  /* 60100..601FF */
+  FriBidiPropsBlockLevel1_0800,  /* 60200..602FF */
+  FriBidiPropsBlockLevel1_0800,  /* 60300..603FF */
+  FriBidiPropsBlockLevel1_0800,  /* 60400..604FF */
+  FriBidiPropsBlockLevel1_0800,  /* 60500..605FF */
+  FriBidiPropsBlockLevel1_0800,  /* 60600..606FF */
+  FriBidiPropsBlockLevel1_0800,  /* 60700..607FF */
+  FriBidiPropsBlockLevel1_0800,  /* 60800..608FF */
+  FriBidiPropsBlockLevel1_0800,  /* 60900..609FF */
+  FriBidiPropsBlockLevel1_0800,  /* 60A00..60AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 60B00..60BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 60C00..60CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 60D00..60DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 60E00..60EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 60F00..60FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 61000..610FF */
+  FriBidiPropsBlockLevel1_0800,  /* 61100..611FF */
+  FriBidiPropsBlockLevel1_0800,  /* 61200..612FF */
+  FriBidiPropsBlockLevel1_0800,  /* 61300..613FF */
+  FriBidiPropsBlockLevel1_0800,  /* 61400..614FF */
+  FriBidiPropsBlockLevel1_0800,  /* 61500..615FF */
+  FriBidiPropsBlockLevel1_0800,  /* 61600..616FF */
+  FriBidiPropsBlockLevel1_0800,  /* 61700..617FF */
+  FriBidiPropsBlockLevel1_0800,  /* 61800..618FF */
+  FriBidiPropsBlockLevel1_0800,  /* 61900..619FF */
+  FriBidiPropsBlockLevel1_0800,  /* 61A00..61AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 61B00..61BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 61C00..61CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 61D00..61DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 61E00..61EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 61F00..61FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 62000..620FF */
+  FriBidiPropsBlockLevel1_0800,  /* 62100..621FF */
+  FriBidiPropsBlockLevel1_0800,  /* 62200..622FF */
+  FriBidiPropsBlockLevel1_0800,  /* 62300..623FF */
+  FriBidiPropsBlockLevel1_0800,  /* 62400..624FF */
+  FriBidiPropsBlockLevel1_0800,  /* 62500..625FF */
+  FriBidiPropsBlockLevel1_0800,  /* 62600..626FF */
+  FriBidiPropsBlockLevel1_0800,  /* 62700..627FF */
+  FriBidiPropsBlockLevel1_0800,  /* 62800..628FF */
+  FriBidiPropsBlockLevel1_0800,  /* 62900..629FF */
+  FriBidiPropsBlockLevel1_0800,  /* 62A00..62AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 62B00..62BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 62C00..62CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 62D00..62DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 62E00..62EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 62F00..62FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 63000..630FF */
+  FriBidiPropsBlockLevel1_0800,  /* 63100..631FF */
+  FriBidiPropsBlockLevel1_0800,  /* 63200..632FF */
+  FriBidiPropsBlockLevel1_0800,  /* 63300..633FF */
+  FriBidiPropsBlockLevel1_0800,  /* 63400..634FF */
+  FriBidiPropsBlockLevel1_0800,  /* 63500..635FF */
+  FriBidiPropsBlockLevel1_0800,  /* 63600..636FF */
+  FriBidiPropsBlockLevel1_0800,  /* 63700..637FF */
+  FriBidiPropsBlockLevel1_0800,  /* 63800..638FF */
+  FriBidiPropsBlockLevel1_0800,  /* 63900..639FF */
+  FriBidiPropsBlockLevel1_0800,  /* 63A00..63AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 63B00..63BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 63C00..63CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 63D00..63DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 63E00..63EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 63F00..63FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 64000..640FF */
+  FriBidiPropsBlockLevel1_0800,  /* 64100..641FF */
+  FriBidiPropsBlockLevel1_0800,  /* 64200..642FF */
+  FriBidiPropsBlockLevel1_0800,  /* 64300..643FF */
+  FriBidiPropsBlockLevel1_0800,  /* 64400..644FF */
+  FriBidiPropsBlockLevel1_0800,  /* 64500..645FF */
+  FriBidiPropsBlockLevel1_0800,  /* 64600..646FF */
+  FriBidiPropsBlockLevel1_0800,  /* 64700..647FF */
+  FriBidiPropsBlockLevel1_0800,  /* 64800..648FF */
+  FriBidiPropsBlockLevel1_0800,  /* 64900..649FF */
+  FriBidiPropsBlockLevel1_0800,  /* 64A00..64AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 64B00..64BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 64C00..64CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 64D00..64DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 64E00..64EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 64F00..64FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 65000..650FF */
+  FriBidiPropsBlockLevel1_0800,  /* 65100..651FF */
+  FriBidiPropsBlockLevel1_0800,  /* 65200..652FF */
+  FriBidiPropsBlockLevel1_0800,  /* 65300..653FF */
+  FriBidiPropsBlockLevel1_0800,  /* 65400..654FF */
+  FriBidiPropsBlockLevel1_0800,  /* 65500..655FF */
+  FriBidiPropsBlockLevel1_0800,  /* 65600..656FF */
+  FriBidiPropsBlockLevel1_0800,  /* 65700..657FF */
+  FriBidiPropsBlockLevel1_0800,  /* 65800..658FF */
+  FriBidiPropsBlockLevel1_0800,  /* 65900..659FF */
+  FriBidiPropsBlockLevel1_0800,  /* 65A00..65AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 65B00..65BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 65C00..65CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 65D00..65DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 65E00..65EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 65F00..65FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 66000..660FF */
+  FriBidiPropsBlockLevel1_0800,  /* 66100..661FF */
+  FriBidiPropsBlockLevel1_0800,  /* 66200..662FF */
+  FriBidiPropsBlockLevel1_0800,  /* 66300..663FF */
+  FriBidiPropsBlockLevel1_0800,  /* 66400..664FF */
+  FriBidiPropsBlockLevel1_0800,  /* 66500..665FF */
+  FriBidiPropsBlockLevel1_0800,  /* 66600..666FF */
+  FriBidiPropsBlockLevel1_0800,  /* 66700..667FF */
+  FriBidiPropsBlockLevel1_0800,  /* 66800..668FF */
+  FriBidiPropsBlockLevel1_0800,  /* 66900..669FF */
+  FriBidiPropsBlockLevel1_0800,  /* 66A00..66AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 66B00..66BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 66C00..66CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 66D00..66DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 66E00..66EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 66F00..66FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 67000..670FF */
+  FriBidiPropsBlockLevel1_0800,  /* 67100..671FF */
+  FriBidiPropsBlockLevel1_0800,  /* 67200..672FF */
+  FriBidiPropsBlockLevel1_0800,  /* 67300..673FF */
+  FriBidiPropsBlockLevel1_0800,  /* 67400..674FF */
+  FriBidiPropsBlockLevel1_0800,  /* 67500..675FF */
+  FriBidiPropsBlockLevel1_0800,  /* 67600..676FF */
+  FriBidiPropsBlockLevel1_0800,  /* 67700..677FF */
+  FriBidiPropsBlockLevel1_0800,  /* 67800..678FF */
+  FriBidiPropsBlockLevel1_0800,  /* 67900..679FF */
+  FriBidiPropsBlockLevel1_0800,  /* 67A00..67AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 67B00..67BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 67C00..67CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 67D00..67DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 67E00..67EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 67F00..67FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 68000..680FF */
+  FriBidiPropsBlockLevel1_0800,  /* 68100..681FF */
+  FriBidiPropsBlockLevel1_0800,  /* 68200..682FF */
+  FriBidiPropsBlockLevel1_0800,  /* 68300..683FF */
+  FriBidiPropsBlockLevel1_0800,  /* 68400..684FF */
+  FriBidiPropsBlockLevel1_0800,  /* 68500..685FF */
+  FriBidiPropsBlockLevel1_0800,  /* 68600..686FF */
+  FriBidiPropsBlockLevel1_0800,  /* 68700..687FF */
+  FriBidiPropsBlockLevel1_0800,  /* 68800..688FF */
+  FriBidiPropsBlockLevel1_0800,  /* 68900..689FF */
+  FriBidiPropsBlockLevel1_0800,  /* 68A00..68AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 68B00..68BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 68C00..68CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 68D00..68DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 68E00..68EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 68F00..68FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 69000..690FF */
+  FriBidiPropsBlockLevel1_0800,  /* 69100..691FF */
+  FriBidiPropsBlockLevel1_0800,  /* 69200..692FF */
+  FriBidiPropsBlockLevel1_0800,  /* 69300..693FF */
+  FriBidiPropsBlockLevel1_0800,  /* 69400..694FF */
+  FriBidiPropsBlockLevel1_0800,  /* 69500..695FF */
+  FriBidiPropsBlockLevel1_0800,  /* 69600..696FF */
+  FriBidiPropsBlockLevel1_0800,  /* 69700..697FF */
+  FriBidiPropsBlockLevel1_0800,  /* 69800..698FF */
+  FriBidiPropsBlockLevel1_0800,  /* 69900..699FF */
+  FriBidiPropsBlockLevel1_0800,  /* 69A00..69AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 69B00..69BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 69C00..69CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 69D00..69DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 69E00..69EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 69F00..69FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 6A000..6A0FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6A100..6A1FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6A200..6A2FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6A300..6A3FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6A400..6A4FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6A500..6A5FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6A600..6A6FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6A700..6A7FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6A800..6A8FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6A900..6A9FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6AA00..6AAFF */
+  FriBidiPropsBlockLevel1_0800,  /* 6AB00..6ABFF */
+  FriBidiPropsBlockLevel1_0800,  /* 6AC00..6ACFF */
+  FriBidiPropsBlockLevel1_0800,  /* 6AD00..6ADFF */
+  FriBidiPropsBlockLevel1_0800,  /* 6AE00..6AEFF */
+  FriBidiPropsBlockLevel1_0800,  /* 6AF00..6AFFF */
+  FriBidiPropsBlockLevel1_0800,  /* 6B000..6B0FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6B100..6B1FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6B200..6B2FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6B300..6B3FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6B400..6B4FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6B500..6B5FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6B600..6B6FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6B700..6B7FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6B800..6B8FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6B900..6B9FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6BA00..6BAFF */
+  FriBidiPropsBlockLevel1_0800,  /* 6BB00..6BBFF */
+  FriBidiPropsBlockLevel1_0800,  /* 6BC00..6BCFF */
+  FriBidiPropsBlockLevel1_0800,  /* 6BD00..6BDFF */
+  FriBidiPropsBlockLevel1_0800,  /* 6BE00..6BEFF */
+  FriBidiPropsBlockLevel1_0800,  /* 6BF00..6BFFF */
+  FriBidiPropsBlockLevel1_0800,  /* 6C000..6C0FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6C100..6C1FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6C200..6C2FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6C300..6C3FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6C400..6C4FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6C500..6C5FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6C600..6C6FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6C700..6C7FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6C800..6C8FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6C900..6C9FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6CA00..6CAFF */
+  FriBidiPropsBlockLevel1_0800,  /* 6CB00..6CBFF */
+  FriBidiPropsBlockLevel1_0800,  /* 6CC00..6CCFF */
+  FriBidiPropsBlockLevel1_0800,  /* 6CD00..6CDFF */
+  FriBidiPropsBlockLevel1_0800,  /* 6CE00..6CEFF */
+  FriBidiPropsBlockLevel1_0800,  /* 6CF00..6CFFF */
+  FriBidiPropsBlockLevel1_0800,  /* 6D000..6D0FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6D100..6D1FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6D200..6D2FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6D300..6D3FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6D400..6D4FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6D500..6D5FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6D600..6D6FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6D700..6D7FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6D800..6D8FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6D900..6D9FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6DA00..6DAFF */
+  FriBidiPropsBlockLevel1_0800,  /* 6DB00..6DBFF */
+  FriBidiPropsBlockLevel1_0800,  /* 6DC00..6DCFF */
+  FriBidiPropsBlockLevel1_0800,  /* 6DD00..6DDFF */
+  FriBidiPropsBlockLevel1_0800,  /* 6DE00..6DEFF */
+  FriBidiPropsBlockLevel1_0800,  /* 6DF00..6DFFF */
+  FriBidiPropsBlockLevel1_0800,  /* 6E000..6E0FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6E100..6E1FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6E200..6E2FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6E300..6E3FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6E400..6E4FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6E500..6E5FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6E600..6E6FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6E700..6E7FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6E800..6E8FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6E900..6E9FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6EA00..6EAFF */
+  FriBidiPropsBlockLevel1_0800,  /* 6EB00..6EBFF */
+  FriBidiPropsBlockLevel1_0800,  /* 6EC00..6ECFF */
+  FriBidiPropsBlockLevel1_0800,  /* 6ED00..6EDFF */
+  FriBidiPropsBlockLevel1_0800,  /* 6EE00..6EEFF */
+  FriBidiPropsBlockLevel1_0800,  /* 6EF00..6EFFF */
+  FriBidiPropsBlockLevel1_0800,  /* 6F000..6F0FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6F100..6F1FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6F200..6F2FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6F300..6F3FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6F400..6F4FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6F500..6F5FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6F600..6F6FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6F700..6F7FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6F800..6F8FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6F900..6F9FF */
+  FriBidiPropsBlockLevel1_0800,  /* 6FA00..6FAFF */
+  FriBidiPropsBlockLevel1_0800,  /* 6FB00..6FBFF */
+  FriBidiPropsBlockLevel1_0800,  /* 6FC00..6FCFF */
+  FriBidiPropsBlockLevel1_0800,  /* 6FD00..6FDFF */
+  FriBidiPropsBlockLevel1_0800,  /* 6FE00..6FEFF */
+  FriBidiPropsBlockLevel1_0800,  /* 6FF00..6FFFF */
+  FriBidiPropsBlockLevel1_0800,  /* 70000..700FF */
+  FriBidiPropsBlockLevel1_0800,  /* 70100..701FF */
+  FriBidiPropsBlockLevel1_0800,  /* 70200..702FF */
+  FriBidiPropsBlockLevel1_0800,  /* 70300..703FF */
+  FriBidiPropsBlockLevel1_0800,  /* 70400..704FF */
+  FriBidiPropsBlockLevel1_0800,  /* 70500..705FF */
+  FriBidiPropsBlockLevel1_0800,  /* 70600..706FF */
+  FriBidiPropsBlockLevel1_0800,  /* 70700..707FF */
+  FriBidiPropsBlockLevel1_0800,  /* 70800..708FF */
+  FriBidiPropsBlockLevel1_0800,  /* 70900..709FF */
+  FriBidiPropsBlockLevel1_0800,  /* 70A00..70AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 70B00..70BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 70C00..70CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 70D00..70DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 70E00..70EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 70F00..70FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 71000..710FF */
+  FriBidiPropsBlockLevel1_0800,  /* 71100..711FF */
+  FriBidiPropsBlockLevel1_0800,  /* 71200..712FF */
+  FriBidiPropsBlockLevel1_0800,  /* 71300..713FF */
+  FriBidiPropsBlockLevel1_0800,  /* 71400..714FF */
+  FriBidiPropsBlockLevel1_0800,  /* 71500..715FF */
+  FriBidiPropsBlockLevel1_0800,  /* 71600..716FF */
+  FriBidiPropsBlockLevel1_0800,  /* 71700..717FF */
+  FriBidiPropsBlockLevel1_0800,  /* 71800..718FF */
+  FriBidiPropsBlockLevel1_0800,  /* 71900..719FF */
+  FriBidiPropsBlockLevel1_0800,  /* 71A00..71AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 71B00..71BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 71C00..71CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 71D00..71DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 71E00..71EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 71F00..71FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 72000..720FF */
+  FriBidiPropsBlockLevel1_0800,  /* 72100..721FF */
+  FriBidiPropsBlockLevel1_0800,  /* 72200..722FF */
+  FriBidiPropsBlockLevel1_0800,  /* 72300..723FF */
+  FriBidiPropsBlockLevel1_0800,  /* 72400..724FF */
+  FriBidiPropsBlockLevel1_0800,  /* 72500..725FF */
+  FriBidiPropsBlockLevel1_0800,  /* 72600..726FF */
+  FriBidiPropsBlockLevel1_0800,  /* 72700..727FF */
+  FriBidiPropsBlockLevel1_0800,  /* 72800..728FF */
+  FriBidiPropsBlockLevel1_0800,  /* 72900..729FF */
+  FriBidiPropsBlockLevel1_0800,  /* 72A00..72AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 72B00..72BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 72C00..72CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 72D00..72DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 72E00..72EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 72F00..72FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 73000..730FF */
+  FriBidiPropsBlockLevel1_0800,  /* 73100..731FF */
+  FriBidiPropsBlockLevel1_0800,  /* 73200..732FF */
+  FriBidiPropsBlockLevel1_0800,  /* 73300..733FF */
+  FriBidiPropsBlockLevel1_0800,  /* 73400..734FF */
+  FriBidiPropsBlockLevel1_0800,  /* 73500..735FF */
+  FriBidiPropsBlockLevel1_0800,  /* 73600..736FF */
+  FriBidiPropsBlockLevel1_0800,  /* 73700..737FF */
+  FriBidiPropsBlockLevel1_0800,  /* 73800..738FF */
+  FriBidiPropsBlockLevel1_0800,  /* 73900..739FF */
+  FriBidiPropsBlockLevel1_0800,  /* 73A00..73AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 73B00..73BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 73C00..73CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 73D00..73DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 73E00..73EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 73F00..73FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 74000..740FF */
+  FriBidiPropsBlockLevel1_0800,  /* 74100..741FF */
+  FriBidiPropsBlockLevel1_0800,  /* 74200..742FF */
+  FriBidiPropsBlockLevel1_0800,  /* 74300..743FF */
+  FriBidiPropsBlockLevel1_0800,  /* 74400..744FF */
+  FriBidiPropsBlockLevel1_0800,  /* 74500..745FF */
+  FriBidiPropsBlockLevel1_0800,  /* 74600..746FF */
+  FriBidiPropsBlockLevel1_0800,  /* 74700..747FF */
+  FriBidiPropsBlockLevel1_0800,  /* 74800..748FF */
+  FriBidiPropsBlockLevel1_0800,  /* 74900..749FF */
+  FriBidiPropsBlockLevel1_0800,  /* 74A00..74AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 74B00..74BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 74C00..74CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 74D00..74DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 74E00..74EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 74F00..74FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 75000..750FF */
+  FriBidiPropsBlockLevel1_0800,  /* 75100..751FF */
+  FriBidiPropsBlockLevel1_0800,  /* 75200..752FF */
+  FriBidiPropsBlockLevel1_0800,  /* 75300..753FF */
+  FriBidiPropsBlockLevel1_0800,  /* 75400..754FF */
+  FriBidiPropsBlockLevel1_0800,  /* 75500..755FF */
+  FriBidiPropsBlockLevel1_0800,  /* 75600..756FF */
+  FriBidiPropsBlockLevel1_0800,  /* 75700..757FF */
+  FriBidiPropsBlockLevel1_0800,  /* 75800..758FF */
+  FriBidiPropsBlockLevel1_0800,  /* 75900..759FF */
+  FriBidiPropsBlockLevel1_0800,  /* 75A00..75AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 75B00..75BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 75C00..75CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 75D00..75DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 75E00..75EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 75F00..75FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 76000..760FF */
+  FriBidiPropsBlockLevel1_0800,  /* 76100..761FF */
+  FriBidiPropsBlockLevel1_0800,  /* 76200..762FF */
+  FriBidiPropsBlockLevel1_0800,  /* 76300..763FF */
+  FriBidiPropsBlockLevel1_0800,  /* 76400..764FF */
+  FriBidiPropsBlockLevel1_0800,  /* 76500..765FF */
+  FriBidiPropsBlockLevel1_0800,  /* 76600..766FF */
+  FriBidiPropsBlockLevel1_0800,  /* 76700..767FF */
+  FriBidiPropsBlockLevel1_0800,  /* 76800..768FF */
+  FriBidiPropsBlockLevel1_0800,  /* 76900..769FF */
+  FriBidiPropsBlockLevel1_0800,  /* 76A00..76AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 76B00..76BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 76C00..76CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 76D00..76DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 76E00..76EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 76F00..76FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 77000..770FF */
+  FriBidiPropsBlockLevel1_0800,  /* 77100..771FF */
+  FriBidiPropsBlockLevel1_0800,  /* 77200..772FF */
+  FriBidiPropsBlockLevel1_0800,  /* 77300..773FF */
+  FriBidiPropsBlockLevel1_0800,  /* 77400..774FF */
+  FriBidiPropsBlockLevel1_0800,  /* 77500..775FF */
+  FriBidiPropsBlockLevel1_0800,  /* 77600..776FF */
+  FriBidiPropsBlockLevel1_0800,  /* 77700..777FF */
+  FriBidiPropsBlockLevel1_0800,  /* 77800..778FF */
+  FriBidiPropsBlockLevel1_0800,  /* 77900..779FF */
+  FriBidiPropsBlockLevel1_0800,  /* 77A00..77AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 77B00..77BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 77C00..77CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 77D00..77DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 77E00..77EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 77F00..77FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 78000..780FF */
+  FriBidiPropsBlockLevel1_0800,  /* 78100..781FF */
+  FriBidiPropsBlockLevel1_0800,  /* 78200..782FF */
+  FriBidiPropsBlockLevel1_0800,  /* 78300..783FF */
+  FriBidiPropsBlockLevel1_0800,  /* 78400..784FF */
+  FriBidiPropsBlockLevel1_0800,  /* 78500..785FF */
+  FriBidiPropsBlockLevel1_0800,  /* 78600..786FF */
+  FriBidiPropsBlockLevel1_0800,  /* 78700..787FF */
+  FriBidiPropsBlockLevel1_0800,  /* 78800..788FF */
+  FriBidiPropsBlockLevel1_0800,  /* 78900..789FF */
+  FriBidiPropsBlockLevel1_0800,  /* 78A00..78AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 78B00..78BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 78C00..78CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 78D00..78DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 78E00..78EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 78F00..78FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 79000..790FF */
+  FriBidiPropsBlockLevel1_0800,  /* 79100..791FF */
+  FriBidiPropsBlockLevel1_0800,  /* 79200..792FF */
+  FriBidiPropsBlockLevel1_0800,  /* 79300..793FF */
+  FriBidiPropsBlockLevel1_0800,  /* 79400..794FF */
+  FriBidiPropsBlockLevel1_0800,  /* 79500..795FF */
+  FriBidiPropsBlockLevel1_0800,  /* 79600..796FF */
+  FriBidiPropsBlockLevel1_0800,  /* 79700..797FF */
+  FriBidiPropsBlockLevel1_0800,  /* 79800..798FF */
+  FriBidiPropsBlockLevel1_0800,  /* 79900..799FF */
+  FriBidiPropsBlockLevel1_0800,  /* 79A00..79AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 79B00..79BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 79C00..79CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 79D00..79DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 79E00..79EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 79F00..79FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 7A000..7A0FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7A100..7A1FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7A200..7A2FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7A300..7A3FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7A400..7A4FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7A500..7A5FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7A600..7A6FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7A700..7A7FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7A800..7A8FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7A900..7A9FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7AA00..7AAFF */
+  FriBidiPropsBlockLevel1_0800,  /* 7AB00..7ABFF */
+  FriBidiPropsBlockLevel1_0800,  /* 7AC00..7ACFF */
+  FriBidiPropsBlockLevel1_0800,  /* 7AD00..7ADFF */
+  FriBidiPropsBlockLevel1_0800,  /* 7AE00..7AEFF */
+  FriBidiPropsBlockLevel1_0800,  /* 7AF00..7AFFF */
+  FriBidiPropsBlockLevel1_0800,  /* 7B000..7B0FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7B100..7B1FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7B200..7B2FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7B300..7B3FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7B400..7B4FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7B500..7B5FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7B600..7B6FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7B700..7B7FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7B800..7B8FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7B900..7B9FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7BA00..7BAFF */
+  FriBidiPropsBlockLevel1_0800,  /* 7BB00..7BBFF */
+  FriBidiPropsBlockLevel1_0800,  /* 7BC00..7BCFF */
+  FriBidiPropsBlockLevel1_0800,  /* 7BD00..7BDFF */
+  FriBidiPropsBlockLevel1_0800,  /* 7BE00..7BEFF */
+  FriBidiPropsBlockLevel1_0800,  /* 7BF00..7BFFF */
+  FriBidiPropsBlockLevel1_0800,  /* 7C000..7C0FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7C100..7C1FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7C200..7C2FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7C300..7C3FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7C400..7C4FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7C500..7C5FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7C600..7C6FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7C700..7C7FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7C800..7C8FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7C900..7C9FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7CA00..7CAFF */
+  FriBidiPropsBlockLevel1_0800,  /* 7CB00..7CBFF */
+  FriBidiPropsBlockLevel1_0800,  /* 7CC00..7CCFF */
+  FriBidiPropsBlockLevel1_0800,  /* 7CD00..7CDFF */
+  FriBidiPropsBlockLevel1_0800,  /* 7CE00..7CEFF */
+  FriBidiPropsBlockLevel1_0800,  /* 7CF00..7CFFF */
+  FriBidiPropsBlockLevel1_0800,  /* 7D000..7D0FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7D100..7D1FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7D200..7D2FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7D300..7D3FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7D400..7D4FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7D500..7D5FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7D600..7D6FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7D700..7D7FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7D800..7D8FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7D900..7D9FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7DA00..7DAFF */
+  FriBidiPropsBlockLevel1_0800,  /* 7DB00..7DBFF */
+  FriBidiPropsBlockLevel1_0800,  /* 7DC00..7DCFF */
+  FriBidiPropsBlockLevel1_0800,  /* 7DD00..7DDFF */
+  FriBidiPropsBlockLevel1_0800,  /* 7DE00..7DEFF */
+  FriBidiPropsBlockLevel1_0800,  /* 7DF00..7DFFF */
+  FriBidiPropsBlockLevel1_0800,  /* 7E000..7E0FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7E100..7E1FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7E200..7E2FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7E300..7E3FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7E400..7E4FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7E500..7E5FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7E600..7E6FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7E700..7E7FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7E800..7E8FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7E900..7E9FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7EA00..7EAFF */
+  FriBidiPropsBlockLevel1_0800,  /* 7EB00..7EBFF */
+  FriBidiPropsBlockLevel1_0800,  /* 7EC00..7ECFF */
+  FriBidiPropsBlockLevel1_0800,  /* 7ED00..7EDFF */
+  FriBidiPropsBlockLevel1_0800,  /* 7EE00..7EEFF */
+  FriBidiPropsBlockLevel1_0800,  /* 7EF00..7EFFF */
+  FriBidiPropsBlockLevel1_0800,  /* 7F000..7F0FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7F100..7F1FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7F200..7F2FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7F300..7F3FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7F400..7F4FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7F500..7F5FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7F600..7F6FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7F700..7F7FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7F800..7F8FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7F900..7F9FF */
+  FriBidiPropsBlockLevel1_0800,  /* 7FA00..7FAFF */
+  FriBidiPropsBlockLevel1_0800,  /* 7FB00..7FBFF */
+  FriBidiPropsBlockLevel1_0800,  /* 7FC00..7FCFF */
+  FriBidiPropsBlockLevel1_0800,  /* 7FD00..7FDFF */
+  FriBidiPropsBlockLevel1_0800,  /* 7FE00..7FEFF */
+  FriBidiPropsBlockLevel1_0800,  /* 7FF00..7FFFF */
+  FriBidiPropsBlockLevel1_0800,  /* 80000..800FF */
+  FriBidiPropsBlockLevel1_0800,  /* 80100..801FF */
+  FriBidiPropsBlockLevel1_0800,  /* 80200..802FF */
+  FriBidiPropsBlockLevel1_0800,  /* 80300..803FF */
+  FriBidiPropsBlockLevel1_0800,  /* 80400..804FF */
+  FriBidiPropsBlockLevel1_0800,  /* 80500..805FF */
+  FriBidiPropsBlockLevel1_0800,  /* 80600..806FF */
+  FriBidiPropsBlockLevel1_0800,  /* 80700..807FF */
+  FriBidiPropsBlockLevel1_0800,  /* 80800..808FF */
+  FriBidiPropsBlockLevel1_0800,  /* 80900..809FF */
+  FriBidiPropsBlockLevel1_0800,  /* 80A00..80AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 80B00..80BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 80C00..80CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 80D00..80DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 80E00..80EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 80F00..80FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 81000..810FF */
+  FriBidiPropsBlockLevel1_0800,  /* 81100..811FF */
+  FriBidiPropsBlockLevel1_0800,  /* 81200..812FF */
+  FriBidiPropsBlockLevel1_0800,  /* 81300..813FF */
+  FriBidiPropsBlockLevel1_0800,  /* 81400..814FF */
+  FriBidiPropsBlockLevel1_0800,  /* 81500..815FF */
+  FriBidiPropsBlockLevel1_0800,  /* 81600..816FF */
+  FriBidiPropsBlockLevel1_0800,  /* 81700..817FF */
+  FriBidiPropsBlockLevel1_0800,  /* 81800..818FF */
+  FriBidiPropsBlockLevel1_0800,  /* 81900..819FF */
+  FriBidiPropsBlockLevel1_0800,  /* 81A00..81AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 81B00..81BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 81C00..81CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 81D00..81DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 81E00..81EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 81F00..81FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 82000..820FF */
+  FriBidiPropsBlockLevel1_0800,  /* 82100..821FF */
+  FriBidiPropsBlockLevel1_0800,  /* 82200..822FF */
+  FriBidiPropsBlockLevel1_0800,  /* 82300..823FF */
+  FriBidiPropsBlockLevel1_0800,  /* 82400..824FF */
+  FriBidiPropsBlockLevel1_0800,  /* 82500..825FF */
+  FriBidiPropsBlockLevel1_0800,  /* 82600..826FF */
+  FriBidiPropsBlockLevel1_0800,  /* 82700..827FF */
+  FriBidiPropsBlockLevel1_0800,  /* 82800..828FF */
+  FriBidiPropsBlockLevel1_0800,  /* 82900..829FF */
+  FriBidiPropsBlockLevel1_0800,  /* 82A00..82AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 82B00..82BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 82C00..82CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 82D00..82DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 82E00..82EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 82F00..82FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 83000..830FF */
+  FriBidiPropsBlockLevel1_0800,  /* 83100..831FF */
+  FriBidiPropsBlockLevel1_0800,  /* 83200..832FF */
+  FriBidiPropsBlockLevel1_0800,  /* 83300..833FF */
+  FriBidiPropsBlockLevel1_0800,  /* 83400..834FF */
+  FriBidiPropsBlockLevel1_0800,  /* 83500..835FF */
+  FriBidiPropsBlockLevel1_0800,  /* 83600..836FF */
+  FriBidiPropsBlockLevel1_0800,  /* 83700..837FF */
+  FriBidiPropsBlockLevel1_0800,  /* 83800..838FF */
+  FriBidiPropsBlockLevel1_0800,  /* 83900..839FF */
+  FriBidiPropsBlockLevel1_0800,  /* 83A00..83AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 83B00..83BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 83C00..83CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 83D00..83DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 83E00..83EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 83F00..83FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 84000..840FF */
+  FriBidiPropsBlockLevel1_0800,  /* 84100..841FF */
+  FriBidiPropsBlockLevel1_0800,  /* 84200..842FF */
+  FriBidiPropsBlockLevel1_0800,  /* 84300..843FF */
+  FriBidiPropsBlockLevel1_0800,  /* 84400..844FF */
+  FriBidiPropsBlockLevel1_0800,  /* 84500..845FF */
+  FriBidiPropsBlockLevel1_0800,  /* 84600..846FF */
+  FriBidiPropsBlockLevel1_0800,  /* 84700..847FF */
+  FriBidiPropsBlockLevel1_0800,  /* 84800..848FF */
+  FriBidiPropsBlockLevel1_0800,  /* 84900..849FF */
+  FriBidiPropsBlockLevel1_0800,  /* 84A00..84AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 84B00..84BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 84C00..84CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 84D00..84DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 84E00..84EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 84F00..84FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 85000..850FF */
+  FriBidiPropsBlockLevel1_0800,  /* 85100..851FF */
+  FriBidiPropsBlockLevel1_0800,  /* 85200..852FF */
+  FriBidiPropsBlockLevel1_0800,  /* 85300..853FF */
+  FriBidiPropsBlockLevel1_0800,  /* 85400..854FF */
+  FriBidiPropsBlockLevel1_0800,  /* 85500..855FF */
+  FriBidiPropsBlockLevel1_0800,  /* 85600..856FF */
+  FriBidiPropsBlockLevel1_0800,  /* 85700..857FF */
+  FriBidiPropsBlockLevel1_0800,  /* 85800..858FF */
+  FriBidiPropsBlockLevel1_0800,  /* 85900..859FF */
+  FriBidiPropsBlockLevel1_0800,  /* 85A00..85AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 85B00..85BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 85C00..85CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 85D00..85DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 85E00..85EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 85F00..85FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 86000..860FF */
+  FriBidiPropsBlockLevel1_0800,  /* 86100..861FF */
+  FriBidiPropsBlockLevel1_0800,  /* 86200..862FF */
+  FriBidiPropsBlockLevel1_0800,  /* 86300..863FF */
+  FriBidiPropsBlockLevel1_0800,  /* 86400..864FF */
+  FriBidiPropsBlockLevel1_0800,  /* 86500..865FF */
+  FriBidiPropsBlockLevel1_0800,  /* 86600..866FF */
+  FriBidiPropsBlockLevel1_0800,  /* 86700..867FF */
+  FriBidiPropsBlockLevel1_0800,  /* 86800..868FF */
+  FriBidiPropsBlockLevel1_0800,  /* 86900..869FF */
+  FriBidiPropsBlockLevel1_0800,  /* 86A00..86AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 86B00..86BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 86C00..86CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 86D00..86DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 86E00..86EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 86F00..86FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 87000..870FF */
+  FriBidiPropsBlockLevel1_0800,  /* 87100..871FF */
+  FriBidiPropsBlockLevel1_0800,  /* 87200..872FF */
+  FriBidiPropsBlockLevel1_0800,  /* 87300..873FF */
+  FriBidiPropsBlockLevel1_0800,  /* 87400..874FF */
+  FriBidiPropsBlockLevel1_0800,  /* 87500..875FF */
+  FriBidiPropsBlockLevel1_0800,  /* 87600..876FF */
+  FriBidiPropsBlockLevel1_0800,  /* 87700..877FF */
+  FriBidiPropsBlockLevel1_0800,  /* 87800..878FF */
+  FriBidiPropsBlockLevel1_0800,  /* 87900..879FF */
+  FriBidiPropsBlockLevel1_0800,  /* 87A00..87AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 87B00..87BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 87C00..87CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 87D00..87DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 87E00..87EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 87F00..87FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 88000..880FF */
+  FriBidiPropsBlockLevel1_0800,  /* 88100..881FF */
+  FriBidiPropsBlockLevel1_0800,  /* 88200..882FF */
+  FriBidiPropsBlockLevel1_0800,  /* 88300..883FF */
+  FriBidiPropsBlockLevel1_0800,  /* 88400..884FF */
+  FriBidiPropsBlockLevel1_0800,  /* 88500..885FF */
+  FriBidiPropsBlockLevel1_0800,  /* 88600..886FF */
+  FriBidiPropsBlockLevel1_0800,  /* 88700..887FF */
+  FriBidiPropsBlockLevel1_0800,  /* 88800..888FF */
+  FriBidiPropsBlockLevel1_0800,  /* 88900..889FF */
+  FriBidiPropsBlockLevel1_0800,  /* 88A00..88AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 88B00..88BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 88C00..88CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 88D00..88DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 88E00..88EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 88F00..88FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 89000..890FF */
+  FriBidiPropsBlockLevel1_0800,  /* 89100..891FF */
+  FriBidiPropsBlockLevel1_0800,  /* 89200..892FF */
+  FriBidiPropsBlockLevel1_0800,  /* 89300..893FF */
+  FriBidiPropsBlockLevel1_0800,  /* 89400..894FF */
+  FriBidiPropsBlockLevel1_0800,  /* 89500..895FF */
+  FriBidiPropsBlockLevel1_0800,  /* 89600..896FF */
+  FriBidiPropsBlockLevel1_0800,  /* 89700..897FF */
+  FriBidiPropsBlockLevel1_0800,  /* 89800..898FF */
+  FriBidiPropsBlockLevel1_0800,  /* 89900..899FF */
+  FriBidiPropsBlockLevel1_0800,  /* 89A00..89AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 89B00..89BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 89C00..89CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 89D00..89DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 89E00..89EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 89F00..89FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 8A000..8A0FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8A100..8A1FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8A200..8A2FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8A300..8A3FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8A400..8A4FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8A500..8A5FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8A600..8A6FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8A700..8A7FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8A800..8A8FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8A900..8A9FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8AA00..8AAFF */
+  FriBidiPropsBlockLevel1_0800,  /* 8AB00..8ABFF */
+  FriBidiPropsBlockLevel1_0800,  /* 8AC00..8ACFF */
+  FriBidiPropsBlockLevel1_0800,  /* 8AD00..8ADFF */
+  FriBidiPropsBlockLevel1_0800,  /* 8AE00..8AEFF */
+  FriBidiPropsBlockLevel1_0800,  /* 8AF00..8AFFF */
+  FriBidiPropsBlockLevel1_0800,  /* 8B000..8B0FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8B100..8B1FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8B200..8B2FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8B300..8B3FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8B400..8B4FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8B500..8B5FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8B600..8B6FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8B700..8B7FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8B800..8B8FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8B900..8B9FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8BA00..8BAFF */
+  FriBidiPropsBlockLevel1_0800,  /* 8BB00..8BBFF */
+  FriBidiPropsBlockLevel1_0800,  /* 8BC00..8BCFF */
+  FriBidiPropsBlockLevel1_0800,  /* 8BD00..8BDFF */
+  FriBidiPropsBlockLevel1_0800,  /* 8BE00..8BEFF */
+  FriBidiPropsBlockLevel1_0800,  /* 8BF00..8BFFF */
+  FriBidiPropsBlockLevel1_0800,  /* 8C000..8C0FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8C100..8C1FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8C200..8C2FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8C300..8C3FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8C400..8C4FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8C500..8C5FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8C600..8C6FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8C700..8C7FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8C800..8C8FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8C900..8C9FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8CA00..8CAFF */
+  FriBidiPropsBlockLevel1_0800,  /* 8CB00..8CBFF */
+  FriBidiPropsBlockLevel1_0800,  /* 8CC00..8CCFF */
+  FriBidiPropsBlockLevel1_0800,  /* 8CD00..8CDFF */
+  FriBidiPropsBlockLevel1_0800,  /* 8CE00..8CEFF */
+  FriBidiPropsBlockLevel1_0800,  /* 8CF00..8CFFF */
+  FriBidiPropsBlockLevel1_0800,  /* 8D000..8D0FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8D100..8D1FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8D200..8D2FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8D300..8D3FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8D400..8D4FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8D500..8D5FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8D600..8D6FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8D700..8D7FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8D800..8D8FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8D900..8D9FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8DA00..8DAFF */
+  FriBidiPropsBlockLevel1_0800,  /* 8DB00..8DBFF */
+  FriBidiPropsBlockLevel1_0800,  /* 8DC00..8DCFF */
+  FriBidiPropsBlockLevel1_0800,  /* 8DD00..8DDFF */
+  FriBidiPropsBlockLevel1_0800,  /* 8DE00..8DEFF */
+  FriBidiPropsBlockLevel1_0800,  /* 8DF00..8DFFF */
+  FriBidiPropsBlockLevel1_0800,  /* 8E000..8E0FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8E100..8E1FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8E200..8E2FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8E300..8E3FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8E400..8E4FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8E500..8E5FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8E600..8E6FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8E700..8E7FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8E800..8E8FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8E900..8E9FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8EA00..8EAFF */
+  FriBidiPropsBlockLevel1_0800,  /* 8EB00..8EBFF */
+  FriBidiPropsBlockLevel1_0800,  /* 8EC00..8ECFF */
+  FriBidiPropsBlockLevel1_0800,  /* 8ED00..8EDFF */
+  FriBidiPropsBlockLevel1_0800,  /* 8EE00..8EEFF */
+  FriBidiPropsBlockLevel1_0800,  /* 8EF00..8EFFF */
+  FriBidiPropsBlockLevel1_0800,  /* 8F000..8F0FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8F100..8F1FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8F200..8F2FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8F300..8F3FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8F400..8F4FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8F500..8F5FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8F600..8F6FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8F700..8F7FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8F800..8F8FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8F900..8F9FF */
+  FriBidiPropsBlockLevel1_0800,  /* 8FA00..8FAFF */
+  FriBidiPropsBlockLevel1_0800,  /* 8FB00..8FBFF */
+  FriBidiPropsBlockLevel1_0800,  /* 8FC00..8FCFF */
+  FriBidiPropsBlockLevel1_0800,  /* 8FD00..8FDFF */
+  FriBidiPropsBlockLevel1_0800,  /* 8FE00..8FEFF */
+  FriBidiPropsBlockLevel1_0800,  /* 8FF00..8FFFF */
+  FriBidiPropsBlockLevel1_0800,  /* 90000..900FF */
+  FriBidiPropsBlockLevel1_0800,  /* 90100..901FF */
+  FriBidiPropsBlockLevel1_0800,  /* 90200..902FF */
+  FriBidiPropsBlockLevel1_0800,  /* 90300..903FF */
+  FriBidiPropsBlockLevel1_0800,  /* 90400..904FF */
+  FriBidiPropsBlockLevel1_0800,  /* 90500..905FF */
+  FriBidiPropsBlockLevel1_0800,  /* 90600..906FF */
+  FriBidiPropsBlockLevel1_0800,  /* 90700..907FF */
+  FriBidiPropsBlockLevel1_0800,  /* 90800..908FF */
+  FriBidiPropsBlockLevel1_0800,  /* 90900..909FF */
+  FriBidiPropsBlockLevel1_0800,  /* 90A00..90AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 90B00..90BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 90C00..90CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 90D00..90DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 90E00..90EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 90F00..90FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 91000..910FF */
+  FriBidiPropsBlockLevel1_0800,  /* 91100..911FF */
+  FriBidiPropsBlockLevel1_0800,  /* 91200..912FF */
+  FriBidiPropsBlockLevel1_0800,  /* 91300..913FF */
+  FriBidiPropsBlockLevel1_0800,  /* 91400..914FF */
+  FriBidiPropsBlockLevel1_0800,  /* 91500..915FF */
+  FriBidiPropsBlockLevel1_0800,  /* 91600..916FF */
+  FriBidiPropsBlockLevel1_0800,  /* 91700..917FF */
+  FriBidiPropsBlockLevel1_0800,  /* 91800..918FF */
+  FriBidiPropsBlockLevel1_0800,  /* 91900..919FF */
+  FriBidiPropsBlockLevel1_0800,  /* 91A00..91AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 91B00..91BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 91C00..91CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 91D00..91DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 91E00..91EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 91F00..91FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 92000..920FF */
+  FriBidiPropsBlockLevel1_0800,  /* 92100..921FF */
+  FriBidiPropsBlockLevel1_0800,  /* 92200..922FF */
+  FriBidiPropsBlockLevel1_0800,  /* 92300..923FF */
+  FriBidiPropsBlockLevel1_0800,  /* 92400..924FF */
+  FriBidiPropsBlockLevel1_0800,  /* 92500..925FF */
+  FriBidiPropsBlockLevel1_0800,  /* 92600..926FF */
+  FriBidiPropsBlockLevel1_0800,  /* 92700..927FF */
+  FriBidiPropsBlockLevel1_0800,  /* 92800..928FF */
+  FriBidiPropsBlockLevel1_0800,  /* 92900..929FF */
+  FriBidiPropsBlockLevel1_0800,  /* 92A00..92AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 92B00..92BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 92C00..92CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 92D00..92DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 92E00..92EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 92F00..92FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 93000..930FF */
+  FriBidiPropsBlockLevel1_0800,  /* 93100..931FF */
+  FriBidiPropsBlockLevel1_0800,  /* 93200..932FF */
+  FriBidiPropsBlockLevel1_0800,  /* 93300..933FF */
+  FriBidiPropsBlockLevel1_0800,  /* 93400..934FF */
+  FriBidiPropsBlockLevel1_0800,  /* 93500..935FF */
+  FriBidiPropsBlockLevel1_0800,  /* 93600..936FF */
+  FriBidiPropsBlockLevel1_0800,  /* 93700..937FF */
+  FriBidiPropsBlockLevel1_0800,  /* 93800..938FF */
+  FriBidiPropsBlockLevel1_0800,  /* 93900..939FF */
+  FriBidiPropsBlockLevel1_0800,  /* 93A00..93AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 93B00..93BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 93C00..93CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 93D00..93DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 93E00..93EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 93F00..93FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 94000..940FF */
+  FriBidiPropsBlockLevel1_0800,  /* 94100..941FF */
+  FriBidiPropsBlockLevel1_0800,  /* 94200..942FF */
+  FriBidiPropsBlockLevel1_0800,  /* 94300..943FF */
+  FriBidiPropsBlockLevel1_0800,  /* 94400..944FF */
+  FriBidiPropsBlockLevel1_0800,  /* 94500..945FF */
+  FriBidiPropsBlockLevel1_0800,  /* 94600..946FF */
+  FriBidiPropsBlockLevel1_0800,  /* 94700..947FF */
+  FriBidiPropsBlockLevel1_0800,  /* 94800..948FF */
+  FriBidiPropsBlockLevel1_0800,  /* 94900..949FF */
+  FriBidiPropsBlockLevel1_0800,  /* 94A00..94AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 94B00..94BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 94C00..94CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 94D00..94DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 94E00..94EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 94F00..94FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 95000..950FF */
+  FriBidiPropsBlockLevel1_0800,  /* 95100..951FF */
+  FriBidiPropsBlockLevel1_0800,  /* 95200..952FF */
+  FriBidiPropsBlockLevel1_0800,  /* 95300..953FF */
+  FriBidiPropsBlockLevel1_0800,  /* 95400..954FF */
+  FriBidiPropsBlockLevel1_0800,  /* 95500..955FF */
+  FriBidiPropsBlockLevel1_0800,  /* 95600..956FF */
+  FriBidiPropsBlockLevel1_0800,  /* 95700..957FF */
+  FriBidiPropsBlockLevel1_0800,  /* 95800..958FF */
+  FriBidiPropsBlockLevel1_0800,  /* 95900..959FF */
+  FriBidiPropsBlockLevel1_0800,  /* 95A00..95AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 95B00..95BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 95C00..95CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 95D00..95DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 95E00..95EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 95F00..95FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 96000..960FF */
+  FriBidiPropsBlockLevel1_0800,  /* 96100..961FF */
+  FriBidiPropsBlockLevel1_0800,  /* 96200..962FF */
+  FriBidiPropsBlockLevel1_0800,  /* 96300..963FF */
+  FriBidiPropsBlockLevel1_0800,  /* 96400..964FF */
+  FriBidiPropsBlockLevel1_0800,  /* 96500..965FF */
+  FriBidiPropsBlockLevel1_0800,  /* 96600..966FF */
+  FriBidiPropsBlockLevel1_0800,  /* 96700..967FF */
+  FriBidiPropsBlockLevel1_0800,  /* 96800..968FF */
+  FriBidiPropsBlockLevel1_0800,  /* 96900..969FF */
+  FriBidiPropsBlockLevel1_0800,  /* 96A00..96AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 96B00..96BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 96C00..96CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 96D00..96DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 96E00..96EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 96F00..96FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 97000..970FF */
+  FriBidiPropsBlockLevel1_0800,  /* 97100..971FF */
+  FriBidiPropsBlockLevel1_0800,  /* 97200..972FF */
+  FriBidiPropsBlockLevel1_0800,  /* 97300..973FF */
+  FriBidiPropsBlockLevel1_0800,  /* 97400..974FF */
+  FriBidiPropsBlockLevel1_0800,  /* 97500..975FF */
+  FriBidiPropsBlockLevel1_0800,  /* 97600..976FF */
+  FriBidiPropsBlockLevel1_0800,  /* 97700..977FF */
+  FriBidiPropsBlockLevel1_0800,  /* 97800..978FF */
+  FriBidiPropsBlockLevel1_0800,  /* 97900..979FF */
+  FriBidiPropsBlockLevel1_0800,  /* 97A00..97AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 97B00..97BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 97C00..97CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 97D00..97DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 97E00..97EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 97F00..97FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 98000..980FF */
+  FriBidiPropsBlockLevel1_0800,  /* 98100..981FF */
+  FriBidiPropsBlockLevel1_0800,  /* 98200..982FF */
+  FriBidiPropsBlockLevel1_0800,  /* 98300..983FF */
+  FriBidiPropsBlockLevel1_0800,  /* 98400..984FF */
+  FriBidiPropsBlockLevel1_0800,  /* 98500..985FF */
+  FriBidiPropsBlockLevel1_0800,  /* 98600..986FF */
+  FriBidiPropsBlockLevel1_0800,  /* 98700..987FF */
+  FriBidiPropsBlockLevel1_0800,  /* 98800..988FF */
+  FriBidiPropsBlockLevel1_0800,  /* 98900..989FF */
+  FriBidiPropsBlockLevel1_0800,  /* 98A00..98AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 98B00..98BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 98C00..98CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 98D00..98DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 98E00..98EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 98F00..98FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 99000..990FF */
+  FriBidiPropsBlockLevel1_0800,  /* 99100..991FF */
+  FriBidiPropsBlockLevel1_0800,  /* 99200..992FF */
+  FriBidiPropsBlockLevel1_0800,  /* 99300..993FF */
+  FriBidiPropsBlockLevel1_0800,  /* 99400..994FF */
+  FriBidiPropsBlockLevel1_0800,  /* 99500..995FF */
+  FriBidiPropsBlockLevel1_0800,  /* 99600..996FF */
+  FriBidiPropsBlockLevel1_0800,  /* 99700..997FF */
+  FriBidiPropsBlockLevel1_0800,  /* 99800..998FF */
+  FriBidiPropsBlockLevel1_0800,  /* 99900..999FF */
+  FriBidiPropsBlockLevel1_0800,  /* 99A00..99AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 99B00..99BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 99C00..99CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 99D00..99DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 99E00..99EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 99F00..99FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 9A000..9A0FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9A100..9A1FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9A200..9A2FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9A300..9A3FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9A400..9A4FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9A500..9A5FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9A600..9A6FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9A700..9A7FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9A800..9A8FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9A900..9A9FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9AA00..9AAFF */
+  FriBidiPropsBlockLevel1_0800,  /* 9AB00..9ABFF */
+  FriBidiPropsBlockLevel1_0800,  /* 9AC00..9ACFF */
+  FriBidiPropsBlockLevel1_0800,  /* 9AD00..9ADFF */
+  FriBidiPropsBlockLevel1_0800,  /* 9AE00..9AEFF */
+  FriBidiPropsBlockLevel1_0800,  /* 9AF00..9AFFF */
+  FriBidiPropsBlockLevel1_0800,  /* 9B000..9B0FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9B100..9B1FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9B200..9B2FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9B300..9B3FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9B400..9B4FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9B500..9B5FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9B600..9B6FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9B700..9B7FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9B800..9B8FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9B900..9B9FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9BA00..9BAFF */
+  FriBidiPropsBlockLevel1_0800,  /* 9BB00..9BBFF */
+  FriBidiPropsBlockLevel1_0800,  /* 9BC00..9BCFF */
+  FriBidiPropsBlockLevel1_0800,  /* 9BD00..9BDFF */
+  FriBidiPropsBlockLevel1_0800,  /* 9BE00..9BEFF */
+  FriBidiPropsBlockLevel1_0800,  /* 9BF00..9BFFF */
+  FriBidiPropsBlockLevel1_0800,  /* 9C000..9C0FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9C100..9C1FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9C200..9C2FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9C300..9C3FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9C400..9C4FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9C500..9C5FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9C600..9C6FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9C700..9C7FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9C800..9C8FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9C900..9C9FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9CA00..9CAFF */
+  FriBidiPropsBlockLevel1_0800,  /* 9CB00..9CBFF */
+  FriBidiPropsBlockLevel1_0800,  /* 9CC00..9CCFF */
+  FriBidiPropsBlockLevel1_0800,  /* 9CD00..9CDFF */
+  FriBidiPropsBlockLevel1_0800,  /* 9CE00..9CEFF */
+  FriBidiPropsBlockLevel1_0800,  /* 9CF00..9CFFF */
+  FriBidiPropsBlockLevel1_0800,  /* 9D000..9D0FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9D100..9D1FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9D200..9D2FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9D300..9D3FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9D400..9D4FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9D500..9D5FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9D600..9D6FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9D700..9D7FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9D800..9D8FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9D900..9D9FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9DA00..9DAFF */
+  FriBidiPropsBlockLevel1_0800,  /* 9DB00..9DBFF */
+  FriBidiPropsBlockLevel1_0800,  /* 9DC00..9DCFF */
+  FriBidiPropsBlockLevel1_0800,  /* 9DD00..9DDFF */
+  FriBidiPropsBlockLevel1_0800,  /* 9DE00..9DEFF */
+  FriBidiPropsBlockLevel1_0800,  /* 9DF00..9DFFF */
+  FriBidiPropsBlockLevel1_0800,  /* 9E000..9E0FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9E100..9E1FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9E200..9E2FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9E300..9E3FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9E400..9E4FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9E500..9E5FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9E600..9E6FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9E700..9E7FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9E800..9E8FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9E900..9E9FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9EA00..9EAFF */
+  FriBidiPropsBlockLevel1_0800,  /* 9EB00..9EBFF */
+  FriBidiPropsBlockLevel1_0800,  /* 9EC00..9ECFF */
+  FriBidiPropsBlockLevel1_0800,  /* 9ED00..9EDFF */
+  FriBidiPropsBlockLevel1_0800,  /* 9EE00..9EEFF */
+  FriBidiPropsBlockLevel1_0800,  /* 9EF00..9EFFF */
+  FriBidiPropsBlockLevel1_0800,  /* 9F000..9F0FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9F100..9F1FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9F200..9F2FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9F300..9F3FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9F400..9F4FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9F500..9F5FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9F600..9F6FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9F700..9F7FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9F800..9F8FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9F900..9F9FF */
+  FriBidiPropsBlockLevel1_0800,  /* 9FA00..9FAFF */
+  FriBidiPropsBlockLevel1_0800,  /* 9FB00..9FBFF */
+  FriBidiPropsBlockLevel1_0800,  /* 9FC00..9FCFF */
+  FriBidiPropsBlockLevel1_0800,  /* 9FD00..9FDFF */
+  FriBidiPropsBlockLevel1_0800,  /* 9FE00..9FEFF */
+  FriBidiPropsBlockLevel1_0800,  /* 9FF00..9FFFF */
+  FriBidiPropsBlockLevel1_0800,  /* A0000..A00FF */
+  FriBidiPropsBlockLevel1_0800,  /* A0100..A01FF */
+  FriBidiPropsBlockLevel1_0800,  /* A0200..A02FF */
+  FriBidiPropsBlockLevel1_0800,  /* A0300..A03FF */
+  FriBidiPropsBlockLevel1_0800,  /* A0400..A04FF */
+  FriBidiPropsBlockLevel1_0800,  /* A0500..A05FF */
+  FriBidiPropsBlockLevel1_0800,  /* A0600..A06FF */
+  FriBidiPropsBlockLevel1_0800,  /* A0700..A07FF */
+  FriBidiPropsBlockLevel1_0800,  /* A0800..A08FF */
+  FriBidiPropsBlockLevel1_0800,  /* A0900..A09FF */
+  FriBidiPropsBlockLevel1_0800,  /* A0A00..A0AFF */
+  FriBidiPropsBlockLevel1_0800,  /* A0B00..A0BFF */
+  FriBidiPropsBlockLevel1_0800,  /* A0C00..A0CFF */
+  FriBidiPropsBlockLevel1_0800,  /* A0D00..A0DFF */
+  FriBidiPropsBlockLevel1_0800,  /* A0E00..A0EFF */
+  FriBidiPropsBlockLevel1_0800,  /* A0F00..A0FFF */
+  FriBidiPropsBlockLevel1_0800,  /* A1000..A10FF */
+  FriBidiPropsBlockLevel1_0800,  /* A1100..A11FF */
+  FriBidiPropsBlockLevel1_0800,  /* A1200..A12FF */
+  FriBidiPropsBlockLevel1_0800,  /* A1300..A13FF */
+  FriBidiPropsBlockLevel1_0800,  /* A1400..A14FF */
+  FriBidiPropsBlockLevel1_0800,  /* A1500..A15FF */
+  FriBidiPropsBlockLevel1_0800,  /* A1600..A16FF */
+  FriBidiPropsBlockLevel1_0800,  /* A1700..A17FF */
+  FriBidiPropsBlockLevel1_0800,  /* A1800..A18FF */
+  FriBidiPropsBlockLevel1_0800,  /* A1900..A19FF */
+  FriBidiPropsBlockLevel1_0800,  /* A1A00..A1AFF */
+  FriBidiPropsBlockLevel1_0800,  /* A1B00..A1BFF */
+  FriBidiPropsBlockLevel1_0800,  /* A1C00..A1CFF */
+  FriBidiPropsBlockLevel1_0800,  /* A1D00..A1DFF */
+  FriBidiPropsBlockLevel1_0800,  /* A1E00..A1EFF */
+  FriBidiPropsBlockLevel1_0800,  /* A1F00..A1FFF */
+  FriBidiPropsBlockLevel1_0800,  /* A2000..A20FF */
+  FriBidiPropsBlockLevel1_0800,  /* A2100..A21FF */
+  FriBidiPropsBlockLevel1_0800,  /* A2200..A22FF */
+  FriBidiPropsBlockLevel1_0800,  /* A2300..A23FF */
+  FriBidiPropsBlockLevel1_0800,  /* A2400..A24FF */
+  FriBidiPropsBlockLevel1_0800,  /* A2500..A25FF */
+  FriBidiPropsBlockLevel1_0800,  /* A2600..A26FF */
+  FriBidiPropsBlockLevel1_0800,  /* A2700..A27FF */
+  FriBidiPropsBlockLevel1_0800,  /* A2800..A28FF */
+  FriBidiPropsBlockLevel1_0800,  /* A2900..A29FF */
+  FriBidiPropsBlockLevel1_0800,  /* A2A00..A2AFF */
+  FriBidiPropsBlockLevel1_0800,  /* A2B00..A2BFF */
+  FriBidiPropsBlockLevel1_0800,  /* A2C00..A2CFF */
+  FriBidiPropsBlockLevel1_0800,  /* A2D00..A2DFF */
+  FriBidiPropsBlockLevel1_0800,  /* A2E00..A2EFF */
+  FriBidiPropsBlockLevel1_0800,  /* A2F00..A2FFF */
+  FriBidiPropsBlockLevel1_0800,  /* A3000..A30FF */
+  FriBidiPropsBlockLevel1_0800,  /* A3100..A31FF */
+  FriBidiPropsBlockLevel1_0800,  /* A3200..A32FF */
+  FriBidiPropsBlockLevel1_0800,  /* A3300..A33FF */
+  FriBidiPropsBlockLevel1_0800,  /* A3400..A34FF */
+  FriBidiPropsBlockLevel1_0800,  /* A3500..A35FF */
+  FriBidiPropsBlockLevel1_0800,  /* A3600..A36FF */
+  FriBidiPropsBlockLevel1_0800,  /* A3700..A37FF */
+  FriBidiPropsBlockLevel1_0800,  /* A3800..A38FF */
+  FriBidiPropsBlockLevel1_0800,  /* A3900..A39FF */
+  FriBidiPropsBlockLevel1_0800,  /* A3A00..A3AFF */
+  FriBidiPropsBlockLevel1_0800,  /* A3B00..A3BFF */
+  FriBidiPropsBlockLevel1_0800,  /* A3C00..A3CFF */
+  FriBidiPropsBlockLevel1_0800,  /* A3D00..A3DFF */
+  FriBidiPropsBlockLevel1_0800,  /* A3E00..A3EFF */
+  FriBidiPropsBlockLevel1_0800,  /* A3F00..A3FFF */
+  FriBidiPropsBlockLevel1_0800,  /* A4000..A40FF */
+  FriBidiPropsBlockLevel1_0800,  /* A4100..A41FF */
+  FriBidiPropsBlockLevel1_0800,  /* A4200..A42FF */
+  FriBidiPropsBlockLevel1_0800,  /* A4300..A43FF */
+  FriBidiPropsBlockLevel1_0800,  /* A4400..A44FF */
+  FriBidiPropsBlockLevel1_0800,  /* A4500..A45FF */
+  FriBidiPropsBlockLevel1_0800,  /* A4600..A46FF */
+  FriBidiPropsBlockLevel1_0800,  /* A4700..A47FF */
+  FriBidiPropsBlockLevel1_0800,  /* A4800..A48FF */
+  FriBidiPropsBlockLevel1_0800,  /* A4900..A49FF */
+  FriBidiPropsBlockLevel1_0800,  /* A4A00..A4AFF */
+  FriBidiPropsBlockLevel1_0800,  /* A4B00..A4BFF */
+  FriBidiPropsBlockLevel1_0800,  /* A4C00..A4CFF */
+  FriBidiPropsBlockLevel1_0800,  /* A4D00..A4DFF */
+  FriBidiPropsBlockLevel1_0800,  /* A4E00..A4EFF */
+  FriBidiPropsBlockLevel1_0800,  /* A4F00..A4FFF */
+  FriBidiPropsBlockLevel1_0800,  /* A5000..A50FF */
+  FriBidiPropsBlockLevel1_0800,  /* A5100..A51FF */
+  FriBidiPropsBlockLevel1_0800,  /* A5200..A52FF */
+  FriBidiPropsBlockLevel1_0800,  /* A5300..A53FF */
+  FriBidiPropsBlockLevel1_0800,  /* A5400..A54FF */
+  FriBidiPropsBlockLevel1_0800,  /* A5500..A55FF */
+  FriBidiPropsBlockLevel1_0800,  /* A5600..A56FF */
+  FriBidiPropsBlockLevel1_0800,  /* A5700..A57FF */
+  FriBidiPropsBlockLevel1_0800,  /* A5800..A58FF */
+  FriBidiPropsBlockLevel1_0800,  /* A5900..A59FF */
+  FriBidiPropsBlockLevel1_0800,  /* A5A00..A5AFF */
+  FriBidiPropsBlockLevel1_0800,  /* A5B00..A5BFF */
+  FriBidiPropsBlockLevel1_0800,  /* A5C00..A5CFF */
+  FriBidiPropsBlockLevel1_0800,  /* A5D00..A5DFF */
+  FriBidiPropsBlockLevel1_0800,  /* A5E00..A5EFF */
+  FriBidiPropsBlockLevel1_0800,  /* A5F00..A5FFF */
+  FriBidiPropsBlockLevel1_0800,  /* A6000..A60FF */
+  FriBidiPropsBlockLevel1_0800,  /* A6100..A61FF */
+  FriBidiPropsBlockLevel1_0800,  /* A6200..A62FF */
+  FriBidiPropsBlockLevel1_0800,  /* A6300..A63FF */
+  FriBidiPropsBlockLevel1_0800,  /* A6400..A64FF */
+  FriBidiPropsBlockLevel1_0800,  /* A6500..A65FF */
+  FriBidiPropsBlockLevel1_0800,  /* A6600..A66FF */
+  FriBidiPropsBlockLevel1_0800,  /* A6700..A67FF */
+  FriBidiPropsBlockLevel1_0800,  /* A6800..A68FF */
+  FriBidiPropsBlockLevel1_0800,  /* A6900..A69FF */
+  FriBidiPropsBlockLevel1_0800,  /* A6A00..A6AFF */
+  FriBidiPropsBlockLevel1_0800,  /* A6B00..A6BFF */
+  FriBidiPropsBlockLevel1_0800,  /* A6C00..A6CFF */
+  FriBidiPropsBlockLevel1_0800,  /* A6D00..A6DFF */
+  FriBidiPropsBlockLevel1_0800,  /* A6E00..A6EFF */
+  FriBidiPropsBlockLevel1_0800,  /* A6F00..A6FFF */
+  FriBidiPropsBlockLevel1_0800,  /* A7000..A70FF */
+  FriBidiPropsBlockLevel1_0800,  /* A7100..A71FF */
+  FriBidiPropsBlockLevel1_0800,  /* A7200..A72FF */
+  FriBidiPropsBlockLevel1_0800,  /* A7300..A73FF */
+  FriBidiPropsBlockLevel1_0800,  /* A7400..A74FF */
+  FriBidiPropsBlockLevel1_0800,  /* A7500..A75FF */
+  FriBidiPropsBlockLevel1_0800,  /* A7600..A76FF */
+  FriBidiPropsBlockLevel1_0800,  /* A7700..A77FF */
+  FriBidiPropsBlockLevel1_0800,  /* A7800..A78FF */
+  FriBidiPropsBlockLevel1_0800,  /* A7900..A79FF */
+  FriBidiPropsBlockLevel1_0800,  /* A7A00..A7AFF */
+  FriBidiPropsBlockLevel1_0800,  /* A7B00..A7BFF */
+  FriBidiPropsBlockLevel1_0800,  /* A7C00..A7CFF */
+  FriBidiPropsBlockLevel1_0800,  /* A7D00..A7DFF */
+  FriBidiPropsBlockLevel1_0800,  /* A7E00..A7EFF */
+  FriBidiPropsBlockLevel1_0800,  /* A7F00..A7FFF */
+  FriBidiPropsBlockLevel1_0800,  /* A8000..A80FF */
+  FriBidiPropsBlockLevel1_0800,  /* A8100..A81FF */
+  FriBidiPropsBlockLevel1_0800,  /* A8200..A82FF */
+  FriBidiPropsBlockLevel1_0800,  /* A8300..A83FF */
+  FriBidiPropsBlockLevel1_0800,  /* A8400..A84FF */
+  FriBidiPropsBlockLevel1_0800,  /* A8500..A85FF */
+  FriBidiPropsBlockLevel1_0800,  /* A8600..A86FF */
+  FriBidiPropsBlockLevel1_0800,  /* A8700..A87FF */
+  FriBidiPropsBlockLevel1_0800,  /* A8800..A88FF */
+  FriBidiPropsBlockLevel1_0800,  /* A8900..A89FF */
+  FriBidiPropsBlockLevel1_0800,  /* A8A00..A8AFF */
+  FriBidiPropsBlockLevel1_0800,  /* A8B00..A8BFF */
+  FriBidiPropsBlockLevel1_0800,  /* A8C00..A8CFF */
+  FriBidiPropsBlockLevel1_0800,  /* A8D00..A8DFF */
+  FriBidiPropsBlockLevel1_0800,  /* A8E00..A8EFF */
+  FriBidiPropsBlockLevel1_0800,  /* A8F00..A8FFF */
+  FriBidiPropsBlockLevel1_0800,  /* A9000..A90FF */
+  FriBidiPropsBlockLevel1_0800,  /* A9100..A91FF */
+  FriBidiPropsBlockLevel1_0800,  /* A9200..A92FF */
+  FriBidiPropsBlockLevel1_0800,  /* A9300..A93FF */
+  FriBidiPropsBlockLevel1_0800,  /* A9400..A94FF */
+  FriBidiPropsBlockLevel1_0800,  /* A9500..A95FF */
+  FriBidiPropsBlockLevel1_0800,  /* A9600..A96FF */
+  FriBidiPropsBlockLevel1_0800,  /* A9700..A97FF */
+  FriBidiPropsBlockLevel1_0800,  /* A9800..A98FF */
+  FriBidiPropsBlockLevel1_0800,  /* A9900..A99FF */
+  FriBidiPropsBlockLevel1_0800,  /* A9A00..A9AFF */
+  FriBidiPropsBlockLevel1_0800,  /* A9B00..A9BFF */
+  FriBidiPropsBlockLevel1_0800,  /* A9C00..A9CFF */
+  FriBidiPropsBlockLevel1_0800,  /* A9D00..A9DFF */
+  FriBidiPropsBlockLevel1_0800,  /* A9E00..A9EFF */
+  FriBidiPropsBlockLevel1_0800,  /* A9F00..A9FFF */
+  FriBidiPropsBlockLevel1_0800,  /* AA000..AA0FF */
+  FriBidiPropsBlockLevel1_0800,  /* AA100..AA1FF */
+  FriBidiPropsBlockLevel1_0800,  /* AA200..AA2FF */
+  FriBidiPropsBlockLevel1_0800,  /* AA300..AA3FF */
+  FriBidiPropsBlockLevel1_0800,  /* AA400..AA4FF */
+  FriBidiPropsBlockLevel1_0800,  /* AA500..AA5FF */
+  FriBidiPropsBlockLevel1_0800,  /* AA600..AA6FF */
+  FriBidiPropsBlockLevel1_0800,  /* AA700..AA7FF */
+  FriBidiPropsBlockLevel1_0800,  /* AA800..AA8FF */
+  FriBidiPropsBlockLevel1_0800,  /* AA900..AA9FF */
+  FriBidiPropsBlockLevel1_0800,  /* AAA00..AAAFF */
+  FriBidiPropsBlockLevel1_0800,  /* AAB00..AABFF */
+  FriBidiPropsBlockLevel1_0800,  /* AAC00..AACFF */
+  FriBidiPropsBlockLevel1_0800,  /* AAD00..AADFF */
+  FriBidiPropsBlockLevel1_0800,  /* AAE00..AAEFF */
+  FriBidiPropsBlockLevel1_0800,  /* AAF00..AAFFF */
+  FriBidiPropsBlockLevel1_0800,  /* AB000..AB0FF */
+  FriBidiPropsBlockLevel1_0800,  /* AB100..AB1FF */
+  FriBidiPropsBlockLevel1_0800,  /* AB200..AB2FF */
+  FriBidiPropsBlockLevel1_0800,  /* AB300..AB3FF */
+  FriBidiPropsBlockLevel1_0800,  /* AB400..AB4FF */
+  FriBidiPropsBlockLevel1_0800,  /* AB500..AB5FF */
+  FriBidiPropsBlockLevel1_0800,  /* AB600..AB6FF */
+  FriBidiPropsBlockLevel1_0800,  /* AB700..AB7FF */
+  FriBidiPropsBlockLevel1_0800,  /* AB800..AB8FF */
+  FriBidiPropsBlockLevel1_0800,  /* AB900..AB9FF */
+  FriBidiPropsBlockLevel1_0800,  /* ABA00..ABAFF */
+  FriBidiPropsBlockLevel1_0800,  /* ABB00..ABBFF */
+  FriBidiPropsBlockLevel1_0800,  /* ABC00..ABCFF */
+  FriBidiPropsBlockLevel1_0800,  /* ABD00..ABDFF */
+  FriBidiPropsBlockLevel1_0800,  /* ABE00..ABEFF */
+  FriBidiPropsBlockLevel1_0800,  /* ABF00..ABFFF */
+  FriBidiPropsBlockLevel1_0800,  /* AC000..AC0FF */
+  FriBidiPropsBlockLevel1_0800,  /* AC100..AC1FF */
+  FriBidiPropsBlockLevel1_0800,  /* AC200..AC2FF */
+  FriBidiPropsBlockLevel1_0800,  /* AC300..AC3FF */
+  FriBidiPropsBlockLevel1_0800,  /* AC400..AC4FF */
+  FriBidiPropsBlockLevel1_0800,  /* AC500..AC5FF */
+  FriBidiPropsBlockLevel1_0800,  /* AC600..AC6FF */
+  FriBidiPropsBlockLevel1_0800,  /* AC700..AC7FF */
+  FriBidiPropsBlockLevel1_0800,  /* AC800..AC8FF */
+  FriBidiPropsBlockLevel1_0800,  /* AC900..AC9FF */
+  FriBidiPropsBlockLevel1_0800,  /* ACA00..ACAFF */
+  FriBidiPropsBlockLevel1_0800,  /* ACB00..ACBFF */
+  FriBidiPropsBlockLevel1_0800,  /* ACC00..ACCFF */
+  FriBidiPropsBlockLevel1_0800,  /* ACD00..ACDFF */
+  FriBidiPropsBlockLevel1_0800,  /* ACE00..ACEFF */
+  FriBidiPropsBlockLevel1_0800,  /* ACF00..ACFFF */
+  FriBidiPropsBlockLevel1_0800,  /* AD000..AD0FF */
+  FriBidiPropsBlockLevel1_0800,  /* AD100..AD1FF */
+  FriBidiPropsBlockLevel1_0800,  /* AD200..AD2FF */
+  FriBidiPropsBlockLevel1_0800,  /* AD300..AD3FF */
+  FriBidiPropsBlockLevel1_0800,  /* AD400..AD4FF */
+  FriBidiPropsBlockLevel1_0800,  /* AD500..AD5FF */
+  FriBidiPropsBlockLevel1_0800,  /* AD600..AD6FF */
+  FriBidiPropsBlockLevel1_0800,  /* AD700..AD7FF */
+  FriBidiPropsBlockLevel1_0800,  /* AD800..AD8FF */
+  FriBidiPropsBlockLevel1_0800,  /* AD900..AD9FF */
+  FriBidiPropsBlockLevel1_0800,  /* ADA00..ADAFF */
+  FriBidiPropsBlockLevel1_0800,  /* ADB00..ADBFF */
+  FriBidiPropsBlockLevel1_0800,  /* ADC00..ADCFF */
+  FriBidiPropsBlockLevel1_0800,  /* ADD00..ADDFF */
+  FriBidiPropsBlockLevel1_0800,  /* ADE00..ADEFF */
+  FriBidiPropsBlockLevel1_0800,  /* ADF00..ADFFF */
+  FriBidiPropsBlockLevel1_0800,  /* AE000..AE0FF */
+  FriBidiPropsBlockLevel1_0800,  /* AE100..AE1FF */
+  FriBidiPropsBlockLevel1_0800,  /* AE200..AE2FF */
+  FriBidiPropsBlockLevel1_0800,  /* AE300..AE3FF */
+  FriBidiPropsBlockLevel1_0800,  /* AE400..AE4FF */
+  FriBidiPropsBlockLevel1_0800,  /* AE500..AE5FF */
+  FriBidiPropsBlockLevel1_0800,  /* AE600..AE6FF */
+  FriBidiPropsBlockLevel1_0800,  /* AE700..AE7FF */
+  FriBidiPropsBlockLevel1_0800,  /* AE800..AE8FF */
+  FriBidiPropsBlockLevel1_0800,  /* AE900..AE9FF */
+  FriBidiPropsBlockLevel1_0800,  /* AEA00..AEAFF */
+  FriBidiPropsBlockLevel1_0800,  /* AEB00..AEBFF */
+  FriBidiPropsBlockLevel1_0800,  /* AEC00..AECFF */
+  FriBidiPropsBlockLevel1_0800,  /* AED00..AEDFF */
+  FriBidiPropsBlockLevel1_0800,  /* AEE00..AEEFF */
+  FriBidiPropsBlockLevel1_0800,  /* AEF00..AEFFF */
+  FriBidiPropsBlockLevel1_0800,  /* AF000..AF0FF */
+  FriBidiPropsBlockLevel1_0800,  /* AF100..AF1FF */
+  FriBidiPropsBlockLevel1_0800,  /* AF200..AF2FF */
+  FriBidiPropsBlockLevel1_0800,  /* AF300..AF3FF */
+  FriBidiPropsBlockLevel1_0800,  /* AF400..AF4FF */
+  FriBidiPropsBlockLevel1_0800,  /* AF500..AF5FF */
+  FriBidiPropsBlockLevel1_0800,  /* AF600..AF6FF */
+  FriBidiPropsBlockLevel1_0800,  /* AF700..AF7FF */
+  FriBidiPropsBlockLevel1_0800,  /* AF800..AF8FF */
+  FriBidiPropsBlockLevel1_0800,  /* AF900..AF9FF */
+  FriBidiPropsBlockLevel1_0800,  /* AFA00..AFAFF */
+  FriBidiPropsBlockLevel1_0800,  /* AFB00..AFBFF */
+  FriBidiPropsBlockLevel1_0800,  /* AFC00..AFCFF */
+  FriBidiPropsBlockLevel1_0800,  /* AFD00..AFDFF */
+  FriBidiPropsBlockLevel1_0800,  /* AFE00..AFEFF */
+  FriBidiPropsBlockLevel1_0800,  /* AFF00..AFFFF */
+  FriBidiPropsBlockLevel1_0800,  /* B0000..B00FF */
+  FriBidiPropsBlockLevel1_0800,  /* B0100..B01FF */
+  FriBidiPropsBlockLevel1_0800,  /* B0200..B02FF */
+  FriBidiPropsBlockLevel1_0800,  /* B0300..B03FF */
+  FriBidiPropsBlockLevel1_0800,  /* B0400..B04FF */
+  FriBidiPropsBlockLevel1_0800,  /* B0500..B05FF */
+  FriBidiPropsBlockLevel1_0800,  /* B0600..B06FF */
+  FriBidiPropsBlockLevel1_0800,  /* B0700..B07FF */
+  FriBidiPropsBlockLevel1_0800,  /* B0800..B08FF */
+  FriBidiPropsBlockLevel1_0800,  /* B0900..B09FF */
+  FriBidiPropsBlockLevel1_0800,  /* B0A00..B0AFF */
+  FriBidiPropsBlockLevel1_0800,  /* B0B00..B0BFF */
+  FriBidiPropsBlockLevel1_0800,  /* B0C00..B0CFF */
+  FriBidiPropsBlockLevel1_0800,  /* B0D00..B0DFF */
+  FriBidiPropsBlockLevel1_0800,  /* B0E00..B0EFF */
+  FriBidiPropsBlockLevel1_0800,  /* B0F00..B0FFF */
+  FriBidiPropsBlockLevel1_0800,  /* B1000..B10FF */
+  FriBidiPropsBlockLevel1_0800,  /* B1100..B11FF */
+  FriBidiPropsBlockLevel1_0800,  /* B1200..B12FF */
+  FriBidiPropsBlockLevel1_0800,  /* B1300..B13FF */
+  FriBidiPropsBlockLevel1_0800,  /* B1400..B14FF */
+  FriBidiPropsBlockLevel1_0800,  /* B1500..B15FF */
+  FriBidiPropsBlockLevel1_0800,  /* B1600..B16FF */
+  FriBidiPropsBlockLevel1_0800,  /* B1700..B17FF */
+  FriBidiPropsBlockLevel1_0800,  /* B1800..B18FF */
+  FriBidiPropsBlockLevel1_0800,  /* B1900..B19FF */
+  FriBidiPropsBlockLevel1_0800,  /* B1A00..B1AFF */
+  FriBidiPropsBlockLevel1_0800,  /* B1B00..B1BFF */
+  FriBidiPropsBlockLevel1_0800,  /* B1C00..B1CFF */
+  FriBidiPropsBlockLevel1_0800,  /* B1D00..B1DFF */
+  FriBidiPropsBlockLevel1_0800,  /* B1E00..B1EFF */
+  FriBidiPropsBlockLevel1_0800,  /* B1F00..B1FFF */
+  FriBidiPropsBlockLevel1_0800,  /* B2000..B20FF */
+  FriBidiPropsBlockLevel1_0800,  /* B2100..B21FF */
+  FriBidiPropsBlockLevel1_0800,  /* B2200..B22FF */
+  FriBidiPropsBlockLevel1_0800,  /* B2300..B23FF */
+  FriBidiPropsBlockLevel1_0800,  /* B2400..B24FF */
+  FriBidiPropsBlockLevel1_0800,  /* B2500..B25FF */
+  FriBidiPropsBlockLevel1_0800,  /* B2600..B26FF */
+  FriBidiPropsBlockLevel1_0800,  /* B2700..B27FF */
+  FriBidiPropsBlockLevel1_0800,  /* B2800..B28FF */
+  FriBidiPropsBlockLevel1_0800,  /* B2900..B29FF */
+  FriBidiPropsBlockLevel1_0800,  /* B2A00..B2AFF */
+  FriBidiPropsBlockLevel1_0800,  /* B2B00..B2BFF */
+  FriBidiPropsBlockLevel1_0800,  /* B2C00..B2CFF */
+  FriBidiPropsBlockLevel1_0800,  /* B2D00..B2DFF */
+  FriBidiPropsBlockLevel1_0800,  /* B2E00..B2EFF */
+  FriBidiPropsBlockLevel1_0800,  /* B2F00..B2FFF */
+  FriBidiPropsBlockLevel1_0800,  /* B3000..B30FF */
+  FriBidiPropsBlockLevel1_0800,  /* B3100..B31FF */
+  FriBidiPropsBlockLevel1_0800,  /* B3200..B32FF */
+  FriBidiPropsBlockLevel1_0800,  /* B3300..B33FF */
+  FriBidiPropsBlockLevel1_0800,  /* B3400..B34FF */
+  FriBidiPropsBlockLevel1_0800,  /* B3500..B35FF */
+  FriBidiPropsBlockLevel1_0800,  /* B3600..B36FF */
+  FriBidiPropsBlockLevel1_0800,  /* B3700..B37FF */
+  FriBidiPropsBlockLevel1_0800,  /* B3800..B38FF */
+  FriBidiPropsBlockLevel1_0800,  /* B3900..B39FF */
+  FriBidiPropsBlockLevel1_0800,  /* B3A00..B3AFF */
+  FriBidiPropsBlockLevel1_0800,  /* B3B00..B3BFF */
+  FriBidiPropsBlockLevel1_0800,  /* B3C00..B3CFF */
+  FriBidiPropsBlockLevel1_0800,  /* B3D00..B3DFF */
+  FriBidiPropsBlockLevel1_0800,  /* B3E00..B3EFF */
+  FriBidiPropsBlockLevel1_0800,  /* B3F00..B3FFF */
+  FriBidiPropsBlockLevel1_0800,  /* B4000..B40FF */
+  FriBidiPropsBlockLevel1_0800,  /* B4100..B41FF */
+  FriBidiPropsBlockLevel1_0800,  /* B4200..B42FF */
+  FriBidiPropsBlockLevel1_0800,  /* B4300..B43FF */
+  FriBidiPropsBlockLevel1_0800,  /* B4400..B44FF */
+  FriBidiPropsBlockLevel1_0800,  /* B4500..B45FF */
+  FriBidiPropsBlockLevel1_0800,  /* B4600..B46FF */
+  FriBidiPropsBlockLevel1_0800,  /* B4700..B47FF */
+  FriBidiPropsBlockLevel1_0800,  /* B4800..B48FF */
+  FriBidiPropsBlockLevel1_0800,  /* B4900..B49FF */
+  FriBidiPropsBlockLevel1_0800,  /* B4A00..B4AFF */
+  FriBidiPropsBlockLevel1_0800,  /* B4B00..B4BFF */
+  FriBidiPropsBlockLevel1_0800,  /* B4C00..B4CFF */
+  FriBidiPropsBlockLevel1_0800,  /* B4D00..B4DFF */
+  FriBidiPropsBlockLevel1_0800,  /* B4E00..B4EFF */
+  FriBidiPropsBlockLevel1_0800,  /* B4F00..B4FFF */
+  FriBidiPropsBlockLevel1_0800,  /* B5000..B50FF */
+  FriBidiPropsBlockLevel1_0800,  /* B5100..B51FF */
+  FriBidiPropsBlockLevel1_0800,  /* B5200..B52FF */
+  FriBidiPropsBlockLevel1_0800,  /* B5300..B53FF */
+  FriBidiPropsBlockLevel1_0800,  /* B5400..B54FF */
+  FriBidiPropsBlockLevel1_0800,  /* B5500..B55FF */
+  FriBidiPropsBlockLevel1_0800,  /* B5600..B56FF */
+  FriBidiPropsBlockLevel1_0800,  /* B5700..B57FF */
+  FriBidiPropsBlockLevel1_0800,  /* B5800..B58FF */
+  FriBidiPropsBlockLevel1_0800,  /* B5900..B59FF */
+  FriBidiPropsBlockLevel1_0800,  /* B5A00..B5AFF */
+  FriBidiPropsBlockLevel1_0800,  /* B5B00..B5BFF */
+  FriBidiPropsBlockLevel1_0800,  /* B5C00..B5CFF */
+  FriBidiPropsBlockLevel1_0800,  /* B5D00..B5DFF */
+  FriBidiPropsBlockLevel1_0800,  /* B5E00..B5EFF */
+  FriBidiPropsBlockLevel1_0800,  /* B5F00..B5FFF */
+  FriBidiPropsBlockLevel1_0800,  /* B6000..B60FF */
+  FriBidiPropsBlockLevel1_0800,  /* B6100..B61FF */
+  FriBidiPropsBlockLevel1_0800,  /* B6200..B62FF */
+  FriBidiPropsBlockLevel1_0800,  /* B6300..B63FF */
+  FriBidiPropsBlockLevel1_0800,  /* B6400..B64FF */
+  FriBidiPropsBlockLevel1_0800,  /* B6500..B65FF */
+  FriBidiPropsBlockLevel1_0800,  /* B6600..B66FF */
+  FriBidiPropsBlockLevel1_0800,  /* B6700..B67FF */
+  FriBidiPropsBlockLevel1_0800,  /* B6800..B68FF */
+  FriBidiPropsBlockLevel1_0800,  /* B6900..B69FF */
+  FriBidiPropsBlockLevel1_0800,  /* B6A00..B6AFF */
+  FriBidiPropsBlockLevel1_0800,  /* B6B00..B6BFF */
+  FriBidiPropsBlockLevel1_0800,  /* B6C00..B6CFF */
+  FriBidiPropsBlockLevel1_0800,  /* B6D00..B6DFF */
+  FriBidiPropsBlockLevel1_0800,  /* B6E00..B6EFF */
+  FriBidiPropsBlockLevel1_0800,  /* B6F00..B6FFF */
+  FriBidiPropsBlockLevel1_0800,  /* B7000..B70FF */
+  FriBidiPropsBlockLevel1_0800,  /* B7100..B71FF */
+  FriBidiPropsBlockLevel1_0800,  /* B7200..B72FF */
+  FriBidiPropsBlockLevel1_0800,  /* B7300..B73FF */
+  FriBidiPropsBlockLevel1_0800,  /* B7400..B74FF */
+  FriBidiPropsBlockLevel1_0800,  /* B7500..B75FF */
+  FriBidiPropsBlockLevel1_0800,  /* B7600..B76FF */
+  FriBidiPropsBlockLevel1_0800,  /* B7700..B77FF */
+  FriBidiPropsBlockLevel1_0800,  /* B7800..B78FF */
+  FriBidiPropsBlockLevel1_0800,  /* B7900..B79FF */
+  FriBidiPropsBlockLevel1_0800,  /* B7A00..B7AFF */
+  FriBidiPropsBlockLevel1_0800,  /* B7B00..B7BFF */
+  FriBidiPropsBlockLevel1_0800,  /* B7C00..B7CFF */
+  FriBidiPropsBlockLevel1_0800,  /* B7D00..B7DFF */
+  FriBidiPropsBlockLevel1_0800,  /* B7E00..B7EFF */
+  FriBidiPropsBlockLevel1_0800,  /* B7F00..B7FFF */
+  FriBidiPropsBlockLevel1_0800,  /* B8000..B80FF */
+  FriBidiPropsBlockLevel1_0800,  /* B8100..B81FF */
+  FriBidiPropsBlockLevel1_0800,  /* B8200..B82FF */
+  FriBidiPropsBlockLevel1_0800,  /* B8300..B83FF */
+  FriBidiPropsBlockLevel1_0800,  /* B8400..B84FF */
+  FriBidiPropsBlockLevel1_0800,  /* B8500..B85FF */
+  FriBidiPropsBlockLevel1_0800,  /* B8600..B86FF */
+  FriBidiPropsBlockLevel1_0800,  /* B8700..B87FF */
+  FriBidiPropsBlockLevel1_0800,  /* B8800..B88FF */
+  FriBidiPropsBlockLevel1_0800,  /* B8900..B89FF */
+  FriBidiPropsBlockLevel1_0800,  /* B8A00..B8AFF */
+  FriBidiPropsBlockLevel1_0800,  /* B8B00..B8BFF */
+  FriBidiPropsBlockLevel1_0800,  /* B8C00..B8CFF */
+  FriBidiPropsBlockLevel1_0800,  /* B8D00..B8DFF */
+  FriBidiPropsBlockLevel1_0800,  /* B8E00..B8EFF */
+  FriBidiPropsBlockLevel1_0800,  /* B8F00..B8FFF */
+  FriBidiPropsBlockLevel1_0800,  /* B9000..B90FF */
+  FriBidiPropsBlockLevel1_0800,  /* B9100..B91FF */
+  FriBidiPropsBlockLevel1_0800,  /* B9200..B92FF */
+  FriBidiPropsBlockLevel1_0800,  /* B9300..B93FF */
+  FriBidiPropsBlockLevel1_0800,  /* B9400..B94FF */
+  FriBidiPropsBlockLevel1_0800,  /* B9500..B95FF */
+  FriBidiPropsBlockLevel1_0800,  /* B9600..B96FF */
+  FriBidiPropsBlockLevel1_0800,  /* B9700..B97FF */
+  FriBidiPropsBlockLevel1_0800,  /* B9800..B98FF */
+  FriBidiPropsBlockLevel1_0800,  /* B9900..B99FF */
+  FriBidiPropsBlockLevel1_0800,  /* B9A00..B9AFF */
+  FriBidiPropsBlockLevel1_0800,  /* B9B00..B9BFF */
+  FriBidiPropsBlockLevel1_0800,  /* B9C00..B9CFF */
+  FriBidiPropsBlockLevel1_0800,  /* B9D00..B9DFF */
+  FriBidiPropsBlockLevel1_0800,  /* B9E00..B9EFF */
+  FriBidiPropsBlockLevel1_0800,  /* B9F00..B9FFF */
+  FriBidiPropsBlockLevel1_0800,  /* BA000..BA0FF */
+  FriBidiPropsBlockLevel1_0800,  /* BA100..BA1FF */
+  FriBidiPropsBlockLevel1_0800,  /* BA200..BA2FF */
+  FriBidiPropsBlockLevel1_0800,  /* BA300..BA3FF */
+  FriBidiPropsBlockLevel1_0800,  /* BA400..BA4FF */
+  FriBidiPropsBlockLevel1_0800,  /* BA500..BA5FF */
+  FriBidiPropsBlockLevel1_0800,  /* BA600..BA6FF */
+  FriBidiPropsBlockLevel1_0800,  /* BA700..BA7FF */
+  FriBidiPropsBlockLevel1_0800,  /* BA800..BA8FF */
+  FriBidiPropsBlockLevel1_0800,  /* BA900..BA9FF */
+  FriBidiPropsBlockLevel1_0800,  /* BAA00..BAAFF */
+  FriBidiPropsBlockLevel1_0800,  /* BAB00..BABFF */
+  FriBidiPropsBlockLevel1_0800,  /* BAC00..BACFF */
+  FriBidiPropsBlockLevel1_0800,  /* BAD00..BADFF */
+  FriBidiPropsBlockLevel1_0800,  /* BAE00..BAEFF */
+  FriBidiPropsBlockLevel1_0800,  /* BAF00..BAFFF */
+  FriBidiPropsBlockLevel1_0800,  /* BB000..BB0FF */
+  FriBidiPropsBlockLevel1_0800,  /* BB100..BB1FF */
+  FriBidiPropsBlockLevel1_0800,  /* BB200..BB2FF */
+  FriBidiPropsBlockLevel1_0800,  /* BB300..BB3FF */
+  FriBidiPropsBlockLevel1_0800,  /* BB400..BB4FF */
+  FriBidiPropsBlockLevel1_0800,  /* BB500..BB5FF */
+  FriBidiPropsBlockLevel1_0800,  /* BB600..BB6FF */
+  FriBidiPropsBlockLevel1_0800,  /* BB700..BB7FF */
+  FriBidiPropsBlockLevel1_0800,  /* BB800..BB8FF */
+  FriBidiPropsBlockLevel1_0800,  /* BB900..BB9FF */
+  FriBidiPropsBlockLevel1_0800,  /* BBA00..BBAFF */
+  FriBidiPropsBlockLevel1_0800,  /* BBB00..BBBFF */
+  FriBidiPropsBlockLevel1_0800,  /* BBC00..BBCFF */
+  FriBidiPropsBlockLevel1_0800,  /* BBD00..BBDFF */
+  FriBidiPropsBlockLevel1_0800,  /* BBE00..BBEFF */
+  FriBidiPropsBlockLevel1_0800,  /* BBF00..BBFFF */
+  FriBidiPropsBlockLevel1_0800,  /* BC000..BC0FF */
+  FriBidiPropsBlockLevel1_0800,  /* BC100..BC1FF */
+  FriBidiPropsBlockLevel1_0800,  /* BC200..BC2FF */
+  FriBidiPropsBlockLevel1_0800,  /* BC300..BC3FF */
+  FriBidiPropsBlockLevel1_0800,  /* BC400..BC4FF */
+  FriBidiPropsBlockLevel1_0800,  /* BC500..BC5FF */
+  FriBidiPropsBlockLevel1_0800,  /* BC600..BC6FF */
+  FriBidiPropsBlockLevel1_0800,  /* BC700..BC7FF */
+  FriBidiPropsBlockLevel1_0800,  /* BC800..BC8FF */
+  FriBidiPropsBlockLevel1_0800,  /* BC900..BC9FF */
+  FriBidiPropsBlockLevel1_0800,  /* BCA00..BCAFF */
+  FriBidiPropsBlockLevel1_0800,  /* BCB00..BCBFF */
+  FriBidiPropsBlockLevel1_0800,  /* BCC00..BCCFF */
+  FriBidiPropsBlockLevel1_0800,  /* BCD00..BCDFF */
+  FriBidiPropsBlockLevel1_0800,  /* BCE00..BCEFF */
+  FriBidiPropsBlockLevel1_0800,  /* BCF00..BCFFF */
+  FriBidiPropsBlockLevel1_0800,  /* BD000..BD0FF */
+  FriBidiPropsBlockLevel1_0800,  /* BD100..BD1FF */
+  FriBidiPropsBlockLevel1_0800,  /* BD200..BD2FF */
+  FriBidiPropsBlockLevel1_0800,  /* BD300..BD3FF */
+  FriBidiPropsBlockLevel1_0800,  /* BD400..BD4FF */
+  FriBidiPropsBlockLevel1_0800,  /* BD500..BD5FF */
+  FriBidiPropsBlockLevel1_0800,  /* BD600..BD6FF */
+  FriBidiPropsBlockLevel1_0800,  /* BD700..BD7FF */
+  FriBidiPropsBlockLevel1_0800,  /* BD800..BD8FF */
+  FriBidiPropsBlockLevel1_0800,  /* BD900..BD9FF */
+  FriBidiPropsBlockLevel1_0800,  /* BDA00..BDAFF */
+  FriBidiPropsBlockLevel1_0800,  /* BDB00..BDBFF */
+  FriBidiPropsBlockLevel1_0800,  /* BDC00..BDCFF */
+  FriBidiPropsBlockLevel1_0800,  /* BDD00..BDDFF */
+  FriBidiPropsBlockLevel1_0800,  /* BDE00..BDEFF */
+  FriBidiPropsBlockLevel1_0800,  /* BDF00..BDFFF */
+  FriBidiPropsBlockLevel1_0800,  /* BE000..BE0FF */
+  FriBidiPropsBlockLevel1_0800,  /* BE100..BE1FF */
+  FriBidiPropsBlockLevel1_0800,  /* BE200..BE2FF */
+  FriBidiPropsBlockLevel1_0800,  /* BE300..BE3FF */
+  FriBidiPropsBlockLevel1_0800,  /* BE400..BE4FF */
+  FriBidiPropsBlockLevel1_0800,  /* BE500..BE5FF */
+  FriBidiPropsBlockLevel1_0800,  /* BE600..BE6FF */
+  FriBidiPropsBlockLevel1_0800,  /* BE700..BE7FF */
+  FriBidiPropsBlockLevel1_0800,  /* BE800..BE8FF */
+  FriBidiPropsBlockLevel1_0800,  /* BE900..BE9FF */
+  FriBidiPropsBlockLevel1_0800,  /* BEA00..BEAFF */
+  FriBidiPropsBlockLevel1_0800,  /* BEB00..BEBFF */
+  FriBidiPropsBlockLevel1_0800,  /* BEC00..BECFF */
+  FriBidiPropsBlockLevel1_0800,  /* BED00..BEDFF */
+  FriBidiPropsBlockLevel1_0800,  /* BEE00..BEEFF */
+  FriBidiPropsBlockLevel1_0800,  /* BEF00..BEFFF */
+  FriBidiPropsBlockLevel1_0800,  /* BF000..BF0FF */
+  FriBidiPropsBlockLevel1_0800,  /* BF100..BF1FF */
+  FriBidiPropsBlockLevel1_0800,  /* BF200..BF2FF */
+  FriBidiPropsBlockLevel1_0800,  /* BF300..BF3FF */
+  FriBidiPropsBlockLevel1_0800,  /* BF400..BF4FF */
+  FriBidiPropsBlockLevel1_0800,  /* BF500..BF5FF */
+  FriBidiPropsBlockLevel1_0800,  /* BF600..BF6FF */
+  FriBidiPropsBlockLevel1_0800,  /* BF700..BF7FF */
+  FriBidiPropsBlockLevel1_0800,  /* BF800..BF8FF */
+  FriBidiPropsBlockLevel1_0800,  /* BF900..BF9FF */
+  FriBidiPropsBlockLevel1_0800,  /* BFA00..BFAFF */
+  FriBidiPropsBlockLevel1_0800,  /* BFB00..BFBFF */
+  FriBidiPropsBlockLevel1_0800,  /* BFC00..BFCFF */
+  FriBidiPropsBlockLevel1_0800,  /* BFD00..BFDFF */
+  FriBidiPropsBlockLevel1_0800,  /* BFE00..BFEFF */
+  FriBidiPropsBlockLevel1_0800,  /* BFF00..BFFFF */
+  FriBidiPropsBlockLevel1_0800,  /* C0000..C00FF */
+  FriBidiPropsBlockLevel1_0800,  /* C0100..C01FF */
+  FriBidiPropsBlockLevel1_0800,  /* C0200..C02FF */
+  FriBidiPropsBlockLevel1_0800,  /* C0300..C03FF */
+  FriBidiPropsBlockLevel1_0800,  /* C0400..C04FF */
+  FriBidiPropsBlockLevel1_0800,  /* C0500..C05FF */
+  FriBidiPropsBlockLevel1_0800,  /* C0600..C06FF */
+  FriBidiPropsBlockLevel1_0800,  /* C0700..C07FF */
+  FriBidiPropsBlockLevel1_0800,  /* C0800..C08FF */
+  FriBidiPropsBlockLevel1_0800,  /* C0900..C09FF */
+  FriBidiPropsBlockLevel1_0800,  /* C0A00..C0AFF */
+  FriBidiPropsBlockLevel1_0800,  /* C0B00..C0BFF */
+  FriBidiPropsBlockLevel1_0800,  /* C0C00..C0CFF */
+  FriBidiPropsBlockLevel1_0800,  /* C0D00..C0DFF */
+  FriBidiPropsBlockLevel1_0800,  /* C0E00..C0EFF */
+  FriBidiPropsBlockLevel1_0800,  /* C0F00..C0FFF */
+  FriBidiPropsBlockLevel1_0800,  /* C1000..C10FF */
+  FriBidiPropsBlockLevel1_0800,  /* C1100..C11FF */
+  FriBidiPropsBlockLevel1_0800,  /* C1200..C12FF */
+  FriBidiPropsBlockLevel1_0800,  /* C1300..C13FF */
+  FriBidiPropsBlockLevel1_0800,  /* C1400..C14FF */
+  FriBidiPropsBlockLevel1_0800,  /* C1500..C15FF */
+  FriBidiPropsBlockLevel1_0800,  /* C1600..C16FF */
+  FriBidiPropsBlockLevel1_0800,  /* C1700..C17FF */
+  FriBidiPropsBlockLevel1_0800,  /* C1800..C18FF */
+  FriBidiPropsBlockLevel1_0800,  /* C1900..C19FF */
+  FriBidiPropsBlockLevel1_0800,  /* C1A00..C1AFF */
+  FriBidiPropsBlockLevel1_0800,  /* C1B00..C1BFF */
+  FriBidiPropsBlockLevel1_0800,  /* C1C00..C1CFF */
+  FriBidiPropsBlockLevel1_0800,  /* C1D00..C1DFF */
+  FriBidiPropsBlockLevel1_0800,  /* C1E00..C1EFF */
+  FriBidiPropsBlockLevel1_0800,  /* C1F00..C1FFF */
+  FriBidiPropsBlockLevel1_0800,  /* C2000..C20FF */
+  FriBidiPropsBlockLevel1_0800,  /* C2100..C21FF */
+  FriBidiPropsBlockLevel1_0800,  /* C2200..C22FF */
+  FriBidiPropsBlockLevel1_0800,  /* C2300..C23FF */
+  FriBidiPropsBlockLevel1_0800,  /* C2400..C24FF */
+  FriBidiPropsBlockLevel1_0800,  /* C2500..C25FF */
+  FriBidiPropsBlockLevel1_0800,  /* C2600..C26FF */
+  FriBidiPropsBlockLevel1_0800,  /* C2700..C27FF */
+  FriBidiPropsBlockLevel1_0800,  /* C2800..C28FF */
+  FriBidiPropsBlockLevel1_0800,  /* C2900..C29FF */
+  FriBidiPropsBlockLevel1_0800,  /* C2A00..C2AFF */
+  FriBidiPropsBlockLevel1_0800,  /* C2B00..C2BFF */
+  FriBidiPropsBlockLevel1_0800,  /* C2C00..C2CFF */
+  FriBidiPropsBlockLevel1_0800,  /* C2D00..C2DFF */
+  FriBidiPropsBlockLevel1_0800,  /* C2E00..C2EFF */
+  FriBidiPropsBlockLevel1_0800,  /* C2F00..C2FFF */
+  FriBidiPropsBlockLevel1_0800,  /* C3000..C30FF */
+  FriBidiPropsBlockLevel1_0800,  /* C3100..C31FF */
+  FriBidiPropsBlockLevel1_0800,  /* C3200..C32FF */
+  FriBidiPropsBlockLevel1_0800,  /* C3300..C33FF */
+  FriBidiPropsBlockLevel1_0800,  /* C3400..C34FF */
+  FriBidiPropsBlockLevel1_0800,  /* C3500..C35FF */
+  FriBidiPropsBlockLevel1_0800,  /* C3600..C36FF */
+  FriBidiPropsBlockLevel1_0800,  /* C3700..C37FF */
+  FriBidiPropsBlockLevel1_0800,  /* C3800..C38FF */
+  FriBidiPropsBlockLevel1_0800,  /* C3900..C39FF */
+  FriBidiPropsBlockLevel1_0800,  /* C3A00..C3AFF */
+  FriBidiPropsBlockLevel1_0800,  /* C3B00..C3BFF */
+  FriBidiPropsBlockLevel1_0800,  /* C3C00..C3CFF */
+  FriBidiPropsBlockLevel1_0800,  /* C3D00..C3DFF */
+  FriBidiPropsBlockLevel1_0800,  /* C3E00..C3EFF */
+  FriBidiPropsBlockLevel1_0800,  /* C3F00..C3FFF */
+  FriBidiPropsBlockLevel1_0800,  /* C4000..C40FF */
+  FriBidiPropsBlockLevel1_0800,  /* C4100..C41FF */
+  FriBidiPropsBlockLevel1_0800,  /* C4200..C42FF */
+  FriBidiPropsBlockLevel1_0800,  /* C4300..C43FF */
+  FriBidiPropsBlockLevel1_0800,  /* C4400..C44FF */
+  FriBidiPropsBlockLevel1_0800,  /* C4500..C45FF */
+  FriBidiPropsBlockLevel1_0800,  /* C4600..C46FF */
+  FriBidiPropsBlockLevel1_0800,  /* C4700..C47FF */
+  FriBidiPropsBlockLevel1_0800,  /* C4800..C48FF */
+  FriBidiPropsBlockLevel1_0800,  /* C4900..C49FF */
+  FriBidiPropsBlockLevel1_0800,  /* C4A00..C4AFF */
+  FriBidiPropsBlockLevel1_0800,  /* C4B00..C4BFF */
+  FriBidiPropsBlockLevel1_0800,  /* C4C00..C4CFF */
+  FriBidiPropsBlockLevel1_0800,  /* C4D00..C4DFF */
+  FriBidiPropsBlockLevel1_0800,  /* C4E00..C4EFF */
+  FriBidiPropsBlockLevel1_0800,  /* C4F00..C4FFF */
+  FriBidiPropsBlockLevel1_0800,  /* C5000..C50FF */
+  FriBidiPropsBlockLevel1_0800,  /* C5100..C51FF */
+  FriBidiPropsBlockLevel1_0800,  /* C5200..C52FF */
+  FriBidiPropsBlockLevel1_0800,  /* C5300..C53FF */
+  FriBidiPropsBlockLevel1_0800,  /* C5400..C54FF */
+  FriBidiPropsBlockLevel1_0800,  /* C5500..C55FF */
+  FriBidiPropsBlockLevel1_0800,  /* C5600..C56FF */
+  FriBidiPropsBlockLevel1_0800,  /* C5700..C57FF */
+  FriBidiPropsBlockLevel1_0800,  /* C5800..C58FF */
+  FriBidiPropsBlockLevel1_0800,  /* C5900..C59FF */
+  FriBidiPropsBlockLevel1_0800,  /* C5A00..C5AFF */
+  FriBidiPropsBlockLevel1_0800,  /* C5B00..C5BFF */
+  FriBidiPropsBlockLevel1_0800,  /* C5C00..C5CFF */
+  FriBidiPropsBlockLevel1_0800,  /* C5D00..C5DFF */
+  FriBidiPropsBlockLevel1_0800,  /* C5E00..C5EFF */
+  FriBidiPropsBlockLevel1_0800,  /* C5F00..C5FFF */
+  FriBidiPropsBlockLevel1_0800,  /* C6000..C60FF */
+  FriBidiPropsBlockLevel1_0800,  /* C6100..C61FF */
+  FriBidiPropsBlockLevel1_0800,  /* C6200..C62FF */
+  FriBidiPropsBlockLevel1_0800,  /* C6300..C63FF */
+  FriBidiPropsBlockLevel1_0800,  /* C6400..C64FF */
+  FriBidiPropsBlockLevel1_0800,  /* C6500..C65FF */
+  FriBidiPropsBlockLevel1_0800,  /* C6600..C66FF */
+  FriBidiPropsBlockLevel1_0800,  /* C6700..C67FF */
+  FriBidiPropsBlockLevel1_0800,  /* C6800..C68FF */
+  FriBidiPropsBlockLevel1_0800,  /* C6900..C69FF */
+  FriBidiPropsBlockLevel1_0800,  /* C6A00..C6AFF */
+  FriBidiPropsBlockLevel1_0800,  /* C6B00..C6BFF */
+  FriBidiPropsBlockLevel1_0800,  /* C6C00..C6CFF */
+  FriBidiPropsBlockLevel1_0800,  /* C6D00..C6DFF */
+  FriBidiPropsBlockLevel1_0800,  /* C6E00..C6EFF */
+  FriBidiPropsBlockLevel1_0800,  /* C6F00..C6FFF */
+  FriBidiPropsBlockLevel1_0800,  /* C7000..C70FF */
+  FriBidiPropsBlockLevel1_0800,  /* C7100..C71FF */
+  FriBidiPropsBlockLevel1_0800,  /* C7200..C72FF */
+  FriBidiPropsBlockLevel1_0800,  /* C7300..C73FF */
+  FriBidiPropsBlockLevel1_0800,  /* C7400..C74FF */
+  FriBidiPropsBlockLevel1_0800,  /* C7500..C75FF */
+  FriBidiPropsBlockLevel1_0800,  /* C7600..C76FF */
+  FriBidiPropsBlockLevel1_0800,  /* C7700..C77FF */
+  FriBidiPropsBlockLevel1_0800,  /* C7800..C78FF */
+  FriBidiPropsBlockLevel1_0800,  /* C7900..C79FF */
+  FriBidiPropsBlockLevel1_0800,  /* C7A00..C7AFF */
+  FriBidiPropsBlockLevel1_0800,  /* C7B00..C7BFF */
+  FriBidiPropsBlockLevel1_0800,  /* C7C00..C7CFF */
+  FriBidiPropsBlockLevel1_0800,  /* C7D00..C7DFF */
+  FriBidiPropsBlockLevel1_0800,  /* C7E00..C7EFF */
+  FriBidiPropsBlockLevel1_0800,  /* C7F00..C7FFF */
+  FriBidiPropsBlockLevel1_0800,  /* C8000..C80FF */
+  FriBidiPropsBlockLevel1_0800,  /* C8100..C81FF */
+  FriBidiPropsBlockLevel1_0800,  /* C8200..C82FF */
+  FriBidiPropsBlockLevel1_0800,  /* C8300..C83FF */
+  FriBidiPropsBlockLevel1_0800,  /* C8400..C84FF */
+  FriBidiPropsBlockLevel1_0800,  /* C8500..C85FF */
+  FriBidiPropsBlockLevel1_0800,  /* C8600..C86FF */
+  FriBidiPropsBlockLevel1_0800,  /* C8700..C87FF */
+  FriBidiPropsBlockLevel1_0800,  /* C8800..C88FF */
+  FriBidiPropsBlockLevel1_0800,  /* C8900..C89FF */
+  FriBidiPropsBlockLevel1_0800,  /* C8A00..C8AFF */
+  FriBidiPropsBlockLevel1_0800,  /* C8B00..C8BFF */
+  FriBidiPropsBlockLevel1_0800,  /* C8C00..C8CFF */
+  FriBidiPropsBlockLevel1_0800,  /* C8D00..C8DFF */
+  FriBidiPropsBlockLevel1_0800,  /* C8E00..C8EFF */
+  FriBidiPropsBlockLevel1_0800,  /* C8F00..C8FFF */
+  FriBidiPropsBlockLevel1_0800,  /* C9000..C90FF */
+  FriBidiPropsBlockLevel1_0800,  /* C9100..C91FF */
+  FriBidiPropsBlockLevel1_0800,  /* C9200..C92FF */
+  FriBidiPropsBlockLevel1_0800,  /* C9300..C93FF */
+  FriBidiPropsBlockLevel1_0800,  /* C9400..C94FF */
+  FriBidiPropsBlockLevel1_0800,  /* C9500..C95FF */
+  FriBidiPropsBlockLevel1_0800,  /* C9600..C96FF */
+  FriBidiPropsBlockLevel1_0800,  /* C9700..C97FF */
+  FriBidiPropsBlockLevel1_0800,  /* C9800..C98FF */
+  FriBidiPropsBlockLevel1_0800,  /* C9900..C99FF */
+  FriBidiPropsBlockLevel1_0800,  /* C9A00..C9AFF */
+  FriBidiPropsBlockLevel1_0800,  /* C9B00..C9BFF */
+  FriBidiPropsBlockLevel1_0800,  /* C9C00..C9CFF */
+  FriBidiPropsBlockLevel1_0800,  /* C9D00..C9DFF */
+  FriBidiPropsBlockLevel1_0800,  /* C9E00..C9EFF */
+  FriBidiPropsBlockLevel1_0800,  /* C9F00..C9FFF */
+  FriBidiPropsBlockLevel1_0800,  /* CA000..CA0FF */
+  FriBidiPropsBlockLevel1_0800,  /* CA100..CA1FF */
+  FriBidiPropsBlockLevel1_0800,  /* CA200..CA2FF */
+  FriBidiPropsBlockLevel1_0800,  /* CA300..CA3FF */
+  FriBidiPropsBlockLevel1_0800,  /* CA400..CA4FF */
+  FriBidiPropsBlockLevel1_0800,  /* CA500..CA5FF */
+  FriBidiPropsBlockLevel1_0800,  /* CA600..CA6FF */
+  FriBidiPropsBlockLevel1_0800,  /* CA700..CA7FF */
+  FriBidiPropsBlockLevel1_0800,  /* CA800..CA8FF */
+  FriBidiPropsBlockLevel1_0800,  /* CA900..CA9FF */
+  FriBidiPropsBlockLevel1_0800,  /* CAA00..CAAFF */
+  FriBidiPropsBlockLevel1_0800,  /* CAB00..CABFF */
+  FriBidiPropsBlockLevel1_0800,  /* CAC00..CACFF */
+  FriBidiPropsBlockLevel1_0800,  /* CAD00..CADFF */
+  FriBidiPropsBlockLevel1_0800,  /* CAE00..CAEFF */
+  FriBidiPropsBlockLevel1_0800,  /* CAF00..CAFFF */
+  FriBidiPropsBlockLevel1_0800,  /* CB000..CB0FF */
+  FriBidiPropsBlockLevel1_0800,  /* CB100..CB1FF */
+  FriBidiPropsBlockLevel1_0800,  /* CB200..CB2FF */
+  FriBidiPropsBlockLevel1_0800,  /* CB300..CB3FF */
+  FriBidiPropsBlockLevel1_0800,  /* CB400..CB4FF */
+  FriBidiPropsBlockLevel1_0800,  /* CB500..CB5FF */
+  FriBidiPropsBlockLevel1_0800,  /* CB600..CB6FF */
+  FriBidiPropsBlockLevel1_0800,  /* CB700..CB7FF */
+  FriBidiPropsBlockLevel1_0800,  /* CB800..CB8FF */
+  FriBidiPropsBlockLevel1_0800,  /* CB900..CB9FF */
+  FriBidiPropsBlockLevel1_0800,  /* CBA00..CBAFF */
+  FriBidiPropsBlockLevel1_0800,  /* CBB00..CBBFF */
+  FriBidiPropsBlockLevel1_0800,  /* CBC00..CBCFF */
+  FriBidiPropsBlockLevel1_0800,  /* CBD00..CBDFF */
+  FriBidiPropsBlockLevel1_0800,  /* CBE00..CBEFF */
+  FriBidiPropsBlockLevel1_0800,  /* CBF00..CBFFF */
+  FriBidiPropsBlockLevel1_0800,  /* CC000..CC0FF */
+  FriBidiPropsBlockLevel1_0800,  /* CC100..CC1FF */
+  FriBidiPropsBlockLevel1_0800,  /* CC200..CC2FF */
+  FriBidiPropsBlockLevel1_0800,  /* CC300..CC3FF */
+  FriBidiPropsBlockLevel1_0800,  /* CC400..CC4FF */
+  FriBidiPropsBlockLevel1_0800,  /* CC500..CC5FF */
+  FriBidiPropsBlockLevel1_0800,  /* CC600..CC6FF */
+  FriBidiPropsBlockLevel1_0800,  /* CC700..CC7FF */
+  FriBidiPropsBlockLevel1_0800,  /* CC800..CC8FF */
+  FriBidiPropsBlockLevel1_0800,  /* CC900..CC9FF */
+  FriBidiPropsBlockLevel1_0800,  /* CCA00..CCAFF */
+  FriBidiPropsBlockLevel1_0800,  /* CCB00..CCBFF */
+  FriBidiPropsBlockLevel1_0800,  /* CCC00..CCCFF */
+  FriBidiPropsBlockLevel1_0800,  /* CCD00..CCDFF */
+  FriBidiPropsBlockLevel1_0800,  /* CCE00..CCEFF */
+  FriBidiPropsBlockLevel1_0800,  /* CCF00..CCFFF */
+  FriBidiPropsBlockLevel1_0800,  /* CD000..CD0FF */
+  FriBidiPropsBlockLevel1_0800,  /* CD100..CD1FF */
+  FriBidiPropsBlockLevel1_0800,  /* CD200..CD2FF */
+  FriBidiPropsBlockLevel1_0800,  /* CD300..CD3FF */
+  FriBidiPropsBlockLevel1_0800,  /* CD400..CD4FF */
+  FriBidiPropsBlockLevel1_0800,  /* CD500..CD5FF */
+  FriBidiPropsBlockLevel1_0800,  /* CD600..CD6FF */
+  FriBidiPropsBlockLevel1_0800,  /* CD700..CD7FF */
+  FriBidiPropsBlockLevel1_0800,  /* CD800..CD8FF */
+  FriBidiPropsBlockLevel1_0800,  /* CD900..CD9FF */
+  FriBidiPropsBlockLevel1_0800,  /* CDA00..CDAFF */
+  FriBidiPropsBlockLevel1_0800,  /* CDB00..CDBFF */
+  FriBidiPropsBlockLevel1_0800,  /* CDC00..CDCFF */
+  FriBidiPropsBlockLevel1_0800,  /* CDD00..CDDFF */
+  FriBidiPropsBlockLevel1_0800,  /* CDE00..CDEFF */
+  FriBidiPropsBlockLevel1_0800,  /* CDF00..CDFFF */
+  FriBidiPropsBlockLevel1_0800,  /* CE000..CE0FF */
+  FriBidiPropsBlockLevel1_0800,  /* CE100..CE1FF */
+  FriBidiPropsBlockLevel1_0800,  /* CE200..CE2FF */
+  FriBidiPropsBlockLevel1_0800,  /* CE300..CE3FF */
+  FriBidiPropsBlockLevel1_0800,  /* CE400..CE4FF */
+  FriBidiPropsBlockLevel1_0800,  /* CE500..CE5FF */
+  FriBidiPropsBlockLevel1_0800,  /* CE600..CE6FF */
+  FriBidiPropsBlockLevel1_0800,  /* CE700..CE7FF */
+  FriBidiPropsBlockLevel1_0800,  /* CE800..CE8FF */
+  FriBidiPropsBlockLevel1_0800,  /* CE900..CE9FF */
+  FriBidiPropsBlockLevel1_0800,  /* CEA00..CEAFF */
+  FriBidiPropsBlockLevel1_0800,  /* CEB00..CEBFF */
+  FriBidiPropsBlockLevel1_0800,  /* CEC00..CECFF */
+  FriBidiPropsBlockLevel1_0800,  /* CED00..CEDFF */
+  FriBidiPropsBlockLevel1_0800,  /* CEE00..CEEFF */
+  FriBidiPropsBlockLevel1_0800,  /* CEF00..CEFFF */
+  FriBidiPropsBlockLevel1_0800,  /* CF000..CF0FF */
+  FriBidiPropsBlockLevel1_0800,  /* CF100..CF1FF */
+  FriBidiPropsBlockLevel1_0800,  /* CF200..CF2FF */
+  FriBidiPropsBlockLevel1_0800,  /* CF300..CF3FF */
+  FriBidiPropsBlockLevel1_0800,  /* CF400..CF4FF */
+  FriBidiPropsBlockLevel1_0800,  /* CF500..CF5FF */
+  FriBidiPropsBlockLevel1_0800,  /* CF600..CF6FF */
+  FriBidiPropsBlockLevel1_0800,  /* CF700..CF7FF */
+  FriBidiPropsBlockLevel1_0800,  /* CF800..CF8FF */
+  FriBidiPropsBlockLevel1_0800,  /* CF900..CF9FF */
+  FriBidiPropsBlockLevel1_0800,  /* CFA00..CFAFF */
+  FriBidiPropsBlockLevel1_0800,  /* CFB00..CFBFF */
+  FriBidiPropsBlockLevel1_0800,  /* CFC00..CFCFF */
+  FriBidiPropsBlockLevel1_0800,  /* CFD00..CFDFF */
+  FriBidiPropsBlockLevel1_0800,  /* CFE00..CFEFF */
+  FriBidiPropsBlockLevel1_0800,  /* CFF00..CFFFF */
+  FriBidiPropsBlockLevel1_0800,  /* D0000..D00FF */
+  FriBidiPropsBlockLevel1_0800,  /* D0100..D01FF */
+  FriBidiPropsBlockLevel1_0800,  /* D0200..D02FF */
+  FriBidiPropsBlockLevel1_0800,  /* D0300..D03FF */
+  FriBidiPropsBlockLevel1_0800,  /* D0400..D04FF */
+  FriBidiPropsBlockLevel1_0800,  /* D0500..D05FF */
+  FriBidiPropsBlockLevel1_0800,  /* D0600..D06FF */
+  FriBidiPropsBlockLevel1_0800,  /* D0700..D07FF */
+  FriBidiPropsBlockLevel1_0800,  /* D0800..D08FF */
+  FriBidiPropsBlockLevel1_0800,  /* D0900..D09FF */
+  FriBidiPropsBlockLevel1_0800,  /* D0A00..D0AFF */
+  FriBidiPropsBlockLevel1_0800,  /* D0B00..D0BFF */
+  FriBidiPropsBlockLevel1_0800,  /* D0C00..D0CFF */
+  FriBidiPropsBlockLevel1_0800,  /* D0D00..D0DFF */
+  FriBidiPropsBlockLevel1_0800,  /* D0E00..D0EFF */
+  FriBidiPropsBlockLevel1_0800,  /* D0F00..D0FFF */
+  FriBidiPropsBlockLevel1_0800,  /* D1000..D10FF */
+  FriBidiPropsBlockLevel1_0800,  /* D1100..D11FF */
+  FriBidiPropsBlockLevel1_0800,  /* D1200..D12FF */
+  FriBidiPropsBlockLevel1_0800,  /* D1300..D13FF */
+  FriBidiPropsBlockLevel1_0800,  /* D1400..D14FF */
+  FriBidiPropsBlockLevel1_0800,  /* D1500..D15FF */
+  FriBidiPropsBlockLevel1_0800,  /* D1600..D16FF */
+  FriBidiPropsBlockLevel1_0800,  /* D1700..D17FF */
+  FriBidiPropsBlockLevel1_0800,  /* D1800..D18FF */
+  FriBidiPropsBlockLevel1_0800,  /* D1900..D19FF */
+  FriBidiPropsBlockLevel1_0800,  /* D1A00..D1AFF */
+  FriBidiPropsBlockLevel1_0800,  /* D1B00..D1BFF */
+  FriBidiPropsBlockLevel1_0800,  /* D1C00..D1CFF */
+  FriBidiPropsBlockLevel1_0800,  /* D1D00..D1DFF */
+  FriBidiPropsBlockLevel1_0800,  /* D1E00..D1EFF */
+  FriBidiPropsBlockLevel1_0800,  /* D1F00..D1FFF */
+  FriBidiPropsBlockLevel1_0800,  /* D2000..D20FF */
+  FriBidiPropsBlockLevel1_0800,  /* D2100..D21FF */
+  FriBidiPropsBlockLevel1_0800,  /* D2200..D22FF */
+  FriBidiPropsBlockLevel1_0800,  /* D2300..D23FF */
+  FriBidiPropsBlockLevel1_0800,  /* D2400..D24FF */
+  FriBidiPropsBlockLevel1_0800,  /* D2500..D25FF */
+  FriBidiPropsBlockLevel1_0800,  /* D2600..D26FF */
+  FriBidiPropsBlockLevel1_0800,  /* D2700..D27FF */
+  FriBidiPropsBlockLevel1_0800,  /* D2800..D28FF */
+  FriBidiPropsBlockLevel1_0800,  /* D2900..D29FF */
+  FriBidiPropsBlockLevel1_0800,  /* D2A00..D2AFF */
+  FriBidiPropsBlockLevel1_0800,  /* D2B00..D2BFF */
+  FriBidiPropsBlockLevel1_0800,  /* D2C00..D2CFF */
+  FriBidiPropsBlockLevel1_0800,  /* D2D00..D2DFF */
+  FriBidiPropsBlockLevel1_0800,  /* D2E00..D2EFF */
+  FriBidiPropsBlockLevel1_0800,  /* D2F00..D2FFF */
+  FriBidiPropsBlockLevel1_0800,  /* D3000..D30FF */
+  FriBidiPropsBlockLevel1_0800,  /* D3100..D31FF */
+  FriBidiPropsBlockLevel1_0800,  /* D3200..D32FF */
+  FriBidiPropsBlockLevel1_0800,  /* D3300..D33FF */
+  FriBidiPropsBlockLevel1_0800,  /* D3400..D34FF */
+  FriBidiPropsBlockLevel1_0800,  /* D3500..D35FF */
+  FriBidiPropsBlockLevel1_0800,  /* D3600..D36FF */
+  FriBidiPropsBlockLevel1_0800,  /* D3700..D37FF */
+  FriBidiPropsBlockLevel1_0800,  /* D3800..D38FF */
+  FriBidiPropsBlockLevel1_0800,  /* D3900..D39FF */
+  FriBidiPropsBlockLevel1_0800,  /* D3A00..D3AFF */
+  FriBidiPropsBlockLevel1_0800,  /* D3B00..D3BFF */
+  FriBidiPropsBlockLevel1_0800,  /* D3C00..D3CFF */
+  FriBidiPropsBlockLevel1_0800,  /* D3D00..D3DFF */
+  FriBidiPropsBlockLevel1_0800,  /* D3E00..D3EFF */
+  FriBidiPropsBlockLevel1_0800,  /* D3F00..D3FFF */
+  FriBidiPropsBlockLevel1_0800,  /* D4000..D40FF */
+  FriBidiPropsBlockLevel1_0800,  /* D4100..D41FF */
+  FriBidiPropsBlockLevel1_0800,  /* D4200..D42FF */
+  FriBidiPropsBlockLevel1_0800,  /* D4300..D43FF */
+  FriBidiPropsBlockLevel1_0800,  /* D4400..D44FF */
+  FriBidiPropsBlockLevel1_0800,  /* D4500..D45FF */
+  FriBidiPropsBlockLevel1_0800,  /* D4600..D46FF */
+  FriBidiPropsBlockLevel1_0800,  /* D4700..D47FF */
+  FriBidiPropsBlockLevel1_0800,  /* D4800..D48FF */
+  FriBidiPropsBlockLevel1_0800,  /* D4900..D49FF */
+  FriBidiPropsBlockLevel1_0800,  /* D4A00..D4AFF */
+  FriBidiPropsBlockLevel1_0800,  /* D4B00..D4BFF */
+  FriBidiPropsBlockLevel1_0800,  /* D4C00..D4CFF */
+  FriBidiPropsBlockLevel1_0800,  /* D4D00..D4DFF */
+  FriBidiPropsBlockLevel1_0800,  /* D4E00..D4EFF */
+  FriBidiPropsBlockLevel1_0800,  /* D4F00..D4FFF */
+  FriBidiPropsBlockLevel1_0800,  /* D5000..D50FF */
+  FriBidiPropsBlockLevel1_0800,  /* D5100..D51FF */
+  FriBidiPropsBlockLevel1_0800,  /* D5200..D52FF */
+  FriBidiPropsBlockLevel1_0800,  /* D5300..D53FF */
+  FriBidiPropsBlockLevel1_0800,  /* D5400..D54FF */
+  FriBidiPropsBlockLevel1_0800,  /* D5500..D55FF */
+  FriBidiPropsBlockLevel1_0800,  /* D5600..D56FF */
+  FriBidiPropsBlockLevel1_0800,  /* D5700..D57FF */
+  FriBidiPropsBlockLevel1_0800,  /* D5800..D58FF */
+  FriBidiPropsBlockLevel1_0800,  /* D5900..D59FF */
+  FriBidiPropsBlockLevel1_0800,  /* D5A00..D5AFF */
+  FriBidiPropsBlockLevel1_0800,  /* D5B00..D5BFF */
+  FriBidiPropsBlockLevel1_0800,  /* D5C00..D5CFF */
+  FriBidiPropsBlockLevel1_0800,  /* D5D00..D5DFF */
+  FriBidiPropsBlockLevel1_0800,  /* D5E00..D5EFF */
+  FriBidiPropsBlockLevel1_0800,  /* D5F00..D5FFF */
+  FriBidiPropsBlockLevel1_0800,  /* D6000..D60FF */
+  FriBidiPropsBlockLevel1_0800,  /* D6100..D61FF */
+  FriBidiPropsBlockLevel1_0800,  /* D6200..D62FF */
+  FriBidiPropsBlockLevel1_0800,  /* D6300..D63FF */
+  FriBidiPropsBlockLevel1_0800,  /* D6400..D64FF */
+  FriBidiPropsBlockLevel1_0800,  /* D6500..D65FF */
+  FriBidiPropsBlockLevel1_0800,  /* D6600..D66FF */
+  FriBidiPropsBlockLevel1_0800,  /* D6700..D67FF */
+  FriBidiPropsBlockLevel1_0800,  /* D6800..D68FF */
+  FriBidiPropsBlockLevel1_0800,  /* D6900..D69FF */
+  FriBidiPropsBlockLevel1_0800,  /* D6A00..D6AFF */
+  FriBidiPropsBlockLevel1_0800,  /* D6B00..D6BFF */
+  FriBidiPropsBlockLevel1_0800,  /* D6C00..D6CFF */
+  FriBidiPropsBlockLevel1_0800,  /* D6D00..D6DFF */
+  FriBidiPropsBlockLevel1_0800,  /* D6E00..D6EFF */
+  FriBidiPropsBlockLevel1_0800,  /* D6F00..D6FFF */
+  FriBidiPropsBlockLevel1_0800,  /* D7000..D70FF */
+  FriBidiPropsBlockLevel1_0800,  /* D7100..D71FF */
+  FriBidiPropsBlockLevel1_0800,  /* D7200..D72FF */
+  FriBidiPropsBlockLevel1_0800,  /* D7300..D73FF */
+  FriBidiPropsBlockLevel1_0800,  /* D7400..D74FF */
+  FriBidiPropsBlockLevel1_0800,  /* D7500..D75FF */
+  FriBidiPropsBlockLevel1_0800,  /* D7600..D76FF */
+  FriBidiPropsBlockLevel1_0800,  /* D7700..D77FF */
+  FriBidiPropsBlockLevel1_0800,  /* D7800..D78FF */
+  FriBidiPropsBlockLevel1_0800,  /* D7900..D79FF */
+  FriBidiPropsBlockLevel1_0800,  /* D7A00..D7AFF */
+  FriBidiPropsBlockLevel1_0800,  /* D7B00..D7BFF */
+  FriBidiPropsBlockLevel1_0800,  /* D7C00..D7CFF */
+  FriBidiPropsBlockLevel1_0800,  /* D7D00..D7DFF */
+  FriBidiPropsBlockLevel1_0800,  /* D7E00..D7EFF */
+  FriBidiPropsBlockLevel1_0800,  /* D7F00..D7FFF */
+  FriBidiPropsBlockLevel1_0800,  /* D8000..D80FF */
+  FriBidiPropsBlockLevel1_0800,  /* D8100..D81FF */
+  FriBidiPropsBlockLevel1_0800,  /* D8200..D82FF */
+  FriBidiPropsBlockLevel1_0800,  /* D8300..D83FF */
+  FriBidiPropsBlockLevel1_0800,  /* D8400..D84FF */
+  FriBidiPropsBlockLevel1_0800,  /* D8500..D85FF */
+  FriBidiPropsBlockLevel1_0800,  /* D8600..D86FF */
+  FriBidiPropsBlockLevel1_0800,  /* D8700..D87FF */
+  FriBidiPropsBlockLevel1_0800,  /* D8800..D88FF */
+  FriBidiPropsBlockLevel1_0800,  /* D8900..D89FF */
+  FriBidiPropsBlockLevel1_0800,  /* D8A00..D8AFF */
+  FriBidiPropsBlockLevel1_0800,  /* D8B00..D8BFF */
+  FriBidiPropsBlockLevel1_0800,  /* D8C00..D8CFF */
+  FriBidiPropsBlockLevel1_0800,  /* D8D00..D8DFF */
+  FriBidiPropsBlockLevel1_0800,  /* D8E00..D8EFF */
+  FriBidiPropsBlockLevel1_0800,  /* D8F00..D8FFF */
+  FriBidiPropsBlockLevel1_0800,  /* D9000..D90FF */
+  FriBidiPropsBlockLevel1_0800,  /* D9100..D91FF */
+  FriBidiPropsBlockLevel1_0800,  /* D9200..D92FF */
+  FriBidiPropsBlockLevel1_0800,  /* D9300..D93FF */
+  FriBidiPropsBlockLevel1_0800,  /* D9400..D94FF */
+  FriBidiPropsBlockLevel1_0800,  /* D9500..D95FF */
+  FriBidiPropsBlockLevel1_0800,  /* D9600..D96FF */
+  FriBidiPropsBlockLevel1_0800,  /* D9700..D97FF */
+  FriBidiPropsBlockLevel1_0800,  /* D9800..D98FF */
+  FriBidiPropsBlockLevel1_0800,  /* D9900..D99FF */
+  FriBidiPropsBlockLevel1_0800,  /* D9A00..D9AFF */
+  FriBidiPropsBlockLevel1_0800,  /* D9B00..D9BFF */
+  FriBidiPropsBlockLevel1_0800,  /* D9C00..D9CFF */
+  FriBidiPropsBlockLevel1_0800,  /* D9D00..D9DFF */
+  FriBidiPropsBlockLevel1_0800,  /* D9E00..D9EFF */
+  FriBidiPropsBlockLevel1_0800,  /* D9F00..D9FFF */
+  FriBidiPropsBlockLevel1_0800,  /* DA000..DA0FF */
+  FriBidiPropsBlockLevel1_0800,  /* DA100..DA1FF */
+  FriBidiPropsBlockLevel1_0800,  /* DA200..DA2FF */
+  FriBidiPropsBlockLevel1_0800,  /* DA300..DA3FF */
+  FriBidiPropsBlockLevel1_0800,  /* DA400..DA4FF */
+  FriBidiPropsBlockLevel1_0800,  /* DA500..DA5FF */
+  FriBidiPropsBlockLevel1_0800,  /* DA600..DA6FF */
+  FriBidiPropsBlockLevel1_0800,  /* DA700..DA7FF */
+  FriBidiPropsBlockLevel1_0800,  /* DA800..DA8FF */
+  FriBidiPropsBlockLevel1_0800,  /* DA900..DA9FF */
+  FriBidiPropsBlockLevel1_0800,  /* DAA00..DAAFF */
+  FriBidiPropsBlockLevel1_0800,  /* DAB00..DABFF */
+  FriBidiPropsBlockLevel1_0800,  /* DAC00..DACFF */
+  FriBidiPropsBlockLevel1_0800,  /* DAD00..DADFF */
+  FriBidiPropsBlockLevel1_0800,  /* DAE00..DAEFF */
+  FriBidiPropsBlockLevel1_0800,  /* DAF00..DAFFF */
+  FriBidiPropsBlockLevel1_0800,  /* DB000..DB0FF */
+  FriBidiPropsBlockLevel1_0800,  /* DB100..DB1FF */
+  FriBidiPropsBlockLevel1_0800,  /* DB200..DB2FF */
+  FriBidiPropsBlockLevel1_0800,  /* DB300..DB3FF */
+  FriBidiPropsBlockLevel1_0800,  /* DB400..DB4FF */
+  FriBidiPropsBlockLevel1_0800,  /* DB500..DB5FF */
+  FriBidiPropsBlockLevel1_0800,  /* DB600..DB6FF */
+  FriBidiPropsBlockLevel1_0800,  /* DB700..DB7FF */
+  FriBidiPropsBlockLevel1_0800,  /* DB800..DB8FF */
+  FriBidiPropsBlockLevel1_0800,  /* DB900..DB9FF */
+  FriBidiPropsBlockLevel1_0800,  /* DBA00..DBAFF */
+  FriBidiPropsBlockLevel1_0800,  /* DBB00..DBBFF */
+  FriBidiPropsBlockLevel1_0800,  /* DBC00..DBCFF */
+  FriBidiPropsBlockLevel1_0800,  /* DBD00..DBDFF */
+  FriBidiPropsBlockLevel1_0800,  /* DBE00..DBEFF */
+  FriBidiPropsBlockLevel1_0800,  /* DBF00..DBFFF */
+  FriBidiPropsBlockLevel1_0800,  /* DC000..DC0FF */
+  FriBidiPropsBlockLevel1_0800,  /* DC100..DC1FF */
+  FriBidiPropsBlockLevel1_0800,  /* DC200..DC2FF */
+  FriBidiPropsBlockLevel1_0800,  /* DC300..DC3FF */
+  FriBidiPropsBlockLevel1_0800,  /* DC400..DC4FF */
+  FriBidiPropsBlockLevel1_0800,  /* DC500..DC5FF */
+  FriBidiPropsBlockLevel1_0800,  /* DC600..DC6FF */
+  FriBidiPropsBlockLevel1_0800,  /* DC700..DC7FF */
+  FriBidiPropsBlockLevel1_0800,  /* DC800..DC8FF */
+  FriBidiPropsBlockLevel1_0800,  /* DC900..DC9FF */
+  FriBidiPropsBlockLevel1_0800,  /* DCA00..DCAFF */
+  FriBidiPropsBlockLevel1_0800,  /* DCB00..DCBFF */
+  FriBidiPropsBlockLevel1_0800,  /* DCC00..DCCFF */
+  FriBidiPropsBlockLevel1_0800,  /* DCD00..DCDFF */
+  FriBidiPropsBlockLevel1_0800,  /* DCE00..DCEFF */
+  FriBidiPropsBlockLevel1_0800,  /* DCF00..DCFFF */
+  FriBidiPropsBlockLevel1_0800,  /* DD000..DD0FF */
+  FriBidiPropsBlockLevel1_0800,  /* DD100..DD1FF */
+  FriBidiPropsBlockLevel1_0800,  /* DD200..DD2FF */
+  FriBidiPropsBlockLevel1_0800,  /* DD300..DD3FF */
+  FriBidiPropsBlockLevel1_0800,  /* DD400..DD4FF */
+  FriBidiPropsBlockLevel1_0800,  /* DD500..DD5FF */
+  FriBidiPropsBlockLevel1_0800,  /* DD600..DD6FF */
+  FriBidiPropsBlockLevel1_0800,  /* DD700..DD7FF */
+  FriBidiPropsBlockLevel1_0800,  /* DD800..DD8FF */
+  FriBidiPropsBlockLevel1_0800,  /* DD900..DD9FF */
+  FriBidiPropsBlockLevel1_0800,  /* DDA00..DDAFF */
+  FriBidiPropsBlockLevel1_0800,  /* DDB00..DDBFF */
+  FriBidiPropsBlockLevel1_0800,  /* DDC00..DDCFF */
+  FriBidiPropsBlockLevel1_0800,  /* DDD00..DDDFF */
+  FriBidiPropsBlockLevel1_0800,  /* DDE00..DDEFF */
+  FriBidiPropsBlockLevel1_0800,  /* DDF00..DDFFF */
+  FriBidiPropsBlockLevel1_0800,  /* DE000..DE0FF */
+  FriBidiPropsBlockLevel1_0800,  /* DE100..DE1FF */
+  FriBidiPropsBlockLevel1_0800,  /* DE200..DE2FF */
+  FriBidiPropsBlockLevel1_0800,  /* DE300..DE3FF */
+  FriBidiPropsBlockLevel1_0800,  /* DE400..DE4FF */
+  FriBidiPropsBlockLevel1_0800,  /* DE500..DE5FF */
+  FriBidiPropsBlockLevel1_0800,  /* DE600..DE6FF */
+  FriBidiPropsBlockLevel1_0800,  /* DE700..DE7FF */
+  FriBidiPropsBlockLevel1_0800,  /* DE800..DE8FF */
+  FriBidiPropsBlockLevel1_0800,  /* DE900..DE9FF */
+  FriBidiPropsBlockLevel1_0800,  /* DEA00..DEAFF */
+  FriBidiPropsBlockLevel1_0800,  /* DEB00..DEBFF */
+  FriBidiPropsBlockLevel1_0800,  /* DEC00..DECFF */
+  FriBidiPropsBlockLevel1_0800,  /* DED00..DEDFF */
+  FriBidiPropsBlockLevel1_0800,  /* DEE00..DEEFF */
+  FriBidiPropsBlockLevel1_0800,  /* DEF00..DEFFF */
+  FriBidiPropsBlockLevel1_0800,  /* DF000..DF0FF */
+  FriBidiPropsBlockLevel1_0800,  /* DF100..DF1FF */
+  FriBidiPropsBlockLevel1_0800,  /* DF200..DF2FF */
+  FriBidiPropsBlockLevel1_0800,  /* DF300..DF3FF */
+  FriBidiPropsBlockLevel1_0800,  /* DF400..DF4FF */
+  FriBidiPropsBlockLevel1_0800,  /* DF500..DF5FF */
+  FriBidiPropsBlockLevel1_0800,  /* DF600..DF6FF */
+  FriBidiPropsBlockLevel1_0800,  /* DF700..DF7FF */
+  FriBidiPropsBlockLevel1_0800,  /* DF800..DF8FF */
+  FriBidiPropsBlockLevel1_0800,  /* DF900..DF9FF */
+  FriBidiPropsBlockLevel1_0800,  /* DFA00..DFAFF */
+  FriBidiPropsBlockLevel1_0800,  /* DFB00..DFBFF */
+  FriBidiPropsBlockLevel1_0800,  /* DFC00..DFCFF */
+  FriBidiPropsBlockLevel1_0800,  /* DFD00..DFDFF */
+  FriBidiPropsBlockLevel1_0800,  /* DFE00..DFEFF */
+  FriBidiPropsBlockLevel1_0800,  /* DFF00..DFFFF */
+  FriBidiPropsBlockLevel1_E0000,  /* E0000..E00FF */
+  FriBidiPropsBlockLevel1_0800,  /* E0100..E01FF */
+  FriBidiPropsBlockLevel1_0800,  /* E0200..E02FF */
+  FriBidiPropsBlockLevel1_0800,  /* E0300..E03FF */
+  FriBidiPropsBlockLevel1_0800,  /* E0400..E04FF */
+  FriBidiPropsBlockLevel1_0800,  /* E0500..E05FF */
+  FriBidiPropsBlockLevel1_0800,  /* E0600..E06FF */
+  FriBidiPropsBlockLevel1_0800,  /* E0700..E07FF */
+  FriBidiPropsBlockLevel1_0800,  /* E0800..E08FF */
+  FriBidiPropsBlockLevel1_0800,  /* E0900..E09FF */
+  FriBidiPropsBlockLevel1_0800,  /* E0A00..E0AFF */
+  FriBidiPropsBlockLevel1_0800,  /* E0B00..E0BFF */
+  FriBidiPropsBlockLevel1_0800,  /* E0C00..E0CFF */
+  FriBidiPropsBlockLevel1_0800,  /* E0D00..E0DFF */
+  FriBidiPropsBlockLevel1_0800,  /* E0E00..E0EFF */
+  FriBidiPropsBlockLevel1_0800,  /* E0F00..E0FFF */
+  FriBidiPropsBlockLevel1_0800,  /* E1000..E10FF */
+  FriBidiPropsBlockLevel1_0800,  /* E1100..E11FF */
+  FriBidiPropsBlockLevel1_0800,  /* E1200..E12FF */
+  FriBidiPropsBlockLevel1_0800,  /* E1300..E13FF */
+  FriBidiPropsBlockLevel1_0800,  /* E1400..E14FF */
+  FriBidiPropsBlockLevel1_0800,  /* E1500..E15FF */
+  FriBidiPropsBlockLevel1_0800,  /* E1600..E16FF */
+  FriBidiPropsBlockLevel1_0800,  /* E1700..E17FF */
+  FriBidiPropsBlockLevel1_0800,  /* E1800..E18FF */
+  FriBidiPropsBlockLevel1_0800,  /* E1900..E19FF */
+  FriBidiPropsBlockLevel1_0800,  /* E1A00..E1AFF */
+  FriBidiPropsBlockLevel1_0800,  /* E1B00..E1BFF */
+  FriBidiPropsBlockLevel1_0800,  /* E1C00..E1CFF */
+  FriBidiPropsBlockLevel1_0800,  /* E1D00..E1DFF */
+  FriBidiPropsBlockLevel1_0800,  /* E1E00..E1EFF */
+  FriBidiPropsBlockLevel1_0800,  /* E1F00..E1FFF */
+  FriBidiPropsBlockLevel1_0800,  /* E2000..E20FF */
+  FriBidiPropsBlockLevel1_0800,  /* E2100..E21FF */
+  FriBidiPropsBlockLevel1_0800,  /* E2200..E22FF */
+  FriBidiPropsBlockLevel1_0800,  /* E2300..E23FF */
+  FriBidiPropsBlockLevel1_0800,  /* E2400..E24FF */
+  FriBidiPropsBlockLevel1_0800,  /* E2500..E25FF */
+  FriBidiPropsBlockLevel1_0800,  /* E2600..E26FF */
+  FriBidiPropsBlockLevel1_0800,  /* E2700..E27FF */
+  FriBidiPropsBlockLevel1_0800,  /* E2800..E28FF */
+  FriBidiPropsBlockLevel1_0800,  /* E2900..E29FF */
+  FriBidiPropsBlockLevel1_0800,  /* E2A00..E2AFF */
+  FriBidiPropsBlockLevel1_0800,  /* E2B00..E2BFF */
+  FriBidiPropsBlockLevel1_0800,  /* E2C00..E2CFF */
+  FriBidiPropsBlockLevel1_0800,  /* E2D00..E2DFF */
+  FriBidiPropsBlockLevel1_0800,  /* E2E00..E2EFF */
+  FriBidiPropsBlockLevel1_0800,  /* E2F00..E2FFF */
+  FriBidiPropsBlockLevel1_0800,  /* E3000..E30FF */
+  FriBidiPropsBlockLevel1_0800,  /* E3100..E31FF */
+  FriBidiPropsBlockLevel1_0800,  /* E3200..E32FF */
+  FriBidiPropsBlockLevel1_0800,  /* E3300..E33FF */
+  FriBidiPropsBlockLevel1_0800,  /* E3400..E34FF */
+  FriBidiPropsBlockLevel1_0800,  /* E3500..E35FF */
+  FriBidiPropsBlockLevel1_0800,  /* E3600..E36FF */
+  FriBidiPropsBlockLevel1_0800,  /* E3700..E37FF */
+  FriBidiPropsBlockLevel1_0800,  /* E3800..E38FF */
+  FriBidiPropsBlockLevel1_0800,  /* E3900..E39FF */
+  FriBidiPropsBlockLevel1_0800,  /* E3A00..E3AFF */
+  FriBidiPropsBlockLevel1_0800,  /* E3B00..E3BFF */
+  FriBidiPropsBlockLevel1_0800,  /* E3C00..E3CFF */
+  FriBidiPropsBlockLevel1_0800,  /* E3D00..E3DFF */
+  FriBidiPropsBlockLevel1_0800,  /* E3E00..E3EFF */
+  FriBidiPropsBlockLevel1_0800,  /* E3F00..E3FFF */
+  FriBidiPropsBlockLevel1_0800,  /* E4000..E40FF */
+  FriBidiPropsBlockLevel1_0800,  /* E4100..E41FF */
+  FriBidiPropsBlockLevel1_0800,  /* E4200..E42FF */
+  FriBidiPropsBlockLevel1_0800,  /* E4300..E43FF */
+  FriBidiPropsBlockLevel1_0800,  /* E4400..E44FF */
+  FriBidiPropsBlockLevel1_0800,  /* E4500..E45FF */
+  FriBidiPropsBlockLevel1_0800,  /* E4600..E46FF */
+  FriBidiPropsBlockLevel1_0800,  /* E4700..E47FF */
+  FriBidiPropsBlockLevel1_0800,  /* E4800..E48FF */
+  FriBidiPropsBlockLevel1_0800,  /* E4900..E49FF */
+  FriBidiPropsBlockLevel1_0800,  /* E4A00..E4AFF */
+  FriBidiPropsBlockLevel1_0800,  /* E4B00..E4BFF */
+  FriBidiPropsBlockLevel1_0800,  /* E4C00..E4CFF */
+  FriBidiPropsBlockLevel1_0800,  /* E4D00..E4DFF */
+  FriBidiPropsBlockLevel1_0800,  /* E4E00..E4EFF */
+  FriBidiPropsBlockLevel1_0800,  /* E4F00..E4FFF */
+  FriBidiPropsBlockLevel1_0800,  /* E5000..E50FF */
+  FriBidiPropsBlockLevel1_0800,  /* E5100..E51FF */
+  FriBidiPropsBlockLevel1_0800,  /* E5200..E52FF */
+  FriBidiPropsBlockLevel1_0800,  /* E5300..E53FF */
+  FriBidiPropsBlockLevel1_0800,  /* E5400..E54FF */
+  FriBidiPropsBlockLevel1_0800,  /* E5500..E55FF */
+  FriBidiPropsBlockLevel1_0800,  /* E5600..E56FF */
+  FriBidiPropsBlockLevel1_0800,  /* E5700..E57FF */
+  FriBidiPropsBlockLevel1_0800,  /* E5800..E58FF */
+  FriBidiPropsBlockLevel1_0800,  /* E5900..E59FF */
+  FriBidiPropsBlockLevel1_0800,  /* E5A00..E5AFF */
+  FriBidiPropsBlockLevel1_0800,  /* E5B00..E5BFF */
+  FriBidiPropsBlockLevel1_0800,  /* E5C00..E5CFF */
+  FriBidiPropsBlockLevel1_0800,  /* E5D00..E5DFF */
+  FriBidiPropsBlockLevel1_0800,  /* E5E00..E5EFF */
+  FriBidiPropsBlockLevel1_0800,  /* E5F00..E5FFF */
+  FriBidiPropsBlockLevel1_0800,  /* E6000..E60FF */
+  FriBidiPropsBlockLevel1_0800,  /* E6100..E61FF */
+  FriBidiPropsBlockLevel1_0800,  /* E6200..E62FF */
+  FriBidiPropsBlockLevel1_0800,  /* E6300..E63FF */
+  FriBidiPropsBlockLevel1_0800,  /* E6400..E64FF */
+  FriBidiPropsBlockLevel1_0800,  /* E6500..E65FF */
+  FriBidiPropsBlockLevel1_0800,  /* E6600..E66FF */
+  FriBidiPropsBlockLevel1_0800,  /* E6700..E67FF */
+  FriBidiPropsBlockLevel1_0800,  /* E6800..E68FF */
+  FriBidiPropsBlockLevel1_0800,  /* E6900..E69FF */
+  FriBidiPropsBlockLevel1_0800,  /* E6A00..E6AFF */
+  FriBidiPropsBlockLevel1_0800,  /* E6B00..E6BFF */
+  FriBidiPropsBlockLevel1_0800,  /* E6C00..E6CFF */
+  FriBidiPropsBlockLevel1_0800,  /* E6D00..E6DFF */
+  FriBidiPropsBlockLevel1_0800,  /* E6E00..E6EFF */
+  FriBidiPropsBlockLevel1_0800,  /* E6F00..E6FFF */
+  FriBidiPropsBlockLevel1_0800,  /* E7000..E70FF */
+  FriBidiPropsBlockLevel1_0800,  /* E7100..E71FF */
+  FriBidiPropsBlockLevel1_0800,  /* E7200..E72FF */
+  FriBidiPropsBlockLevel1_0800,  /* E7300..E73FF */
+  FriBidiPropsBlockLevel1_0800,  /* E7400..E74FF */
+  FriBidiPropsBlockLevel1_0800,  /* E7500..E75FF */
+  FriBidiPropsBlockLevel1_0800,  /* E7600..E76FF */
+  FriBidiPropsBlockLevel1_0800,  /* E7700..E77FF */
+  FriBidiPropsBlockLevel1_0800,  /* E7800..E78FF */
+  FriBidiPropsBlockLevel1_0800,  /* E7900..E79FF */
+  FriBidiPropsBlockLevel1_0800,  /* E7A00..E7AFF */
+  FriBidiPropsBlockLevel1_0800,  /* E7B00..E7BFF */
+  FriBidiPropsBlockLevel1_0800,  /* E7C00..E7CFF */
+  FriBidiPropsBlockLevel1_0800,  /* E7D00..E7DFF */
+  FriBidiPropsBlockLevel1_0800,  /* E7E00..E7EFF */
+  FriBidiPropsBlockLevel1_0800,  /* E7F00..E7FFF */
+  FriBidiPropsBlockLevel1_0800,  /* E8000..E80FF */
+  FriBidiPropsBlockLevel1_0800,  /* E8100..E81FF */
+  FriBidiPropsBlockLevel1_0800,  /* E8200..E82FF */
+  FriBidiPropsBlockLevel1_0800,  /* E8300..E83FF */
+  FriBidiPropsBlockLevel1_0800,  /* E8400..E84FF */
+  FriBidiPropsBlockLevel1_0800,  /* E8500..E85FF */
+  FriBidiPropsBlockLevel1_0800,  /* E8600..E86FF */
+  FriBidiPropsBlockLevel1_0800,  /* E8700..E87FF */
+  FriBidiPropsBlockLevel1_0800,  /* E8800..E88FF */
+  FriBidiPropsBlockLevel1_0800,  /* E8900..E89FF */
+  FriBidiPropsBlockLevel1_0800,  /* E8A00..E8AFF */
+  FriBidiPropsBlockLevel1_0800,  /* E8B00..E8BFF */
+  FriBidiPropsBlockLevel1_0800,  /* E8C00..E8CFF */
+  FriBidiPropsBlockLevel1_0800,  /* E8D00..E8DFF */
+  FriBidiPropsBlockLevel1_0800,  /* E8E00..E8EFF */
+  FriBidiPropsBlockLevel1_0800,  /* E8F00..E8FFF */
+  FriBidiPropsBlockLevel1_0800,  /* E9000..E90FF */
+  FriBidiPropsBlockLevel1_0800,  /* E9100..E91FF */
+  FriBidiPropsBlockLevel1_0800,  /* E9200..E92FF */
+  FriBidiPropsBlockLevel1_0800,  /* E9300..E93FF */
+  FriBidiPropsBlockLevel1_0800,  /* E9400..E94FF */
+  FriBidiPropsBlockLevel1_0800,  /* E9500..E95FF */
+  FriBidiPropsBlockLevel1_0800,  /* E9600..E96FF */
+  FriBidiPropsBlockLevel1_0800,  /* E9700..E97FF */
+  FriBidiPropsBlockLevel1_0800,  /* E9800..E98FF */
+  FriBidiPropsBlockLevel1_0800,  /* E9900..E99FF */
+  FriBidiPropsBlockLevel1_0800,  /* E9A00..E9AFF */
+  FriBidiPropsBlockLevel1_0800,  /* E9B00..E9BFF */
+  FriBidiPropsBlockLevel1_0800,  /* E9C00..E9CFF */
+  FriBidiPropsBlockLevel1_0800,  /* E9D00..E9DFF */
+  FriBidiPropsBlockLevel1_0800,  /* E9E00..E9EFF */
+  FriBidiPropsBlockLevel1_0800,  /* E9F00..E9FFF */
+  FriBidiPropsBlockLevel1_0800,  /* EA000..EA0FF */
+  FriBidiPropsBlockLevel1_0800,  /* EA100..EA1FF */
+  FriBidiPropsBlockLevel1_0800,  /* EA200..EA2FF */
+  FriBidiPropsBlockLevel1_0800,  /* EA300..EA3FF */
+  FriBidiPropsBlockLevel1_0800,  /* EA400..EA4FF */
+  FriBidiPropsBlockLevel1_0800,  /* EA500..EA5FF */
+  FriBidiPropsBlockLevel1_0800,  /* EA600..EA6FF */
+  FriBidiPropsBlockLevel1_0800,  /* EA700..EA7FF */
+  FriBidiPropsBlockLevel1_0800,  /* EA800..EA8FF */
+  FriBidiPropsBlockLevel1_0800,  /* EA900..EA9FF */
+  FriBidiPropsBlockLevel1_0800,  /* EAA00..EAAFF */
+  FriBidiPropsBlockLevel1_0800,  /* EAB00..EABFF */
+  FriBidiPropsBlockLevel1_0800,  /* EAC00..EACFF */
+  FriBidiPropsBlockLevel1_0800,  /* EAD00..EADFF */
+  FriBidiPropsBlockLevel1_0800,  /* EAE00..EAEFF */
+  FriBidiPropsBlockLevel1_0800,  /* EAF00..EAFFF */
+  FriBidiPropsBlockLevel1_0800,  /* EB000..EB0FF */
+  FriBidiPropsBlockLevel1_0800,  /* EB100..EB1FF */
+  FriBidiPropsBlockLevel1_0800,  /* EB200..EB2FF */
+  FriBidiPropsBlockLevel1_0800,  /* EB300..EB3FF */
+  FriBidiPropsBlockLevel1_0800,  /* EB400..EB4FF */
+  FriBidiPropsBlockLevel1_0800,  /* EB500..EB5FF */
+  FriBidiPropsBlockLevel1_0800,  /* EB600..EB6FF */
+  FriBidiPropsBlockLevel1_0800,  /* EB700..EB7FF */
+  FriBidiPropsBlockLevel1_0800,  /* EB800..EB8FF */
+  FriBidiPropsBlockLevel1_0800,  /* EB900..EB9FF */
+  FriBidiPropsBlockLevel1_0800,  /* EBA00..EBAFF */
+  FriBidiPropsBlockLevel1_0800,  /* EBB00..EBBFF */
+  FriBidiPropsBlockLevel1_0800,  /* EBC00..EBCFF */
+  FriBidiPropsBlockLevel1_0800,  /* EBD00..EBDFF */
+  FriBidiPropsBlockLevel1_0800,  /* EBE00..EBEFF */
+  FriBidiPropsBlockLevel1_0800,  /* EBF00..EBFFF */
+  FriBidiPropsBlockLevel1_0800,  /* EC000..EC0FF */
+  FriBidiPropsBlockLevel1_0800,  /* EC100..EC1FF */
+  FriBidiPropsBlockLevel1_0800,  /* EC200..EC2FF */
+  FriBidiPropsBlockLevel1_0800,  /* EC300..EC3FF */
+  FriBidiPropsBlockLevel1_0800,  /* EC400..EC4FF */
+  FriBidiPropsBlockLevel1_0800,  /* EC500..EC5FF */
+  FriBidiPropsBlockLevel1_0800,  /* EC600..EC6FF */
+  FriBidiPropsBlockLevel1_0800,  /* EC700..EC7FF */
+  FriBidiPropsBlockLevel1_0800,  /* EC800..EC8FF */
+  FriBidiPropsBlockLevel1_0800,  /* EC900..EC9FF */
+  FriBidiPropsBlockLevel1_0800,  /* ECA00..ECAFF */
+  FriBidiPropsBlockLevel1_0800,  /* ECB00..ECBFF */
+  FriBidiPropsBlockLevel1_0800,  /* ECC00..ECCFF */
+  FriBidiPropsBlockLevel1_0800,  /* ECD00..ECDFF */
+  FriBidiPropsBlockLevel1_0800,  /* ECE00..ECEFF */
+  FriBidiPropsBlockLevel1_0800,  /* ECF00..ECFFF */
+  FriBidiPropsBlockLevel1_0800,  /* ED000..ED0FF */
+  FriBidiPropsBlockLevel1_0800,  /* ED100..ED1FF */
+  FriBidiPropsBlockLevel1_0800,  /* ED200..ED2FF */
+  FriBidiPropsBlockLevel1_0800,  /* ED300..ED3FF */
+  FriBidiPropsBlockLevel1_0800,  /* ED400..ED4FF */
+  FriBidiPropsBlockLevel1_0800,  /* ED500..ED5FF */
+  FriBidiPropsBlockLevel1_0800,  /* ED600..ED6FF */
+  FriBidiPropsBlockLevel1_0800,  /* ED700..ED7FF */
+  FriBidiPropsBlockLevel1_0800,  /* ED800..ED8FF */
+  FriBidiPropsBlockLevel1_0800,  /* ED900..ED9FF */
+  FriBidiPropsBlockLevel1_0800,  /* EDA00..EDAFF */
+  FriBidiPropsBlockLevel1_0800,  /* EDB00..EDBFF */
+  FriBidiPropsBlockLevel1_0800,  /* EDC00..EDCFF */
+  FriBidiPropsBlockLevel1_0800,  /* EDD00..EDDFF */
+  FriBidiPropsBlockLevel1_0800,  /* EDE00..EDEFF */
+  FriBidiPropsBlockLevel1_0800,  /* EDF00..EDFFF */
+  FriBidiPropsBlockLevel1_0800,  /* EE000..EE0FF */
+  FriBidiPropsBlockLevel1_0800,  /* EE100..EE1FF */
+  FriBidiPropsBlockLevel1_0800,  /* EE200..EE2FF */
+  FriBidiPropsBlockLevel1_0800,  /* EE300..EE3FF */
+  FriBidiPropsBlockLevel1_0800,  /* EE400..EE4FF */
+  FriBidiPropsBlockLevel1_0800,  /* EE500..EE5FF */
+  FriBidiPropsBlockLevel1_0800,  /* EE600..EE6FF */
+  FriBidiPropsBlockLevel1_0800,  /* EE700..EE7FF */
+  FriBidiPropsBlockLevel1_0800,  /* EE800..EE8FF */
+  FriBidiPropsBlockLevel1_0800,  /* EE900..EE9FF */
+  FriBidiPropsBlockLevel1_0800,  /* EEA00..EEAFF */
+  FriBidiPropsBlockLevel1_0800,  /* EEB00..EEBFF */
+  FriBidiPropsBlockLevel1_0800,  /* EEC00..EECFF */
+  FriBidiPropsBlockLevel1_0800,  /* EED00..EEDFF */
+  FriBidiPropsBlockLevel1_0800,  /* EEE00..EEEFF */
+  FriBidiPropsBlockLevel1_0800,  /* EEF00..EEFFF */
+  FriBidiPropsBlockLevel1_0800,  /* EF000..EF0FF */
+  FriBidiPropsBlockLevel1_0800,  /* EF100..EF1FF */
+  FriBidiPropsBlockLevel1_0800,  /* EF200..EF2FF */
+  FriBidiPropsBlockLevel1_0800,  /* EF300..EF3FF */
+  FriBidiPropsBlockLevel1_0800,  /* EF400..EF4FF */
+  FriBidiPropsBlockLevel1_0800,  /* EF500..EF5FF */
+  FriBidiPropsBlockLevel1_0800,  /* EF600..EF6FF */
+  FriBidiPropsBlockLevel1_0800,  /* EF700..EF7FF */
+  FriBidiPropsBlockLevel1_0800,  /* EF800..EF8FF */
+  FriBidiPropsBlockLevel1_0800,  /* EF900..EF9FF */
+  FriBidiPropsBlockLevel1_0800,  /* EFA00..EFAFF */
+  FriBidiPropsBlockLevel1_0800,  /* EFB00..EFBFF */
+  FriBidiPropsBlockLevel1_0800,  /* EFC00..EFCFF */
+  FriBidiPropsBlockLevel1_0800,  /* EFD00..EFDFF */
+  FriBidiPropsBlockLevel1_0800,  /* EFE00..EFEFF */
+  FriBidiPropsBlockLevel1_0800,  /* EFF00..EFFFF */
+  FriBidiPropsBlockLevel1_0800,  /* F0000..F00FF */
+  FriBidiPropsBlockLevel1_0800,  /* F0100..F01FF */
+  FriBidiPropsBlockLevel1_0800,  /* F0200..F02FF */
+  FriBidiPropsBlockLevel1_0800,  /* F0300..F03FF */
+  FriBidiPropsBlockLevel1_0800,  /* F0400..F04FF */
+  FriBidiPropsBlockLevel1_0800,  /* F0500..F05FF */
+  FriBidiPropsBlockLevel1_0800,  /* F0600..F06FF */
+  FriBidiPropsBlockLevel1_0800,  /* F0700..F07FF */
+  FriBidiPropsBlockLevel1_0800,  /* F0800..F08FF */
+  FriBidiPropsBlockLevel1_0800,  /* F0900..F09FF */
+  FriBidiPropsBlockLevel1_0800,  /* F0A00..F0AFF */
+  FriBidiPropsBlockLevel1_0800,  /* F0B00..F0BFF */
+  FriBidiPropsBlockLevel1_0800,  /* F0C00..F0CFF */
+  FriBidiPropsBlockLevel1_0800,  /* F0D00..F0DFF */
+  FriBidiPropsBlockLevel1_0800,  /* F0E00..F0EFF */
+  FriBidiPropsBlockLevel1_0800,  /* F0F00..F0FFF */
+  FriBidiPropsBlockLevel1_0800,  /* F1000..F10FF */
+  FriBidiPropsBlockLevel1_0800,  /* F1100..F11FF */
+  FriBidiPropsBlockLevel1_0800,  /* F1200..F12FF */
+  FriBidiPropsBlockLevel1_0800,  /* F1300..F13FF */
+  FriBidiPropsBlockLevel1_0800,  /* F1400..F14FF */
+  FriBidiPropsBlockLevel1_0800,  /* F1500..F15FF */
+  FriBidiPropsBlockLevel1_0800,  /* F1600..F16FF */
+  FriBidiPropsBlockLevel1_0800,  /* F1700..F17FF */
+  FriBidiPropsBlockLevel1_0800,  /* F1800..F18FF */
+  FriBidiPropsBlockLevel1_0800,  /* F1900..F19FF */
+  FriBidiPropsBlockLevel1_0800,  /* F1A00..F1AFF */
+  FriBidiPropsBlockLevel1_0800,  /* F1B00..F1BFF */
+  FriBidiPropsBlockLevel1_0800,  /* F1C00..F1CFF */
+  FriBidiPropsBlockLevel1_0800,  /* F1D00..F1DFF */
+  FriBidiPropsBlockLevel1_0800,  /* F1E00..F1EFF */
+  FriBidiPropsBlockLevel1_0800,  /* F1F00..F1FFF */
+  FriBidiPropsBlockLevel1_0800,  /* F2000..F20FF */
+  FriBidiPropsBlockLevel1_0800,  /* F2100..F21FF */
+  FriBidiPropsBlockLevel1_0800,  /* F2200..F22FF */
+  FriBidiPropsBlockLevel1_0800,  /* F2300..F23FF */
+  FriBidiPropsBlockLevel1_0800,  /* F2400..F24FF */
+  FriBidiPropsBlockLevel1_0800,  /* F2500..F25FF */
+  FriBidiPropsBlockLevel1_0800,  /* F2600..F26FF */
+  FriBidiPropsBlockLevel1_0800,  /* F2700..F27FF */
+  FriBidiPropsBlockLevel1_0800,  /* F2800..F28FF */
+  FriBidiPropsBlockLevel1_0800,  /* F2900..F29FF */
+  FriBidiPropsBlockLevel1_0800,  /* F2A00..F2AFF */
+  FriBidiPropsBlockLevel1_0800,  /* F2B00..F2BFF */
+  FriBidiPropsBlockLevel1_0800,  /* F2C00..F2CFF */
+  FriBidiPropsBlockLevel1_0800,  /* F2D00..F2DFF */
+  FriBidiPropsBlockLevel1_0800,  /* F2E00..F2EFF */
+  FriBidiPropsBlockLevel1_0800,  /* F2F00..F2FFF */
+  FriBidiPropsBlockLevel1_0800,  /* F3000..F30FF */
+  FriBidiPropsBlockLevel1_0800,  /* F3100..F31FF */
+  FriBidiPropsBlockLevel1_0800,  /* F3200..F32FF */
+  FriBidiPropsBlockLevel1_0800,  /* F3300..F33FF */
+  FriBidiPropsBlockLevel1_0800,  /* F3400..F34FF */
+  FriBidiPropsBlockLevel1_0800,  /* F3500..F35FF */
+  FriBidiPropsBlockLevel1_0800,  /* F3600..F36FF */
+  FriBidiPropsBlockLevel1_0800,  /* F3700..F37FF */
+  FriBidiPropsBlockLevel1_0800,  /* F3800..F38FF */
+  FriBidiPropsBlockLevel1_0800,  /* F3900..F39FF */
+  FriBidiPropsBlockLevel1_0800,  /* F3A00..F3AFF */
+  FriBidiPropsBlockLevel1_0800,  /* F3B00..F3BFF */
+  FriBidiPropsBlockLevel1_0800,  /* F3C00..F3CFF */
+  FriBidiPropsBlockLevel1_0800,  /* F3D00..F3DFF */
+  FriBidiPropsBlockLevel1_0800,  /* F3E00..F3EFF */
+  FriBidiPropsBlockLevel1_0800,  /* F3F00..F3FFF */
+  FriBidiPropsBlockLevel1_0800,  /* F4000..F40FF */
+  FriBidiPropsBlockLevel1_0800,  /* F4100..F41FF */
+  FriBidiPropsBlockLevel1_0800,  /* F4200..F42FF */
+  FriBidiPropsBlockLevel1_0800,  /* F4300..F43FF */
+  FriBidiPropsBlockLevel1_0800,  /* F4400..F44FF */
+  FriBidiPropsBlockLevel1_0800,  /* F4500..F45FF */
+  FriBidiPropsBlockLevel1_0800,  /* F4600..F46FF */
+  FriBidiPropsBlockLevel1_0800,  /* F4700..F47FF */
+  FriBidiPropsBlockLevel1_0800,  /* F4800..F48FF */
+  FriBidiPropsBlockLevel1_0800,  /* F4900..F49FF */
+  FriBidiPropsBlockLevel1_0800,  /* F4A00..F4AFF */
+  FriBidiPropsBlockLevel1_0800,  /* F4B00..F4BFF */
+  FriBidiPropsBlockLevel1_0800,  /* F4C00..F4CFF */
+  FriBidiPropsBlockLevel1_0800,  /* F4D00..F4DFF */
+  FriBidiPropsBlockLevel1_0800,  /* F4E00..F4EFF */
+  FriBidiPropsBlockLevel1_0800,  /* F4F00..F4FFF */
+  FriBidiPropsBlockLevel1_0800,  /* F5000..F50FF */
+  FriBidiPropsBlockLevel1_0800,  /* F5100..F51FF */
+  FriBidiPropsBlockLevel1_0800,  /* F5200..F52FF */
+  FriBidiPropsBlockLevel1_0800,  /* F5300..F53FF */
+  FriBidiPropsBlockLevel1_0800,  /* F5400..F54FF */
+  FriBidiPropsBlockLevel1_0800,  /* F5500..F55FF */
+  FriBidiPropsBlockLevel1_0800,  /* F5600..F56FF */
+  FriBidiPropsBlockLevel1_0800,  /* F5700..F57FF */
+  FriBidiPropsBlockLevel1_0800,  /* F5800..F58FF */
+  FriBidiPropsBlockLevel1_0800,  /* F5900..F59FF */
+  FriBidiPropsBlockLevel1_0800,  /* F5A00..F5AFF */
+  FriBidiPropsBlockLevel1_0800,  /* F5B00..F5BFF */
+  FriBidiPropsBlockLevel1_0800,  /* F5C00..F5CFF */
+  FriBidiPropsBlockLevel1_0800,  /* F5D00..F5DFF */
+  FriBidiPropsBlockLevel1_0800,  /* F5E00..F5EFF */
+  FriBidiPropsBlockLevel1_0800,  /* F5F00..F5FFF */
+  FriBidiPropsBlockLevel1_0800,  /* F6000..F60FF */
+  FriBidiPropsBlockLevel1_0800,  /* F6100..F61FF */
+  FriBidiPropsBlockLevel1_0800,  /* F6200..F62FF */
+  FriBidiPropsBlockLevel1_0800,  /* F6300..F63FF */
+  FriBidiPropsBlockLevel1_0800,  /* F6400..F64FF */
+  FriBidiPropsBlockLevel1_0800,  /* F6500..F65FF */
+  FriBidiPropsBlockLevel1_0800,  /* F6600..F66FF */
+  FriBidiPropsBlockLevel1_0800,  /* F6700..F67FF */
+  FriBidiPropsBlockLevel1_0800,  /* F6800..F68FF */
+  FriBidiPropsBlockLevel1_0800,  /* F6900..F69FF */
+  FriBidiPropsBlockLevel1_0800,  /* F6A00..F6AFF */
+  FriBidiPropsBlockLevel1_0800,  /* F6B00..F6BFF */
+  FriBidiPropsBlockLevel1_0800,  /* F6C00..F6CFF */
+  FriBidiPropsBlockLevel1_0800,  /* F6D00..F6DFF */
+  FriBidiPropsBlockLevel1_0800,  /* F6E00..F6EFF */
+  FriBidiPropsBlockLevel1_0800,  /* F6F00..F6FFF */
+  FriBidiPropsBlockLevel1_0800,  /* F7000..F70FF */
+  FriBidiPropsBlockLevel1_0800,  /* F7100..F71FF */
+  FriBidiPropsBlockLevel1_0800,  /* F7200..F72FF */
+  FriBidiPropsBlockLevel1_0800,  /* F7300..F73FF */
+  FriBidiPropsBlockLevel1_0800,  /* F7400..F74FF */
+  FriBidiPropsBlockLevel1_0800,  /* F7500..F75FF */
+  FriBidiPropsBlockLevel1_0800,  /* F7600..F76FF */
+  FriBidiPropsBlockLevel1_0800,  /* F7700..F77FF */
+  FriBidiPropsBlockLevel1_0800,  /* F7800..F78FF */
+  FriBidiPropsBlockLevel1_0800,  /* F7900..F79FF */
+  FriBidiPropsBlockLevel1_0800,  /* F7A00..F7AFF */
+  FriBidiPropsBlockLevel1_0800,  /* F7B00..F7BFF */
+  FriBidiPropsBlockLevel1_0800,  /* F7C00..F7CFF */
+  FriBidiPropsBlockLevel1_0800,  /* F7D00..F7DFF */
+  FriBidiPropsBlockLevel1_0800,  /* F7E00..F7EFF */
+  FriBidiPropsBlockLevel1_0800,  /* F7F00..F7FFF */
+  FriBidiPropsBlockLevel1_0800,  /* F8000..F80FF */
+  FriBidiPropsBlockLevel1_0800,  /* F8100..F81FF */
+  FriBidiPropsBlockLevel1_0800,  /* F8200..F82FF */
+  FriBidiPropsBlockLevel1_0800,  /* F8300..F83FF */
+  FriBidiPropsBlockLevel1_0800,  /* F8400..F84FF */
+  FriBidiPropsBlockLevel1_0800,  /* F8500..F85FF */
+  FriBidiPropsBlockLevel1_0800,  /* F8600..F86FF */
+  FriBidiPropsBlockLevel1_0800,  /* F8700..F87FF */
+  FriBidiPropsBlockLevel1_0800,  /* F8800..F88FF */
+  FriBidiPropsBlockLevel1_0800,  /* F8900..F89FF */
+  FriBidiPropsBlockLevel1_0800,  /* F8A00..F8AFF */
+  FriBidiPropsBlockLevel1_0800,  /* F8B00..F8BFF */
+  FriBidiPropsBlockLevel1_0800,  /* F8C00..F8CFF */
+  FriBidiPropsBlockLevel1_0800,  /* F8D00..F8DFF */
+  FriBidiPropsBlockLevel1_0800,  /* F8E00..F8EFF */
+  FriBidiPropsBlockLevel1_0800,  /* F8F00..F8FFF */
+  FriBidiPropsBlockLevel1_0800,  /* F9000..F90FF */
+  FriBidiPropsBlockLevel1_0800,  /* F9100..F91FF */
+  FriBidiPropsBlockLevel1_0800,  /* F9200..F92FF */
+  FriBidiPropsBlockLevel1_0800,  /* F9300..F93FF */
+  FriBidiPropsBlockLevel1_0800,  /* F9400..F94FF */
+  FriBidiPropsBlockLevel1_0800,  /* F9500..F95FF */
+  FriBidiPropsBlockLevel1_0800,  /* F9600..F96FF */
+  FriBidiPropsBlockLevel1_0800,  /* F9700..F97FF */
+  FriBidiPropsBlockLevel1_0800,  /* F9800..F98FF */
+  FriBidiPropsBlockLevel1_0800,  /* F9900..F99FF */
+  FriBidiPropsBlockLevel1_0800,  /* F9A00..F9AFF */
+  FriBidiPropsBlockLevel1_0800,  /* F9B00..F9BFF */
+  FriBidiPropsBlockLevel1_0800,  /* F9C00..F9CFF */
+  FriBidiPropsBlockLevel1_0800,  /* F9D00..F9DFF */
+  FriBidiPropsBlockLevel1_0800,  /* F9E00..F9EFF */
+  FriBidiPropsBlockLevel1_0800,  /* F9F00..F9FFF */
+  FriBidiPropsBlockLevel1_0800,  /* FA000..FA0FF */
+  FriBidiPropsBlockLevel1_0800,  /* FA100..FA1FF */
+  FriBidiPropsBlockLevel1_0800,  /* FA200..FA2FF */
+  FriBidiPropsBlockLevel1_0800,  /* FA300..FA3FF */
+  FriBidiPropsBlockLevel1_0800,  /* FA400..FA4FF */
+  FriBidiPropsBlockLevel1_0800,  /* FA500..FA5FF */
+  FriBidiPropsBlockLevel1_0800,  /* FA600..FA6FF */
+  FriBidiPropsBlockLevel1_0800,  /* FA700..FA7FF */
+  FriBidiPropsBlockLevel1_0800,  /* FA800..FA8FF */
+  FriBidiPropsBlockLevel1_0800,  /* FA900..FA9FF */
+  FriBidiPropsBlockLevel1_0800,  /* FAA00..FAAFF */
+  FriBidiPropsBlockLevel1_0800,  /* FAB00..FABFF */
+  FriBidiPropsBlockLevel1_0800,  /* FAC00..FACFF */
+  FriBidiPropsBlockLevel1_0800,  /* FAD00..FADFF */
+  FriBidiPropsBlockLevel1_0800,  /* FAE00..FAEFF */
+  FriBidiPropsBlockLevel1_0800,  /* FAF00..FAFFF */
+  FriBidiPropsBlockLevel1_0800,  /* FB000..FB0FF */
+  FriBidiPropsBlockLevel1_0800,  /* FB100..FB1FF */
+  FriBidiPropsBlockLevel1_0800,  /* FB200..FB2FF */
+  FriBidiPropsBlockLevel1_0800,  /* FB300..FB3FF */
+  FriBidiPropsBlockLevel1_0800,  /* FB400..FB4FF */
+  FriBidiPropsBlockLevel1_0800,  /* FB500..FB5FF */
+  FriBidiPropsBlockLevel1_0800,  /* FB600..FB6FF */
+  FriBidiPropsBlockLevel1_0800,  /* FB700..FB7FF */
+  FriBidiPropsBlockLevel1_0800,  /* FB800..FB8FF */
+  FriBidiPropsBlockLevel1_0800,  /* FB900..FB9FF */
+  FriBidiPropsBlockLevel1_0800,  /* FBA00..FBAFF */
+  FriBidiPropsBlockLevel1_0800,  /* FBB00..FBBFF */
+  FriBidiPropsBlockLevel1_0800,  /* FBC00..FBCFF */
+  FriBidiPropsBlockLevel1_0800,  /* FBD00..FBDFF */
+  FriBidiPropsBlockLevel1_0800,  /* FBE00..FBEFF */
+  FriBidiPropsBlockLevel1_0800,  /* FBF00..FBFFF */
+  FriBidiPropsBlockLevel1_0800,  /* FC000..FC0FF */
+  FriBidiPropsBlockLevel1_0800,  /* FC100..FC1FF */
+  FriBidiPropsBlockLevel1_0800,  /* FC200..FC2FF */
+  FriBidiPropsBlockLevel1_0800,  /* FC300..FC3FF */
+  FriBidiPropsBlockLevel1_0800,  /* FC400..FC4FF */
+  FriBidiPropsBlockLevel1_0800,  /* FC500..FC5FF */
+  FriBidiPropsBlockLevel1_0800,  /* FC600..FC6FF */
+  FriBidiPropsBlockLevel1_0800,  /* FC700..FC7FF */
+  FriBidiPropsBlockLevel1_0800,  /* FC800..FC8FF */
+  FriBidiPropsBlockLevel1_0800,  /* FC900..FC9FF */
+  FriBidiPropsBlockLevel1_0800,  /* FCA00..FCAFF */
+  FriBidiPropsBlockLevel1_0800,  /* FCB00..FCBFF */
+  FriBidiPropsBlockLevel1_0800,  /* FCC00..FCCFF */
+  FriBidiPropsBlockLevel1_0800,  /* FCD00..FCDFF */
+  FriBidiPropsBlockLevel1_0800,  /* FCE00..FCEFF */
+  FriBidiPropsBlockLevel1_0800,  /* FCF00..FCFFF */
+  FriBidiPropsBlockLevel1_0800,  /* FD000..FD0FF */
+  FriBidiPropsBlockLevel1_0800,  /* FD100..FD1FF */
+  FriBidiPropsBlockLevel1_0800,  /* FD200..FD2FF */
+  FriBidiPropsBlockLevel1_0800,  /* FD300..FD3FF */
+  FriBidiPropsBlockLevel1_0800,  /* FD400..FD4FF */
+  FriBidiPropsBlockLevel1_0800,  /* FD500..FD5FF */
+  FriBidiPropsBlockLevel1_0800,  /* FD600..FD6FF */
+  FriBidiPropsBlockLevel1_0800,  /* FD700..FD7FF */
+  FriBidiPropsBlockLevel1_0800,  /* FD800..FD8FF */
+  FriBidiPropsBlockLevel1_0800,  /* FD900..FD9FF */
+  FriBidiPropsBlockLevel1_0800,  /* FDA00..FDAFF */
+  FriBidiPropsBlockLevel1_0800,  /* FDB00..FDBFF */
+  FriBidiPropsBlockLevel1_0800,  /* FDC00..FDCFF */
+  FriBidiPropsBlockLevel1_0800,  /* FDD00..FDDFF */
+  FriBidiPropsBlockLevel1_0800,  /* FDE00..FDEFF */
+  FriBidiPropsBlockLevel1_0800,  /* FDF00..FDFFF */
+  FriBidiPropsBlockLevel1_0800,  /* FE000..FE0FF */
+  FriBidiPropsBlockLevel1_0800,  /* FE100..FE1FF */
+  FriBidiPropsBlockLevel1_0800,  /* FE200..FE2FF */
+  FriBidiPropsBlockLevel1_0800,  /* FE300..FE3FF */
+  FriBidiPropsBlockLevel1_0800,  /* FE400..FE4FF */
+  FriBidiPropsBlockLevel1_0800,  /* FE500..FE5FF */
+  FriBidiPropsBlockLevel1_0800,  /* FE600..FE6FF */
+  FriBidiPropsBlockLevel1_0800,  /* FE700..FE7FF */
+  FriBidiPropsBlockLevel1_0800,  /* FE800..FE8FF */
+  FriBidiPropsBlockLevel1_0800,  /* FE900..FE9FF */
+  FriBidiPropsBlockLevel1_0800,  /* FEA00..FEAFF */
+  FriBidiPropsBlockLevel1_0800,  /* FEB00..FEBFF */
+  FriBidiPropsBlockLevel1_0800,  /* FEC00..FECFF */
+  FriBidiPropsBlockLevel1_0800,  /* FED00..FEDFF */
+  FriBidiPropsBlockLevel1_0800,  /* FEE00..FEEFF */
+  FriBidiPropsBlockLevel1_0800,  /* FEF00..FEFFF */
+  FriBidiPropsBlockLevel1_0800,  /* FF000..FF0FF */
+  FriBidiPropsBlockLevel1_0800,  /* FF100..FF1FF */
+  FriBidiPropsBlockLevel1_0800,  /* FF200..FF2FF */
+  FriBidiPropsBlockLevel1_0800,  /* FF300..FF3FF */
+  FriBidiPropsBlockLevel1_0800,  /* FF400..FF4FF */
+  FriBidiPropsBlockLevel1_0800,  /* FF500..FF5FF */
+  FriBidiPropsBlockLevel1_0800,  /* FF600..FF6FF */
+  FriBidiPropsBlockLevel1_0800,  /* FF700..FF7FF */
+  FriBidiPropsBlockLevel1_0800,  /* FF800..FF8FF */
+  FriBidiPropsBlockLevel1_0800,  /* FF900..FF9FF */
+  FriBidiPropsBlockLevel1_0800,  /* FFA00..FFAFF */
+  FriBidiPropsBlockLevel1_0800,  /* FFB00..FFBFF */
+  FriBidiPropsBlockLevel1_0800,  /* FFC00..FFCFF */
+  FriBidiPropsBlockLevel1_0800,  /* FFD00..FFDFF */
+  FriBidiPropsBlockLevel1_0800,  /* FFE00..FFEFF */
+  FriBidiPropsBlockLevel1_0800,  /* FFF00..FFFFF */
+  FriBidiPropsBlockLevel1_0800,  /* 100000..1000FF */
+  FriBidiPropsBlockLevel1_0800,  /* 100100..1001FF */
+  FriBidiPropsBlockLevel1_0800,  /* 100200..1002FF */
+  FriBidiPropsBlockLevel1_0800,  /* 100300..1003FF */
+  FriBidiPropsBlockLevel1_0800,  /* 100400..1004FF */
+  FriBidiPropsBlockLevel1_0800,  /* 100500..1005FF */
+  FriBidiPropsBlockLevel1_0800,  /* 100600..1006FF */
+  FriBidiPropsBlockLevel1_0800,  /* 100700..1007FF */
+  FriBidiPropsBlockLevel1_0800,  /* 100800..1008FF */
+  FriBidiPropsBlockLevel1_0800,  /* 100900..1009FF */
+  FriBidiPropsBlockLevel1_0800,  /* 100A00..100AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 100B00..100BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 100C00..100CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 100D00..100DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 100E00..100EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 100F00..100FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 101000..1010FF */
+  FriBidiPropsBlockLevel1_0800,  /* 101100..1011FF */
+  FriBidiPropsBlockLevel1_0800,  /* 101200..1012FF */
+  FriBidiPropsBlockLevel1_0800,  /* 101300..1013FF */
+  FriBidiPropsBlockLevel1_0800,  /* 101400..1014FF */
+  FriBidiPropsBlockLevel1_0800,  /* 101500..1015FF */
+  FriBidiPropsBlockLevel1_0800,  /* 101600..1016FF */
+  FriBidiPropsBlockLevel1_0800,  /* 101700..1017FF */
+  FriBidiPropsBlockLevel1_0800,  /* 101800..1018FF */
+  FriBidiPropsBlockLevel1_0800,  /* 101900..1019FF */
+  FriBidiPropsBlockLevel1_0800,  /* 101A00..101AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 101B00..101BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 101C00..101CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 101D00..101DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 101E00..101EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 101F00..101FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 102000..1020FF */
+  FriBidiPropsBlockLevel1_0800,  /* 102100..1021FF */
+  FriBidiPropsBlockLevel1_0800,  /* 102200..1022FF */
+  FriBidiPropsBlockLevel1_0800,  /* 102300..1023FF */
+  FriBidiPropsBlockLevel1_0800,  /* 102400..1024FF */
+  FriBidiPropsBlockLevel1_0800,  /* 102500..1025FF */
+  FriBidiPropsBlockLevel1_0800,  /* 102600..1026FF */
+  FriBidiPropsBlockLevel1_0800,  /* 102700..1027FF */
+  FriBidiPropsBlockLevel1_0800,  /* 102800..1028FF */
+  FriBidiPropsBlockLevel1_0800,  /* 102900..1029FF */
+  FriBidiPropsBlockLevel1_0800,  /* 102A00..102AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 102B00..102BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 102C00..102CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 102D00..102DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 102E00..102EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 102F00..102FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 103000..1030FF */
+  FriBidiPropsBlockLevel1_0800,  /* 103100..1031FF */
+  FriBidiPropsBlockLevel1_0800,  /* 103200..1032FF */
+  FriBidiPropsBlockLevel1_0800,  /* 103300..1033FF */
+  FriBidiPropsBlockLevel1_0800,  /* 103400..1034FF */
+  FriBidiPropsBlockLevel1_0800,  /* 103500..1035FF */
+  FriBidiPropsBlockLevel1_0800,  /* 103600..1036FF */
+  FriBidiPropsBlockLevel1_0800,  /* 103700..1037FF */
+  FriBidiPropsBlockLevel1_0800,  /* 103800..1038FF */
+  FriBidiPropsBlockLevel1_0800,  /* 103900..1039FF */
+  FriBidiPropsBlockLevel1_0800,  /* 103A00..103AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 103B00..103BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 103C00..103CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 103D00..103DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 103E00..103EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 103F00..103FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 104000..1040FF */
+  FriBidiPropsBlockLevel1_0800,  /* 104100..1041FF */
+  FriBidiPropsBlockLevel1_0800,  /* 104200..1042FF */
+  FriBidiPropsBlockLevel1_0800,  /* 104300..1043FF */
+  FriBidiPropsBlockLevel1_0800,  /* 104400..1044FF */
+  FriBidiPropsBlockLevel1_0800,  /* 104500..1045FF */
+  FriBidiPropsBlockLevel1_0800,  /* 104600..1046FF */
+  FriBidiPropsBlockLevel1_0800,  /* 104700..1047FF */
+  FriBidiPropsBlockLevel1_0800,  /* 104800..1048FF */
+  FriBidiPropsBlockLevel1_0800,  /* 104900..1049FF */
+  FriBidiPropsBlockLevel1_0800,  /* 104A00..104AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 104B00..104BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 104C00..104CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 104D00..104DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 104E00..104EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 104F00..104FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 105000..1050FF */
+  FriBidiPropsBlockLevel1_0800,  /* 105100..1051FF */
+  FriBidiPropsBlockLevel1_0800,  /* 105200..1052FF */
+  FriBidiPropsBlockLevel1_0800,  /* 105300..1053FF */
+  FriBidiPropsBlockLevel1_0800,  /* 105400..1054FF */
+  FriBidiPropsBlockLevel1_0800,  /* 105500..1055FF */
+  FriBidiPropsBlockLevel1_0800,  /* 105600..1056FF */
+  FriBidiPropsBlockLevel1_0800,  /* 105700..1057FF */
+  FriBidiPropsBlockLevel1_0800,  /* 105800..1058FF */
+  FriBidiPropsBlockLevel1_0800,  /* 105900..1059FF */
+  FriBidiPropsBlockLevel1_0800,  /* 105A00..105AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 105B00..105BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 105C00..105CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 105D00..105DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 105E00..105EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 105F00..105FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 106000..1060FF */
+  FriBidiPropsBlockLevel1_0800,  /* 106100..1061FF */
+  FriBidiPropsBlockLevel1_0800,  /* 106200..1062FF */
+  FriBidiPropsBlockLevel1_0800,  /* 106300..1063FF */
+  FriBidiPropsBlockLevel1_0800,  /* 106400..1064FF */
+  FriBidiPropsBlockLevel1_0800,  /* 106500..1065FF */
+  FriBidiPropsBlockLevel1_0800,  /* 106600..1066FF */
+  FriBidiPropsBlockLevel1_0800,  /* 106700..1067FF */
+  FriBidiPropsBlockLevel1_0800,  /* 106800..1068FF */
+  FriBidiPropsBlockLevel1_0800,  /* 106900..1069FF */
+  FriBidiPropsBlockLevel1_0800,  /* 106A00..106AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 106B00..106BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 106C00..106CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 106D00..106DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 106E00..106EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 106F00..106FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 107000..1070FF */
+  FriBidiPropsBlockLevel1_0800,  /* 107100..1071FF */
+  FriBidiPropsBlockLevel1_0800,  /* 107200..1072FF */
+  FriBidiPropsBlockLevel1_0800,  /* 107300..1073FF */
+  FriBidiPropsBlockLevel1_0800,  /* 107400..1074FF */
+  FriBidiPropsBlockLevel1_0800,  /* 107500..1075FF */
+  FriBidiPropsBlockLevel1_0800,  /* 107600..1076FF */
+  FriBidiPropsBlockLevel1_0800,  /* 107700..1077FF */
+  FriBidiPropsBlockLevel1_0800,  /* 107800..1078FF */
+  FriBidiPropsBlockLevel1_0800,  /* 107900..1079FF */
+  FriBidiPropsBlockLevel1_0800,  /* 107A00..107AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 107B00..107BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 107C00..107CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 107D00..107DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 107E00..107EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 107F00..107FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 108000..1080FF */
+  FriBidiPropsBlockLevel1_0800,  /* 108100..1081FF */
+  FriBidiPropsBlockLevel1_0800,  /* 108200..1082FF */
+  FriBidiPropsBlockLevel1_0800,  /* 108300..1083FF */
+  FriBidiPropsBlockLevel1_0800,  /* 108400..1084FF */
+  FriBidiPropsBlockLevel1_0800,  /* 108500..1085FF */
+  FriBidiPropsBlockLevel1_0800,  /* 108600..1086FF */
+  FriBidiPropsBlockLevel1_0800,  /* 108700..1087FF */
+  FriBidiPropsBlockLevel1_0800,  /* 108800..1088FF */
+  FriBidiPropsBlockLevel1_0800,  /* 108900..1089FF */
+  FriBidiPropsBlockLevel1_0800,  /* 108A00..108AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 108B00..108BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 108C00..108CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 108D00..108DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 108E00..108EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 108F00..108FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 109000..1090FF */
+  FriBidiPropsBlockLevel1_0800,  /* 109100..1091FF */
+  FriBidiPropsBlockLevel1_0800,  /* 109200..1092FF */
+  FriBidiPropsBlockLevel1_0800,  /* 109300..1093FF */
+  FriBidiPropsBlockLevel1_0800,  /* 109400..1094FF */
+  FriBidiPropsBlockLevel1_0800,  /* 109500..1095FF */
+  FriBidiPropsBlockLevel1_0800,  /* 109600..1096FF */
+  FriBidiPropsBlockLevel1_0800,  /* 109700..1097FF */
+  FriBidiPropsBlockLevel1_0800,  /* 109800..1098FF */
+  FriBidiPropsBlockLevel1_0800,  /* 109900..1099FF */
+  FriBidiPropsBlockLevel1_0800,  /* 109A00..109AFF */
+  FriBidiPropsBlockLevel1_0800,  /* 109B00..109BFF */
+  FriBidiPropsBlockLevel1_0800,  /* 109C00..109CFF */
+  FriBidiPropsBlockLevel1_0800,  /* 109D00..109DFF */
+  FriBidiPropsBlockLevel1_0800,  /* 109E00..109EFF */
+  FriBidiPropsBlockLevel1_0800,  /* 109F00..109FFF */
+  FriBidiPropsBlockLevel1_0800,  /* 10A000..10A0FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10A100..10A1FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10A200..10A2FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10A300..10A3FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10A400..10A4FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10A500..10A5FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10A600..10A6FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10A700..10A7FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10A800..10A8FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10A900..10A9FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10AA00..10AAFF */
+  FriBidiPropsBlockLevel1_0800,  /* 10AB00..10ABFF */
+  FriBidiPropsBlockLevel1_0800,  /* 10AC00..10ACFF */
+  FriBidiPropsBlockLevel1_0800,  /* 10AD00..10ADFF */
+  FriBidiPropsBlockLevel1_0800,  /* 10AE00..10AEFF */
+  FriBidiPropsBlockLevel1_0800,  /* 10AF00..10AFFF */
+  FriBidiPropsBlockLevel1_0800,  /* 10B000..10B0FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10B100..10B1FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10B200..10B2FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10B300..10B3FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10B400..10B4FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10B500..10B5FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10B600..10B6FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10B700..10B7FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10B800..10B8FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10B900..10B9FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10BA00..10BAFF */
+  FriBidiPropsBlockLevel1_0800,  /* 10BB00..10BBFF */
+  FriBidiPropsBlockLevel1_0800,  /* 10BC00..10BCFF */
+  FriBidiPropsBlockLevel1_0800,  /* 10BD00..10BDFF */
+  FriBidiPropsBlockLevel1_0800,  /* 10BE00..10BEFF */
+  FriBidiPropsBlockLevel1_0800,  /* 10BF00..10BFFF */
+  FriBidiPropsBlockLevel1_0800,  /* 10C000..10C0FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10C100..10C1FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10C200..10C2FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10C300..10C3FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10C400..10C4FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10C500..10C5FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10C600..10C6FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10C700..10C7FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10C800..10C8FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10C900..10C9FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10CA00..10CAFF */
+  FriBidiPropsBlockLevel1_0800,  /* 10CB00..10CBFF */
+  FriBidiPropsBlockLevel1_0800,  /* 10CC00..10CCFF */
+  FriBidiPropsBlockLevel1_0800,  /* 10CD00..10CDFF */
+  FriBidiPropsBlockLevel1_0800,  /* 10CE00..10CEFF */
+  FriBidiPropsBlockLevel1_0800,  /* 10CF00..10CFFF */
+  FriBidiPropsBlockLevel1_0800,  /* 10D000..10D0FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10D100..10D1FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10D200..10D2FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10D300..10D3FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10D400..10D4FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10D500..10D5FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10D600..10D6FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10D700..10D7FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10D800..10D8FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10D900..10D9FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10DA00..10DAFF */
+  FriBidiPropsBlockLevel1_0800,  /* 10DB00..10DBFF */
+  FriBidiPropsBlockLevel1_0800,  /* 10DC00..10DCFF */
+  FriBidiPropsBlockLevel1_0800,  /* 10DD00..10DDFF */
+  FriBidiPropsBlockLevel1_0800,  /* 10DE00..10DEFF */
+  FriBidiPropsBlockLevel1_0800,  /* 10DF00..10DFFF */
+  FriBidiPropsBlockLevel1_0800,  /* 10E000..10E0FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10E100..10E1FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10E200..10E2FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10E300..10E3FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10E400..10E4FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10E500..10E5FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10E600..10E6FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10E700..10E7FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10E800..10E8FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10E900..10E9FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10EA00..10EAFF */
+  FriBidiPropsBlockLevel1_0800,  /* 10EB00..10EBFF */
+  FriBidiPropsBlockLevel1_0800,  /* 10EC00..10ECFF */
+  FriBidiPropsBlockLevel1_0800,  /* 10ED00..10EDFF */
+  FriBidiPropsBlockLevel1_0800,  /* 10EE00..10EEFF */
+  FriBidiPropsBlockLevel1_0800,  /* 10EF00..10EFFF */
+  FriBidiPropsBlockLevel1_0800,  /* 10F000..10F0FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10F100..10F1FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10F200..10F2FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10F300..10F3FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10F400..10F4FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10F500..10F5FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10F600..10F6FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10F700..10F7FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10F800..10F8FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10F900..10F9FF */
+  FriBidiPropsBlockLevel1_0800,  /* 10FA00..10FAFF */
+  FriBidiPropsBlockLevel1_0800,  /* 10FB00..10FBFF */
+  FriBidiPropsBlockLevel1_0800,  /* 10FC00..10FCFF */
+  FriBidiPropsBlockLevel1_0800,  /* 10FD00..10FDFF */
+  FriBidiPropsBlockLevel1_0800,  /* 10FE00..10FEFF */
+  FriBidiPropsBlockLevel1_0800,  /* 10FF00..10FFFF */
+};
+
+/* *INDENT-ON* */
+
+#define FRIBIDI_GET_PROPS(x)	\
+	FriBidiPropsBlockLevel1[(x)%256 +	\
+	FriBidiPropsBlockLevel0[(x)/256]]
+
+
+/* The bidi types of the ASCII characters, directly. */
+#define FRIBIDI_ASCII_TYPES \
+  FRIBIDI_TYPE_BN, FRIBIDI_TYPE_BN, FRIBIDI_TYPE_BN, FRIBIDI_TYPE_BN, \
+  FRIBIDI_TYPE_BN, FRIBIDI_TYPE_BN, FRIBIDI_TYPE_BN, FRIBIDI_TYPE_BN, \
+  FRIBIDI_TYPE_BN, FRIBIDI_TYPE_SS, FRIBIDI_TYPE_BS, FRIBIDI_TYPE_SS, \
+  FRIBIDI_TYPE_WS, FRIBIDI_TYPE_BS, FRIBIDI_TYPE_BN, FRIBIDI_TYPE_BN, \
+  FRIBIDI_TYPE_BN, FRIBIDI_TYPE_BN, FRIBIDI_TYPE_BN, FRIBIDI_TYPE_BN, \
+  FRIBIDI_TYPE_BN, FRIBIDI_TYPE_BN, FRIBIDI_TYPE_BN, FRIBIDI_TYPE_BN, \
+  FRIBIDI_TYPE_BN, FRIBIDI_TYPE_BN, FRIBIDI_TYPE_BN, FRIBIDI_TYPE_BN, \
+  FRIBIDI_TYPE_BS, FRIBIDI_TYPE_BS, FRIBIDI_TYPE_BS, FRIBIDI_TYPE_SS, \
+  FRIBIDI_TYPE_WS, FRIBIDI_TYPE_ON, FRIBIDI_TYPE_ON, FRIBIDI_TYPE_ET, \
+  FRIBIDI_TYPE_ET, FRIBIDI_TYPE_ET, FRIBIDI_TYPE_ON, FRIBIDI_TYPE_ON, \
+  FRIBIDI_TYPE_ON, FRIBIDI_TYPE_ON, FRIBIDI_TYPE_ON, FRIBIDI_TYPE_ET, \
+  FRIBIDI_TYPE_CS, FRIBIDI_TYPE_ET, FRIBIDI_TYPE_CS, FRIBIDI_TYPE_ES, \
+  FRIBIDI_TYPE_EN, FRIBIDI_TYPE_EN, FRIBIDI_TYPE_EN, FRIBIDI_TYPE_EN, \
+  FRIBIDI_TYPE_EN, FRIBIDI_TYPE_EN, FRIBIDI_TYPE_EN, FRIBIDI_TYPE_EN, \
+  FRIBIDI_TYPE_EN, FRIBIDI_TYPE_EN, FRIBIDI_TYPE_CS, FRIBIDI_TYPE_ON, \
+  FRIBIDI_TYPE_ON, FRIBIDI_TYPE_ON, FRIBIDI_TYPE_ON, FRIBIDI_TYPE_ON, \
+  FRIBIDI_TYPE_ON, FRIBIDI_TYPE_LTR, FRIBIDI_TYPE_LTR, FRIBIDI_TYPE_LTR, \
+  FRIBIDI_TYPE_LTR, FRIBIDI_TYPE_LTR, FRIBIDI_TYPE_LTR, FRIBIDI_TYPE_LTR, \
+  FRIBIDI_TYPE_LTR, FRIBIDI_TYPE_LTR, FRIBIDI_TYPE_LTR, FRIBIDI_TYPE_LTR, \
+  FRIBIDI_TYPE_LTR, FRIBIDI_TYPE_LTR, FRIBIDI_TYPE_LTR, FRIBIDI_TYPE_LTR, \
+  FRIBIDI_TYPE_LTR, FRIBIDI_TYPE_LTR, FRIBIDI_TYPE_LTR, FRIBIDI_TYPE_LTR, \
+  FRIBIDI_TYPE_LTR, FRIBIDI_TYPE_LTR, FRIBIDI_TYPE_LTR, FRIBIDI_TYPE_LTR, \
+  FRIBIDI_TYPE_LTR, FRIBIDI_TYPE_LTR, FRIBIDI_TYPE_LTR, FRIBIDI_TYPE_ON, \
+  FRIBIDI_TYPE_ON, FRIBIDI_TYPE_ON, FRIBIDI_TYPE_ON, FRIBIDI_TYPE_ON, \
+  FRIBIDI_TYPE_ON, FRIBIDI_TYPE_LTR, FRIBIDI_TYPE_LTR, FRIBIDI_TYPE_LTR, \
+  FRIBIDI_TYPE_LTR, FRIBIDI_TYPE_LTR, FRIBIDI_TYPE_LTR, FRIBIDI_TYPE_LTR, \
+  FRIBIDI_TYPE_LTR, FRIBIDI_TYPE_LTR, FRIBIDI_TYPE_LTR, FRIBIDI_TYPE_LTR, \
+  FRIBIDI_TYPE_LTR, FRIBIDI_TYPE_LTR, FRIBIDI_TYPE_LTR, FRIBIDI_TYPE_LTR, \
+  FRIBIDI_TYPE_LTR, FRIBIDI_TYPE_LTR, FRIBIDI_TYPE_LTR, FRIBIDI_TYPE_LTR, \
+  FRIBIDI_TYPE_LTR, FRIBIDI_TYPE_LTR, FRIBIDI_TYPE_LTR, FRIBIDI_TYPE_LTR, \
+  FRIBIDI_TYPE_LTR, FRIBIDI_TYPE_LTR, FRIBIDI_TYPE_LTR, FRIBIDI_TYPE_ON, \
+  FRIBIDI_TYPE_ON, FRIBIDI_TYPE_ON, FRIBIDI_TYPE_ON, FRIBIDI_TYPE_BN,
+
+#endif /* FRIBIDI_TAB_PROPS_I */
@@ -0,0 +1,5641 @@
+/*
+  This file was automatically created from fribidi_wcwidth.c
+  by fribidi_create_wcwidth
+*/
+
+#ifndef FRIBIDI_TAB_WCWIDTH_I
+#define FRIBIDI_TAB_WCWIDTH_I
+
+#include "fribidi.h"
+
+#define CONTROL FRIBIDI_WIDTH_CLASS_CONTROL
+#define ZERO FRIBIDI_WIDTH_CLASS_ZERO
+#define NARROW FRIBIDI_WIDTH_CLASS_NARROW
+#define WIDE FRIBIDI_WIDTH_CLASS_WIDE
+#define AMBIGUOUS FRIBIDI_WIDTH_CLASS_AMBIGUOUS
+
+#define PACKTAB_UINT8 fribidi_uint8
+#define PACKTAB_UINT16 fribidi_uint16
+#define PACKTAB_UINT32 fribidi_uint32
+/*
+  Automatically generated by packtab.c version 2
+
+  just use FRIBIDI_GET_WIDTH_CLASS(key)
+
+  assumed sizeof(fribidi_uint8) == 1
+  required memory: 17664
+  lookups: 2
+  partition shape: FriBidiWidthBlock[2176][512]
+  different table entries: 1 26
+*/
+
+/* *INDENT-OFF* */
+
+static const fribidi_uint8 FriBidiWidthBlockLevel1[512*26] = {
+
+#define FriBidiWidthBlockLevel1_0000 0x0
+
+       ZERO,  CONTROL,  CONTROL,  CONTROL,
+    CONTROL,  CONTROL,  CONTROL,  CONTROL,
+    CONTROL,  CONTROL,  CONTROL,  CONTROL,
+    CONTROL,  CONTROL,  CONTROL,  CONTROL,
+    CONTROL,  CONTROL,  CONTROL,  CONTROL,
+    CONTROL,  CONTROL,  CONTROL,  CONTROL,
+    CONTROL,  CONTROL,  CONTROL,  CONTROL,
+    CONTROL,  CONTROL,  CONTROL,  CONTROL,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,  CONTROL,
+    CONTROL,  CONTROL,  CONTROL,  CONTROL,
+    CONTROL,  CONTROL,  CONTROL,  CONTROL,
+    CONTROL,  CONTROL,  CONTROL,  CONTROL,
+    CONTROL,  CONTROL,  CONTROL,  CONTROL,
+    CONTROL,  CONTROL,  CONTROL,  CONTROL,
+    CONTROL,  CONTROL,  CONTROL,  CONTROL,
+    CONTROL,  CONTROL,  CONTROL,  CONTROL,
+    CONTROL,  CONTROL,  CONTROL,  CONTROL,
+     NARROW,AMBIGUOUS,   NARROW,   NARROW,
+  AMBIGUOUS,   NARROW,   NARROW,AMBIGUOUS,
+  AMBIGUOUS,   NARROW,AMBIGUOUS,   NARROW,
+     NARROW,AMBIGUOUS,AMBIGUOUS,   NARROW,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,   NARROW,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,   NARROW,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,AMBIGUOUS,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+  AMBIGUOUS,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,AMBIGUOUS,
+  AMBIGUOUS,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,   NARROW,   NARROW,
+     NARROW,   NARROW,AMBIGUOUS,   NARROW,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,   NARROW,
+  AMBIGUOUS,AMBIGUOUS,   NARROW,   NARROW,
+  AMBIGUOUS,   NARROW,AMBIGUOUS,AMBIGUOUS,
+     NARROW,   NARROW,   NARROW,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,   NARROW,
+  AMBIGUOUS,   NARROW,AMBIGUOUS,   NARROW,
+     NARROW,AMBIGUOUS,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,AMBIGUOUS,   NARROW,AMBIGUOUS,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,AMBIGUOUS,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,AMBIGUOUS,AMBIGUOUS,
+     NARROW,   NARROW,   NARROW,AMBIGUOUS,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+     NARROW,   NARROW,   NARROW,   NARROW,
+  AMBIGUOUS,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,   NARROW,
+  AMBIGUOUS,   NARROW,   NARROW,   NARROW,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+     NARROW,AMBIGUOUS,   NARROW,   NARROW,
+     NARROW,   NARROW,AMBIGUOUS,AMBIGUOUS,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,AMBIGUOUS,AMBIGUOUS,
+     NARROW,   NARROW,   NARROW,AMBIGUOUS,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,AMBIGUOUS,   NARROW,
+  AMBIGUOUS,   NARROW,AMBIGUOUS,   NARROW,
+  AMBIGUOUS,   NARROW,AMBIGUOUS,   NARROW,
+  AMBIGUOUS,   NARROW,AMBIGUOUS,   NARROW,
+  AMBIGUOUS,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+
+#define FriBidiWidthBlockLevel1_0200 0x200
+
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,AMBIGUOUS,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,AMBIGUOUS,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+  AMBIGUOUS,   NARROW,   NARROW,AMBIGUOUS,
+     NARROW,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+     NARROW,AMBIGUOUS,   NARROW,   NARROW,
+  AMBIGUOUS,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+     NARROW,AMBIGUOUS,   NARROW,AMBIGUOUS,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,   NARROW,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,   NARROW,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+
+#define FriBidiWidthBlockLevel1_0400 0x400
+
+     NARROW,AMBIGUOUS,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+     NARROW,AMBIGUOUS,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,     ZERO,
+       ZERO,     ZERO,     ZERO,   NARROW,
+       ZERO,     ZERO,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,   NARROW,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,   NARROW,     ZERO,
+       ZERO,     ZERO,   NARROW,     ZERO,
+     NARROW,     ZERO,     ZERO,   NARROW,
+       ZERO,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+
+#define FriBidiWidthBlockLevel1_0600 0x600
+
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+       ZERO,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,   NARROW,   NARROW,     ZERO,
+       ZERO,   NARROW,     ZERO,     ZERO,
+       ZERO,     ZERO,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,     ZERO,
+     NARROW,     ZERO,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+
+#define FriBidiWidthBlockLevel1_0800 0x800
+
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,     ZERO,     ZERO,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+       ZERO,   NARROW,   NARROW,   NARROW,
+     NARROW,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,   NARROW,   NARROW,   NARROW,
+     NARROW,     ZERO,   NARROW,   NARROW,
+     NARROW,     ZERO,     ZERO,     ZERO,
+       ZERO,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,     ZERO,     ZERO,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,     ZERO,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+       ZERO,   NARROW,   NARROW,   NARROW,
+     NARROW,     ZERO,     ZERO,     ZERO,
+       ZERO,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,     ZERO,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,     ZERO,     ZERO,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+
+#define FriBidiWidthBlockLevel1_0A00 0xA00
+
+     NARROW,   NARROW,     ZERO,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+       ZERO,   NARROW,   NARROW,   NARROW,
+     NARROW,     ZERO,     ZERO,   NARROW,
+     NARROW,   NARROW,   NARROW,     ZERO,
+       ZERO,   NARROW,   NARROW,     ZERO,
+       ZERO,     ZERO,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+       ZERO,     ZERO,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,     ZERO,     ZERO,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+       ZERO,   NARROW,   NARROW,   NARROW,
+     NARROW,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,   NARROW,     ZERO,
+       ZERO,   NARROW,   NARROW,   NARROW,
+     NARROW,     ZERO,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,     ZERO,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+       ZERO,   NARROW,   NARROW,     ZERO,
+     NARROW,     ZERO,     ZERO,     ZERO,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,     ZERO,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,     ZERO,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,     ZERO,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+       ZERO,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,     ZERO,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+
+#define FriBidiWidthBlockLevel1_0C00 0xC00
+
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,     ZERO,     ZERO,
+       ZERO,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,     ZERO,     ZERO,
+       ZERO,   NARROW,     ZERO,     ZERO,
+       ZERO,     ZERO,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,     ZERO,     ZERO,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,     ZERO,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,     ZERO,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+       ZERO,     ZERO,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,     ZERO,     ZERO,     ZERO,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,     ZERO,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,     ZERO,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,     ZERO,     ZERO,
+       ZERO,   NARROW,     ZERO,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+
+#define FriBidiWidthBlockLevel1_0E00 0xE00
+
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,     ZERO,   NARROW,   NARROW,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,     ZERO,   NARROW,   NARROW,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,   NARROW,     ZERO,
+       ZERO,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+       ZERO,     ZERO,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,     ZERO,   NARROW,     ZERO,
+     NARROW,     ZERO,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,   NARROW,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,   NARROW,     ZERO,     ZERO,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+     NARROW,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,     ZERO,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+
+#define FriBidiWidthBlockLevel1_1000 0x1000
+
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,     ZERO,     ZERO,     ZERO,
+       ZERO,   NARROW,     ZERO,   NARROW,
+     NARROW,   NARROW,     ZERO,     ZERO,
+     NARROW,     ZERO,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+       ZERO,     ZERO,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+
+#define FriBidiWidthBlockLevel1_1200 0x1200
+
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+
+#define FriBidiWidthBlockLevel1_1600 0x1400
+
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,     ZERO,     ZERO,
+       ZERO,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,     ZERO,     ZERO,
+       ZERO,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,     ZERO,     ZERO,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,     ZERO,     ZERO,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,     ZERO,   NARROW,
+     NARROW,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+
+#define FriBidiWidthBlockLevel1_1800 0x1600
+
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,     ZERO,
+       ZERO,     ZERO,     ZERO,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,     ZERO,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+
+#define FriBidiWidthBlockLevel1_2000 0x1800
+
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+  AMBIGUOUS,   NARROW,   NARROW,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,   NARROW,
+  AMBIGUOUS,AMBIGUOUS,   NARROW,   NARROW,
+  AMBIGUOUS,AMBIGUOUS,   NARROW,   NARROW,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,   NARROW,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+     NARROW,   NARROW,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,   NARROW,
+  AMBIGUOUS,   NARROW,AMBIGUOUS,AMBIGUOUS,
+     NARROW,AMBIGUOUS,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,AMBIGUOUS,
+     NARROW,   NARROW,AMBIGUOUS,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+       ZERO,     ZERO,     ZERO,     ZERO,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+     NARROW,   NARROW,   NARROW,   NARROW,
+  AMBIGUOUS,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,AMBIGUOUS,
+     NARROW,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+  AMBIGUOUS,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,AMBIGUOUS,
+     NARROW,AMBIGUOUS,   NARROW,   NARROW,
+     NARROW,AMBIGUOUS,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,AMBIGUOUS,
+     NARROW,   NARROW,AMBIGUOUS,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,AMBIGUOUS,AMBIGUOUS,   NARROW,
+     NARROW,   NARROW,AMBIGUOUS,   NARROW,
+     NARROW,   NARROW,   NARROW,AMBIGUOUS,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,AMBIGUOUS,
+  AMBIGUOUS,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,   NARROW,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+     NARROW,   NARROW,   NARROW,   NARROW,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+  AMBIGUOUS,AMBIGUOUS,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,AMBIGUOUS,   NARROW,
+  AMBIGUOUS,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,AMBIGUOUS,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+
+#define FriBidiWidthBlockLevel1_2200 0x1A00
+
+  AMBIGUOUS,   NARROW,AMBIGUOUS,AMBIGUOUS,
+     NARROW,   NARROW,   NARROW,AMBIGUOUS,
+  AMBIGUOUS,   NARROW,   NARROW,AMBIGUOUS,
+     NARROW,   NARROW,   NARROW,AMBIGUOUS,
+     NARROW,AMBIGUOUS,   NARROW,   NARROW,
+     NARROW,AMBIGUOUS,   NARROW,   NARROW,
+     NARROW,   NARROW,AMBIGUOUS,   NARROW,
+     NARROW,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,   NARROW,   NARROW,AMBIGUOUS,
+     NARROW,AMBIGUOUS,   NARROW,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,   NARROW,AMBIGUOUS,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+     NARROW,   NARROW,   NARROW,   NARROW,
+  AMBIGUOUS,AMBIGUOUS,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+  AMBIGUOUS,   NARROW,   NARROW,   NARROW,
+  AMBIGUOUS,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,AMBIGUOUS,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+  AMBIGUOUS,AMBIGUOUS,   NARROW,   NARROW,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+     NARROW,   NARROW,AMBIGUOUS,AMBIGUOUS,
+     NARROW,   NARROW,AMBIGUOUS,AMBIGUOUS,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,AMBIGUOUS,AMBIGUOUS,
+     NARROW,   NARROW,AMBIGUOUS,AMBIGUOUS,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,AMBIGUOUS,   NARROW,   NARROW,
+     NARROW,AMBIGUOUS,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,AMBIGUOUS,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,AMBIGUOUS,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,AMBIGUOUS,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,     WIDE,     WIDE,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+
+#define FriBidiWidthBlockLevel1_2400 0x1C00
+
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,   NARROW,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,   NARROW,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+     NARROW,   NARROW,   NARROW,   NARROW,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+     NARROW,   NARROW,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+  AMBIGUOUS,AMBIGUOUS,   NARROW,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,AMBIGUOUS,AMBIGUOUS,
+     NARROW,   NARROW,AMBIGUOUS,AMBIGUOUS,
+     NARROW,   NARROW,   NARROW,   NARROW,
+  AMBIGUOUS,AMBIGUOUS,   NARROW,   NARROW,
+  AMBIGUOUS,AMBIGUOUS,   NARROW,   NARROW,
+     NARROW,   NARROW,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,   NARROW,   NARROW,AMBIGUOUS,
+     NARROW,   NARROW,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,AMBIGUOUS,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+
+#define FriBidiWidthBlockLevel1_2600 0x1E00
+
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,AMBIGUOUS,AMBIGUOUS,   NARROW,
+     NARROW,AMBIGUOUS,   NARROW,   NARROW,
+     NARROW,   NARROW,AMBIGUOUS,AMBIGUOUS,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+  AMBIGUOUS,   NARROW,AMBIGUOUS,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+  AMBIGUOUS,   NARROW,AMBIGUOUS,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+  AMBIGUOUS,AMBIGUOUS,   NARROW,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,   NARROW,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,   NARROW,
+  AMBIGUOUS,AMBIGUOUS,   NARROW,AMBIGUOUS,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,AMBIGUOUS,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+  AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,AMBIGUOUS,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+
+#define FriBidiWidthBlockLevel1_2E00 0x2000
+
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+
+#define FriBidiWidthBlockLevel1_3000 0x2200
+
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,   NARROW,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     ZERO,     ZERO,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+
+#define FriBidiWidthBlockLevel1_3200 0x2400
+
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+
+#define FriBidiWidthBlockLevel1_A400 0x2600
+
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+
+#define FriBidiWidthBlockLevel1_D600 0x2800
+
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+
+#define FriBidiWidthBlockLevel1_F800 0x2A00
+
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+
+#define FriBidiWidthBlockLevel1_FA00 0x2C00
+
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,     ZERO,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+
+#define FriBidiWidthBlockLevel1_FE00 0x2E00
+
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+       ZERO,     ZERO,     ZERO,     ZERO,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,     ZERO,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+       WIDE,     WIDE,     WIDE,     WIDE,
+       WIDE,     WIDE,     WIDE,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,     ZERO,     ZERO,     ZERO,
+     NARROW,AMBIGUOUS,   NARROW,   NARROW,
+
+#define FriBidiWidthBlockLevel1_1D000 0x3000
+
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,     ZERO,
+       ZERO,     ZERO,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,   NARROW,
+     NARROW,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,     ZERO,     ZERO,
+       ZERO,     ZERO,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+
+#define FriBidiWidthBlockLevel1_E0000 0x3200
+
+     NARROW,     ZERO,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+       ZERO,     ZERO,     ZERO,     ZERO,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+     NARROW,   NARROW,   NARROW,   NARROW,
+};
+
+static const PACKTAB_UINT16 FriBidiWidthBlockLevel0[2176*1] = {
+
+#define FriBidiWidthBlockLevel0_0000 0x0
+
+  FriBidiWidthBlockLevel1_0000,  /* 0000..01FF */
+  FriBidiWidthBlockLevel1_0200,  /* 0200..03FF */
+  FriBidiWidthBlockLevel1_0400,  /* 0400..05FF */
+  FriBidiWidthBlockLevel1_0600,  /* 0600..07FF */
+  FriBidiWidthBlockLevel1_0800,  /* 0800..09FF */
+  FriBidiWidthBlockLevel1_0A00,  /* 0A00..0BFF */
+  FriBidiWidthBlockLevel1_0C00,  /* 0C00..0DFF */
+  FriBidiWidthBlockLevel1_0E00,  /* 0E00..0FFF */
+  FriBidiWidthBlockLevel1_1000,  /* 1000..11FF */
+  FriBidiWidthBlockLevel1_1200,  /* 1200..13FF */
+  FriBidiWidthBlockLevel1_1200,  /* 1400..15FF */
+  FriBidiWidthBlockLevel1_1600,  /* 1600..17FF */
+  FriBidiWidthBlockLevel1_1800,  /* 1800..19FF */
+  FriBidiWidthBlockLevel1_1200,  /* 1A00..1BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 1C00..1DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 1E00..1FFF */
+  FriBidiWidthBlockLevel1_2000,  /* 2000..21FF */
+  FriBidiWidthBlockLevel1_2200,  /* 2200..23FF */
+  FriBidiWidthBlockLevel1_2400,  /* 2400..25FF */
+  FriBidiWidthBlockLevel1_2600,  /* 2600..27FF */
+  FriBidiWidthBlockLevel1_1200,  /* 2800..29FF */
+  FriBidiWidthBlockLevel1_1200,  /* 2A00..2BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 2C00..2DFF */
+  FriBidiWidthBlockLevel1_2E00,  /* 2E00..2FFF */
+  FriBidiWidthBlockLevel1_3000,  /* 3000..31FF */
+  FriBidiWidthBlockLevel1_3200,  /* 3200..33FF */
+  FriBidiWidthBlockLevel1_3200,  /* 3400..35FF */
+  FriBidiWidthBlockLevel1_3200,  /* 3600..37FF */
+  FriBidiWidthBlockLevel1_3200,  /* 3800..39FF */
+  FriBidiWidthBlockLevel1_3200,  /* 3A00..3BFF */
+  FriBidiWidthBlockLevel1_3200,  /* 3C00..3DFF */
+  FriBidiWidthBlockLevel1_3200,  /* 3E00..3FFF */
+  FriBidiWidthBlockLevel1_3200,  /* 4000..41FF */
+  FriBidiWidthBlockLevel1_3200,  /* 4200..43FF */
+  FriBidiWidthBlockLevel1_3200,  /* 4400..45FF */
+  FriBidiWidthBlockLevel1_3200,  /* 4600..47FF */
+  FriBidiWidthBlockLevel1_3200,  /* 4800..49FF */
+  FriBidiWidthBlockLevel1_3200,  /* 4A00..4BFF */
+  FriBidiWidthBlockLevel1_3200,  /* 4C00..4DFF */
+  FriBidiWidthBlockLevel1_3200,  /* 4E00..4FFF */
+  FriBidiWidthBlockLevel1_3200,  /* 5000..51FF */
+  FriBidiWidthBlockLevel1_3200,  /* 5200..53FF */
+  FriBidiWidthBlockLevel1_3200,  /* 5400..55FF */
+  FriBidiWidthBlockLevel1_3200,  /* 5600..57FF */
+  FriBidiWidthBlockLevel1_3200,  /* 5800..59FF */
+  FriBidiWidthBlockLevel1_3200,  /* 5A00..5BFF */
+  FriBidiWidthBlockLevel1_3200,  /* 5C00..5DFF */
+  FriBidiWidthBlockLevel1_3200,  /* 5E00..5FFF */
+  FriBidiWidthBlockLevel1_3200,  /* 6000..61FF */
+  FriBidiWidthBlockLevel1_3200,  /* 6200..63FF */
+  FriBidiWidthBlockLevel1_3200,  /* 6400..65FF */
+  FriBidiWidthBlockLevel1_3200,  /* 6600..67FF */
+  FriBidiWidthBlockLevel1_3200,  /* 6800..69FF */
+  FriBidiWidthBlockLevel1_3200,  /* 6A00..6BFF */
+  FriBidiWidthBlockLevel1_3200,  /* 6C00..6DFF */
+  FriBidiWidthBlockLevel1_3200,  /* 6E00..6FFF */
+  FriBidiWidthBlockLevel1_3200,  /* 7000..71FF */
+  FriBidiWidthBlockLevel1_3200,  /* 7200..73FF */
+  FriBidiWidthBlockLevel1_3200,  /* 7400..75FF */
+  FriBidiWidthBlockLevel1_3200,  /* 7600..77FF */
+  FriBidiWidthBlockLevel1_3200,  /* 7800..79FF */
+  FriBidiWidthBlockLevel1_3200,  /* 7A00..7BFF */
+  FriBidiWidthBlockLevel1_3200,  /* 7C00..7DFF */
+  FriBidiWidthBlockLevel1_3200,  /* 7E00..7FFF */
+  FriBidiWidthBlockLevel1_3200,  /* 8000..81FF */
+  FriBidiWidthBlockLevel1_3200,  /* 8200..83FF */
+  FriBidiWidthBlockLevel1_3200,  /* 8400..85FF */
+  FriBidiWidthBlockLevel1_3200,  /* 8600..87FF */
+  FriBidiWidthBlockLevel1_3200,  /* 8800..89FF */
+  FriBidiWidthBlockLevel1_3200,  /* 8A00..8BFF */
+  FriBidiWidthBlockLevel1_3200,  /* 8C00..8DFF */
+  FriBidiWidthBlockLevel1_3200,  /* 8E00..8FFF */
+  FriBidiWidthBlockLevel1_3200,  /* 9000..91FF */
+  FriBidiWidthBlockLevel1_3200,  /* 9200..93FF */
+  FriBidiWidthBlockLevel1_3200,  /* 9400..95FF */
+  FriBidiWidthBlockLevel1_3200,  /* 9600..97FF */
+  FriBidiWidthBlockLevel1_3200,  /* 9800..99FF */
+  FriBidiWidthBlockLevel1_3200,  /* 9A00..9BFF */
+  FriBidiWidthBlockLevel1_3200,  /* 9C00..9DFF */
+  FriBidiWidthBlockLevel1_3200,  /* 9E00..9FFF */
+  FriBidiWidthBlockLevel1_3200,  /* A000..A1FF */
+  FriBidiWidthBlockLevel1_3200,  /* A200..A3FF */
+  FriBidiWidthBlockLevel1_A400,  /* A400..A5FF */
+  FriBidiWidthBlockLevel1_1200,  /* A600..A7FF */
+  FriBidiWidthBlockLevel1_1200,  /* A800..A9FF */
+  FriBidiWidthBlockLevel1_1200,  /* AA00..ABFF */
+  FriBidiWidthBlockLevel1_3200,  /* AC00..ADFF */
+  FriBidiWidthBlockLevel1_3200,  /* AE00..AFFF */
+  FriBidiWidthBlockLevel1_3200,  /* B000..B1FF */
+  FriBidiWidthBlockLevel1_3200,  /* B200..B3FF */
+  FriBidiWidthBlockLevel1_3200,  /* B400..B5FF */
+  FriBidiWidthBlockLevel1_3200,  /* B600..B7FF */
+  FriBidiWidthBlockLevel1_3200,  /* B800..B9FF */
+  FriBidiWidthBlockLevel1_3200,  /* BA00..BBFF */
+  FriBidiWidthBlockLevel1_3200,  /* BC00..BDFF */
+  FriBidiWidthBlockLevel1_3200,  /* BE00..BFFF */
+  FriBidiWidthBlockLevel1_3200,  /* C000..C1FF */
+  FriBidiWidthBlockLevel1_3200,  /* C200..C3FF */
+  FriBidiWidthBlockLevel1_3200,  /* C400..C5FF */
+  FriBidiWidthBlockLevel1_3200,  /* C600..C7FF */
+  FriBidiWidthBlockLevel1_3200,  /* C800..C9FF */
+  FriBidiWidthBlockLevel1_3200,  /* CA00..CBFF */
+  FriBidiWidthBlockLevel1_3200,  /* CC00..CDFF */
+  FriBidiWidthBlockLevel1_3200,  /* CE00..CFFF */
+  FriBidiWidthBlockLevel1_3200,  /* D000..D1FF */
+  FriBidiWidthBlockLevel1_3200,  /* D200..D3FF */
+  FriBidiWidthBlockLevel1_3200,  /* D400..D5FF */
+  FriBidiWidthBlockLevel1_D600,  /* D600..D7FF */
+  FriBidiWidthBlockLevel1_1200,  /* D800..D9FF */
+  FriBidiWidthBlockLevel1_1200,  /* DA00..DBFF */
+  FriBidiWidthBlockLevel1_1200,  /* DC00..DDFF */
+  FriBidiWidthBlockLevel1_1200,  /* DE00..DFFF */
+  FriBidiWidthBlockLevel1_1200,  /* E000..E1FF */
+  FriBidiWidthBlockLevel1_1200,  /* E200..E3FF */
+  FriBidiWidthBlockLevel1_1200,  /* E400..E5FF */
+  FriBidiWidthBlockLevel1_1200,  /* E600..E7FF */
+  FriBidiWidthBlockLevel1_1200,  /* E800..E9FF */
+  FriBidiWidthBlockLevel1_1200,  /* EA00..EBFF */
+  FriBidiWidthBlockLevel1_1200,  /* EC00..EDFF */
+  FriBidiWidthBlockLevel1_1200,  /* EE00..EFFF */
+  FriBidiWidthBlockLevel1_1200,  /* F000..F1FF */
+  FriBidiWidthBlockLevel1_1200,  /* F200..F3FF */
+  FriBidiWidthBlockLevel1_1200,  /* F400..F5FF */
+  FriBidiWidthBlockLevel1_1200,  /* F600..F7FF */
+  FriBidiWidthBlockLevel1_F800,  /* F800..F9FF */
+  FriBidiWidthBlockLevel1_FA00,  /* FA00..FBFF */
+  FriBidiWidthBlockLevel1_1200,  /* FC00..FDFF */
+  FriBidiWidthBlockLevel1_FE00,  /* FE00..FFFF */
+  FriBidiWidthBlockLevel1_1200,  /* 10000..101FF */
+  FriBidiWidthBlockLevel1_1200,  /* 10200..103FF */
+  FriBidiWidthBlockLevel1_1200,  /* 10400..105FF */
+  FriBidiWidthBlockLevel1_1200,  /* 10600..107FF */
+  FriBidiWidthBlockLevel1_1200,  /* 10800..109FF */
+  FriBidiWidthBlockLevel1_1200,  /* 10A00..10BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 10C00..10DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 10E00..10FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 11000..111FF */
+  FriBidiWidthBlockLevel1_1200,  /* 11200..113FF */
+  FriBidiWidthBlockLevel1_1200,  /* 11400..115FF */
+  FriBidiWidthBlockLevel1_1200,  /* 11600..117FF */
+  FriBidiWidthBlockLevel1_1200,  /* 11800..119FF */
+  FriBidiWidthBlockLevel1_1200,  /* 11A00..11BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 11C00..11DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 11E00..11FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 12000..121FF */
+  FriBidiWidthBlockLevel1_1200,  /* 12200..123FF */
+  FriBidiWidthBlockLevel1_1200,  /* 12400..125FF */
+  FriBidiWidthBlockLevel1_1200,  /* 12600..127FF */
+  FriBidiWidthBlockLevel1_1200,  /* 12800..129FF */
+  FriBidiWidthBlockLevel1_1200,  /* 12A00..12BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 12C00..12DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 12E00..12FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 13000..131FF */
+  FriBidiWidthBlockLevel1_1200,  /* 13200..133FF */
+  FriBidiWidthBlockLevel1_1200,  /* 13400..135FF */
+  FriBidiWidthBlockLevel1_1200,  /* 13600..137FF */
+  FriBidiWidthBlockLevel1_1200,  /* 13800..139FF */
+  FriBidiWidthBlockLevel1_1200,  /* 13A00..13BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 13C00..13DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 13E00..13FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 14000..141FF */
+  FriBidiWidthBlockLevel1_1200,  /* 14200..143FF */
+  FriBidiWidthBlockLevel1_1200,  /* 14400..145FF */
+  FriBidiWidthBlockLevel1_1200,  /* 14600..147FF */
+  FriBidiWidthBlockLevel1_1200,  /* 14800..149FF */
+  FriBidiWidthBlockLevel1_1200,  /* 14A00..14BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 14C00..14DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 14E00..14FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 15000..151FF */
+  FriBidiWidthBlockLevel1_1200,  /* 15200..153FF */
+  FriBidiWidthBlockLevel1_1200,  /* 15400..155FF */
+  FriBidiWidthBlockLevel1_1200,  /* 15600..157FF */
+  FriBidiWidthBlockLevel1_1200,  /* 15800..159FF */
+  FriBidiWidthBlockLevel1_1200,  /* 15A00..15BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 15C00..15DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 15E00..15FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 16000..161FF */
+  FriBidiWidthBlockLevel1_1200,  /* 16200..163FF */
+  FriBidiWidthBlockLevel1_1200,  /* 16400..165FF */
+  FriBidiWidthBlockLevel1_1200,  /* 16600..167FF */
+  FriBidiWidthBlockLevel1_1200,  /* 16800..169FF */
+  FriBidiWidthBlockLevel1_1200,  /* 16A00..16BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 16C00..16DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 16E00..16FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 17000..171FF */
+  FriBidiWidthBlockLevel1_1200,  /* 17200..173FF */
+  FriBidiWidthBlockLevel1_1200,  /* 17400..175FF */
+  FriBidiWidthBlockLevel1_1200,  /* 17600..177FF */
+  FriBidiWidthBlockLevel1_1200,  /* 17800..179FF */
+  FriBidiWidthBlockLevel1_1200,  /* 17A00..17BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 17C00..17DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 17E00..17FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 18000..181FF */
+  FriBidiWidthBlockLevel1_1200,  /* 18200..183FF */
+  FriBidiWidthBlockLevel1_1200,  /* 18400..185FF */
+  FriBidiWidthBlockLevel1_1200,  /* 18600..187FF */
+  FriBidiWidthBlockLevel1_1200,  /* 18800..189FF */
+  FriBidiWidthBlockLevel1_1200,  /* 18A00..18BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 18C00..18DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 18E00..18FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 19000..191FF */
+  FriBidiWidthBlockLevel1_1200,  /* 19200..193FF */
+  FriBidiWidthBlockLevel1_1200,  /* 19400..195FF */
+  FriBidiWidthBlockLevel1_1200,  /* 19600..197FF */
+  FriBidiWidthBlockLevel1_1200,  /* 19800..199FF */
+  FriBidiWidthBlockLevel1_1200,  /* 19A00..19BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 19C00..19DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 19E00..19FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 1A000..1A1FF */
+  FriBidiWidthBlockLevel1_1200,  /* 1A200..1A3FF */
+  FriBidiWidthBlockLevel1_1200,  /* 1A400..1A5FF */
+  FriBidiWidthBlockLevel1_1200,  /* 1A600..1A7FF */
+  FriBidiWidthBlockLevel1_1200,  /* 1A800..1A9FF */
+  FriBidiWidthBlockLevel1_1200,  /* 1AA00..1ABFF */
+  FriBidiWidthBlockLevel1_1200,  /* 1AC00..1ADFF */
+  FriBidiWidthBlockLevel1_1200,  /* 1AE00..1AFFF */
+  FriBidiWidthBlockLevel1_1200,  /* 1B000..1B1FF */
+  FriBidiWidthBlockLevel1_1200,  /* 1B200..1B3FF */
+  FriBidiWidthBlockLevel1_1200,  /* 1B400..1B5FF */
+  FriBidiWidthBlockLevel1_1200,  /* 1B600..1B7FF */
+  FriBidiWidthBlockLevel1_1200,  /* 1B800..1B9FF */
+  FriBidiWidthBlockLevel1_1200,  /* 1BA00..1BBFF */
+  FriBidiWidthBlockLevel1_1200,  /* 1BC00..1BDFF */
+  FriBidiWidthBlockLevel1_1200,  /* 1BE00..1BFFF */
+  FriBidiWidthBlockLevel1_1200,  /* 1C000..1C1FF */
+  FriBidiWidthBlockLevel1_1200,  /* 1C200..1C3FF */
+  FriBidiWidthBlockLevel1_1200,  /* 1C400..1C5FF */
+  FriBidiWidthBlockLevel1_1200,  /* 1C600..1C7FF */
+  FriBidiWidthBlockLevel1_1200,  /* 1C800..1C9FF */
+  FriBidiWidthBlockLevel1_1200,  /* 1CA00..1CBFF */
+  FriBidiWidthBlockLevel1_1200,  /* 1CC00..1CDFF */
+  FriBidiWidthBlockLevel1_1200,  /* 1CE00..1CFFF */
+  FriBidiWidthBlockLevel1_1D000,  /* 1D000..1D1FF */
+  FriBidiWidthBlockLevel1_1200,  /* 1D200..1D3FF */
+  FriBidiWidthBlockLevel1_1200,  /* 1D400..1D5FF */
+  FriBidiWidthBlockLevel1_1200,  /* 1D600..1D7FF */
+  FriBidiWidthBlockLevel1_1200,  /* 1D800..1D9FF */
+  FriBidiWidthBlockLevel1_1200,  /* 1DA00..1DBFF */
+  FriBidiWidthBlockLevel1_1200,  /* 1DC00..1DDFF */
+  FriBidiWidthBlockLevel1_1200,  /* 1DE00..1DFFF */
+  FriBidiWidthBlockLevel1_1200,  /* 1E000..1E1FF */
+  FriBidiWidthBlockLevel1_1200,  /* 1E200..1E3FF */
+  FriBidiWidthBlockLevel1_1200,  /* 1E400..1E5FF */
+  FriBidiWidthBlockLevel1_1200,  /* 1E600..1E7FF */
+  FriBidiWidthBlockLevel1_1200,  /* 1E800..1E9FF */
+  FriBidiWidthBlockLevel1_1200,  /* 1EA00..1EBFF */
+  FriBidiWidthBlockLevel1_1200,  /* 1EC00..1EDFF */
+  FriBidiWidthBlockLevel1_1200,  /* 1EE00..1EFFF */
+  FriBidiWidthBlockLevel1_1200,  /* 1F000..1F1FF */
+  FriBidiWidthBlockLevel1_1200,  /* 1F200..1F3FF */
+  FriBidiWidthBlockLevel1_1200,  /* 1F400..1F5FF */
+  FriBidiWidthBlockLevel1_1200,  /* 1F600..1F7FF */
+  FriBidiWidthBlockLevel1_1200,  /* 1F800..1F9FF */
+  FriBidiWidthBlockLevel1_1200,  /* 1FA00..1FBFF */
+  FriBidiWidthBlockLevel1_1200,  /* 1FC00..1FDFF */
+  FriBidiWidthBlockLevel1_1200,  /* 1FE00..1FFFF */
+  FriBidiWidthBlockLevel1_3200,  /* 20000..201FF */
+  FriBidiWidthBlockLevel1_3200,  /* 20200..203FF */
+  FriBidiWidthBlockLevel1_3200,  /* 20400..205FF */
+  FriBidiWidthBlockLevel1_3200,  /* 20600..207FF */
+  FriBidiWidthBlockLevel1_3200,  /* 20800..209FF */
+  FriBidiWidthBlockLevel1_3200,  /* 20A00..20BFF */
+  FriBidiWidthBlockLevel1_3200,  /* 20C00..20DFF */
+  FriBidiWidthBlockLevel1_3200,  /* 20E00..20FFF */
+  FriBidiWidthBlockLevel1_3200,  /* 21000..211FF */
+  FriBidiWidthBlockLevel1_3200,  /* 21200..213FF */
+  FriBidiWidthBlockLevel1_3200,  /* 21400..215FF */
+  FriBidiWidthBlockLevel1_3200,  /* 21600..217FF */
+  FriBidiWidthBlockLevel1_3200,  /* 21800..219FF */
+  FriBidiWidthBlockLevel1_3200,  /* 21A00..21BFF */
+  FriBidiWidthBlockLevel1_3200,  /* 21C00..21DFF */
+  FriBidiWidthBlockLevel1_3200,  /* 21E00..21FFF */
+  FriBidiWidthBlockLevel1_3200,  /* 22000..221FF */
+  FriBidiWidthBlockLevel1_3200,  /* 22200..223FF */
+  FriBidiWidthBlockLevel1_3200,  /* 22400..225FF */
+  FriBidiWidthBlockLevel1_3200,  /* 22600..227FF */
+  FriBidiWidthBlockLevel1_3200,  /* 22800..229FF */
+  FriBidiWidthBlockLevel1_3200,  /* 22A00..22BFF */
+  FriBidiWidthBlockLevel1_3200,  /* 22C00..22DFF */
+  FriBidiWidthBlockLevel1_3200,  /* 22E00..22FFF */
+  FriBidiWidthBlockLevel1_3200,  /* 23000..231FF */
+  FriBidiWidthBlockLevel1_3200,  /* 23200..233FF */
+  FriBidiWidthBlockLevel1_3200,  /* 23400..235FF */
+  FriBidiWidthBlockLevel1_3200,  /* 23600..237FF */
+  FriBidiWidthBlockLevel1_3200,  /* 23800..239FF */
+  FriBidiWidthBlockLevel1_3200,  /* 23A00..23BFF */
+  FriBidiWidthBlockLevel1_3200,  /* 23C00..23DFF */
+  FriBidiWidthBlockLevel1_3200,  /* 23E00..23FFF */
+  FriBidiWidthBlockLevel1_3200,  /* 24000..241FF */
+  FriBidiWidthBlockLevel1_3200,  /* 24200..243FF */
+  FriBidiWidthBlockLevel1_3200,  /* 24400..245FF */
+  FriBidiWidthBlockLevel1_3200,  /* 24600..247FF */
+  FriBidiWidthBlockLevel1_3200,  /* 24800..249FF */
+  FriBidiWidthBlockLevel1_3200,  /* 24A00..24BFF */
+  FriBidiWidthBlockLevel1_3200,  /* 24C00..24DFF */
+  FriBidiWidthBlockLevel1_3200,  /* 24E00..24FFF */
+  FriBidiWidthBlockLevel1_3200,  /* 25000..251FF */
+  FriBidiWidthBlockLevel1_3200,  /* 25200..253FF */
+  FriBidiWidthBlockLevel1_3200,  /* 25400..255FF */
+  FriBidiWidthBlockLevel1_3200,  /* 25600..257FF */
+  FriBidiWidthBlockLevel1_3200,  /* 25800..259FF */
+  FriBidiWidthBlockLevel1_3200,  /* 25A00..25BFF */
+  FriBidiWidthBlockLevel1_3200,  /* 25C00..25DFF */
+  FriBidiWidthBlockLevel1_3200,  /* 25E00..25FFF */
+  FriBidiWidthBlockLevel1_3200,  /* 26000..261FF */
+  FriBidiWidthBlockLevel1_3200,  /* 26200..263FF */
+  FriBidiWidthBlockLevel1_3200,  /* 26400..265FF */
+  FriBidiWidthBlockLevel1_3200,  /* 26600..267FF */
+  FriBidiWidthBlockLevel1_3200,  /* 26800..269FF */
+  FriBidiWidthBlockLevel1_3200,  /* 26A00..26BFF */
+  FriBidiWidthBlockLevel1_3200,  /* 26C00..26DFF */
+  FriBidiWidthBlockLevel1_3200,  /* 26E00..26FFF */
+  FriBidiWidthBlockLevel1_3200,  /* 27000..271FF */
+  FriBidiWidthBlockLevel1_3200,  /* 27200..273FF */
+  FriBidiWidthBlockLevel1_3200,  /* 27400..275FF */
+  FriBidiWidthBlockLevel1_3200,  /* 27600..277FF */
+  FriBidiWidthBlockLevel1_3200,  /* 27800..279FF */
+  FriBidiWidthBlockLevel1_3200,  /* 27A00..27BFF */
+  FriBidiWidthBlockLevel1_3200,  /* 27C00..27DFF */
+  FriBidiWidthBlockLevel1_3200,  /* 27E00..27FFF */
+  FriBidiWidthBlockLevel1_3200,  /* 28000..281FF */
+  FriBidiWidthBlockLevel1_3200,  /* 28200..283FF */
+  FriBidiWidthBlockLevel1_3200,  /* 28400..285FF */
+  FriBidiWidthBlockLevel1_3200,  /* 28600..287FF */
+  FriBidiWidthBlockLevel1_3200,  /* 28800..289FF */
+  FriBidiWidthBlockLevel1_3200,  /* 28A00..28BFF */
+  FriBidiWidthBlockLevel1_3200,  /* 28C00..28DFF */
+  FriBidiWidthBlockLevel1_3200,  /* 28E00..28FFF */
+  FriBidiWidthBlockLevel1_3200,  /* 29000..291FF */
+  FriBidiWidthBlockLevel1_3200,  /* 29200..293FF */
+  FriBidiWidthBlockLevel1_3200,  /* 29400..295FF */
+  FriBidiWidthBlockLevel1_3200,  /* 29600..297FF */
+  FriBidiWidthBlockLevel1_3200,  /* 29800..299FF */
+  FriBidiWidthBlockLevel1_3200,  /* 29A00..29BFF */
+  FriBidiWidthBlockLevel1_3200,  /* 29C00..29DFF */
+  FriBidiWidthBlockLevel1_3200,  /* 29E00..29FFF */
+  FriBidiWidthBlockLevel1_3200,  /* 2A000..2A1FF */
+  FriBidiWidthBlockLevel1_3200,  /* 2A200..2A3FF */
+  FriBidiWidthBlockLevel1_3200,  /* 2A400..2A5FF */
+  FriBidiWidthBlockLevel1_3200,  /* 2A600..2A7FF */
+  FriBidiWidthBlockLevel1_3200,  /* 2A800..2A9FF */
+  FriBidiWidthBlockLevel1_3200,  /* 2AA00..2ABFF */
+  FriBidiWidthBlockLevel1_3200,  /* 2AC00..2ADFF */
+  FriBidiWidthBlockLevel1_3200,  /* 2AE00..2AFFF */
+  FriBidiWidthBlockLevel1_3200,  /* 2B000..2B1FF */
+  FriBidiWidthBlockLevel1_3200,  /* 2B200..2B3FF */
+  FriBidiWidthBlockLevel1_3200,  /* 2B400..2B5FF */
+  FriBidiWidthBlockLevel1_3200,  /* 2B600..2B7FF */
+  FriBidiWidthBlockLevel1_3200,  /* 2B800..2B9FF */
+  FriBidiWidthBlockLevel1_3200,  /* 2BA00..2BBFF */
+  FriBidiWidthBlockLevel1_3200,  /* 2BC00..2BDFF */
+  FriBidiWidthBlockLevel1_3200,  /* 2BE00..2BFFF */
+  FriBidiWidthBlockLevel1_3200,  /* 2C000..2C1FF */
+  FriBidiWidthBlockLevel1_3200,  /* 2C200..2C3FF */
+  FriBidiWidthBlockLevel1_3200,  /* 2C400..2C5FF */
+  FriBidiWidthBlockLevel1_3200,  /* 2C600..2C7FF */
+  FriBidiWidthBlockLevel1_3200,  /* 2C800..2C9FF */
+  FriBidiWidthBlockLevel1_3200,  /* 2CA00..2CBFF */
+  FriBidiWidthBlockLevel1_3200,  /* 2CC00..2CDFF */
+  FriBidiWidthBlockLevel1_3200,  /* 2CE00..2CFFF */
+  FriBidiWidthBlockLevel1_3200,  /* 2D000..2D1FF */
+  FriBidiWidthBlockLevel1_3200,  /* 2D200..2D3FF */
+  FriBidiWidthBlockLevel1_3200,  /* 2D400..2D5FF */
+  FriBidiWidthBlockLevel1_3200,  /* 2D600..2D7FF */
+  FriBidiWidthBlockLevel1_3200,  /* 2D800..2D9FF */
+  FriBidiWidthBlockLevel1_3200,  /* 2DA00..2DBFF */
+  FriBidiWidthBlockLevel1_3200,  /* 2DC00..2DDFF */
+  FriBidiWidthBlockLevel1_3200,  /* 2DE00..2DFFF */
+  FriBidiWidthBlockLevel1_3200,  /* 2E000..2E1FF */
+  FriBidiWidthBlockLevel1_3200,  /* 2E200..2E3FF */
+  FriBidiWidthBlockLevel1_3200,  /* 2E400..2E5FF */
+  FriBidiWidthBlockLevel1_3200,  /* 2E600..2E7FF */
+  FriBidiWidthBlockLevel1_3200,  /* 2E800..2E9FF */
+  FriBidiWidthBlockLevel1_3200,  /* 2EA00..2EBFF */
+  FriBidiWidthBlockLevel1_3200,  /* 2EC00..2EDFF */
+  FriBidiWidthBlockLevel1_3200,  /* 2EE00..2EFFF */
+  FriBidiWidthBlockLevel1_3200,  /* 2F000..2F1FF */
+  FriBidiWidthBlockLevel1_3200,  /* 2F200..2F3FF */
+  FriBidiWidthBlockLevel1_3200,  /* 2F400..2F5FF */
+  FriBidiWidthBlockLevel1_3200,  /* 2F600..2F7FF */
+  FriBidiWidthBlockLevel1_3200,  /* 2F800..2F9FF */
+  FriBidiWidthBlockLevel1_3200,  /* 2FA00..2FBFF */
+  FriBidiWidthBlockLevel1_3200,  /* 2FC00..2FDFF */
+  FriBidiWidthBlockLevel1_3200,  /* 2FE00..2FFFF */
+  FriBidiWidthBlockLevel1_1200,  /* 30000..301FF */
+  FriBidiWidthBlockLevel1_1200,  /* 30200..303FF */
+  FriBidiWidthBlockLevel1_1200,  /* 30400..305FF */
+  FriBidiWidthBlockLevel1_1200,  /* 30600..307FF */
+  FriBidiWidthBlockLevel1_1200,  /* 30800..309FF */
+  FriBidiWidthBlockLevel1_1200,  /* 30A00..30BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 30C00..30DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 30E00..30FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 31000..311FF */
+  FriBidiWidthBlockLevel1_1200,  /* 31200..313FF */
+  FriBidiWidthBlockLevel1_1200,  /* 31400..315FF */
+  FriBidiWidthBlockLevel1_1200,  /* 31600..317FF */
+  FriBidiWidthBlockLevel1_1200,  /* 31800..319FF */
+  FriBidiWidthBlockLevel1_1200,  /* 31A00..31BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 31C00..31DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 31E00..31FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 32000..321FF */
+  FriBidiWidthBlockLevel1_1200,  /* 32200..323FF */
+  FriBidiWidthBlockLevel1_1200,  /* 32400..325FF */
+  FriBidiWidthBlockLevel1_1200,  /* 32600..327FF */
+  FriBidiWidthBlockLevel1_1200,  /* 32800..329FF */
+  FriBidiWidthBlockLevel1_1200,  /* 32A00..32BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 32C00..32DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 32E00..32FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 33000..331FF */
+  FriBidiWidthBlockLevel1_1200,  /* 33200..333FF */
+  FriBidiWidthBlockLevel1_1200,  /* 33400..335FF */
+  FriBidiWidthBlockLevel1_1200,  /* 33600..337FF */
+  FriBidiWidthBlockLevel1_1200,  /* 33800..339FF */
+  FriBidiWidthBlockLevel1_1200,  /* 33A00..33BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 33C00..33DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 33E00..33FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 34000..341FF */
+  FriBidiWidthBlockLevel1_1200,  /* 34200..343FF */
+  FriBidiWidthBlockLevel1_1200,  /* 34400..345FF */
+  FriBidiWidthBlockLevel1_1200,  /* 34600..347FF */
+  FriBidiWidthBlockLevel1_1200,  /* 34800..349FF */
+  FriBidiWidthBlockLevel1_1200,  /* 34A00..34BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 34C00..34DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 34E00..34FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 35000..351FF */
+  FriBidiWidthBlockLevel1_1200,  /* 35200..353FF */
+  FriBidiWidthBlockLevel1_1200,  /* 35400..355FF */
+  FriBidiWidthBlockLevel1_1200,  /* 35600..357FF */
+  FriBidiWidthBlockLevel1_1200,  /* 35800..359FF */
+  FriBidiWidthBlockLevel1_1200,  /* 35A00..35BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 35C00..35DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 35E00..35FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 36000..361FF */
+  FriBidiWidthBlockLevel1_1200,  /* 36200..363FF */
+  FriBidiWidthBlockLevel1_1200,  /* 36400..365FF */
+  FriBidiWidthBlockLevel1_1200,  /* 36600..367FF */
+  FriBidiWidthBlockLevel1_1200,  /* 36800..369FF */
+  FriBidiWidthBlockLevel1_1200,  /* 36A00..36BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 36C00..36DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 36E00..36FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 37000..371FF */
+  FriBidiWidthBlockLevel1_1200,  /* 37200..373FF */
+  FriBidiWidthBlockLevel1_1200,  /* 37400..375FF */
+  FriBidiWidthBlockLevel1_1200,  /* 37600..377FF */
+  FriBidiWidthBlockLevel1_1200,  /* 37800..379FF */
+  FriBidiWidthBlockLevel1_1200,  /* 37A00..37BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 37C00..37DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 37E00..37FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 38000..381FF */
+  FriBidiWidthBlockLevel1_1200,  /* 38200..383FF */
+  FriBidiWidthBlockLevel1_1200,  /* 38400..385FF */
+  FriBidiWidthBlockLevel1_1200,  /* 38600..387FF */
+  FriBidiWidthBlockLevel1_1200,  /* 38800..389FF */
+  FriBidiWidthBlockLevel1_1200,  /* 38A00..38BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 38C00..38DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 38E00..38FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 39000..391FF */
+  FriBidiWidthBlockLevel1_1200,  /* 39200..393FF */
+  FriBidiWidthBlockLevel1_1200,  /* 39400..395FF */
+  FriBidiWidthBlockLevel1_1200,  /* 39600..397FF */
+  FriBidiWidthBlockLevel1_1200,  /* 39800..399FF */
+  FriBidiWidthBlockLevel1_1200,  /* 39A00..39BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 39C00..39DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 39E00..39FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 3A000..3A1FF */
+  FriBidiWidthBlockLevel1_1200,  /* 3A200..3A3FF */
+  FriBidiWidthBlockLevel1_1200,  /* 3A400..3A5FF */
+  FriBidiWidthBlockLevel1_1200,  /* 3A600..3A7FF */
+  FriBidiWidthBlockLevel1_1200,  /* 3A800..3A9FF */
+  FriBidiWidthBlockLevel1_1200,  /* 3AA00..3ABFF */
+  FriBidiWidthBlockLevel1_1200,  /* 3AC00..3ADFF */
+  FriBidiWidthBlockLevel1_1200,  /* 3AE00..3AFFF */
+  FriBidiWidthBlockLevel1_1200,  /* 3B000..3B1FF */
+  FriBidiWidthBlockLevel1_1200,  /* 3B200..3B3FF */
+  FriBidiWidthBlockLevel1_1200,  /* 3B400..3B5FF */
+  FriBidiWidthBlockLevel1_1200,  /* 3B600..3B7FF */
+  FriBidiWidthBlockLevel1_1200,  /* 3B800..3B9FF */
+  FriBidiWidthBlockLevel1_1200,  /* 3BA00..3BBFF */
+  FriBidiWidthBlockLevel1_1200,  /* 3BC00..3BDFF */
+  FriBidiWidthBlockLevel1_1200,  /* 3BE00..3BFFF */
+  FriBidiWidthBlockLevel1_1200,  /* 3C000..3C1FF */
+  FriBidiWidthBlockLevel1_1200,  /* 3C200..3C3FF */
+  FriBidiWidthBlockLevel1_1200,  /* 3C400..3C5FF */
+  FriBidiWidthBlockLevel1_1200,  /* 3C600..3C7FF */
+  FriBidiWidthBlockLevel1_1200,  /* 3C800..3C9FF */
+  FriBidiWidthBlockLevel1_1200,  /* 3CA00..3CBFF */
+  FriBidiWidthBlockLevel1_1200,  /* 3CC00..3CDFF */
+  FriBidiWidthBlockLevel1_1200,  /* 3CE00..3CFFF */
+  FriBidiWidthBlockLevel1_1200,  /* 3D000..3D1FF */
+  FriBidiWidthBlockLevel1_1200,  /* 3D200..3D3FF */
+  FriBidiWidthBlockLevel1_1200,  /* 3D400..3D5FF */
+  FriBidiWidthBlockLevel1_1200,  /* 3D600..3D7FF */
+  FriBidiWidthBlockLevel1_1200,  /* 3D800..3D9FF */
+  FriBidiWidthBlockLevel1_1200,  /* 3DA00..3DBFF */
+  FriBidiWidthBlockLevel1_1200,  /* 3DC00..3DDFF */
+  FriBidiWidthBlockLevel1_1200,  /* 3DE00..3DFFF */
+  FriBidiWidthBlockLevel1_1200,  /* 3E000..3E1FF */
+  FriBidiWidthBlockLevel1_1200,  /* 3E200..3E3FF */
+  FriBidiWidthBlockLevel1_1200,  /* 3E400..3E5FF */
+  FriBidiWidthBlockLevel1_1200,  /* 3E600..3E7FF */
+  FriBidiWidthBlockLevel1_1200,  /* 3E800..3E9FF */
+  FriBidiWidthBlockLevel1_1200,  /* 3EA00..3EBFF */
+  FriBidiWidthBlockLevel1_1200,  /* 3EC00..3EDFF */
+  FriBidiWidthBlockLevel1_1200,  /* 3EE00..3EFFF */
+  FriBidiWidthBlockLevel1_1200,  /* 3F000..3F1FF */
+  FriBidiWidthBlockLevel1_1200,  /* 3F200..3F3FF */
+  FriBidiWidthBlockLevel1_1200,  /* 3F400..3F5FF */
+  FriBidiWidthBlockLevel1_1200,  /* 3F600..3F7FF */
+  FriBidiWidthBlockLevel1_1200,  /* 3F800..3F9FF */
+  FriBidiWidthBlockLevel1_1200,  /* 3FA00..3FBFF */
+  FriBidiWidthBlockLevel1_1200,  /* 3FC00..3FDFF */
+  FriBidiWidthBlockLevel1_1200,  /* 3FE00..3FFFF */
+  FriBidiWidthBlockLevel1_1200,  /* 40000..401FF */
+  FriBidiWidthBlockLevel1_1200,  /* 40200..403FF */
+  FriBidiWidthBlockLevel1_1200,  /* 40400..405FF */
+  FriBidiWidthBlockLevel1_1200,  /* 40600..407FF */
+  FriBidiWidthBlockLevel1_1200,  /* 40800..409FF */
+  FriBidiWidthBlockLevel1_1200,  /* 40A00..40BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 40C00..40DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 40E00..40FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 41000..411FF */
+  FriBidiWidthBlockLevel1_1200,  /* 41200..413FF */
+  FriBidiWidthBlockLevel1_1200,  /* 41400..415FF */
+  FriBidiWidthBlockLevel1_1200,  /* 41600..417FF */
+  FriBidiWidthBlockLevel1_1200,  /* 41800..419FF */
+  FriBidiWidthBlockLevel1_1200,  /* 41A00..41BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 41C00..41DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 41E00..41FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 42000..421FF */
+  FriBidiWidthBlockLevel1_1200,  /* 42200..423FF */
+  FriBidiWidthBlockLevel1_1200,  /* 42400..425FF */
+  FriBidiWidthBlockLevel1_1200,  /* 42600..427FF */
+  FriBidiWidthBlockLevel1_1200,  /* 42800..429FF */
+  FriBidiWidthBlockLevel1_1200,  /* 42A00..42BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 42C00..42DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 42E00..42FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 43000..431FF */
+  FriBidiWidthBlockLevel1_1200,  /* 43200..433FF */
+  FriBidiWidthBlockLevel1_1200,  /* 43400..435FF */
+  FriBidiWidthBlockLevel1_1200,  /* 43600..437FF */
+  FriBidiWidthBlockLevel1_1200,  /* 43800..439FF */
+  FriBidiWidthBlockLevel1_1200,  /* 43A00..43BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 43C00..43DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 43E00..43FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 44000..441FF */
+  FriBidiWidthBlockLevel1_1200,  /* 44200..443FF */
+  FriBidiWidthBlockLevel1_1200,  /* 44400..445FF */
+  FriBidiWidthBlockLevel1_1200,  /* 44600..447FF */
+  FriBidiWidthBlockLevel1_1200,  /* 44800..449FF */
+  FriBidiWidthBlockLevel1_1200,  /* 44A00..44BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 44C00..44DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 44E00..44FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 45000..451FF */
+  FriBidiWidthBlockLevel1_1200,  /* 45200..453FF */
+  FriBidiWidthBlockLevel1_1200,  /* 45400..455FF */
+  FriBidiWidthBlockLevel1_1200,  /* 45600..457FF */
+  FriBidiWidthBlockLevel1_1200,  /* 45800..459FF */
+  FriBidiWidthBlockLevel1_1200,  /* 45A00..45BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 45C00..45DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 45E00..45FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 46000..461FF */
+  FriBidiWidthBlockLevel1_1200,  /* 46200..463FF */
+  FriBidiWidthBlockLevel1_1200,  /* 46400..465FF */
+  FriBidiWidthBlockLevel1_1200,  /* 46600..467FF */
+  FriBidiWidthBlockLevel1_1200,  /* 46800..469FF */
+  FriBidiWidthBlockLevel1_1200,  /* 46A00..46BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 46C00..46DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 46E00..46FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 47000..471FF */
+  FriBidiWidthBlockLevel1_1200,  /* 47200..473FF */
+  FriBidiWidthBlockLevel1_1200,  /* 47400..475FF */
+  FriBidiWidthBlockLevel1_1200,  /* 47600..477FF */
+  FriBidiWidthBlockLevel1_1200,  /* 47800..479FF */
+  FriBidiWidthBlockLevel1_1200,  /* 47A00..47BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 47C00..47DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 47E00..47FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 48000..481FF */
+  FriBidiWidthBlockLevel1_1200,  /* 48200..483FF */
+  FriBidiWidthBlockLevel1_1200,  /* 48400..485FF */
+  FriBidiWidthBlockLevel1_1200,  /* 48600..487FF */
+  FriBidiWidthBlockLevel1_1200,  /* 48800..489FF */
+  FriBidiWidthBlockLevel1_1200,  /* 48A00..48BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 48C00..48DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 48E00..48FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 49000..491FF */
+  FriBidiWidthBlockLevel1_1200,  /* 49200..493FF */
+  FriBidiWidthBlockLevel1_1200,  /* 49400..495FF */
+  FriBidiWidthBlockLevel1_1200,  /* 49600..497FF */
+  FriBidiWidthBlockLevel1_1200,  /* 49800..499FF */
+  FriBidiWidthBlockLevel1_1200,  /* 49A00..49BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 49C00..49DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 49E00..49FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 4A000..4A1FF */
+  FriBidiWidthBlockLevel1_1200,  /* 4A200..4A3FF */
+  FriBidiWidthBlockLevel1_1200,  /* 4A400..4A5FF */
+  FriBidiWidthBlockLevel1_1200,  /* 4A600..4A7FF */
+  FriBidiWidthBlockLevel1_1200,  /* 4A800..4A9FF */
+  FriBidiWidthBlockLevel1_1200,  /* 4AA00..4ABFF */
+  FriBidiWidthBlockLevel1_1200,  /* 4AC00..4ADFF */
+  FriBidiWidthBlockLevel1_1200,  /* 4AE00..4AFFF */
+  FriBidiWidthBlockLevel1_1200,  /* 4B000..4B1FF */
+  FriBidiWidthBlockLevel1_1200,  /* 4B200..4B3FF */
+  FriBidiWidthBlockLevel1_1200,  /* 4B400..4B5FF */
+  FriBidiWidthBlockLevel1_1200,  /* 4B600..4B7FF */
+  FriBidiWidthBlockLevel1_1200,  /* 4B800..4B9FF */
+  FriBidiWidthBlockLevel1_1200,  /* 4BA00..4BBFF */
+  FriBidiWidthBlockLevel1_1200,  /* 4BC00..4BDFF */
+  FriBidiWidthBlockLevel1_1200,  /* 4BE00..4BFFF */
+  FriBidiWidthBlockLevel1_1200,  /* 4C000..4C1FF */
+  FriBidiWidthBlockLevel1_1200,  /* 4C200..4C3FF */
+  FriBidiWidthBlockLevel1_1200,  /* 4C400..4C5FF */
+  FriBidiWidthBlockLevel1_1200,  /* 4C600..4C7FF */
+  FriBidiWidthBlockLevel1_1200,  /* 4C800..4C9FF */
+  FriBidiWidthBlockLevel1_1200,  /* 4CA00..4CBFF */
+  FriBidiWidthBlockLevel1_1200,  /* 4CC00..4CDFF */
+  FriBidiWidthBlockLevel1_1200,  /* 4CE00..4CFFF */
+  FriBidiWidthBlockLevel1_1200,  /* 4D000..4D1FF */
+  FriBidiWidthBlockLevel1_1200,  /* 4D200..4D3FF */
+  FriBidiWidthBlockLevel1_1200,  /* 4D400..4D5FF */
+  FriBidiWidthBlockLevel1_1200,  /* 4D600..4D7FF */
+  FriBidiWidthBlockLevel1_1200,  /* 4D800..4D9FF */
+  FriBidiWidthBlockLevel1_1200,  /* 4DA00..4DBFF */
+  FriBidiWidthBlockLevel1_1200,  /* 4DC00..4DDFF */
+  FriBidiWidthBlockLevel1_1200,  /* 4DE00..4DFFF */
+  FriBidiWidthBlockLevel1_1200,  /* 4E000..4E1FF */
+  FriBidiWidthBlockLevel1_1200,  /* 4E200..4E3FF */
+  FriBidiWidthBlockLevel1_1200,  /* 4E400..4E5FF */
+  FriBidiWidthBlockLevel1_1200,  /* 4E600..4E7FF */
+  FriBidiWidthBlockLevel1_1200,  /* 4E800..4E9FF */
+  FriBidiWidthBlockLevel1_1200,  /* 4EA00..4EBFF */
+  FriBidiWidthBlockLevel1_1200,  /* 4EC00..4EDFF */
+  FriBidiWidthBlockLevel1_1200,  /* 4EE00..4EFFF */
+  FriBidiWidthBlockLevel1_1200,  /* 4F000..4F1FF */
+  FriBidiWidthBlockLevel1_1200,  /* 4F200..4F3FF */
+  FriBidiWidthBlockLevel1_1200,  /* 4F400..4F5FF */
+  FriBidiWidthBlockLevel1_1200,  /* 4F600..4F7FF */
+  FriBidiWidthBlockLevel1_1200,  /* 4F800..4F9FF */
+  FriBidiWidthBlockLevel1_1200,  /* 4FA00..4FBFF */
+  FriBidiWidthBlockLevel1_1200,  /* 4FC00..4FDFF */
+  FriBidiWidthBlockLevel1_1200,  /* 4FE00..4FFFF */
+  FriBidiWidthBlockLevel1_1200,  /* 50000..501FF */
+  FriBidiWidthBlockLevel1_1200,  /* 50200..503FF */
+  FriBidiWidthBlockLevel1_1200,  /* 50400..505FF */
+  FriBidiWidthBlockLevel1_1200,  /* 50600..507FF */
+  FriBidiWidthBlockLevel1_1200,  /* 50800..509FF */
+  FriBidiWidthBlockLevel1_1200,  /* 50A00..50BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 50C00..50DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 50E00..50FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 51000..511FF */
+  FriBidiWidthBlockLevel1_1200,  /* 51200..513FF */
+  FriBidiWidthBlockLevel1_1200,  /* 51400..515FF */
+  FriBidiWidthBlockLevel1_1200,  /* 51600..517FF */
+  FriBidiWidthBlockLevel1_1200,  /* 51800..519FF */
+  FriBidiWidthBlockLevel1_1200,  /* 51A00..51BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 51C00..51DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 51E00..51FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 52000..521FF */
+  FriBidiWidthBlockLevel1_1200,  /* 52200..523FF */
+  FriBidiWidthBlockLevel1_1200,  /* 52400..525FF */
+  FriBidiWidthBlockLevel1_1200,  /* 52600..527FF */
+  FriBidiWidthBlockLevel1_1200,  /* 52800..529FF */
+  FriBidiWidthBlockLevel1_1200,  /* 52A00..52BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 52C00..52DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 52E00..52FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 53000..531FF */
+  FriBidiWidthBlockLevel1_1200,  /* 53200..533FF */
+  FriBidiWidthBlockLevel1_1200,  /* 53400..535FF */
+  FriBidiWidthBlockLevel1_1200,  /* 53600..537FF */
+  FriBidiWidthBlockLevel1_1200,  /* 53800..539FF */
+  FriBidiWidthBlockLevel1_1200,  /* 53A00..53BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 53C00..53DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 53E00..53FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 54000..541FF */
+  FriBidiWidthBlockLevel1_1200,  /* 54200..543FF */
+  FriBidiWidthBlockLevel1_1200,  /* 54400..545FF */
+  FriBidiWidthBlockLevel1_1200,  /* 54600..547FF */
+  FriBidiWidthBlockLevel1_1200,  /* 54800..549FF */
+  FriBidiWidthBlockLevel1_1200,  /* 54A00..54BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 54C00..54DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 54E00..54FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 55000..551FF */
+  FriBidiWidthBlockLevel1_1200,  /* 55200..553FF */
+  FriBidiWidthBlockLevel1_1200,  /* 55400..555FF */
+  FriBidiWidthBlockLevel1_1200,  /* 55600..557FF */
+  FriBidiWidthBlockLevel1_1200,  /* 55800..559FF */
+  FriBidiWidthBlockLevel1_1200,  /* 55A00..55BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 55C00..55DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 55E00..55FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 56000..561FF */
+  FriBidiWidthBlockLevel1_1200,  /* 56200..563FF */
+  FriBidiWidthBlockLevel1_1200,  /* 56400..565FF */
+  FriBidiWidthBlockLevel1_1200,  /* 56600..567FF */
+  FriBidiWidthBlockLevel1_1200,  /* 56800..569FF */
+  FriBidiWidthBlockLevel1_1200,  /* 56A00..56BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 56C00..56DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 56E00..56FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 57000..571FF */
+  FriBidiWidthBlockLevel1_1200,  /* 57200..573FF */
+  FriBidiWidthBlockLevel1_1200,  /* 57400..575FF */
+  FriBidiWidthBlockLevel1_1200,  /* 57600..577FF */
+  FriBidiWidthBlockLevel1_1200,  /* 57800..579FF */
+  FriBidiWidthBlockLevel1_1200,  /* 57A00..57BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 57C00..57DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 57E00..57FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 58000..581FF */
+  FriBidiWidthBlockLevel1_1200,  /* 58200..583FF */
+  FriBidiWidthBlockLevel1_1200,  /* 58400..585FF */
+  FriBidiWidthBlockLevel1_1200,  /* 58600..587FF */
+  FriBidiWidthBlockLevel1_1200,  /* 58800..589FF */
+  FriBidiWidthBlockLevel1_1200,  /* 58A00..58BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 58C00..58DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 58E00..58FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 59000..591FF */
+  FriBidiWidthBlockLevel1_1200,  /* 59200..593FF */
+  FriBidiWidthBlockLevel1_1200,  /* 59400..595FF */
+  FriBidiWidthBlockLevel1_1200,  /* 59600..597FF */
+  FriBidiWidthBlockLevel1_1200,  /* 59800..599FF */
+  FriBidiWidthBlockLevel1_1200,  /* 59A00..59BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 59C00..59DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 59E00..59FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 5A000..5A1FF */
+  FriBidiWidthBlockLevel1_1200,  /* 5A200..5A3FF */
+  FriBidiWidthBlockLevel1_1200,  /* 5A400..5A5FF */
+  FriBidiWidthBlockLevel1_1200,  /* 5A600..5A7FF */
+  FriBidiWidthBlockLevel1_1200,  /* 5A800..5A9FF */
+  FriBidiWidthBlockLevel1_1200,  /* 5AA00..5ABFF */
+  FriBidiWidthBlockLevel1_1200,  /* 5AC00..5ADFF */
+  FriBidiWidthBlockLevel1_1200,  /* 5AE00..5AFFF */
+  FriBidiWidthBlockLevel1_1200,  /* 5B000..5B1FF */
+  FriBidiWidthBlockLevel1_1200,  /* 5B200..5B3FF */
+  FriBidiWidthBlockLevel1_1200,  /* 5B400..5B5FF */
+  FriBidiWidthBlockLevel1_1200,  /* 5B600..5B7FF */
+  FriBidiWidthBlockLevel1_1200,  /* 5B800..5B9FF */
+  FriBidiWidthBlockLevel1_1200,  /* 5BA00..5BBFF */
+  FriBidiWidthBlockLevel1_1200,  /* 5BC00..5BDFF */
+  FriBidiWidthBlockLevel1_1200,  /* 5BE00..5BFFF */
+  FriBidiWidthBlockLevel1_1200,  /* 5C000..5C1FF */
+  FriBidiWidthBlockLevel1_1200,  /* 5C200..5C3FF */
+  FriBidiWidthBlockLevel1_1200,  /* 5C400..5C5FF */
+  FriBidiWidthBlockLevel1_1200,  /* 5C600..5C7FF */
+  FriBidiWidthBlockLevel1_1200,  /* 5C800..5C9FF */
+  FriBidiWidthBlockLevel1_1200,  /* 5CA00..5CBFF */
+  FriBidiWidthBlockLevel1_1200,  /* 5CC00..5CDFF */
+  FriBidiWidthBlockLevel1_1200,  /* 5CE00..5CFFF */
+  FriBidiWidthBlockLevel1_1200,  /* 5D000..5D1FF */
+  FriBidiWidthBlockLevel1_1200,  /* 5D200..5D3FF */
+  FriBidiWidthBlockLevel1_1200,  /* 5D400..5D5FF */
+  FriBidiWidthBlockLevel1_1200,  /* 5D600..5D7FF */
+  FriBidiWidthBlockLevel1_1200,  /* 5D800..5D9FF */
+  FriBidiWidthBlockLevel1_1200,  /* 5DA00..5DBFF */
+  FriBidiWidthBlockLevel1_1200,  /* 5DC00..5DDFF */
+  FriBidiWidthBlockLevel1_1200,  /* 5DE00..5DFFF */
+  FriBidiWidthBlockLevel1_1200,  /* 5E000..5E1FF */
+  FriBidiWidthBlockLevel1_1200,  /* 5E200..5E3FF */
+  FriBidiWidthBlockLevel1_1200,  /* 5E400..5E5FF */
+  FriBidiWidthBlockLevel1_1200,  /* 5E600..5E7FF */
+  FriBidiWidthBlockLevel1_1200,  /* 5E800..5E9FF */
+  FriBidiWidthBlockLevel1_1200,  /* 5EA00..5EBFF */
+  FriBidiWidthBlockLevel1_1200,  /* 5EC00..5EDFF */
+  FriBidiWidthBlockLevel1_1200,  /* 5EE00..5EFFF */
+  FriBidiWidthBlockLevel1_1200,  /* 5F000..5F1FF */
+  FriBidiWidthBlockLevel1_1200,  /* 5F200..5F3FF */
+  FriBidiWidthBlockLevel1_1200,  /* 5F400..5F5FF */
+  FriBidiWidthBlockLevel1_1200,  /* 5F600..5F7FF */
+  FriBidiWidthBlockLevel1_1200,  /* 5F800..5F9FF */
+  FriBidiWidthBlockLevel1_1200,  /* 5FA00..5FBFF */
+  FriBidiWidthBlockLevel1_1200,  /* 5FC00..5FDFF */
+  FriBidiWidthBlockLevel1_1200,  /* 5FE00..5FFFF */
+  FriBidiWidthBlockLevel1_1200,  /* 60000..601FF */
+  FriBidiWidthBlockLevel1_1200,  /* 60200..603FF */
+  FriBidiWidthBlockLevel1_1200,  /* 60400..605FF */
+  FriBidiWidthBlockLevel1_1200,  /* 60600..607FF */
+  FriBidiWidthBlockLevel1_1200,  /* 60800..609FF */
+  FriBidiWidthBlockLevel1_1200,  /* 60A00..60BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 60C00..60DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 60E00..60FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 61000..611FF */
+  FriBidiWidthBlockLevel1_1200,  /* 61200..613FF */
+  FriBidiWidthBlockLevel1_1200,  /* 61400..615FF */
+  FriBidiWidthBlockLevel1_1200,  /* 61600..617FF */
+  FriBidiWidthBlockLevel1_1200,  /* 61800..619FF */
+  FriBidiWidthBlockLevel1_1200,  /* 61A00..61BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 61C00..61DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 61E00..61FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 62000..621FF */
+  FriBidiWidthBlockLevel1_1200,  /* 62200..623FF */
+  FriBidiWidthBlockLevel1_1200,  /* 62400..625FF */
+  FriBidiWidthBlockLevel1_1200,  /* 62600..627FF */
+  FriBidiWidthBlockLevel1_1200,  /* 62800..629FF */
+  FriBidiWidthBlockLevel1_1200,  /* 62A00..62BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 62C00..62DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 62E00..62FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 63000..631FF */
+  FriBidiWidthBlockLevel1_1200,  /* 63200..633FF */
+  FriBidiWidthBlockLevel1_1200,  /* 63400..635FF */
+  FriBidiWidthBlockLevel1_1200,  /* 63600..637FF */
+  FriBidiWidthBlockLevel1_1200,  /* 63800..639FF */
+  FriBidiWidthBlockLevel1_1200,  /* 63A00..63BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 63C00..63DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 63E00..63FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 64000..641FF */
+  FriBidiWidthBlockLevel1_1200,  /* 64200..643FF */
+  FriBidiWidthBlockLevel1_1200,  /* 64400..645FF */
+  FriBidiWidthBlockLevel1_1200,  /* 64600..647FF */
+  FriBidiWidthBlockLevel1_1200,  /* 64800..649FF */
+  FriBidiWidthBlockLevel1_1200,  /* 64A00..64BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 64C00..64DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 64E00..64FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 65000..651FF */
+  FriBidiWidthBlockLevel1_1200,  /* 65200..653FF */
+  FriBidiWidthBlockLevel1_1200,  /* 65400..655FF */
+  FriBidiWidthBlockLevel1_1200,  /* 65600..657FF */
+  FriBidiWidthBlockLevel1_1200,  /* 65800..659FF */
+  FriBidiWidthBlockLevel1_1200,  /* 65A00..65BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 65C00..65DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 65E00..65FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 66000..661FF */
+  FriBidiWidthBlockLevel1_1200,  /* 66200..663FF */
+  FriBidiWidthBlockLevel1_1200,  /* 66400..665FF */
+  FriBidiWidthBlockLevel1_1200,  /* 66600..667FF */
+  FriBidiWidthBlockLevel1_1200,  /* 66800..669FF */
+  FriBidiWidthBlockLevel1_1200,  /* 66A00..66BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 66C00..66DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 66E00..66FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 67000..671FF */
+  FriBidiWidthBlockLevel1_1200,  /* 67200..673FF */
+  FriBidiWidthBlockLevel1_1200,  /* 67400..675FF */
+  FriBidiWidthBlockLevel1_1200,  /* 67600..677FF */
+  FriBidiWidthBlockLevel1_1200,  /* 67800..679FF */
+  FriBidiWidthBlockLevel1_1200,  /* 67A00..67BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 67C00..67DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 67E00..67FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 68000..681FF */
+  FriBidiWidthBlockLevel1_1200,  /* 68200..683FF */
+  FriBidiWidthBlockLevel1_1200,  /* 68400..685FF */
+  FriBidiWidthBlockLevel1_1200,  /* 68600..687FF */
+  FriBidiWidthBlockLevel1_1200,  /* 68800..689FF */
+  FriBidiWidthBlockLevel1_1200,  /* 68A00..68BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 68C00..68DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 68E00..68FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 69000..691FF */
+  FriBidiWidthBlockLevel1_1200,  /* 69200..693FF */
+  FriBidiWidthBlockLevel1_1200,  /* 69400..695FF */
+  FriBidiWidthBlockLevel1_1200,  /* 69600..697FF */
+  FriBidiWidthBlockLevel1_1200,  /* 69800..699FF */
+  FriBidiWidthBlockLevel1_1200,  /* 69A00..69BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 69C00..69DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 69E00..69FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 6A000..6A1FF */
+  FriBidiWidthBlockLevel1_1200,  /* 6A200..6A3FF */
+  FriBidiWidthBlockLevel1_1200,  /* 6A400..6A5FF */
+  FriBidiWidthBlockLevel1_1200,  /* 6A600..6A7FF */
+  FriBidiWidthBlockLevel1_1200,  /* 6A800..6A9FF */
+  FriBidiWidthBlockLevel1_1200,  /* 6AA00..6ABFF */
+  FriBidiWidthBlockLevel1_1200,  /* 6AC00..6ADFF */
+  FriBidiWidthBlockLevel1_1200,  /* 6AE00..6AFFF */
+  FriBidiWidthBlockLevel1_1200,  /* 6B000..6B1FF */
+  FriBidiWidthBlockLevel1_1200,  /* 6B200..6B3FF */
+  FriBidiWidthBlockLevel1_1200,  /* 6B400..6B5FF */
+  FriBidiWidthBlockLevel1_1200,  /* 6B600..6B7FF */
+  FriBidiWidthBlockLevel1_1200,  /* 6B800..6B9FF */
+  FriBidiWidthBlockLevel1_1200,  /* 6BA00..6BBFF */
+  FriBidiWidthBlockLevel1_1200,  /* 6BC00..6BDFF */
+  FriBidiWidthBlockLevel1_1200,  /* 6BE00..6BFFF */
+  FriBidiWidthBlockLevel1_1200,  /* 6C000..6C1FF */
+  FriBidiWidthBlockLevel1_1200,  /* 6C200..6C3FF */
+  FriBidiWidthBlockLevel1_1200,  /* 6C400..6C5FF */
+  FriBidiWidthBlockLevel1_1200,  /* 6C600..6C7FF */
+  FriBidiWidthBlockLevel1_1200,  /* 6C800..6C9FF */
+  FriBidiWidthBlockLevel1_1200,  /* 6CA00..6CBFF */
+  FriBidiWidthBlockLevel1_1200,  /* 6CC00..6CDFF */
+  FriBidiWidthBlockLevel1_1200,  /* 6CE00..6CFFF */
+  FriBidiWidthBlockLevel1_1200,  /* 6D000..6D1FF */
+  FriBidiWidthBlockLevel1_1200,  /* 6D200..6D3FF */
+  FriBidiWidthBlockLevel1_1200,  /* 6D400..6D5FF */
+  FriBidiWidthBlockLevel1_1200,  /* 6D600..6D7FF */
+  FriBidiWidthBlockLevel1_1200,  /* 6D800..6D9FF */
+  FriBidiWidthBlockLevel1_1200,  /* 6DA00..6DBFF */
+  FriBidiWidthBlockLevel1_1200,  /* 6DC00..6DDFF */
+  FriBidiWidthBlockLevel1_1200,  /* 6DE00..6DFFF */
+  FriBidiWidthBlockLevel1_1200,  /* 6E000..6E1FF */
+  FriBidiWidthBlockLevel1_1200,  /* 6E200..6E3FF */
+  FriBidiWidthBlockLevel1_1200,  /* 6E400..6E5FF */
+  FriBidiWidthBlockLevel1_1200,  /* 6E600..6E7FF */
+  FriBidiWidthBlockLevel1_1200,  /* 6E800..6E9FF */
+  FriBidiWidthBlockLevel1_1200,  /* 6EA00..6EBFF */
+  FriBidiWidthBlockLevel1_1200,  /* 6EC00..6EDFF */
+  FriBidiWidthBlockLevel1_1200,  /* 6EE00..6EFFF */
+  FriBidiWidthBlockLevel1_1200,  /* 6F000..6F1FF */
+  FriBidiWidthBlockLevel1_1200,  /* 6F200..6F3FF */
+  FriBidiWidthBlockLevel1_1200,  /* 6F400..6F5FF */
+  FriBidiWidthBlockLevel1_1200,  /* 6F600..6F7FF */
+  FriBidiWidthBlockLevel1_1200,  /* 6F800..6F9FF */
+  FriBidiWidthBlockLevel1_1200,  /* 6FA00..6FBFF */
+  FriBidiWidthBlockLevel1_1200,  /* 6FC00..6FDFF */
+  FriBidiWidthBlockLevel1_1200,  /* 6FE00..6FFFF */
+  FriBidiWidthBlockLevel1_1200,  /* 70000..701FF */
+  FriBidiWidthBlockLevel1_1200,  /* 70200..703FF */
+  FriBidiWidthBlockLevel1_1200,  /* 70400..705FF */
+  FriBidiWidthBlockLevel1_1200,  /* 70600..707FF */
+  FriBidiWidthBlockLevel1_1200,  /* 70800..709FF */
+  FriBidiWidthBlockLevel1_1200,  /* 70A00..70BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 70C00..70DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 70E00..70FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 71000..711FF */
+  FriBidiWidthBlockLevel1_1200,  /* 71200..713FF */
+  FriBidiWidthBlockLevel1_1200,  /* 71400..715FF */
+  FriBidiWidthBlockLevel1_1200,  /* 71600..717FF */
+  FriBidiWidthBlockLevel1_1200,  /* 71800..719FF */
+  FriBidiWidthBlockLevel1_1200,  /* 71A00..71BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 71C00..71DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 71E00..71FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 72000..721FF */
+  FriBidiWidthBlockLevel1_1200,  /* 72200..723FF */
+  FriBidiWidthBlockLevel1_1200,  /* 72400..725FF */
+  FriBidiWidthBlockLevel1_1200,  /* 72600..727FF */
+  FriBidiWidthBlockLevel1_1200,  /* 72800..729FF */
+  FriBidiWidthBlockLevel1_1200,  /* 72A00..72BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 72C00..72DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 72E00..72FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 73000..731FF */
+  FriBidiWidthBlockLevel1_1200,  /* 73200..733FF */
+  FriBidiWidthBlockLevel1_1200,  /* 73400..735FF */
+  FriBidiWidthBlockLevel1_1200,  /* 73600..737FF */
+  FriBidiWidthBlockLevel1_1200,  /* 73800..739FF */
+  FriBidiWidthBlockLevel1_1200,  /* 73A00..73BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 73C00..73DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 73E00..73FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 74000..741FF */
+  FriBidiWidthBlockLevel1_1200,  /* 74200..743FF */
+  FriBidiWidthBlockLevel1_1200,  /* 74400..745FF */
+  FriBidiWidthBlockLevel1_1200,  /* 74600..747FF */
+  FriBidiWidthBlockLevel1_1200,  /* 74800..749FF */
+  FriBidiWidthBlockLevel1_1200,  /* 74A00..74BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 74C00..74DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 74E00..74FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 75000..751FF */
+  FriBidiWidthBlockLevel1_1200,  /* 75200..753FF */
+  FriBidiWidthBlockLevel1_1200,  /* 75400..755FF */
+  FriBidiWidthBlockLevel1_1200,  /* 75600..757FF */
+  FriBidiWidthBlockLevel1_1200,  /* 75800..759FF */
+  FriBidiWidthBlockLevel1_1200,  /* 75A00..75BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 75C00..75DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 75E00..75FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 76000..761FF */
+  FriBidiWidthBlockLevel1_1200,  /* 76200..763FF */
+  FriBidiWidthBlockLevel1_1200,  /* 76400..765FF */
+  FriBidiWidthBlockLevel1_1200,  /* 76600..767FF */
+  FriBidiWidthBlockLevel1_1200,  /* 76800..769FF */
+  FriBidiWidthBlockLevel1_1200,  /* 76A00..76BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 76C00..76DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 76E00..76FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 77000..771FF */
+  FriBidiWidthBlockLevel1_1200,  /* 77200..773FF */
+  FriBidiWidthBlockLevel1_1200,  /* 77400..775FF */
+  FriBidiWidthBlockLevel1_1200,  /* 77600..777FF */
+  FriBidiWidthBlockLevel1_1200,  /* 77800..779FF */
+  FriBidiWidthBlockLevel1_1200,  /* 77A00..77BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 77C00..77DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 77E00..77FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 78000..781FF */
+  FriBidiWidthBlockLevel1_1200,  /* 78200..783FF */
+  FriBidiWidthBlockLevel1_1200,  /* 78400..785FF */
+  FriBidiWidthBlockLevel1_1200,  /* 78600..787FF */
+  FriBidiWidthBlockLevel1_1200,  /* 78800..789FF */
+  FriBidiWidthBlockLevel1_1200,  /* 78A00..78BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 78C00..78DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 78E00..78FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 79000..791FF */
+  FriBidiWidthBlockLevel1_1200,  /* 79200..793FF */
+  FriBidiWidthBlockLevel1_1200,  /* 79400..795FF */
+  FriBidiWidthBlockLevel1_1200,  /* 79600..797FF */
+  FriBidiWidthBlockLevel1_1200,  /* 79800..799FF */
+  FriBidiWidthBlockLevel1_1200,  /* 79A00..79BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 79C00..79DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 79E00..79FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 7A000..7A1FF */
+  FriBidiWidthBlockLevel1_1200,  /* 7A200..7A3FF */
+  FriBidiWidthBlockLevel1_1200,  /* 7A400..7A5FF */
+  FriBidiWidthBlockLevel1_1200,  /* 7A600..7A7FF */
+  FriBidiWidthBlockLevel1_1200,  /* 7A800..7A9FF */
+  FriBidiWidthBlockLevel1_1200,  /* 7AA00..7ABFF */
+  FriBidiWidthBlockLevel1_1200,  /* 7AC00..7ADFF */
+  FriBidiWidthBlockLevel1_1200,  /* 7AE00..7AFFF */
+  FriBidiWidthBlockLevel1_1200,  /* 7B000..7B1FF */
+  FriBidiWidthBlockLevel1_1200,  /* 7B200..7B3FF */
+  FriBidiWidthBlockLevel1_1200,  /* 7B400..7B5FF */
+  FriBidiWidthBlockLevel1_1200,  /* 7B600..7B7FF */
+  FriBidiWidthBlockLevel1_1200,  /* 7B800..7B9FF */
+  FriBidiWidthBlockLevel1_1200,  /* 7BA00..7BBFF */
+  FriBidiWidthBlockLevel1_1200,  /* 7BC00..7BDFF */
+  FriBidiWidthBlockLevel1_1200,  /* 7BE00..7BFFF */
+  FriBidiWidthBlockLevel1_1200,  /* 7C000..7C1FF */
+  FriBidiWidthBlockLevel1_1200,  /* 7C200..7C3FF */
+  FriBidiWidthBlockLevel1_1200,  /* 7C400..7C5FF */
+  FriBidiWidthBlockLevel1_1200,  /* 7C600..7C7FF */
+  FriBidiWidthBlockLevel1_1200,  /* 7C800..7C9FF */
+  FriBidiWidthBlockLevel1_1200,  /* 7CA00..7CBFF */
+  FriBidiWidthBlockLevel1_1200,  /* 7CC00..7CDFF */
+  FriBidiWidthBlockLevel1_1200,  /* 7CE00..7CFFF */
+  FriBidiWidthBlockLevel1_1200,  /* 7D000..7D1FF */
+  FriBidiWidthBlockLevel1_1200,  /* 7D200..7D3FF */
+  FriBidiWidthBlockLevel1_1200,  /* 7D400..7D5FF */
+  FriBidiWidthBlockLevel1_1200,  /* 7D600..7D7FF */
+  FriBidiWidthBlockLevel1_1200,  /* 7D800..7D9FF */
+  FriBidiWidthBlockLevel1_1200,  /* 7DA00..7DBFF */
+  FriBidiWidthBlockLevel1_1200,  /* 7DC00..7DDFF */
+  FriBidiWidthBlockLevel1_1200,  /* 7DE00..7DFFF */
+  FriBidiWidthBlockLevel1_1200,  /* 7E000..7E1FF */
+  FriBidiWidthBlockLevel1_1200,  /* 7E200..7E3FF */
+  FriBidiWidthBlockLevel1_1200,  /* 7E400..7E5FF */
+  FriBidiWidthBlockLevel1_1200,  /* 7E600..7E7FF */
+  FriBidiWidthBlockLevel1_1200,  /* 7E800..7E9FF */
+  FriBidiWidthBlockLevel1_1200,  /* 7EA00..7EBFF */
+  FriBidiWidthBlockLevel1_1200,  /* 7EC00..7EDFF */
+  FriBidiWidthBlockLevel1_1200,  /* 7EE00..7EFFF */
+  FriBidiWidthBlockLevel1_1200,  /* 7F000..7F1FF */
+  FriBidiWidthBlockLevel1_1200,  /* 7F200..7F3FF */
+  FriBidiWidthBlockLevel1_1200,  /* 7F400..7F5FF */
+  FriBidiWidthBlockLevel1_1200,  /* 7F600..7F7FF */
+  FriBidiWidthBlockLevel1_1200,  /* 7F800..7F9FF */
+  FriBidiWidthBlockLevel1_1200,  /* 7FA00..7FBFF */
+  FriBidiWidthBlockLevel1_1200,  /* 7FC00..7FDFF */
+  FriBidiWidthBlockLevel1_1200,  /* 7FE00..7FFFF */
+  FriBidiWidthBlockLevel1_1200,  /* 80000..801FF */
+  FriBidiWidthBlockLevel1_1200,  /* 80200..803FF */
+  FriBidiWidthBlockLevel1_1200,  /* 80400..805FF */
+  FriBidiWidthBlockLevel1_1200,  /* 80600..807FF */
+  FriBidiWidthBlockLevel1_1200,  /* 80800..809FF */
+  FriBidiWidthBlockLevel1_1200,  /* 80A00..80BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 80C00..80DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 80E00..80FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 81000..811FF */
+  FriBidiWidthBlockLevel1_1200,  /* 81200..813FF */
+  FriBidiWidthBlockLevel1_1200,  /* 81400..815FF */
+  FriBidiWidthBlockLevel1_1200,  /* 81600..817FF */
+  FriBidiWidthBlockLevel1_1200,  /* 81800..819FF */
+  FriBidiWidthBlockLevel1_1200,  /* 81A00..81BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 81C00..81DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 81E00..81FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 82000..821FF */
+  FriBidiWidthBlockLevel1_1200,  /* 82200..823FF */
+  FriBidiWidthBlockLevel1_1200,  /* 82400..825FF */
+  FriBidiWidthBlockLevel1_1200,  /* 82600..827FF */
+  FriBidiWidthBlockLevel1_1200,  /* 82800..829FF */
+  FriBidiWidthBlockLevel1_1200,  /* 82A00..82BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 82C00..82DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 82E00..82FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 83000..831FF */
+  FriBidiWidthBlockLevel1_1200,  /* 83200..833FF */
+  FriBidiWidthBlockLevel1_1200,  /* 83400..835FF */
+  FriBidiWidthBlockLevel1_1200,  /* 83600..837FF */
+  FriBidiWidthBlockLevel1_1200,  /* 83800..839FF */
+  FriBidiWidthBlockLevel1_1200,  /* 83A00..83BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 83C00..83DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 83E00..83FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 84000..841FF */
+  FriBidiWidthBlockLevel1_1200,  /* 84200..843FF */
+  FriBidiWidthBlockLevel1_1200,  /* 84400..845FF */
+  FriBidiWidthBlockLevel1_1200,  /* 84600..847FF */
+  FriBidiWidthBlockLevel1_1200,  /* 84800..849FF */
+  FriBidiWidthBlockLevel1_1200,  /* 84A00..84BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 84C00..84DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 84E00..84FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 85000..851FF */
+  FriBidiWidthBlockLevel1_1200,  /* 85200..853FF */
+  FriBidiWidthBlockLevel1_1200,  /* 85400..855FF */
+  FriBidiWidthBlockLevel1_1200,  /* 85600..857FF */
+  FriBidiWidthBlockLevel1_1200,  /* 85800..859FF */
+  FriBidiWidthBlockLevel1_1200,  /* 85A00..85BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 85C00..85DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 85E00..85FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 86000..861FF */
+  FriBidiWidthBlockLevel1_1200,  /* 86200..863FF */
+  FriBidiWidthBlockLevel1_1200,  /* 86400..865FF */
+  FriBidiWidthBlockLevel1_1200,  /* 86600..867FF */
+  FriBidiWidthBlockLevel1_1200,  /* 86800..869FF */
+  FriBidiWidthBlockLevel1_1200,  /* 86A00..86BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 86C00..86DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 86E00..86FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 87000..871FF */
+  FriBidiWidthBlockLevel1_1200,  /* 87200..873FF */
+  FriBidiWidthBlockLevel1_1200,  /* 87400..875FF */
+  FriBidiWidthBlockLevel1_1200,  /* 87600..877FF */
+  FriBidiWidthBlockLevel1_1200,  /* 87800..879FF */
+  FriBidiWidthBlockLevel1_1200,  /* 87A00..87BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 87C00..87DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 87E00..87FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 88000..881FF */
+  FriBidiWidthBlockLevel1_1200,  /* 88200..883FF */
+  FriBidiWidthBlockLevel1_1200,  /* 88400..885FF */
+  FriBidiWidthBlockLevel1_1200,  /* 88600..887FF */
+  FriBidiWidthBlockLevel1_1200,  /* 88800..889FF */
+  FriBidiWidthBlockLevel1_1200,  /* 88A00..88BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 88C00..88DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 88E00..88FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 89000..891FF */
+  FriBidiWidthBlockLevel1_1200,  /* 89200..893FF */
+  FriBidiWidthBlockLevel1_1200,  /* 89400..895FF */
+  FriBidiWidthBlockLevel1_1200,  /* 89600..897FF */
+  FriBidiWidthBlockLevel1_1200,  /* 89800..899FF */
+  FriBidiWidthBlockLevel1_1200,  /* 89A00..89BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 89C00..89DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 89E00..89FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 8A000..8A1FF */
+  FriBidiWidthBlockLevel1_1200,  /* 8A200..8A3FF */
+  FriBidiWidthBlockLevel1_1200,  /* 8A400..8A5FF */
+  FriBidiWidthBlockLevel1_1200,  /* 8A600..8A7FF */
+  FriBidiWidthBlockLevel1_1200,  /* 8A800..8A9FF */
+  FriBidiWidthBlockLevel1_1200,  /* 8AA00..8ABFF */
+  FriBidiWidthBlockLevel1_1200,  /* 8AC00..8ADFF */
+  FriBidiWidthBlockLevel1_1200,  /* 8AE00..8AFFF */
+  FriBidiWidthBlockLevel1_1200,  /* 8B000..8B1FF */
+  FriBidiWidthBlockLevel1_1200,  /* 8B200..8B3FF */
+  FriBidiWidthBlockLevel1_1200,  /* 8B400..8B5FF */
+  FriBidiWidthBlockLevel1_1200,  /* 8B600..8B7FF */
+  FriBidiWidthBlockLevel1_1200,  /* 8B800..8B9FF */
+  FriBidiWidthBlockLevel1_1200,  /* 8BA00..8BBFF */
+  FriBidiWidthBlockLevel1_1200,  /* 8BC00..8BDFF */
+  FriBidiWidthBlockLevel1_1200,  /* 8BE00..8BFFF */
+  FriBidiWidthBlockLevel1_1200,  /* 8C000..8C1FF */
+  FriBidiWidthBlockLevel1_1200,  /* 8C200..8C3FF */
+  FriBidiWidthBlockLevel1_1200,  /* 8C400..8C5FF */
+  FriBidiWidthBlockLevel1_1200,  /* 8C600..8C7FF */
+  FriBidiWidthBlockLevel1_1200,  /* 8C800..8C9FF */
+  FriBidiWidthBlockLevel1_1200,  /* 8CA00..8CBFF */
+  FriBidiWidthBlockLevel1_1200,  /* 8CC00..8CDFF */
+  FriBidiWidthBlockLevel1_1200,  /* 8CE00..8CFFF */
+  FriBidiWidthBlockLevel1_1200,  /* 8D000..8D1FF */
+  FriBidiWidthBlockLevel1_1200,  /* 8D200..8D3FF */
+  FriBidiWidthBlockLevel1_1200,  /* 8D400..8D5FF */
+  FriBidiWidthBlockLevel1_1200,  /* 8D600..8D7FF */
+  FriBidiWidthBlockLevel1_1200,  /* 8D800..8D9FF */
+  FriBidiWidthBlockLevel1_1200,  /* 8DA00..8DBFF */
+  FriBidiWidthBlockLevel1_1200,  /* 8DC00..8DDFF */
+  FriBidiWidthBlockLevel1_1200,  /* 8DE00..8DFFF */
+  FriBidiWidthBlockLevel1_1200,  /* 8E000..8E1FF */
+  FriBidiWidthBlockLevel1_1200,  /* 8E200..8E3FF */
+  FriBidiWidthBlockLevel1_1200,  /* 8E400..8E5FF */
+  FriBidiWidthBlockLevel1_1200,  /* 8E600..8E7FF */
+  FriBidiWidthBlockLevel1_1200,  /* 8E800..8E9FF */
+  FriBidiWidthBlockLevel1_1200,  /* 8EA00..8EBFF */
+  FriBidiWidthBlockLevel1_1200,  /* 8EC00..8EDFF */
+  FriBidiWidthBlockLevel1_1200,  /* 8EE00..8EFFF */
+  FriBidiWidthBlockLevel1_1200,  /* 8F000..8F1FF */
+  FriBidiWidthBlockLevel1_1200,  /* 8F200..8F3FF */
+  FriBidiWidthBlockLevel1_1200,  /* 8F400..8F5FF */
+  FriBidiWidthBlockLevel1_1200,  /* 8F600..8F7FF */
+  FriBidiWidthBlockLevel1_1200,  /* 8F800..8F9FF */
+  FriBidiWidthBlockLevel1_1200,  /* 8FA00..8FBFF */
+  FriBidiWidthBlockLevel1_1200,  /* 8FC00..8FDFF */
+  FriBidiWidthBlockLevel1_1200,  /* 8FE00..8FFFF */
+  FriBidiWidthBlockLevel1_1200,  /* 90000..901FF */
+  FriBidiWidthBlockLevel1_1200,  /* 90200..903FF */
+  FriBidiWidthBlockLevel1_1200,  /* 90400..905FF */
+  FriBidiWidthBlockLevel1_1200,  /* 90600..907FF */
+  FriBidiWidthBlockLevel1_1200,  /* 90800..909FF */
+  FriBidiWidthBlockLevel1_1200,  /* 90A00..90BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 90C00..90DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 90E00..90FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 91000..911FF */
+  FriBidiWidthBlockLevel1_1200,  /* 91200..913FF */
+  FriBidiWidthBlockLevel1_1200,  /* 91400..915FF */
+  FriBidiWidthBlockLevel1_1200,  /* 91600..917FF */
+  FriBidiWidthBlockLevel1_1200,  /* 91800..919FF */
+  FriBidiWidthBlockLevel1_1200,  /* 91A00..91BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 91C00..91DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 91E00..91FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 92000..921FF */
+  FriBidiWidthBlockLevel1_1200,  /* 92200..923FF */
+  FriBidiWidthBlockLevel1_1200,  /* 92400..925FF */
+  FriBidiWidthBlockLevel1_1200,  /* 92600..927FF */
+  FriBidiWidthBlockLevel1_1200,  /* 92800..929FF */
+  FriBidiWidthBlockLevel1_1200,  /* 92A00..92BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 92C00..92DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 92E00..92FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 93000..931FF */
+  FriBidiWidthBlockLevel1_1200,  /* 93200..933FF */
+  FriBidiWidthBlockLevel1_1200,  /* 93400..935FF */
+  FriBidiWidthBlockLevel1_1200,  /* 93600..937FF */
+  FriBidiWidthBlockLevel1_1200,  /* 93800..939FF */
+  FriBidiWidthBlockLevel1_1200,  /* 93A00..93BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 93C00..93DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 93E00..93FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 94000..941FF */
+  FriBidiWidthBlockLevel1_1200,  /* 94200..943FF */
+  FriBidiWidthBlockLevel1_1200,  /* 94400..945FF */
+  FriBidiWidthBlockLevel1_1200,  /* 94600..947FF */
+  FriBidiWidthBlockLevel1_1200,  /* 94800..949FF */
+  FriBidiWidthBlockLevel1_1200,  /* 94A00..94BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 94C00..94DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 94E00..94FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 95000..951FF */
+  FriBidiWidthBlockLevel1_1200,  /* 95200..953FF */
+  FriBidiWidthBlockLevel1_1200,  /* 95400..955FF */
+  FriBidiWidthBlockLevel1_1200,  /* 95600..957FF */
+  FriBidiWidthBlockLevel1_1200,  /* 95800..959FF */
+  FriBidiWidthBlockLevel1_1200,  /* 95A00..95BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 95C00..95DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 95E00..95FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 96000..961FF */
+  FriBidiWidthBlockLevel1_1200,  /* 96200..963FF */
+  FriBidiWidthBlockLevel1_1200,  /* 96400..965FF */
+  FriBidiWidthBlockLevel1_1200,  /* 96600..967FF */
+  FriBidiWidthBlockLevel1_1200,  /* 96800..969FF */
+  FriBidiWidthBlockLevel1_1200,  /* 96A00..96BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 96C00..96DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 96E00..96FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 97000..971FF */
+  FriBidiWidthBlockLevel1_1200,  /* 97200..973FF */
+  FriBidiWidthBlockLevel1_1200,  /* 97400..975FF */
+  FriBidiWidthBlockLevel1_1200,  /* 97600..977FF */
+  FriBidiWidthBlockLevel1_1200,  /* 97800..979FF */
+  FriBidiWidthBlockLevel1_1200,  /* 97A00..97BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 97C00..97DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 97E00..97FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 98000..981FF */
+  FriBidiWidthBlockLevel1_1200,  /* 98200..983FF */
+  FriBidiWidthBlockLevel1_1200,  /* 98400..985FF */
+  FriBidiWidthBlockLevel1_1200,  /* 98600..987FF */
+  FriBidiWidthBlockLevel1_1200,  /* 98800..989FF */
+  FriBidiWidthBlockLevel1_1200,  /* 98A00..98BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 98C00..98DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 98E00..98FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 99000..991FF */
+  FriBidiWidthBlockLevel1_1200,  /* 99200..993FF */
+  FriBidiWidthBlockLevel1_1200,  /* 99400..995FF */
+  FriBidiWidthBlockLevel1_1200,  /* 99600..997FF */
+  FriBidiWidthBlockLevel1_1200,  /* 99800..999FF */
+  FriBidiWidthBlockLevel1_1200,  /* 99A00..99BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 99C00..99DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 99E00..99FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 9A000..9A1FF */
+  FriBidiWidthBlockLevel1_1200,  /* 9A200..9A3FF */
+  FriBidiWidthBlockLevel1_1200,  /* 9A400..9A5FF */
+  FriBidiWidthBlockLevel1_1200,  /* 9A600..9A7FF */
+  FriBidiWidthBlockLevel1_1200,  /* 9A800..9A9FF */
+  FriBidiWidthBlockLevel1_1200,  /* 9AA00..9ABFF */
+  FriBidiWidthBlockLevel1_1200,  /* 9AC00..9ADFF */
+  FriBidiWidthBlockLevel1_1200,  /* 9AE00..9AFFF */
+  FriBidiWidthBlockLevel1_1200,  /* 9B000..9B1FF */
+  FriBidiWidthBlockLevel1_1200,  /* 9B200..9B3FF */
+  FriBidiWidthBlockLevel1_1200,  /* 9B400..9B5FF */
+  FriBidiWidthBlockLevel1_1200,  /* 9B600..9B7FF */
+  FriBidiWidthBlockLevel1_1200,  /* 9B800..9B9FF */
+  FriBidiWidthBlockLevel1_1200,  /* 9BA00..9BBFF */
+  FriBidiWidthBlockLevel1_1200,  /* 9BC00..9BDFF */
+  FriBidiWidthBlockLevel1_1200,  /* 9BE00..9BFFF */
+  FriBidiWidthBlockLevel1_1200,  /* 9C000..9C1FF */
+  FriBidiWidthBlockLevel1_1200,  /* 9C200..9C3FF */
+  FriBidiWidthBlockLevel1_1200,  /* 9C400..9C5FF */
+  FriBidiWidthBlockLevel1_1200,  /* 9C600..9C7FF */
+  FriBidiWidthBlockLevel1_1200,  /* 9C800..9C9FF */
+  FriBidiWidthBlockLevel1_1200,  /* 9CA00..9CBFF */
+  FriBidiWidthBlockLevel1_1200,  /* 9CC00..9CDFF */
+  FriBidiWidthBlockLevel1_1200,  /* 9CE00..9CFFF */
+  FriBidiWidthBlockLevel1_1200,  /* 9D000..9D1FF */
+  FriBidiWidthBlockLevel1_1200,  /* 9D200..9D3FF */
+  FriBidiWidthBlockLevel1_1200,  /* 9D400..9D5FF */
+  FriBidiWidthBlockLevel1_1200,  /* 9D600..9D7FF */
+  FriBidiWidthBlockLevel1_1200,  /* 9D800..9D9FF */
+  FriBidiWidthBlockLevel1_1200,  /* 9DA00..9DBFF */
+  FriBidiWidthBlockLevel1_1200,  /* 9DC00..9DDFF */
+  FriBidiWidthBlockLevel1_1200,  /* 9DE00..9DFFF */
+  FriBidiWidthBlockLevel1_1200,  /* 9E000..9E1FF */
+  FriBidiWidthBlockLevel1_1200,  /* 9E200..9E3FF */
+  FriBidiWidthBlockLevel1_1200,  /* 9E400..9E5FF */
+  FriBidiWidthBlockLevel1_1200,  /* 9E600..9E7FF */
+  FriBidiWidthBlockLevel1_1200,  /* 9E800..9E9FF */
+  FriBidiWidthBlockLevel1_1200,  /* 9EA00..9EBFF */
+  FriBidiWidthBlockLevel1_1200,  /* 9EC00..9EDFF */
+  FriBidiWidthBlockLevel1_1200,  /* 9EE00..9EFFF */
+  FriBidiWidthBlockLevel1_1200,  /* 9F000..9F1FF */
+  FriBidiWidthBlockLevel1_1200,  /* 9F200..9F3FF */
+  FriBidiWidthBlockLevel1_1200,  /* 9F400..9F5FF */
+  FriBidiWidthBlockLevel1_1200,  /* 9F600..9F7FF */
+  FriBidiWidthBlockLevel1_1200,  /* 9F800..9F9FF */
+  FriBidiWidthBlockLevel1_1200,  /* 9FA00..9FBFF */
+  FriBidiWidthBlockLevel1_1200,  /* 9FC00..9FDFF */
+  FriBidiWidthBlockLevel1_1200,  /* 9FE00..9FFFF */
+  FriBidiWidthBlockLevel1_1200,  /* A0000..A01FF */
+  FriBidiWidthBlockLevel1_1200,  /* A0200..A03FF */
+  FriBidiWidthBlockLevel1_1200,  /* A0400..A05FF */
+  FriBidiWidthBlockLevel1_1200,  /* A0600..A07FF */
+  FriBidiWidthBlockLevel1_1200,  /* A0800..A09FF */
+  FriBidiWidthBlockLevel1_1200,  /* A0A00..A0BFF */
+  FriBidiWidthBlockLevel1_1200,  /* A0C00..A0DFF */
+  FriBidiWidthBlockLevel1_1200,  /* A0E00..A0FFF */
+  FriBidiWidthBlockLevel1_1200,  /* A1000..A11FF */
+  FriBidiWidthBlockLevel1_1200,  /* A1200..A13FF */
+  FriBidiWidthBlockLevel1_1200,  /* A1400..A15FF */
+  FriBidiWidthBlockLevel1_1200,  /* A1600..A17FF */
+  FriBidiWidthBlockLevel1_1200,  /* A1800..A19FF */
+  FriBidiWidthBlockLevel1_1200,  /* A1A00..A1BFF */
+  FriBidiWidthBlockLevel1_1200,  /* A1C00..A1DFF */
+  FriBidiWidthBlockLevel1_1200,  /* A1E00..A1FFF */
+  FriBidiWidthBlockLevel1_1200,  /* A2000..A21FF */
+  FriBidiWidthBlockLevel1_1200,  /* A2200..A23FF */
+  FriBidiWidthBlockLevel1_1200,  /* A2400..A25FF */
+  FriBidiWidthBlockLevel1_1200,  /* A2600..A27FF */
+  FriBidiWidthBlockLevel1_1200,  /* A2800..A29FF */
+  FriBidiWidthBlockLevel1_1200,  /* A2A00..A2BFF */
+  FriBidiWidthBlockLevel1_1200,  /* A2C00..A2DFF */
+  FriBidiWidthBlockLevel1_1200,  /* A2E00..A2FFF */
+  FriBidiWidthBlockLevel1_1200,  /* A3000..A31FF */
+  FriBidiWidthBlockLevel1_1200,  /* A3200..A33FF */
+  FriBidiWidthBlockLevel1_1200,  /* A3400..A35FF */
+  FriBidiWidthBlockLevel1_1200,  /* A3600..A37FF */
+  FriBidiWidthBlockLevel1_1200,  /* A3800..A39FF */
+  FriBidiWidthBlockLevel1_1200,  /* A3A00..A3BFF */
+  FriBidiWidthBlockLevel1_1200,  /* A3C00..A3DFF */
+  FriBidiWidthBlockLevel1_1200,  /* A3E00..A3FFF */
+  FriBidiWidthBlockLevel1_1200,  /* A4000..A41FF */
+  FriBidiWidthBlockLevel1_1200,  /* A4200..A43FF */
+  FriBidiWidthBlockLevel1_1200,  /* A4400..A45FF */
+  FriBidiWidthBlockLevel1_1200,  /* A4600..A47FF */
+  FriBidiWidthBlockLevel1_1200,  /* A4800..A49FF */
+  FriBidiWidthBlockLevel1_1200,  /* A4A00..A4BFF */
+  FriBidiWidthBlockLevel1_1200,  /* A4C00..A4DFF */
+  FriBidiWidthBlockLevel1_1200,  /* A4E00..A4FFF */
+  FriBidiWidthBlockLevel1_1200,  /* A5000..A51FF */
+  FriBidiWidthBlockLevel1_1200,  /* A5200..A53FF */
+  FriBidiWidthBlockLevel1_1200,  /* A5400..A55FF */
+  FriBidiWidthBlockLevel1_1200,  /* A5600..A57FF */
+  FriBidiWidthBlockLevel1_1200,  /* A5800..A59FF */
+  FriBidiWidthBlockLevel1_1200,  /* A5A00..A5BFF */
+  FriBidiWidthBlockLevel1_1200,  /* A5C00..A5DFF */
+  FriBidiWidthBlockLevel1_1200,  /* A5E00..A5FFF */
+  FriBidiWidthBlockLevel1_1200,  /* A6000..A61FF */
+  FriBidiWidthBlockLevel1_1200,  /* A6200..A63FF */
+  FriBidiWidthBlockLevel1_1200,  /* A6400..A65FF */
+  FriBidiWidthBlockLevel1_1200,  /* A6600..A67FF */
+  FriBidiWidthBlockLevel1_1200,  /* A6800..A69FF */
+  FriBidiWidthBlockLevel1_1200,  /* A6A00..A6BFF */
+  FriBidiWidthBlockLevel1_1200,  /* A6C00..A6DFF */
+  FriBidiWidthBlockLevel1_1200,  /* A6E00..A6FFF */
+  FriBidiWidthBlockLevel1_1200,  /* A7000..A71FF */
+  FriBidiWidthBlockLevel1_1200,  /* A7200..A73FF */
+  FriBidiWidthBlockLevel1_1200,  /* A7400..A75FF */
+  FriBidiWidthBlockLevel1_1200,  /* A7600..A77FF */
+  FriBidiWidthBlockLevel1_1200,  /* A7800..A79FF */
+  FriBidiWidthBlockLevel1_1200,  /* A7A00..A7BFF */
+  FriBidiWidthBlockLevel1_1200,  /* A7C00..A7DFF */
+  FriBidiWidthBlockLevel1_1200,  /* A7E00..A7FFF */
+  FriBidiWidthBlockLevel1_1200,  /* A8000..A81FF */
+  FriBidiWidthBlockLevel1_1200,  /* A8200..A83FF */
+  FriBidiWidthBlockLevel1_1200,  /* A8400..A85FF */
+  FriBidiWidthBlockLevel1_1200,  /* A8600..A87FF */
+  FriBidiWidthBlockLevel1_1200,  /* A8800..A89FF */
+  FriBidiWidthBlockLevel1_1200,  /* A8A00..A8BFF */
+  FriBidiWidthBlockLevel1_1200,  /* A8C00..A8DFF */
+  FriBidiWidthBlockLevel1_1200,  /* A8E00..A8FFF */
+  FriBidiWidthBlockLevel1_1200,  /* A9000..A91FF */
+  FriBidiWidthBlockLevel1_1200,  /* A9200..A93FF */
+  FriBidiWidthBlockLevel1_1200,  /* A9400..A95FF */
+  FriBidiWidthBlockLevel1_1200,  /* A9600..A97FF */
+  FriBidiWidthBlockLevel1_1200,  /* A9800..A99FF */
+  FriBidiWidthBlockLevel1_1200,  /* A9A00..A9BFF */
+  FriBidiWidthBlockLevel1_1200,  /* A9C00..A9DFF */
+  FriBidiWidthBlockLevel1_1200,  /* A9E00..A9FFF */
+  FriBidiWidthBlockLevel1_1200,  /* AA000..AA1FF */
+  FriBidiWidthBlockLevel1_1200,  /* AA200..AA3FF */
+  FriBidiWidthBlockLevel1_1200,  /* AA400..AA5FF */
+  FriBidiWidthBlockLevel1_1200,  /* AA600..AA7FF */
+  FriBidiWidthBlockLevel1_1200,  /* AA800..AA9FF */
+  FriBidiWidthBlockLevel1_1200,  /* AAA00..AABFF */
+  FriBidiWidthBlockLevel1_1200,  /* AAC00..AADFF */
+  FriBidiWidthBlockLevel1_1200,  /* AAE00..AAFFF */
+  FriBidiWidthBlockLevel1_1200,  /* AB000..AB1FF */
+  FriBidiWidthBlockLevel1_1200,  /* AB200..AB3FF */
+  FriBidiWidthBlockLevel1_1200,  /* AB400..AB5FF */
+  FriBidiWidthBlockLevel1_1200,  /* AB600..AB7FF */
+  FriBidiWidthBlockLevel1_1200,  /* AB800..AB9FF */
+  FriBidiWidthBlockLevel1_1200,  /* ABA00..ABBFF */
+  FriBidiWidthBlockLevel1_1200,  /* ABC00..ABDFF */
+  FriBidiWidthBlockLevel1_1200,  /* ABE00..ABFFF */
+  FriBidiWidthBlockLevel1_1200,  /* AC000..AC1FF */
+  FriBidiWidthBlockLevel1_1200,  /* AC200..AC3FF */
+  FriBidiWidthBlockLevel1_1200,  /* AC400..AC5FF */
+  FriBidiWidthBlockLevel1_1200,  /* AC600..AC7FF */
+  FriBidiWidthBlockLevel1_1200,  /* AC800..AC9FF */
+  FriBidiWidthBlockLevel1_1200,  /* ACA00..ACBFF */
+  FriBidiWidthBlockLevel1_1200,  /* ACC00..ACDFF */
+  FriBidiWidthBlockLevel1_1200,  /* ACE00..ACFFF */
+  FriBidiWidthBlockLevel1_1200,  /* AD000..AD1FF */
+  FriBidiWidthBlockLevel1_1200,  /* AD200..AD3FF */
+  FriBidiWidthBlockLevel1_1200,  /* AD400..AD5FF */
+  FriBidiWidthBlockLevel1_1200,  /* AD600..AD7FF */
+  FriBidiWidthBlockLevel1_1200,  /* AD800..AD9FF */
+  FriBidiWidthBlockLevel1_1200,  /* ADA00..ADBFF */
+  FriBidiWidthBlockLevel1_1200,  /* ADC00..ADDFF */
+  FriBidiWidthBlockLevel1_1200,  /* ADE00..ADFFF */
+  FriBidiWidthBlockLevel1_1200,  /* AE000..AE1FF */
+  FriBidiWidthBlockLevel1_1200,  /* AE200..AE3FF */
+  FriBidiWidthBlockLevel1_1200,  /* AE400..AE5FF */
+  FriBidiWidthBlockLevel1_1200,  /* AE600..AE7FF */
+  FriBidiWidthBlockLevel1_1200,  /* AE800..AE9FF */
+  FriBidiWidthBlockLevel1_1200,  /* AEA00..AEBFF */
+  FriBidiWidthBlockLevel1_1200,  /* AEC00..AEDFF */
+  FriBidiWidthBlockLevel1_1200,  /* AEE00..AEFFF */
+  FriBidiWidthBlockLevel1_1200,  /* AF000..AF1FF */
+  FriBidiWidthBlockLevel1_1200,  /* AF200..AF3FF */
+  FriBidiWidthBlockLevel1_1200,  /* AF400..AF5FF */
+  FriBidiWidthBlockLevel1_1200,  /* AF600..AF7FF */
+  FriBidiWidthBlockLevel1_1200,  /* AF800..AF9FF */
+  FriBidiWidthBlockLevel1_1200,  /* AFA00..AFBFF */
+  FriBidiWidthBlockLevel1_1200,  /* AFC00..AFDFF */
+  FriBidiWidthBlockLevel1_1200,  /* AFE00..AFFFF */
+  FriBidiWidthBlockLevel1_1200,  /* B0000..B01FF */
+  FriBidiWidthBlockLevel1_1200,  /* B0200..B03FF */
+  FriBidiWidthBlockLevel1_1200,  /* B0400..B05FF */
+  FriBidiWidthBlockLevel1_1200,  /* B0600..B07FF */
+  FriBidiWidthBlockLevel1_1200,  /* B0800..B09FF */
+  FriBidiWidthBlockLevel1_1200,  /* B0A00..B0BFF */
+  FriBidiWidthBlockLevel1_1200,  /* B0C00..B0DFF */
+  FriBidiWidthBlockLevel1_1200,  /* B0E00..B0FFF */
+  FriBidiWidthBlockLevel1_1200,  /* B1000..B11FF */
+  FriBidiWidthBlockLevel1_1200,  /* B1200..B13FF */
+  FriBidiWidthBlockLevel1_1200,  /* B1400..B15FF */
+  FriBidiWidthBlockLevel1_1200,  /* B1600..B17FF */
+  FriBidiWidthBlockLevel1_1200,  /* B1800..B19FF */
+  FriBidiWidthBlockLevel1_1200,  /* B1A00..B1BFF */
+  FriBidiWidthBlockLevel1_1200,  /* B1C00..B1DFF */
+  FriBidiWidthBlockLevel1_1200,  /* B1E00..B1FFF */
+  FriBidiWidthBlockLevel1_1200,  /* B2000..B21FF */
+  FriBidiWidthBlockLevel1_1200,  /* B2200..B23FF */
+  FriBidiWidthBlockLevel1_1200,  /* B2400..B25FF */
+  FriBidiWidthBlockLevel1_1200,  /* B2600..B27FF */
+  FriBidiWidthBlockLevel1_1200,  /* B2800..B29FF */
+  FriBidiWidthBlockLevel1_1200,  /* B2A00..B2BFF */
+  FriBidiWidthBlockLevel1_1200,  /* B2C00..B2DFF */
+  FriBidiWidthBlockLevel1_1200,  /* B2E00..B2FFF */
+  FriBidiWidthBlockLevel1_1200,  /* B3000..B31FF */
+  FriBidiWidthBlockLevel1_1200,  /* B3200..B33FF */
+  FriBidiWidthBlockLevel1_1200,  /* B3400..B35FF */
+  FriBidiWidthBlockLevel1_1200,  /* B3600..B37FF */
+  FriBidiWidthBlockLevel1_1200,  /* B3800..B39FF */
+  FriBidiWidthBlockLevel1_1200,  /* B3A00..B3BFF */
+  FriBidiWidthBlockLevel1_1200,  /* B3C00..B3DFF */
+  FriBidiWidthBlockLevel1_1200,  /* B3E00..B3FFF */
+  FriBidiWidthBlockLevel1_1200,  /* B4000..B41FF */
+  FriBidiWidthBlockLevel1_1200,  /* B4200..B43FF */
+  FriBidiWidthBlockLevel1_1200,  /* B4400..B45FF */
+  FriBidiWidthBlockLevel1_1200,  /* B4600..B47FF */
+  FriBidiWidthBlockLevel1_1200,  /* B4800..B49FF */
+  FriBidiWidthBlockLevel1_1200,  /* B4A00..B4BFF */
+  FriBidiWidthBlockLevel1_1200,  /* B4C00..B4DFF */
+  FriBidiWidthBlockLevel1_1200,  /* B4E00..B4FFF */
+  FriBidiWidthBlockLevel1_1200,  /* B5000..B51FF */
+  FriBidiWidthBlockLevel1_1200,  /* B5200..B53FF */
+  FriBidiWidthBlockLevel1_1200,  /* B5400..B55FF */
+  FriBidiWidthBlockLevel1_1200,  /* B5600..B57FF */
+  FriBidiWidthBlockLevel1_1200,  /* B5800..B59FF */
+  FriBidiWidthBlockLevel1_1200,  /* B5A00..B5BFF */
+  FriBidiWidthBlockLevel1_1200,  /* B5C00..B5DFF */
+  FriBidiWidthBlockLevel1_1200,  /* B5E00..B5FFF */
+  FriBidiWidthBlockLevel1_1200,  /* B6000..B61FF */
+  FriBidiWidthBlockLevel1_1200,  /* B6200..B63FF */
+  FriBidiWidthBlockLevel1_1200,  /* B6400..B65FF */
+  FriBidiWidthBlockLevel1_1200,  /* B6600..B67FF */
+  FriBidiWidthBlockLevel1_1200,  /* B6800..B69FF */
+  FriBidiWidthBlockLevel1_1200,  /* B6A00..B6BFF */
+  FriBidiWidthBlockLevel1_1200,  /* B6C00..B6DFF */
+  FriBidiWidthBlockLevel1_1200,  /* B6E00..B6FFF */
+  FriBidiWidthBlockLevel1_1200,  /* B7000..B71FF */
+  FriBidiWidthBlockLevel1_1200,  /* B7200..B73FF */
+  FriBidiWidthBlockLevel1_1200,  /* B7400..B75FF */
+  FriBidiWidthBlockLevel1_1200,  /* B7600..B77FF */
+  FriBidiWidthBlockLevel1_1200,  /* B7800..B79FF */
+  FriBidiWidthBlockLevel1_1200,  /* B7A00..B7BFF */
+  FriBidiWidthBlockLevel1_1200,  /* B7C00..B7DFF */
+  FriBidiWidthBlockLevel1_1200,  /* B7E00..B7FFF */
+  FriBidiWidthBlockLevel1_1200,  /* B8000..B81FF */
+  FriBidiWidthBlockLevel1_1200,  /* B8200..B83FF */
+  FriBidiWidthBlockLevel1_1200,  /* B8400..B85FF */
+  FriBidiWidthBlockLevel1_1200,  /* B8600..B87FF */
+  FriBidiWidthBlockLevel1_1200,  /* B8800..B89FF */
+  FriBidiWidthBlockLevel1_1200,  /* B8A00..B8BFF */
+  FriBidiWidthBlockLevel1_1200,  /* B8C00..B8DFF */
+  FriBidiWidthBlockLevel1_1200,  /* B8E00..B8FFF */
+  FriBidiWidthBlockLevel1_1200,  /* B9000..B91FF */
+  FriBidiWidthBlockLevel1_1200,  /* B9200..B93FF */
+  FriBidiWidthBlockLevel1_1200,  /* B9400..B95FF */
+  FriBidiWidthBlockLevel1_1200,  /* B9600..B97FF */
+  FriBidiWidthBlockLevel1_1200,  /* B9800..B99FF */
+  FriBidiWidthBlockLevel1_1200,  /* B9A00..B9BFF */
+  FriBidiWidthBlockLevel1_1200,  /* B9C00..B9DFF */
+  FriBidiWidthBlockLevel1_1200,  /* B9E00..B9FFF */
+  FriBidiWidthBlockLevel1_1200,  /* BA000..BA1FF */
+  FriBidiWidthBlockLevel1_1200,  /* BA200..BA3FF */
+  FriBidiWidthBlockLevel1_1200,  /* BA400..BA5FF */
+  FriBidiWidthBlockLevel1_1200,  /* BA600..BA7FF */
+  FriBidiWidthBlockLevel1_1200,  /* BA800..BA9FF */
+  FriBidiWidthBlockLevel1_1200,  /* BAA00..BABFF */
+  FriBidiWidthBlockLevel1_1200,  /* BAC00..BADFF */
+  FriBidiWidthBlockLevel1_1200,  /* BAE00..BAFFF */
+  FriBidiWidthBlockLevel1_1200,  /* BB000..BB1FF */
+  FriBidiWidthBlockLevel1_1200,  /* BB200..BB3FF */
+  FriBidiWidthBlockLevel1_1200,  /* BB400..BB5FF */
+  FriBidiWidthBlockLevel1_1200,  /* BB600..BB7FF */
+  FriBidiWidthBlockLevel1_1200,  /* BB800..BB9FF */
+  FriBidiWidthBlockLevel1_1200,  /* BBA00..BBBFF */
+  FriBidiWidthBlockLevel1_1200,  /* BBC00..BBDFF */
+  FriBidiWidthBlockLevel1_1200,  /* BBE00..BBFFF */
+  FriBidiWidthBlockLevel1_1200,  /* BC000..BC1FF */
+  FriBidiWidthBlockLevel1_1200,  /* BC200..BC3FF */
+  FriBidiWidthBlockLevel1_1200,  /* BC400..BC5FF */
+  FriBidiWidthBlockLevel1_1200,  /* BC600..BC7FF */
+  FriBidiWidthBlockLevel1_1200,  /* BC800..BC9FF */
+  FriBidiWidthBlockLevel1_1200,  /* BCA00..BCBFF */
+  FriBidiWidthBlockLevel1_1200,  /* BCC00..BCDFF */
+  FriBidiWidthBlockLevel1_1200,  /* BCE00..BCFFF */
+  FriBidiWidthBlockLevel1_1200,  /* BD000..BD1FF */
+  FriBidiWidthBlockLevel1_1200,  /* BD200..BD3FF */
+  FriBidiWidthBlockLevel1_1200,  /* BD400..BD5FF */
+  FriBidiWidthBlockLevel1_1200,  /* BD600..BD7FF */
+  FriBidiWidthBlockLevel1_1200,  /* BD800..BD9FF */
+  FriBidiWidthBlockLevel1_1200,  /* BDA00..BDBFF */
+  FriBidiWidthBlockLevel1_1200,  /* BDC00..BDDFF */
+  FriBidiWidthBlockLevel1_1200,  /* BDE00..BDFFF */
+  FriBidiWidthBlockLevel1_1200,  /* BE000..BE1FF */
+  FriBidiWidthBlockLevel1_1200,  /* BE200..BE3FF */
+  FriBidiWidthBlockLevel1_1200,  /* BE400..BE5FF */
+  FriBidiWidthBlockLevel1_1200,  /* BE600..BE7FF */
+  FriBidiWidthBlockLevel1_1200,  /* BE800..BE9FF */
+  FriBidiWidthBlockLevel1_1200,  /* BEA00..BEBFF */
+  FriBidiWidthBlockLevel1_1200,  /* BEC00..BEDFF */
+  FriBidiWidthBlockLevel1_1200,  /* BEE00..BEFFF */
+  FriBidiWidthBlockLevel1_1200,  /* BF000..BF1FF */
+  FriBidiWidthBlockLevel1_1200,  /* BF200..BF3FF */
+  FriBidiWidthBlockLevel1_1200,  /* BF400..BF5FF */
+  FriBidiWidthBlockLevel1_1200,  /* BF600..BF7FF */
+  FriBidiWidthBlockLevel1_1200,  /* BF800..BF9FF */
+  FriBidiWidthBlockLevel1_1200,  /* BFA00..BFBFF */
+  FriBidiWidthBlockLevel1_1200,  /* BFC00..BFDFF */
+  FriBidiWidthBlockLevel1_1200,  /* BFE00..BFFFF */
+  FriBidiWidthBlockLevel1_1200,  /* C0000..C01FF */
+  FriBidiWidthBlockLevel1_1200,  /* C0200..C03FF */
+  FriBidiWidthBlockLevel1_1200,  /* C0400..C05FF */
+  FriBidiWidthBlockLevel1_1200,  /* C0600..C07FF */
+  FriBidiWidthBlockLevel1_1200,  /* C0800..C09FF */
+  FriBidiWidthBlockLevel1_1200,  /* C0A00..C0BFF */
+  FriBidiWidthBlockLevel1_1200,  /* C0C00..C0DFF */
+  FriBidiWidthBlockLevel1_1200,  /* C0E00..C0FFF */
+  FriBidiWidthBlockLevel1_1200,  /* C1000..C11FF */
+  FriBidiWidthBlockLevel1_1200,  /* C1200..C13FF */
+  FriBidiWidthBlockLevel1_1200,  /* C1400..C15FF */
+  FriBidiWidthBlockLevel1_1200,  /* C1600..C17FF */
+  FriBidiWidthBlockLevel1_1200,  /* C1800..C19FF */
+  FriBidiWidthBlockLevel1_1200,  /* C1A00..C1BFF */
+  FriBidiWidthBlockLevel1_1200,  /* C1C00..C1DFF */
+  FriBidiWidthBlockLevel1_1200,  /* C1E00..C1FFF */
+  FriBidiWidthBlockLevel1_1200,  /* C2000..C21FF */
+  FriBidiWidthBlockLevel1_1200,  /* C2200..C23FF */
+  FriBidiWidthBlockLevel1_1200,  /* C2400..C25FF */
+  FriBidiWidthBlockLevel1_1200,  /* C2600..C27FF */
+  FriBidiWidthBlockLevel1_1200,  /* C2800..C29FF */
+  FriBidiWidthBlockLevel1_1200,  /* C2A00..C2BFF */
+  FriBidiWidthBlockLevel1_1200,  /* C2C00..C2DFF */
+  FriBidiWidthBlockLevel1_1200,  /* C2E00..C2FFF */
+  FriBidiWidthBlockLevel1_1200,  /* C3000..C31FF */
+  FriBidiWidthBlockLevel1_1200,  /* C3200..C33FF */
+  FriBidiWidthBlockLevel1_1200,  /* C3400..C35FF */
+  FriBidiWidthBlockLevel1_1200,  /* C3600..C37FF */
+  FriBidiWidthBlockLevel1_1200,  /* C3800..C39FF */
+  FriBidiWidthBlockLevel1_1200,  /* C3A00..C3BFF */
+  FriBidiWidthBlockLevel1_1200,  /* C3C00..C3DFF */
+  FriBidiWidthBlockLevel1_1200,  /* C3E00..C3FFF */
+  FriBidiWidthBlockLevel1_1200,  /* C4000..C41FF */
+  FriBidiWidthBlockLevel1_1200,  /* C4200..C43FF */
+  FriBidiWidthBlockLevel1_1200,  /* C4400..C45FF */
+  FriBidiWidthBlockLevel1_1200,  /* C4600..C47FF */
+  FriBidiWidthBlockLevel1_1200,  /* C4800..C49FF */
+  FriBidiWidthBlockLevel1_1200,  /* C4A00..C4BFF */
+  FriBidiWidthBlockLevel1_1200,  /* C4C00..C4DFF */
+  FriBidiWidthBlockLevel1_1200,  /* C4E00..C4FFF */
+  FriBidiWidthBlockLevel1_1200,  /* C5000..C51FF */
+  FriBidiWidthBlockLevel1_1200,  /* C5200..C53FF */
+  FriBidiWidthBlockLevel1_1200,  /* C5400..C55FF */
+  FriBidiWidthBlockLevel1_1200,  /* C5600..C57FF */
+  FriBidiWidthBlockLevel1_1200,  /* C5800..C59FF */
+  FriBidiWidthBlockLevel1_1200,  /* C5A00..C5BFF */
+  FriBidiWidthBlockLevel1_1200,  /* C5C00..C5DFF */
+  FriBidiWidthBlockLevel1_1200,  /* C5E00..C5FFF */
+  FriBidiWidthBlockLevel1_1200,  /* C6000..C61FF */
+  FriBidiWidthBlockLevel1_1200,  /* C6200..C63FF */
+  FriBidiWidthBlockLevel1_1200,  /* C6400..C65FF */
+  FriBidiWidthBlockLevel1_1200,  /* C6600..C67FF */
+  FriBidiWidthBlockLevel1_1200,  /* C6800..C69FF */
+  FriBidiWidthBlockLevel1_1200,  /* C6A00..C6BFF */
+  FriBidiWidthBlockLevel1_1200,  /* C6C00..C6DFF */
+  FriBidiWidthBlockLevel1_1200,  /* C6E00..C6FFF */
+  FriBidiWidthBlockLevel1_1200,  /* C7000..C71FF */
+  FriBidiWidthBlockLevel1_1200,  /* C7200..C73FF */
+  FriBidiWidthBlockLevel1_1200,  /* C7400..C75FF */
+  FriBidiWidthBlockLevel1_1200,  /* C7600..C77FF */
+  FriBidiWidthBlockLevel1_1200,  /* C7800..C79FF */
+  FriBidiWidthBlockLevel1_1200,  /* C7A00..C7BFF */
+  FriBidiWidthBlockLevel1_1200,  /* C7C00..C7DFF */
+  FriBidiWidthBlockLevel1_1200,  /* C7E00..C7FFF */
+  FriBidiWidthBlockLevel1_1200,  /* C8000..C81FF */
+  FriBidiWidthBlockLevel1_1200,  /* C8200..C83FF */
+  FriBidiWidthBlockLevel1_1200,  /* C8400..C85FF */
+  FriBidiWidthBlockLevel1_1200,  /* C8600..C87FF */
+  FriBidiWidthBlockLevel1_1200,  /* C8800..C89FF */
+  FriBidiWidthBlockLevel1_1200,  /* C8A00..C8BFF */
+  FriBidiWidthBlockLevel1_1200,  /* C8C00..C8DFF */
+  FriBidiWidthBlockLevel1_1200,  /* C8E00..C8FFF */
+  FriBidiWidthBlockLevel1_1200,  /* C9000..C91FF */
+  FriBidiWidthBlockLevel1_1200,  /* C9200..C93FF */
+  FriBidiWidthBlockLevel1_1200,  /* C9400..C95FF */
+  FriBidiWidthBlockLevel1_1200,  /* C9600..C97FF */
+  FriBidiWidthBlockLevel1_1200,  /* C9800..C99FF */
+  FriBidiWidthBlockLevel1_1200,  /* C9A00..C9BFF */
+  FriBidiWidthBlockLevel1_1200,  /* C9C00..C9DFF */
+  FriBidiWidthBlockLevel1_1200,  /* C9E00..C9FFF */
+  FriBidiWidthBlockLevel1_1200,  /* CA000..CA1FF */
+  FriBidiWidthBlockLevel1_1200,  /* CA200..CA3FF */
+  FriBidiWidthBlockLevel1_1200,  /* CA400..CA5FF */
+  FriBidiWidthBlockLevel1_1200,  /* CA600..CA7FF */
+  FriBidiWidthBlockLevel1_1200,  /* CA800..CA9FF */
+  FriBidiWidthBlockLevel1_1200,  /* CAA00..CABFF */
+  FriBidiWidthBlockLevel1_1200,  /* CAC00..CADFF */
+  FriBidiWidthBlockLevel1_1200,  /* CAE00..CAFFF */
+  FriBidiWidthBlockLevel1_1200,  /* CB000..CB1FF */
+  FriBidiWidthBlockLevel1_1200,  /* CB200..CB3FF */
+  FriBidiWidthBlockLevel1_1200,  /* CB400..CB5FF */
+  FriBidiWidthBlockLevel1_1200,  /* CB600..CB7FF */
+  FriBidiWidthBlockLevel1_1200,  /* CB800..CB9FF */
+  FriBidiWidthBlockLevel1_1200,  /* CBA00..CBBFF */
+  FriBidiWidthBlockLevel1_1200,  /* CBC00..CBDFF */
+  FriBidiWidthBlockLevel1_1200,  /* CBE00..CBFFF */
+  FriBidiWidthBlockLevel1_1200,  /* CC000..CC1FF */
+  FriBidiWidthBlockLevel1_1200,  /* CC200..CC3FF */
+  FriBidiWidthBlockLevel1_1200,  /* CC400..CC5FF */
+  FriBidiWidthBlockLevel1_1200,  /* CC600..CC7FF */
+  FriBidiWidthBlockLevel1_1200,  /* CC800..CC9FF */
+  FriBidiWidthBlockLevel1_1200,  /* CCA00..CCBFF */
+  FriBidiWidthBlockLevel1_1200,  /* CCC00..CCDFF */
+  FriBidiWidthBlockLevel1_1200,  /* CCE00..CCFFF */
+  FriBidiWidthBlockLevel1_1200,  /* CD000..CD1FF */
+  FriBidiWidthBlockLevel1_1200,  /* CD200..CD3FF */
+  FriBidiWidthBlockLevel1_1200,  /* CD400..CD5FF */
+  FriBidiWidthBlockLevel1_1200,  /* CD600..CD7FF */
+  FriBidiWidthBlockLevel1_1200,  /* CD800..CD9FF */
+  FriBidiWidthBlockLevel1_1200,  /* CDA00..CDBFF */
+  FriBidiWidthBlockLevel1_1200,  /* CDC00..CDDFF */
+  FriBidiWidthBlockLevel1_1200,  /* CDE00..CDFFF */
+  FriBidiWidthBlockLevel1_1200,  /* CE000..CE1FF */
+  FriBidiWidthBlockLevel1_1200,  /* CE200..CE3FF */
+  FriBidiWidthBlockLevel1_1200,  /* CE400..CE5FF */
+  FriBidiWidthBlockLevel1_1200,  /* CE600..CE7FF */
+  FriBidiWidthBlockLevel1_1200,  /* CE800..CE9FF */
+  FriBidiWidthBlockLevel1_1200,  /* CEA00..CEBFF */
+  FriBidiWidthBlockLevel1_1200,  /* CEC00..CEDFF */
+  FriBidiWidthBlockLevel1_1200,  /* CEE00..CEFFF */
+  FriBidiWidthBlockLevel1_1200,  /* CF000..CF1FF */
+  FriBidiWidthBlockLevel1_1200,  /* CF200..CF3FF */
+  FriBidiWidthBlockLevel1_1200,  /* CF400..CF5FF */
+  FriBidiWidthBlockLevel1_1200,  /* CF600..CF7FF */
+  FriBidiWidthBlockLevel1_1200,  /* CF800..CF9FF */
+  FriBidiWidthBlockLevel1_1200,  /* CFA00..CFBFF */
+  FriBidiWidthBlockLevel1_1200,  /* CFC00..CFDFF */
+  FriBidiWidthBlockLevel1_1200,  /* CFE00..CFFFF */
+  FriBidiWidthBlockLevel1_1200,  /* D0000..D01FF */
+  FriBidiWidthBlockLevel1_1200,  /* D0200..D03FF */
+  FriBidiWidthBlockLevel1_1200,  /* D0400..D05FF */
+  FriBidiWidthBlockLevel1_1200,  /* D0600..D07FF */
+  FriBidiWidthBlockLevel1_1200,  /* D0800..D09FF */
+  FriBidiWidthBlockLevel1_1200,  /* D0A00..D0BFF */
+  FriBidiWidthBlockLevel1_1200,  /* D0C00..D0DFF */
+  FriBidiWidthBlockLevel1_1200,  /* D0E00..D0FFF */
+  FriBidiWidthBlockLevel1_1200,  /* D1000..D11FF */
+  FriBidiWidthBlockLevel1_1200,  /* D1200..D13FF */
+  FriBidiWidthBlockLevel1_1200,  /* D1400..D15FF */
+  FriBidiWidthBlockLevel1_1200,  /* D1600..D17FF */
+  FriBidiWidthBlockLevel1_1200,  /* D1800..D19FF */
+  FriBidiWidthBlockLevel1_1200,  /* D1A00..D1BFF */
+  FriBidiWidthBlockLevel1_1200,  /* D1C00..D1DFF */
+  FriBidiWidthBlockLevel1_1200,  /* D1E00..D1FFF */
+  FriBidiWidthBlockLevel1_1200,  /* D2000..D21FF */
+  FriBidiWidthBlockLevel1_1200,  /* D2200..D23FF */
+  FriBidiWidthBlockLevel1_1200,  /* D2400..D25FF */
+  FriBidiWidthBlockLevel1_1200,  /* D2600..D27FF */
+  FriBidiWidthBlockLevel1_1200,  /* D2800..D29FF */
+  FriBidiWidthBlockLevel1_1200,  /* D2A00..D2BFF */
+  FriBidiWidthBlockLevel1_1200,  /* D2C00..D2DFF */
+  FriBidiWidthBlockLevel1_1200,  /* D2E00..D2FFF */
+  FriBidiWidthBlockLevel1_1200,  /* D3000..D31FF */
+  FriBidiWidthBlockLevel1_1200,  /* D3200..D33FF */
+  FriBidiWidthBlockLevel1_1200,  /* D3400..D35FF */
+  FriBidiWidthBlockLevel1_1200,  /* D3600..D37FF */
+  FriBidiWidthBlockLevel1_1200,  /* D3800..D39FF */
+  FriBidiWidthBlockLevel1_1200,  /* D3A00..D3BFF */
+  FriBidiWidthBlockLevel1_1200,  /* D3C00..D3DFF */
+  FriBidiWidthBlockLevel1_1200,  /* D3E00..D3FFF */
+  FriBidiWidthBlockLevel1_1200,  /* D4000..D41FF */
+  FriBidiWidthBlockLevel1_1200,  /* D4200..D43FF */
+  FriBidiWidthBlockLevel1_1200,  /* D4400..D45FF */
+  FriBidiWidthBlockLevel1_1200,  /* D4600..D47FF */
+  FriBidiWidthBlockLevel1_1200,  /* D4800..D49FF */
+  FriBidiWidthBlockLevel1_1200,  /* D4A00..D4BFF */
+  FriBidiWidthBlockLevel1_1200,  /* D4C00..D4DFF */
+  FriBidiWidthBlockLevel1_1200,  /* D4E00..D4FFF */
+  FriBidiWidthBlockLevel1_1200,  /* D5000..D51FF */
+  FriBidiWidthBlockLevel1_1200,  /* D5200..D53FF */
+  FriBidiWidthBlockLevel1_1200,  /* D5400..D55FF */
+  FriBidiWidthBlockLevel1_1200,  /* D5600..D57FF */
+  FriBidiWidthBlockLevel1_1200,  /* D5800..D59FF */
+  FriBidiWidthBlockLevel1_1200,  /* D5A00..D5BFF */
+  FriBidiWidthBlockLevel1_1200,  /* D5C00..D5DFF */
+  FriBidiWidthBlockLevel1_1200,  /* D5E00..D5FFF */
+  FriBidiWidthBlockLevel1_1200,  /* D6000..D61FF */
+  FriBidiWidthBlockLevel1_1200,  /* D6200..D63FF */
+  FriBidiWidthBlockLevel1_1200,  /* D6400..D65FF */
+  FriBidiWidthBlockLevel1_1200,  /* D6600..D67FF */
+  FriBidiWidthBlockLevel1_1200,  /* D6800..D69FF */
+  FriBidiWidthBlockLevel1_1200,  /* D6A00..D6BFF */
+  FriBidiWidthBlockLevel1_1200,  /* D6C00..D6DFF */
+  FriBidiWidthBlockLevel1_1200,  /* D6E00..D6FFF */
+  FriBidiWidthBlockLevel1_1200,  /* D7000..D71FF */
+  FriBidiWidthBlockLevel1_1200,  /* D7200..D73FF */
+  FriBidiWidthBlockLevel1_1200,  /* D7400..D75FF */
+  FriBidiWidthBlockLevel1_1200,  /* D7600..D77FF */
+  FriBidiWidthBlockLevel1_1200,  /* D7800..D79FF */
+  FriBidiWidthBlockLevel1_1200,  /* D7A00..D7BFF */
+  FriBidiWidthBlockLevel1_1200,  /* D7C00..D7DFF */
+  FriBidiWidthBlockLevel1_1200,  /* D7E00..D7FFF */
+  FriBidiWidthBlockLevel1_1200,  /* D8000..D81FF */
+  FriBidiWidthBlockLevel1_1200,  /* D8200..D83FF */
+  FriBidiWidthBlockLevel1_1200,  /* D8400..D85FF */
+  FriBidiWidthBlockLevel1_1200,  /* D8600..D87FF */
+  FriBidiWidthBlockLevel1_1200,  /* D8800..D89FF */
+  FriBidiWidthBlockLevel1_1200,  /* D8A00..D8BFF */
+  FriBidiWidthBlockLevel1_1200,  /* D8C00..D8DFF */
+  FriBidiWidthBlockLevel1_1200,  /* D8E00..D8FFF */
+  FriBidiWidthBlockLevel1_1200,  /* D9000..D91FF */
+  FriBidiWidthBlockLevel1_1200,  /* D9200..D93FF */
+  FriBidiWidthBlockLevel1_1200,  /* D9400..D95FF */
+  FriBidiWidthBlockLevel1_1200,  /* D9600..D97FF */
+  FriBidiWidthBlockLevel1_1200,  /* D9800..D99FF */
+  FriBidiWidthBlockLevel1_1200,  /* D9A00..D9BFF */
+  FriBidiWidthBlockLevel1_1200,  /* D9C00..D9DFF */
+  FriBidiWidthBlockLevel1_1200,  /* D9E00..D9FFF */
+  FriBidiWidthBlockLevel1_1200,  /* DA000..DA1FF */
+  FriBidiWidthBlockLevel1_1200,  /* DA200..DA3FF */
+  FriBidiWidthBlockLevel1_1200,  /* DA400..DA5FF */
+  FriBidiWidthBlockLevel1_1200,  /* DA600..DA7FF */
+  FriBidiWidthBlockLevel1_1200,  /* DA800..DA9FF */
+  FriBidiWidthBlockLevel1_1200,  /* DAA00..DABFF */
+  FriBidiWidthBlockLevel1_1200,  /* DAC00..DADFF */
+  FriBidiWidthBlockLevel1_1200,  /* DAE00..DAFFF */
+  FriBidiWidthBlockLevel1_1200,  /* DB000..DB1FF */
+  FriBidiWidthBlockLevel1_1200,  /* DB200..DB3FF */
+  FriBidiWidthBlockLevel1_1200,  /* DB400..DB5FF */
+  FriBidiWidthBlockLevel1_1200,  /* DB600..DB7FF */
+  FriBidiWidthBlockLevel1_1200,  /* DB800..DB9FF */
+  FriBidiWidthBlockLevel1_1200,  /* DBA00..DBBFF */
+  FriBidiWidthBlockLevel1_1200,  /* DBC00..DBDFF */
+  FriBidiWidthBlockLevel1_1200,  /* DBE00..DBFFF */
+  FriBidiWidthBlockLevel1_1200,  /* DC000..DC1FF */
+  FriBidiWidthBlockLevel1_1200,  /* DC200..DC3FF */
+  FriBidiWidthBlockLevel1_1200,  /* DC400..DC5FF */
+  FriBidiWidthBlockLevel1_1200,  /* DC600..DC7FF */
+  FriBidiWidthBlockLevel1_1200,  /* DC800..DC9FF */
+  FriBidiWidthBlockLevel1_1200,  /* DCA00..DCBFF */
+  FriBidiWidthBlockLevel1_1200,  /* DCC00..DCDFF */
+  FriBidiWidthBlockLevel1_1200,  /* DCE00..DCFFF */
+  FriBidiWidthBlockLevel1_1200,  /* DD000..DD1FF */
+  FriBidiWidthBlockLevel1_1200,  /* DD200..DD3FF */
+  FriBidiWidthBlockLevel1_1200,  /* DD400..DD5FF */
+  FriBidiWidthBlockLevel1_1200,  /* DD600..DD7FF */
+  FriBidiWidthBlockLevel1_1200,  /* DD800..DD9FF */
+  FriBidiWidthBlockLevel1_1200,  /* DDA00..DDBFF */
+  FriBidiWidthBlockLevel1_1200,  /* DDC00..DDDFF */
+  FriBidiWidthBlockLevel1_1200,  /* DDE00..DDFFF */
+  FriBidiWidthBlockLevel1_1200,  /* DE000..DE1FF */
+  FriBidiWidthBlockLevel1_1200,  /* DE200..DE3FF */
+  FriBidiWidthBlockLevel1_1200,  /* DE400..DE5FF */
+  FriBidiWidthBlockLevel1_1200,  /* DE600..DE7FF */
+  FriBidiWidthBlockLevel1_1200,  /* DE800..DE9FF */
+  FriBidiWidthBlockLevel1_1200,  /* DEA00..DEBFF */
+  FriBidiWidthBlockLevel1_1200,  /* DEC00..DEDFF */
+  FriBidiWidthBlockLevel1_1200,  /* DEE00..DEFFF */
+  FriBidiWidthBlockLevel1_1200,  /* DF000..DF1FF */
+  FriBidiWidthBlockLevel1_1200,  /* DF200..DF3FF */
+  FriBidiWidthBlockLevel1_1200,  /* DF400..DF5FF */
+  FriBidiWidthBlockLevel1_1200,  /* DF600..DF7FF */
+  FriBidiWidthBlockLevel1_1200,  /* DF800..DF9FF */
+  FriBidiWidthBlockLevel1_1200,  /* DFA00..DFBFF */
+  FriBidiWidthBlockLevel1_1200,  /* DFC00..DFDFF */
+  FriBidiWidthBlockLevel1_1200,  /* DFE00..DFFFF */
+  FriBidiWidthBlockLevel1_E0000,  /* E0000..E01FF */
+  FriBidiWidthBlockLevel1_1200,  /* E0200..E03FF */
+  FriBidiWidthBlockLevel1_1200,  /* E0400..E05FF */
+  FriBidiWidthBlockLevel1_1200,  /* E0600..E07FF */
+  FriBidiWidthBlockLevel1_1200,  /* E0800..E09FF */
+  FriBidiWidthBlockLevel1_1200,  /* E0A00..E0BFF */
+  FriBidiWidthBlockLevel1_1200,  /* E0C00..E0DFF */
+  FriBidiWidthBlockLevel1_1200,  /* E0E00..E0FFF */
+  FriBidiWidthBlockLevel1_1200,  /* E1000..E11FF */
+  FriBidiWidthBlockLevel1_1200,  /* E1200..E13FF */
+  FriBidiWidthBlockLevel1_1200,  /* E1400..E15FF */
+  FriBidiWidthBlockLevel1_1200,  /* E1600..E17FF */
+  FriBidiWidthBlockLevel1_1200,  /* E1800..E19FF */
+  FriBidiWidthBlockLevel1_1200,  /* E1A00..E1BFF */
+  FriBidiWidthBlockLevel1_1200,  /* E1C00..E1DFF */
+  FriBidiWidthBlockLevel1_1200,  /* E1E00..E1FFF */
+  FriBidiWidthBlockLevel1_1200,  /* E2000..E21FF */
+  FriBidiWidthBlockLevel1_1200,  /* E2200..E23FF */
+  FriBidiWidthBlockLevel1_1200,  /* E2400..E25FF */
+  FriBidiWidthBlockLevel1_1200,  /* E2600..E27FF */
+  FriBidiWidthBlockLevel1_1200,  /* E2800..E29FF */
+  FriBidiWidthBlockLevel1_1200,  /* E2A00..E2BFF */
+  FriBidiWidthBlockLevel1_1200,  /* E2C00..E2DFF */
+  FriBidiWidthBlockLevel1_1200,  /* E2E00..E2FFF */
+  FriBidiWidthBlockLevel1_1200,  /* E3000..E31FF */
+  FriBidiWidthBlockLevel1_1200,  /* E3200..E33FF */
+  FriBidiWidthBlockLevel1_1200,  /* E3400..E35FF */
+  FriBidiWidthBlockLevel1_1200,  /* E3600..E37FF */
+  FriBidiWidthBlockLevel1_1200,  /* E3800..E39FF */
+  FriBidiWidthBlockLevel1_1200,  /* E3A00..E3BFF */
+  FriBidiWidthBlockLevel1_1200,  /* E3C00..E3DFF */
+  FriBidiWidthBlockLevel1_1200,  /* E3E00..E3FFF */
+  FriBidiWidthBlockLevel1_1200,  /* E4000..E41FF */
+  FriBidiWidthBlockLevel1_1200,  /* E4200..E43FF */
+  FriBidiWidthBlockLevel1_1200,  /* E4400..E45FF */
+  FriBidiWidthBlockLevel1_1200,  /* E4600..E47FF */
+  FriBidiWidthBlockLevel1_1200,  /* E4800..E49FF */
+  FriBidiWidthBlockLevel1_1200,  /* E4A00..E4BFF */
+  FriBidiWidthBlockLevel1_1200,  /* E4C00..E4DFF */
+  FriBidiWidthBlockLevel1_1200,  /* E4E00..E4FFF */
+  FriBidiWidthBlockLevel1_1200,  /* E5000..E51FF */
+  FriBidiWidthBlockLevel1_1200,  /* E5200..E53FF */
+  FriBidiWidthBlockLevel1_1200,  /* E5400..E55FF */
+  FriBidiWidthBlockLevel1_1200,  /* E5600..E57FF */
+  FriBidiWidthBlockLevel1_1200,  /* E5800..E59FF */
+  FriBidiWidthBlockLevel1_1200,  /* E5A00..E5BFF */
+  FriBidiWidthBlockLevel1_1200,  /* E5C00..E5DFF */
+  FriBidiWidthBlockLevel1_1200,  /* E5E00..E5FFF */
+  FriBidiWidthBlockLevel1_1200,  /* E6000..E61FF */
+  FriBidiWidthBlockLevel1_1200,  /* E6200..E63FF */
+  FriBidiWidthBlockLevel1_1200,  /* E6400..E65FF */
+  FriBidiWidthBlockLevel1_1200,  /* E6600..E67FF */
+  FriBidiWidthBlockLevel1_1200,  /* E6800..E69FF */
+  FriBidiWidthBlockLevel1_1200,  /* E6A00..E6BFF */
+  FriBidiWidthBlockLevel1_1200,  /* E6C00..E6DFF */
+  FriBidiWidthBlockLevel1_1200,  /* E6E00..E6FFF */
+  FriBidiWidthBlockLevel1_1200,  /* E7000..E71FF */
+  FriBidiWidthBlockLevel1_1200,  /* E7200..E73FF */
+  FriBidiWidthBlockLevel1_1200,  /* E7400..E75FF */
+  FriBidiWidthBlockLevel1_1200,  /* E7600..E77FF */
+  FriBidiWidthBlockLevel1_1200,  /* E7800..E79FF */
+  FriBidiWidthBlockLevel1_1200,  /* E7A00..E7BFF */
+  FriBidiWidthBlockLevel1_1200,  /* E7C00..E7DFF */
+  FriBidiWidthBlockLevel1_1200,  /* E7E00..E7FFF */
+  FriBidiWidthBlockLevel1_1200,  /* E8000..E81FF */
+  FriBidiWidthBlockLevel1_1200,  /* E8200..E83FF */
+  FriBidiWidthBlockLevel1_1200,  /* E8400..E85FF */
+  FriBidiWidthBlockLevel1_1200,  /* E8600..E87FF */
+  FriBidiWidthBlockLevel1_1200,  /* E8800..E89FF */
+  FriBidiWidthBlockLevel1_1200,  /* E8A00..E8BFF */
+  FriBidiWidthBlockLevel1_1200,  /* E8C00..E8DFF */
+  FriBidiWidthBlockLevel1_1200,  /* E8E00..E8FFF */
+  FriBidiWidthBlockLevel1_1200,  /* E9000..E91FF */
+  FriBidiWidthBlockLevel1_1200,  /* E9200..E93FF */
+  FriBidiWidthBlockLevel1_1200,  /* E9400..E95FF */
+  FriBidiWidthBlockLevel1_1200,  /* E9600..E97FF */
+  FriBidiWidthBlockLevel1_1200,  /* E9800..E99FF */
+  FriBidiWidthBlockLevel1_1200,  /* E9A00..E9BFF */
+  FriBidiWidthBlockLevel1_1200,  /* E9C00..E9DFF */
+  FriBidiWidthBlockLevel1_1200,  /* E9E00..E9FFF */
+  FriBidiWidthBlockLevel1_1200,  /* EA000..EA1FF */
+  FriBidiWidthBlockLevel1_1200,  /* EA200..EA3FF */
+  FriBidiWidthBlockLevel1_1200,  /* EA400..EA5FF */
+  FriBidiWidthBlockLevel1_1200,  /* EA600..EA7FF */
+  FriBidiWidthBlockLevel1_1200,  /* EA800..EA9FF */
+  FriBidiWidthBlockLevel1_1200,  /* EAA00..EABFF */
+  FriBidiWidthBlockLevel1_1200,  /* EAC00..EADFF */
+  FriBidiWidthBlockLevel1_1200,  /* EAE00..EAFFF */
+  FriBidiWidthBlockLevel1_1200,  /* EB000..EB1FF */
+  FriBidiWidthBlockLevel1_1200,  /* EB200..EB3FF */
+  FriBidiWidthBlockLevel1_1200,  /* EB400..EB5FF */
+  FriBidiWidthBlockLevel1_1200,  /* EB600..EB7FF */
+  FriBidiWidthBlockLevel1_1200,  /* EB800..EB9FF */
+  FriBidiWidthBlockLevel1_1200,  /* EBA00..EBBFF */
+  FriBidiWidthBlockLevel1_1200,  /* EBC00..EBDFF */
+  FriBidiWidthBlockLevel1_1200,  /* EBE00..EBFFF */
+  FriBidiWidthBlockLevel1_1200,  /* EC000..EC1FF */
+  FriBidiWidthBlockLevel1_1200,  /* EC200..EC3FF */
+  FriBidiWidthBlockLevel1_1200,  /* EC400..EC5FF */
+  FriBidiWidthBlockLevel1_1200,  /* EC600..EC7FF */
+  FriBidiWidthBlockLevel1_1200,  /* EC800..EC9FF */
+  FriBidiWidthBlockLevel1_1200,  /* ECA00..ECBFF */
+  FriBidiWidthBlockLevel1_1200,  /* ECC00..ECDFF */
+  FriBidiWidthBlockLevel1_1200,  /* ECE00..ECFFF */
+  FriBidiWidthBlockLevel1_1200,  /* ED000..ED1FF */
+  FriBidiWidthBlockLevel1_1200,  /* ED200..ED3FF */
+  FriBidiWidthBlockLevel1_1200,  /* ED400..ED5FF */
+  FriBidiWidthBlockLevel1_1200,  /* ED600..ED7FF */
+  FriBidiWidthBlockLevel1_1200,  /* ED800..ED9FF */
+  FriBidiWidthBlockLevel1_1200,  /* EDA00..EDBFF */
+  FriBidiWidthBlockLevel1_1200,  /* EDC00..EDDFF */
+  FriBidiWidthBlockLevel1_1200,  /* EDE00..EDFFF */
+  FriBidiWidthBlockLevel1_1200,  /* EE000..EE1FF */
+  FriBidiWidthBlockLevel1_1200,  /* EE200..EE3FF */
+  FriBidiWidthBlockLevel1_1200,  /* EE400..EE5FF */
+  FriBidiWidthBlockLevel1_1200,  /* EE600..EE7FF */
+  FriBidiWidthBlockLevel1_1200,  /* EE800..EE9FF */
+  FriBidiWidthBlockLevel1_1200,  /* EEA00..EEBFF */
+  FriBidiWidthBlockLevel1_1200,  /* EEC00..EEDFF */
+  FriBidiWidthBlockLevel1_1200,  /* EEE00..EEFFF */
+  FriBidiWidthBlockLevel1_1200,  /* EF000..EF1FF */
+  FriBidiWidthBlockLevel1_1200,  /* EF200..EF3FF */
+  FriBidiWidthBlockLevel1_1200,  /* EF400..EF5FF */
+  FriBidiWidthBlockLevel1_1200,  /* EF600..EF7FF */
+  FriBidiWidthBlockLevel1_1200,  /* EF800..EF9FF */
+  FriBidiWidthBlockLevel1_1200,  /* EFA00..EFBFF */
+  FriBidiWidthBlockLevel1_1200,  /* EFC00..EFDFF */
+  FriBidiWidthBlockLevel1_1200,  /* EFE00..EFFFF */
+  FriBidiWidthBlockLevel1_1200,  /* F0000..F01FF */
+  FriBidiWidthBlockLevel1_1200,  /* F0200..F03FF */
+  FriBidiWidthBlockLevel1_1200,  /* F0400..F05FF */
+  FriBidiWidthBlockLevel1_1200,  /* F0600..F07FF */
+  FriBidiWidthBlockLevel1_1200,  /* F0800..F09FF */
+  FriBidiWidthBlockLevel1_1200,  /* F0A00..F0BFF */
+  FriBidiWidthBlockLevel1_1200,  /* F0C00..F0DFF */
+  FriBidiWidthBlockLevel1_1200,  /* F0E00..F0FFF */
+  FriBidiWidthBlockLevel1_1200,  /* F1000..F11FF */
+  FriBidiWidthBlockLevel1_1200,  /* F1200..F13FF */
+  FriBidiWidthBlockLevel1_1200,  /* F1400..F15FF */
+  FriBidiWidthBlockLevel1_1200,  /* F1600..F17FF */
+  FriBidiWidthBlockLevel1_1200,  /* F1800..F19FF */
+  FriBidiWidthBlockLevel1_1200,  /* F1A00..F1BFF */
+  FriBidiWidthBlockLevel1_1200,  /* F1C00..F1DFF */
+  FriBidiWidthBlockLevel1_1200,  /* F1E00..F1FFF */
+  FriBidiWidthBlockLevel1_1200,  /* F2000..F21FF */
+  FriBidiWidthBlockLevel1_1200,  /* F2200..F23FF */
+  FriBidiWidthBlockLevel1_1200,  /* F2400..F25FF */
+  FriBidiWidthBlockLevel1_1200,  /* F2600..F27FF */
+  FriBidiWidthBlockLevel1_1200,  /* F2800..F29FF */
+  FriBidiWidthBlockLevel1_1200,  /* F2A00..F2BFF */
+  FriBidiWidthBlockLevel1_1200,  /* F2C00..F2DFF */
+  FriBidiWidthBlockLevel1_1200,  /* F2E00..F2FFF */
+  FriBidiWidthBlockLevel1_1200,  /* F3000..F31FF */
+  FriBidiWidthBlockLevel1_1200,  /* F3200..F33FF */
+  FriBidiWidthBlockLevel1_1200,  /* F3400..F35FF */
+  FriBidiWidthBlockLevel1_1200,  /* F3600..F37FF */
+  FriBidiWidthBlockLevel1_1200,  /* F3800..F39FF */
+  FriBidiWidthBlockLevel1_1200,  /* F3A00..F3BFF */
+  FriBidiWidthBlockLevel1_1200,  /* F3C00..F3DFF */
+  FriBidiWidthBlockLevel1_1200,  /* F3E00..F3FFF */
+  FriBidiWidthBlockLevel1_1200,  /* F4000..F41FF */
+  FriBidiWidthBlockLevel1_1200,  /* F4200..F43FF */
+  FriBidiWidthBlockLevel1_1200,  /* F4400..F45FF */
+  FriBidiWidthBlockLevel1_1200,  /* F4600..F47FF */
+  FriBidiWidthBlockLevel1_1200,  /* F4800..F49FF */
+  FriBidiWidthBlockLevel1_1200,  /* F4A00..F4BFF */
+  FriBidiWidthBlockLevel1_1200,  /* F4C00..F4DFF */
+  FriBidiWidthBlockLevel1_1200,  /* F4E00..F4FFF */
+  FriBidiWidthBlockLevel1_1200,  /* F5000..F51FF */
+  FriBidiWidthBlockLevel1_1200,  /* F5200..F53FF */
+  FriBidiWidthBlockLevel1_1200,  /* F5400..F55FF */
+  FriBidiWidthBlockLevel1_1200,  /* F5600..F57FF */
+  FriBidiWidthBlockLevel1_1200,  /* F5800..F59FF */
+  FriBidiWidthBlockLevel1_1200,  /* F5A00..F5BFF */
+  FriBidiWidthBlockLevel1_1200,  /* F5C00..F5DFF */
+  FriBidiWidthBlockLevel1_1200,  /* F5E00..F5FFF */
+  FriBidiWidthBlockLevel1_1200,  /* F6000..F61FF */
+  FriBidiWidthBlockLevel1_1200,  /* F6200..F63FF */
+  FriBidiWidthBlockLevel1_1200,  /* F6400..F65FF */
+  FriBidiWidthBlockLevel1_1200,  /* F6600..F67FF */
+  FriBidiWidthBlockLevel1_1200,  /* F6800..F69FF */
+  FriBidiWidthBlockLevel1_1200,  /* F6A00..F6BFF */
+  FriBidiWidthBlockLevel1_1200,  /* F6C00..F6DFF */
+  FriBidiWidthBlockLevel1_1200,  /* F6E00..F6FFF */
+  FriBidiWidthBlockLevel1_1200,  /* F7000..F71FF */
+  FriBidiWidthBlockLevel1_1200,  /* F7200..F73FF */
+  FriBidiWidthBlockLevel1_1200,  /* F7400..F75FF */
+  FriBidiWidthBlockLevel1_1200,  /* F7600..F77FF */
+  FriBidiWidthBlockLevel1_1200,  /* F7800..F79FF */
+  FriBidiWidthBlockLevel1_1200,  /* F7A00..F7BFF */
+  FriBidiWidthBlockLevel1_1200,  /* F7C00..F7DFF */
+  FriBidiWidthBlockLevel1_1200,  /* F7E00..F7FFF */
+  FriBidiWidthBlockLevel1_1200,  /* F8000..F81FF */
+  FriBidiWidthBlockLevel1_1200,  /* F8200..F83FF */
+  FriBidiWidthBlockLevel1_1200,  /* F8400..F85FF */
+  FriBidiWidthBlockLevel1_1200,  /* F8600..F87FF */
+  FriBidiWidthBlockLevel1_1200,  /* F8800..F89FF */
+  FriBidiWidthBlockLevel1_1200,  /* F8A00..F8BFF */
+  FriBidiWidthBlockLevel1_1200,  /* F8C00..F8DFF */
+  FriBidiWidthBlockLevel1_1200,  /* F8E00..F8FFF */
+  FriBidiWidthBlockLevel1_1200,  /* F9000..F91FF */
+  FriBidiWidthBlockLevel1_1200,  /* F9200..F93FF */
+  FriBidiWidthBlockLevel1_1200,  /* F9400..F95FF */
+  FriBidiWidthBlockLevel1_1200,  /* F9600..F97FF */
+  FriBidiWidthBlockLevel1_1200,  /* F9800..F99FF */
+  FriBidiWidthBlockLevel1_1200,  /* F9A00..F9BFF */
+  FriBidiWidthBlockLevel1_1200,  /* F9C00..F9DFF */
+  FriBidiWidthBlockLevel1_1200,  /* F9E00..F9FFF */
+  FriBidiWidthBlockLevel1_1200,  /* FA000..FA1FF */
+  FriBidiWidthBlockLevel1_1200,  /* FA200..FA3FF */
+  FriBidiWidthBlockLevel1_1200,  /* FA400..FA5FF */
+  FriBidiWidthBlockLevel1_1200,  /* FA600..FA7FF */
+  FriBidiWidthBlockLevel1_1200,  /* FA800..FA9FF */
+  FriBidiWidthBlockLevel1_1200,  /* FAA00..FABFF */
+  FriBidiWidthBlockLevel1_1200,  /* FAC00..FADFF */
+  FriBidiWidthBlockLevel1_1200,  /* FAE00..FAFFF */
+  FriBidiWidthBlockLevel1_1200,  /* FB000..FB1FF */
+  FriBidiWidthBlockLevel1_1200,  /* FB200..FB3FF */
+  FriBidiWidthBlockLevel1_1200,  /* FB400..FB5FF */
+  FriBidiWidthBlockLevel1_1200,  /* FB600..FB7FF */
+  FriBidiWidthBlockLevel1_1200,  /* FB800..FB9FF */
+  FriBidiWidthBlockLevel1_1200,  /* FBA00..FBBFF */
+  FriBidiWidthBlockLevel1_1200,  /* FBC00..FBDFF */
+  FriBidiWidthBlockLevel1_1200,  /* FBE00..FBFFF */
+  FriBidiWidthBlockLevel1_1200,  /* FC000..FC1FF */
+  FriBidiWidthBlockLevel1_1200,  /* FC200..FC3FF */
+  FriBidiWidthBlockLevel1_1200,  /* FC400..FC5FF */
+  FriBidiWidthBlockLevel1_1200,  /* FC600..FC7FF */
+  FriBidiWidthBlockLevel1_1200,  /* FC800..FC9FF */
+  FriBidiWidthBlockLevel1_1200,  /* FCA00..FCBFF */
+  FriBidiWidthBlockLevel1_1200,  /* FCC00..FCDFF */
+  FriBidiWidthBlockLevel1_1200,  /* FCE00..FCFFF */
+  FriBidiWidthBlockLevel1_1200,  /* FD000..FD1FF */
+  FriBidiWidthBlockLevel1_1200,  /* FD200..FD3FF */
+  FriBidiWidthBlockLevel1_1200,  /* FD400..FD5FF */
+  FriBidiWidthBlockLevel1_1200,  /* FD600..FD7FF */
+  FriBidiWidthBlockLevel1_1200,  /* FD800..FD9FF */
+  FriBidiWidthBlockLevel1_1200,  /* FDA00..FDBFF */
+  FriBidiWidthBlockLevel1_1200,  /* FDC00..FDDFF */
+  FriBidiWidthBlockLevel1_1200,  /* FDE00..FDFFF */
+  FriBidiWidthBlockLevel1_1200,  /* FE000..FE1FF */
+  FriBidiWidthBlockLevel1_1200,  /* FE200..FE3FF */
+  FriBidiWidthBlockLevel1_1200,  /* FE400..FE5FF */
+  FriBidiWidthBlockLevel1_1200,  /* FE600..FE7FF */
+  FriBidiWidthBlockLevel1_1200,  /* FE800..FE9FF */
+  FriBidiWidthBlockLevel1_1200,  /* FEA00..FEBFF */
+  FriBidiWidthBlockLevel1_1200,  /* FEC00..FEDFF */
+  FriBidiWidthBlockLevel1_1200,  /* FEE00..FEFFF */
+  FriBidiWidthBlockLevel1_1200,  /* FF000..FF1FF */
+  FriBidiWidthBlockLevel1_1200,  /* FF200..FF3FF */
+  FriBidiWidthBlockLevel1_1200,  /* FF400..FF5FF */
+  FriBidiWidthBlockLevel1_1200,  /* FF600..FF7FF */
+  FriBidiWidthBlockLevel1_1200,  /* FF800..FF9FF */
+  FriBidiWidthBlockLevel1_1200,  /* FFA00..FFBFF */
+  FriBidiWidthBlockLevel1_1200,  /* FFC00..FFDFF */
+  FriBidiWidthBlockLevel1_1200,  /* FFE00..FFFFF */
+  FriBidiWidthBlockLevel1_1200,  /* 100000..1001FF */
+  FriBidiWidthBlockLevel1_1200,  /* 100200..1003FF */
+  FriBidiWidthBlockLevel1_1200,  /* 100400..1005FF */
+  FriBidiWidthBlockLevel1_1200,  /* 100600..1007FF */
+  FriBidiWidthBlockLevel1_1200,  /* 100800..1009FF */
+  FriBidiWidthBlockLevel1_1200,  /* 100A00..100BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 100C00..100DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 100E00..100FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 101000..1011FF */
+  FriBidiWidthBlockLevel1_1200,  /* 101200..1013FF */
+  FriBidiWidthBlockLevel1_1200,  /* 101400..1015FF */
+  FriBidiWidthBlockLevel1_1200,  /* 101600..1017FF */
+  FriBidiWidthBlockLevel1_1200,  /* 101800..1019FF */
+  FriBidiWidthBlockLevel1_1200,  /* 101A00..101BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 101C00..101DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 101E00..101FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 102000..1021FF */
+  FriBidiWidthBlockLevel1_1200,  /* 102200..1023FF */
+  FriBidiWidthBlockLevel1_1200,  /* 102400..1025FF */
+  FriBidiWidthBlockLevel1_1200,  /* 102600..1027FF */
+  FriBidiWidthBlockLevel1_1200,  /* 102800..1029FF */
+  FriBidiWidthBlockLevel1_1200,  /* 102A00..102BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 102C00..102DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 102E00..102FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 103000..1031FF */
+  FriBidiWidthBlockLevel1_1200,  /* 103200..1033FF */
+  FriBidiWidthBlockLevel1_1200,  /* 103400..1035FF */
+  FriBidiWidthBlockLevel1_1200,  /* 103600..1037FF */
+  FriBidiWidthBlockLevel1_1200,  /* 103800..1039FF */
+  FriBidiWidthBlockLevel1_1200,  /* 103A00..103BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 103C00..103DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 103E00..103FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 104000..1041FF */
+  FriBidiWidthBlockLevel1_1200,  /* 104200..1043FF */
+  FriBidiWidthBlockLevel1_1200,  /* 104400..1045FF */
+  FriBidiWidthBlockLevel1_1200,  /* 104600..1047FF */
+  FriBidiWidthBlockLevel1_1200,  /* 104800..1049FF */
+  FriBidiWidthBlockLevel1_1200,  /* 104A00..104BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 104C00..104DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 104E00..104FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 105000..1051FF */
+  FriBidiWidthBlockLevel1_1200,  /* 105200..1053FF */
+  FriBidiWidthBlockLevel1_1200,  /* 105400..1055FF */
+  FriBidiWidthBlockLevel1_1200,  /* 105600..1057FF */
+  FriBidiWidthBlockLevel1_1200,  /* 105800..1059FF */
+  FriBidiWidthBlockLevel1_1200,  /* 105A00..105BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 105C00..105DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 105E00..105FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 106000..1061FF */
+  FriBidiWidthBlockLevel1_1200,  /* 106200..1063FF */
+  FriBidiWidthBlockLevel1_1200,  /* 106400..1065FF */
+  FriBidiWidthBlockLevel1_1200,  /* 106600..1067FF */
+  FriBidiWidthBlockLevel1_1200,  /* 106800..1069FF */
+  FriBidiWidthBlockLevel1_1200,  /* 106A00..106BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 106C00..106DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 106E00..106FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 107000..1071FF */
+  FriBidiWidthBlockLevel1_1200,  /* 107200..1073FF */
+  FriBidiWidthBlockLevel1_1200,  /* 107400..1075FF */
+  FriBidiWidthBlockLevel1_1200,  /* 107600..1077FF */
+  FriBidiWidthBlockLevel1_1200,  /* 107800..1079FF */
+  FriBidiWidthBlockLevel1_1200,  /* 107A00..107BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 107C00..107DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 107E00..107FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 108000..1081FF */
+  FriBidiWidthBlockLevel1_1200,  /* 108200..1083FF */
+  FriBidiWidthBlockLevel1_1200,  /* 108400..1085FF */
+  FriBidiWidthBlockLevel1_1200,  /* 108600..1087FF */
+  FriBidiWidthBlockLevel1_1200,  /* 108800..1089FF */
+  FriBidiWidthBlockLevel1_1200,  /* 108A00..108BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 108C00..108DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 108E00..108FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 109000..1091FF */
+  FriBidiWidthBlockLevel1_1200,  /* 109200..1093FF */
+  FriBidiWidthBlockLevel1_1200,  /* 109400..1095FF */
+  FriBidiWidthBlockLevel1_1200,  /* 109600..1097FF */
+  FriBidiWidthBlockLevel1_1200,  /* 109800..1099FF */
+  FriBidiWidthBlockLevel1_1200,  /* 109A00..109BFF */
+  FriBidiWidthBlockLevel1_1200,  /* 109C00..109DFF */
+  FriBidiWidthBlockLevel1_1200,  /* 109E00..109FFF */
+  FriBidiWidthBlockLevel1_1200,  /* 10A000..10A1FF */
+  FriBidiWidthBlockLevel1_1200,  /* 10A200..10A3FF */
+  FriBidiWidthBlockLevel1_1200,  /* 10A400..10A5FF */
+  FriBidiWidthBlockLevel1_1200,  /* 10A600..10A7FF */
+  FriBidiWidthBlockLevel1_1200,  /* 10A800..10A9FF */
+  FriBidiWidthBlockLevel1_1200,  /* 10AA00..10ABFF */
+  FriBidiWidthBlockLevel1_1200,  /* 10AC00..10ADFF */
+  FriBidiWidthBlockLevel1_1200,  /* 10AE00..10AFFF */
+  FriBidiWidthBlockLevel1_1200,  /* 10B000..10B1FF */
+  FriBidiWidthBlockLevel1_1200,  /* 10B200..10B3FF */
+  FriBidiWidthBlockLevel1_1200,  /* 10B400..10B5FF */
+  FriBidiWidthBlockLevel1_1200,  /* 10B600..10B7FF */
+  FriBidiWidthBlockLevel1_1200,  /* 10B800..10B9FF */
+  FriBidiWidthBlockLevel1_1200,  /* 10BA00..10BBFF */
+  FriBidiWidthBlockLevel1_1200,  /* 10BC00..10BDFF */
+  FriBidiWidthBlockLevel1_1200,  /* 10BE00..10BFFF */
+  FriBidiWidthBlockLevel1_1200,  /* 10C000..10C1FF */
+  FriBidiWidthBlockLevel1_1200,  /* 10C200..10C3FF */
+  FriBidiWidthBlockLevel1_1200,  /* 10C400..10C5FF */
+  FriBidiWidthBlockLevel1_1200,  /* 10C600..10C7FF */
+  FriBidiWidthBlockLevel1_1200,  /* 10C800..10C9FF */
+  FriBidiWidthBlockLevel1_1200,  /* 10CA00..10CBFF */
+  FriBidiWidthBlockLevel1_1200,  /* 10CC00..10CDFF */
+  FriBidiWidthBlockLevel1_1200,  /* 10CE00..10CFFF */
+  FriBidiWidthBlockLevel1_1200,  /* 10D000..10D1FF */
+  FriBidiWidthBlockLevel1_1200,  /* 10D200..10D3FF */
+  FriBidiWidthBlockLevel1_1200,  /* 10D400..10D5FF */
+  FriBidiWidthBlockLevel1_1200,  /* 10D600..10D7FF */
+  FriBidiWidthBlockLevel1_1200,  /* 10D800..10D9FF */
+  FriBidiWidthBlockLevel1_1200,  /* 10DA00..10DBFF */
+  FriBidiWidthBlockLevel1_1200,  /* 10DC00..10DDFF */
+  FriBidiWidthBlockLevel1_1200,  /* 10DE00..10DFFF */
+  FriBidiWidthBlockLevel1_1200,  /* 10E000..10E1FF */
+  FriBidiWidthBlockLevel1_1200,  /* 10E200..10E3FF */
+  FriBidiWidthBlockLevel1_1200,  /* 10E400..10E5FF */
+  FriBidiWidthBlockLevel1_1200,  /* 10E600..10E7FF */
+  FriBidiWidthBlockLevel1_1200,  /* 10E800..10E9FF */
+  FriBidiWidthBlockLevel1_1200,  /* 10EA00..10EBFF */
+  FriBidiWidthBlockLevel1_1200,  /* 10EC00..10EDFF */
+  FriBidiWidthBlockLevel1_1200,  /* 10EE00..10EFFF */
+  FriBidiWidthBlockLevel1_1200,  /* 10F000..10F1FF */
+  FriBidiWidthBlockLevel1_1200,  /* 10F200..10F3FF */
+  FriBidiWidthBlockLevel1_1200,  /* 10F400..10F5FF */
+  FriBidiWidthBlockLevel1_1200,  /* 10F600..10F7FF */
+  FriBidiWidthBlockLevel1_1200,  /* 10F800..10F9FF */
+  FriBidiWidthBlockLevel1_1200,  /* 10FA00..10FBFF */
+  FriBidiWidthBlockLevel1_1200,  /* 10FC00..10FDFF */
+  FriBidiWidthBlockLevel1_1200,  /* 10FE00..10FFFF */
+};
+
+/* *INDENT-ON* */
+
+#define FRIBIDI_GET_WIDTH_CLASS(x)	\
+	FriBidiWidthBlockLevel1[(x)%512 +	\
+	FriBidiWidthBlockLevel0[(x)/512]]
+
+#undef AMBIGUOUS
+#undef WIDE
+#undef NARROW
+#undef ZERO
+#undef CONTROL
+
+/* Column width of each class, normal and CJK. */
+static const signed char FriBidiWidthOfClass[5] = {-1, 0, 1, 2, 1};
+static const signed char FriBidiWidthOfClassCJK[5] = {-1, 0, 1, 2, 2};
+
+#endif /* FRIBIDI_TAB_WCWIDTH_I */
@@ -0,0 +1,229 @@
+/* FriBidi - Library of BiDi algorithm
+ * Copyright (C) 2002 FriBidi Project (http://fribidi.sf.net/).
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library, in a file named COPYING; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307, USA
+ *
+ * For licensing issues, contact <dov@imagic.weizmann.ac.il> and
+ * <fwpg@sharif.edu>.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#ifdef HAVE_MMAP
+#include <sys/types.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "fribidi.h"
+
+FRIBIDI_API fribidi_uint32
+fribidi_tables_checksum (const void *data,
+			 fribidi_uint32 len)
+{
+  const unsigned char *p = (const unsigned char *) data;
+  fribidi_uint32 a = 1, b = 0;
+
+  while (len > 0)
+    {
+      /* 5552 is the most bytes before b can overflow. */
+      fribidi_uint32 n = len < 5552 ? len : 5552;
+
+      len -= n;
+      while (n-- > 0)
+	{
+	  a += *p++;
+	  b += a;
+	}
+      a %= 65521;
+      b %= 65521;
+    }
+
+  return (b << 16) | a;
+}
+
+static fribidi_boolean
+read_file (FriBidiTables *tables,
+	   const char *filename)
+{
+#ifdef HAVE_MMAP
+  int fd;
+  struct stat st;
+
+  if ((fd = open (filename, O_RDONLY)) < 0)
+    return FRIBIDI_FALSE;
+  if (fstat (fd, &st) < 0
+      || st.st_size < (off_t) sizeof (FriBidiTablesHeader))
+    {
+      close (fd);
+      return FRIBIDI_FALSE;
+    }
+  tables->map_size = st.st_size;
+  tables->map = mmap (NULL, tables->map_size, PROT_READ, MAP_SHARED, fd, 0);
+  close (fd);
+  if (tables->map == MAP_FAILED)
+    return FRIBIDI_FALSE;
+  tables->mapped = FRIBIDI_TRUE;
+#else /* !HAVE_MMAP */
+  FILE *f;
+  long size;
+
+  if (!(f = fopen (filename, "rb")))
+    return FRIBIDI_FALSE;
+  if (fseek (f, 0, SEEK_END) < 0 || (size = ftell (f)) <
+      (long) sizeof (FriBidiTablesHeader) || fseek (f, 0, SEEK_SET) < 0)
+    {
+      fclose (f);
+      return FRIBIDI_FALSE;
+    }
+  tables->map_size = size;
+  if (!(tables->map = malloc (size))
+      || fread (tables->map, 1, size, f) != (size_t) size)
+    {
+      free (tables->map);
+      fclose (f);
+      return FRIBIDI_FALSE;
+    }
+  fclose (f);
+  tables->mapped = FRIBIDI_FALSE;
+#endif /* !HAVE_MMAP */
+
+  return FRIBIDI_TRUE;
+}
+
+static fribidi_boolean
+validate (FriBidiTables *tables)
+{
+  const FriBidiTablesHeader *h = (const FriBidiTablesHeader *) tables->map;
+  unsigned long index_size, data_size, i;
+
+  if (memcmp (h->magic, FRIBIDI_TABLES_MAGIC, sizeof h->magic)
+      || h->format_version != FRIBIDI_TABLES_FORMAT_VERSION
+      || h->byte_order != FRIBIDI_TABLES_BYTE_ORDER
+      || h->block_size != FRIBIDI_TABLES_BLOCK_SIZE
+      || h->file_size != tables->map_size
+      || !memchr (h->unicode_version, '\0', sizeof h->unicode_version))
+    return FRIBIDI_FALSE;
+
+  /* The sections must be aligned, in the file and not overlapping. */
+  if (h->chars == 0 || h->chars > 0x110000
+      || h->chars % FRIBIDI_TABLES_BLOCK_SIZE || h->blocks == 0
+      || h->blocks > h->chars / FRIBIDI_TABLES_BLOCK_SIZE
+      || h->index_offset % sizeof (fribidi_uint16)
+      || h->data_offset % sizeof (FriBidiProps))
+    return FRIBIDI_FALSE;
+  index_size = h->chars / FRIBIDI_TABLES_BLOCK_SIZE * sizeof (fribidi_uint16);
+  data_size = (unsigned long) h->blocks * FRIBIDI_TABLES_BLOCK_SIZE
+    * sizeof (FriBidiProps);
+  if (h->index_offset < sizeof (FriBidiTablesHeader)
+      || h->index_offset > h->file_size || h->data_offset > h->file_size
+      || h->index_offset + index_size > h->data_offset
+      || h->data_offset + data_size > h->file_size)
+    return FRIBIDI_FALSE;
+
+  if (fribidi_tables_checksum ((const char *) h + sizeof *h,
+			       h->file_size - sizeof *h) != h->checksum)
+    return FRIBIDI_FALSE;
+
+  tables->header = h;
+  tables->index = (const fribidi_uint16 *) ((const char *) h
+					    + h->index_offset);
+  tables->data = (const FriBidiProps *) ((const char *) h + h->data_offset);
+  tables->chars = h->chars;
+
+  /* Lookups are not checked, so check every entry once here. */
+  for (i = 0; i < h->chars / FRIBIDI_TABLES_BLOCK_SIZE; i++)
+    if (tables->index[i] >= h->blocks)
+      return FRIBIDI_FALSE;
+  for (i = 0; i < h->blocks * FRIBIDI_TABLES_BLOCK_SIZE; i++)
+    if ((tables->data[i] & FRIBIDI_PROPS_TYPE_MASK) >= FRIBIDI_TYPES_COUNT)
+      return FRIBIDI_FALSE;
+
+  return FRIBIDI_TRUE;
+}
+
+FRIBIDI_API FriBidiTables *
+fribidi_tables_open (const char *filename)
+{
+  FriBidiTables *tables;
+
+  if (!(tables = (FriBidiTables *) malloc (sizeof (FriBidiTables))))
+    return NULL;
+  if (!read_file (tables, filename))
+    {
+      free (tables);
+      return NULL;
+    }
+  if (!validate (tables))
+    {
+      fribidi_tables_close (tables);
+      return NULL;
+    }
+
+  return tables;
+}
+
+FRIBIDI_API void
+fribidi_tables_close (FriBidiTables *tables)
+{
+  if (!tables)
+    return;
+#ifdef HAVE_MMAP
+  if (tables->mapped)
+    munmap (tables->map, tables->map_size);
+  else
+#endif
+    free (tables->map);
+  free (tables);
+}
+
+FRIBIDI_API const char *
+fribidi_tables_unicode_version (FriBidiTables *tables)
+{
+  return tables->header->unicode_version;
+}
+
+FRIBIDI_API fribidi_boolean
+fribidi_set_tables (FriBidiEnv *fribidienv,
+		    FriBidiTables *tables)
+{
+  FriBidiEnvExtension *extension;
+
+  VALIDATE_FRIBIDIENV (fribidienv);
+
+  if (!tables && !fribidienv->iExtension)
+    return FRIBIDI_TRUE;
+
+  extension = fribidi_env_extension (fribidienv);
+  if (!extension)
+    return FRIBIDI_FALSE;
+  extension->iTables = tables;
+  return FRIBIDI_TRUE;
+}
+
+FRIBIDI_API FriBidiTables *
+fribidi_get_tables (FriBidiEnv *fribidienv)
+{
+  VALIDATE_FRIBIDIENV (fribidienv);
+
+  return fribidienv->iExtension ? fribidienv->iExtension->iTables : NULL;
+}
@@ -0,0 +1,136 @@
+/* FriBidi - Library of BiDi algorithm
+ * Copyright (C) 2002 FriBidi Project (http://fribidi.sf.net/).
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library, in a file named COPYING; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307, USA
+ *
+ * For licensing issues, contact <dov@imagic.weizmann.ac.il> and
+ * <fwpg@sharif.edu>.
+ */
+
+#ifndef FRIBIDI_TABLES_H
+#define FRIBIDI_TABLES_H
+
+#include "fribidi_config.h"
+#include "fribidi_types.h"
+#include "fribidi_env.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*======================================================================
+ *  Runtime loadable property tables.
+ *
+ *  fribidi_create_char_types writes the FriBidiProps of every character
+ *  (see fribidi_get_props()) to a binary file, so that newer Unicode
+ *  data can be deployed without rebuilding the library.  The file is
+ *  mapped read-only, so all the processes using it share its pages.
+ *
+ *  The file starts with a FriBidiTablesHeader, all in the byte order of
+ *  the host that wrote it.  At index_offset there are chars / block_size
+ *  fribidi_uint16 block numbers, and at data_offset there are blocks *
+ *  block_size FriBidiProps, so the properties of ch are
+ *
+ *    data[index[ch / block_size] * block_size + ch % block_size]
+ *
+ *  checksum is the Adler-32 of the file after the header.
+ *----------------------------------------------------------------------*/
+
+#define FRIBIDI_TABLES_MAGIC		"FriBidiT"
+#define FRIBIDI_TABLES_FORMAT_VERSION	1
+#define FRIBIDI_TABLES_BYTE_ORDER	0x01020304
+#define FRIBIDI_TABLES_BLOCK_SIZE	256
+
+  typedef struct _FriBidiTablesHeader
+  {
+    char magic[8];
+    fribidi_uint32 format_version;
+    fribidi_uint32 byte_order;
+    char unicode_version[16];	/* NUL terminated. */
+    fribidi_uint32 chars;	/* Characters covered, from 0. */
+    fribidi_uint32 block_size;
+    fribidi_uint32 blocks;	/* Distinct blocks in the data. */
+    fribidi_uint32 index_offset;
+    fribidi_uint32 data_offset;
+    fribidi_uint32 file_size;
+    fribidi_uint32 checksum;
+  }
+  FriBidiTablesHeader;
+
+  typedef struct _FriBidiTables
+  {
+    const FriBidiTablesHeader *header;
+    const fribidi_uint16 *index;
+    const FriBidiProps *data;
+    fribidi_uint32 chars;
+    void *map;			/* The file, mapped or read. */
+    unsigned long map_size;
+    fribidi_boolean mapped;
+  }
+  FriBidiTables;
+
+/* The properties of ch, which must be less than tables->chars. */
+#define FRIBIDI_TABLES_GET_PROPS(tables, ch) \
+	((tables)->data[(tables)->index[(ch) / FRIBIDI_TABLES_BLOCK_SIZE] \
+			* FRIBIDI_TABLES_BLOCK_SIZE \
+			+ (ch) % FRIBIDI_TABLES_BLOCK_SIZE])
+
+/*======================================================================
+ *  fribidi_tables_open() maps and validates a table file.  Returns NULL
+ *  if the file cannot be read or is not a valid table file.
+ *----------------------------------------------------------------------*/
+  FRIBIDI_API FriBidiTables *fribidi_tables_open (const char *filename);
+
+/*======================================================================
+ *  fribidi_tables_close() unmaps the tables.  They must not be attached
+ *  to any environment anymore.
+ *----------------------------------------------------------------------*/
+  FRIBIDI_API void fribidi_tables_close (FriBidiTables *tables);
+
+/*======================================================================
+ *  fribidi_tables_unicode_version() returns the Unicode version the
+ *  tables were created from.
+ *----------------------------------------------------------------------*/
+  FRIBIDI_API const char *fribidi_tables_unicode_version (FriBidiTables
+							  *tables);
+
+/*======================================================================
+ *  fribidi_set_tables() makes fribidi_get_type() and fribidi_get_props()
+ *  use tables under the environment, or the compiled-in tables again if
+ *  tables is NULL.  The caller keeps the ownership of tables.  Returns
+ *  FRIBIDI_FALSE if out of memory.
+ *----------------------------------------------------------------------*/
+  FRIBIDI_API fribidi_boolean fribidi_set_tables (FriBidiEnv *fribidienv,
+						  FriBidiTables *tables);
+
+/*======================================================================
+ *  fribidi_get_tables() returns the tables attached to the environment,
+ *  or NULL if the compiled-in tables are used.
+ *----------------------------------------------------------------------*/
+  FRIBIDI_API FriBidiTables *fribidi_get_tables (FriBidiEnv *fribidienv);
+
+/*======================================================================
+ *  fribidi_tables_checksum() returns the Adler-32 of len bytes.
+ *----------------------------------------------------------------------*/
+  FRIBIDI_API fribidi_uint32 fribidi_tables_checksum (const void *data,
+						      fribidi_uint32 len);
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif				/* FRIBIDI_TABLES_H */
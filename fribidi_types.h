@@ -310,6 +310,27 @@ extern "C"
 /* Map fribidi_prop_types to fribidi_types */
   extern const FriBidiCharType fribidi_prop_to_type[];
 
+/*
+ * The combined properties of a character, as returned by
+ * fribidi_get_props(): the FriBidiPropCharType in the low bits, a bit
+ * set if it has a mirror, its FRIBIDI_WIDTH_CLASS_*, and a bit set if it
+ * is a combining mark (general category Mn, Mc or Me).
+ */
+  typedef fribidi_uint16 FriBidiProps;
+
+#define FRIBIDI_PROPS_TYPE_MASK		0x001F
+#define FRIBIDI_PROPS_MIRROR		0x0020
+#define FRIBIDI_PROPS_WIDTH_SHIFT	6
+#define FRIBIDI_PROPS_WIDTH_MASK	0x01C0
+#define FRIBIDI_PROPS_COMBINING		0x0200
+
+#define FRIBIDI_PROPS_TYPE(p) \
+	(fribidi_prop_to_type[(p) & FRIBIDI_PROPS_TYPE_MASK])
+#define FRIBIDI_PROPS_HAS_MIRROR(p) (((p) & FRIBIDI_PROPS_MIRROR) != 0)
+#define FRIBIDI_PROPS_WIDTH_CLASS(p) \
+	(((p) & FRIBIDI_PROPS_WIDTH_MASK) >> FRIBIDI_PROPS_WIDTH_SHIFT)
+#define FRIBIDI_PROPS_IS_COMBINING(p) (((p) & FRIBIDI_PROPS_COMBINING) != 0)
+
 #ifdef	__cplusplus
 }
 #endif
@@ -54,19 +54,78 @@ extern "C"
 #define UNI_ZWNJ	0x200C
 #define UNI_ZWJ		0x200D
 
+/* Replaces undecodable input */
+#define UNI_REPLACEMENT_CHAR	0xFFFD
+
 /* Hebrew and Arabic */
 #define UNI_HEBREW_ALEF	0x05D0
 #define UNI_ARABIC_ALEF	0x0627
 #define UNI_ARABIC_ZERO	0x0660
 #define UNI_FARSI_ZERO	0x06F0
 
+/* Decode the UTF-8 sequence at str, of at most len bytes, into *ch and
+   return its length.  An ill-formed sequence, including one cut at len,
+   decodes to UNI_REPLACEMENT_CHAR and consumes its longest valid prefix,
+   or one byte.  If len is 0 or less, nothing is read, *ch is left as it
+   is and 0 is returned. */
+  FRIBIDI_API int fribidi_utf8_get_char (const char *str,
+					 int len,
+					 FriBidiChar *ch);
+
+/* Encode ch as UTF-8 to s and return its length, at most 4, or 0 if ch
+   is above Unicode. */
+  FRIBIDI_API int fribidi_utf8_put_char (FriBidiChar ch,
+					 char *s);
+
+/* Tell from the bytes alone, without decoding, whether len bytes of
+   UTF-8 may hold a character that needs the bidi algorithm: RTL, AL and
+   AN characters, and the marks and explicit codes.  If not, all the
+   levels are 0 for a base direction of LTR, WL or ON, and
+   fribidi_log2vis() can be skipped.  There are no false negatives, also
+   with the tables of later Unicode versions, which may add RTL
+   characters to the blocks checked: U+0580..U+08FF, U+200E..U+200F,
+   U+202A..U+202E, U+FB00..U+FDFF, U+FE40..U+FEFF, U+10800..U+10FFF and
+   U+1E800..U+1EFFF. */
+  FRIBIDI_API fribidi_boolean fribidi_utf8_may_need_bidi (const char *str,
+							  int len);
+
 /* wcwidth functions */
   FRIBIDI_API int fribidi_wcwidth (FriBidiChar ch);
+  FRIBIDI_API int fribidi_wcwidth_cjk (FriBidiChar ch);
   FRIBIDI_API int fribidi_wcswidth (const FriBidiChar *str,
 				    FriBidiStrIndex len);
   FRIBIDI_API int fribidi_wcswidth_cjk (const FriBidiChar *str,
 					FriBidiStrIndex len);
 
+/* Column width classes, fribidi_wcwidth() and fribidi_wcwidth_cjk() are
+   derived from these. */
+#define FRIBIDI_WIDTH_CLASS_CONTROL	0	/* -1, not printable */
+#define FRIBIDI_WIDTH_CLASS_ZERO	1	/* 0, combining and NUL */
+#define FRIBIDI_WIDTH_CLASS_NARROW	2	/* 1 */
+#define FRIBIDI_WIDTH_CLASS_WIDE	3	/* 2 */
+#define FRIBIDI_WIDTH_CLASS_AMBIGUOUS	4	/* 1, or 2 in CJK context */
+#define FRIBIDI_WIDTH_CLASSES_COUNT	5
+
+  FRIBIDI_API int fribidi_get_width_class (FriBidiChar ch);
+
+/* Fill prefix[0..len] with the running column width of str, so that
+   str[i..j-1] takes prefix[j] - prefix[i] columns.  Non-printable
+   characters count as 0 columns.  Returns prefix[len]. */
+  FRIBIDI_API int fribidi_wcswidth_prefix (const FriBidiChar *str,
+					   FriBidiStrIndex len,
+					   int *prefix);
+  FRIBIDI_API int fribidi_wcswidth_prefix_cjk (const FriBidiChar *str,
+					       FriBidiStrIndex len,
+					       int *prefix);
+
+/* Return the largest end in [start, len] such that str[start..end-1]
+   fits in width columns, by binary search over a prefix array filled by
+   fribidi_wcswidth_prefix(). */
+  FRIBIDI_API FriBidiStrIndex fribidi_width_fit (const int *prefix,
+						 FriBidiStrIndex start,
+						 FriBidiStrIndex len,
+						 int width);
+
 #ifdef	__cplusplus
 }
 #endif
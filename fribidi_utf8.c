@@ -0,0 +1,323 @@
+/* FriBidi - Library of BiDi algorithm
+ * Copyright (C) 2002 FriBidi Project (http://fribidi.sf.net/).
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library, in a file named COPYING; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307, USA
+ *
+ * For licensing issues, contact <dov@imagic.weizmann.ac.il> and
+ * <fwpg@sharif.edu>.
+ */
+
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+#include "fribidi.h"
+#include "fribidi_inline.h"
+#include "fribidi_utf8.h"
+
+/* The well-formed sequences are those of table 3-7 of The Unicode
+   Standard: no overlong forms, no surrogates and nothing above U+10FFFF.
+   An ill-formed sequence decodes to UNI_REPLACEMENT_CHAR and consumes its
+   longest valid prefix, or one byte if there is none, as Unicode
+   recommends. */
+FRIBIDI_API int
+fribidi_utf8_get_char (const char *str,
+		       int len,
+		       FriBidiChar *ch)
+{
+  const unsigned char *s = (const unsigned char *) str;
+  unsigned char lo = 0x80, hi = 0xBF;
+  FriBidiChar c;
+  int i, n;
+
+  if (len <= 0)
+    return 0;
+  c = s[0];
+  if (c < 0x80)
+    {
+      *ch = c;
+      return 1;
+    }
+  else if (c < 0xC2)
+    n = 0;
+  else if (c < 0xE0)
+    {
+      n = 2;
+      c &= 0x1F;
+    }
+  else if (c < 0xF0)
+    {
+      n = 3;
+      if (c == 0xE0)
+	lo = 0xA0;		/* No overlong forms. */
+      else if (c == 0xED)
+	hi = 0x9F;		/* No surrogates. */
+      c &= 0x0F;
+    }
+  else if (c < 0xF5)
+    {
+      n = 4;
+      if (c == 0xF0)
+	lo = 0x90;		/* No overlong forms. */
+      else if (c == 0xF4)
+	hi = 0x8F;		/* Nothing above U+10FFFF. */
+      c &= 0x07;
+    }
+  else
+    n = 0;
+
+  if (!n)
+    {
+      *ch = UNI_REPLACEMENT_CHAR;
+      return 1;
+    }
+  for (i = 1; i < n; i++)
+    {
+      if (i >= len || s[i] < lo || s[i] > hi)
+	{
+	  *ch = UNI_REPLACEMENT_CHAR;
+	  return i;
+	}
+      c = (c << 6) | (s[i] & 0x3F);
+      lo = 0x80;
+      hi = 0xBF;
+    }
+  *ch = c;
+  return n;
+}
+
+FRIBIDI_API int
+fribidi_utf8_put_char (FriBidiChar ch,
+		       char *s)
+{
+  if (ch <= 0x7F)
+    {
+      s[0] = ch;
+      return 1;
+    }
+  else if (ch <= 0x7FF)
+    {
+      s[0] = 0xC0 | (ch >> 6);
+      s[1] = 0x80 | (ch & 0x3F);
+      return 2;
+    }
+  else if (ch <= 0xFFFF)
+    {
+      s[0] = 0xE0 | (ch >> 12);
+      s[1] = 0x80 | ((ch >> 6) & 0x3F);
+      s[2] = 0x80 | (ch & 0x3F);
+      return 3;
+    }
+  else if (ch < FRIBIDI_UNICODE_CHARS)
+    {
+      s[0] = 0xF0 | (ch >> 18);
+      s[1] = 0x80 | ((ch >> 12) & 0x3F);
+      s[2] = 0x80 | ((ch >> 6) & 0x3F);
+      s[3] = 0x80 | (ch & 0x3F);
+      return 4;
+    }
+  else
+    return 0;
+}
+
+/* No byte below 0xD6 starts a sequence of the blocks checked by
+   fribidi_utf8_may_need_bidi(), and eight bytes are all below it if
+   their OR is. */
+#define ARE_BELOW_D6_8(s) \
+	(((s)[0] | (s)[1] | (s)[2] | (s)[3] \
+	  | (s)[4] | (s)[5] | (s)[6] | (s)[7]) < 0xD6)
+
+FRIBIDI_API fribidi_boolean
+fribidi_utf8_may_need_bidi (const char *str,
+			    int len)
+{
+  const unsigned char *p = (const unsigned char *) str, *end = p + len;
+
+  while (p < end)
+    {
+      /* Fast path: skip eight bytes at a time, for ASCII. */
+      if (end - p >= 8 && ARE_BELOW_D6_8 (p))
+	{
+	  p += 8;
+	  continue;
+	}
+
+      switch (*p++)
+	{
+	case 0xD6:		/* U+0580..U+07FF */
+	case 0xD7:
+	case 0xD8:
+	case 0xD9:
+	case 0xDA:
+	case 0xDB:
+	case 0xDC:
+	case 0xDD:
+	case 0xDE:
+	case 0xDF:
+	  return FRIBIDI_TRUE;
+	case 0xE0:		/* U+0800..U+08FF */
+	  if (p < end && p[0] >= 0xA0 && p[0] <= 0xA3)
+	    return FRIBIDI_TRUE;
+	  break;
+	case 0xE2:		/* U+200E..U+200F, U+202A..U+202E */
+	  if (end - p >= 2 && p[0] == 0x80
+	      && ((p[1] >= 0x8E && p[1] <= 0x8F)
+		  || (p[1] >= 0xAA && p[1] <= 0xAE)))
+	    return FRIBIDI_TRUE;
+	  break;
+	case 0xEF:		/* U+FB00..U+FDFF, U+FE40..U+FEFF */
+	  if (p < end && ((p[0] >= 0xAC && p[0] <= 0xB7)
+			  || (p[0] >= 0xB9 && p[0] <= 0xBB)))
+	    return FRIBIDI_TRUE;
+	  break;
+	case 0xF0:		/* U+10800..U+10FFF, U+1E800..U+1EFFF */
+	  if (end - p >= 2 && (p[0] == 0x90 || p[0] == 0x9E) && p[1] >= 0xA0
+	      && p[1] <= 0xBF)
+	    return FRIBIDI_TRUE;
+	  break;
+	}
+    }
+
+  return FRIBIDI_FALSE;
+}
+
+/* The types that make a string need more than level 0 everywhere. */
+#define NEEDS_BIDI(type) \
+	(FRIBIDI_IS_RTL (type) || FRIBIDI_IS_ARABIC (type) \
+	 || FRIBIDI_IS_EXPLICIT (type))
+
+FriBidiStrIndex
+fribidi_utf8_get_types_offsets (FriBidiEnv *fribidienv,
+				/* input */
+				const char *str,
+				FriBidiStrIndex len,
+				/* output */
+				FriBidiChar *us,
+				FriBidiPropCharType *char_type,
+				FriBidiStrIndex *offset,
+				fribidi_boolean *pneeds_bidi,
+				fribidi_boolean *phas_mirror)
+{
+  const unsigned char *p = (const unsigned char *) str, *end = p + len;
+  FriBidiTables *tables = fribidi_get_tables (fribidienv);
+  const FriBidiProps *ascii;
+  fribidi_uint32 seen = 0;	/* A bit for each type seen. */
+  FriBidiProps mirror = 0;	/* The OR of the props seen. */
+  FriBidiStrIndex n = 0;
+
+  /* Every table has the block of ASCII, the first one. */
+  ascii = tables ? &FRIBIDI_TABLES_GET_PROPS (tables, 0) :
+    &fribidi_props_data[fribidi_props_index[0]];
+
+  while (p < end)
+    {
+      /* Fast path: eight ASCII bytes at a time. */
+      if (end - p >= 8 && ARE_ASCII8 (p))
+	{
+	  int k;
+
+	  for (k = 0; k < 8; k++)
+	    {
+	      FriBidiProps props = ascii[p[k]];
+	      FriBidiPropCharType type = props & FRIBIDI_PROPS_TYPE_MASK;
+
+	      char_type[n + k] = type;
+	      seen |= (fribidi_uint32) 1 << type;
+	      mirror |= props;
+	    }
+	  if (us)
+	    for (k = 0; k < 8; k++)
+	      us[n + k] = p[k];
+	  if (offset)
+	    for (k = 0; k < 8; k++)
+	      offset[n + k] = p - (const unsigned char *) str + k;
+	  n += 8;
+	  p += 8;
+	}
+      else
+	{
+	  FriBidiChar ch;
+	  FriBidiProps props;
+	  FriBidiPropCharType type;
+
+	  if (offset)
+	    offset[n] = p - (const unsigned char *) str;
+	  p += fribidi_utf8_get_char ((const char *) p, end - p, &ch);
+	  props = tables ? fribidi_get_props (fribidienv, ch) :
+	    fribidi_get_props_inline (ch);
+	  type = props & FRIBIDI_PROPS_TYPE_MASK;
+	  char_type[n] = type;
+	  seen |= (fribidi_uint32) 1 << type;
+	  mirror |= props;
+	  if (us)
+	    us[n] = ch;
+	  n++;
+	}
+    }
+  if (offset)
+    offset[n] = len;
+
+  if (pneeds_bidi)
+    {
+      int type;
+
+      *pneeds_bidi = FRIBIDI_FALSE;
+      for (type = 0; type < FRIBIDI_TYPES_COUNT; type++)
+	if (seen >> type & 1 && NEEDS_BIDI (fribidi_prop_to_type[type]))
+	  *pneeds_bidi = FRIBIDI_TRUE;
+    }
+  if (phas_mirror)
+    *phas_mirror = FRIBIDI_PROPS_HAS_MIRROR (mirror);
+
+  return n;
+}
+
+FRIBIDI_API FriBidiStrIndex
+fribidi_utf8_get_types (FriBidiEnv *fribidienv,
+			/* input */
+			const char *str,
+			FriBidiStrIndex len,
+			/* output */
+			FriBidiChar *us,
+			FriBidiPropCharType *char_type,
+			fribidi_boolean *pneeds_bidi)
+{
+  return fribidi_utf8_get_types_offsets (fribidienv, str, len, us, char_type,
+					 NULL, pneeds_bidi, NULL);
+}
+
+FRIBIDI_API FriBidiCharType
+fribidi_utf8_get_par_direction (FriBidiEnv *fribidienv,
+				const char *str,
+				FriBidiStrIndex len)
+{
+  fribidi_boolean runtime_tables = fribidi_get_tables (fribidienv) != NULL;
+  FriBidiStrIndex i = 0;
+
+  while (i < len)
+    {
+      FriBidiChar ch;
+      FriBidiCharType type;
+
+      i += fribidi_utf8_get_char (str + i, len - i, &ch);
+      type = runtime_tables ? fribidi_get_type (fribidienv, ch) :
+	fribidi_get_type_inline (ch);
+      if (FRIBIDI_IS_LETTER (type))
+	return FRIBIDI_LEVEL_TO_DIR (FRIBIDI_DIR_TO_LEVEL (type));
+    }
+
+  return FRIBIDI_TYPE_ON;
+}
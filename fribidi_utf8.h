@@ -0,0 +1,55 @@
+/* FriBidi - Library of BiDi algorithm
+ * Copyright (C) 2002 FriBidi Project (http://fribidi.sf.net/).
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library, in a file named COPYING; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307, USA
+ *
+ * For licensing issues, contact <dov@imagic.weizmann.ac.il> and
+ * <fwpg@sharif.edu>.
+ */
+
+
+#ifndef FRIBIDI_UTF8_H
+#define FRIBIDI_UTF8_H
+
+#include "fribidi_types.h"
+#include "fribidi_env.h"
+
+/* The parts of the UTF-8 code shared between the library's own files. */
+
+/* Eight bytes, or characters, are all ASCII if their OR is.  The UTF-8
+   decoders and the encoder convert such runs without looking further. */
+#define ARE_ASCII8(s) \
+	(((s)[0] | (s)[1] | (s)[2] | (s)[3] \
+	  | (s)[4] | (s)[5] | (s)[6] | (s)[7]) < 0x80)
+
+/* fribidi_utf8_get_types() for fribidi_log2vis_utf8(): offset, if not
+   NULL, gets the offsets of the sequences of the characters, with
+   offset[n] == len for the n characters, so it must have room for len +
+   1 of them, and *phas_mirror, if phas_mirror is not NULL, is set to
+   whether any of the characters has a mirror. */
+FriBidiStrIndex fribidi_utf8_get_types_offsets (FriBidiEnv *fribidienv,
+						/* input */
+						const char *str,
+						FriBidiStrIndex len,
+						/* output */
+						FriBidiChar *us,
+						FriBidiPropCharType
+						*char_type,
+						FriBidiStrIndex *offset,
+						fribidi_boolean *pneeds_bidi,
+						fribidi_boolean *phas_mirror);
+
+#endif /* FRIBIDI_UTF8_H */
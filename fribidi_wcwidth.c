@@ -218,7 +218,7 @@ mk_wcswidth (const wchar_t * pwcs,
  * the traditional terminal character-width behaviour. It is not
  * otherwise recommended for general use.
  */
-static int
+int
 mk_wcwidth_cjk (wchar_t ucs)
 {
   /* sorted list of non-overlapping intervals of East Asian Ambiguous
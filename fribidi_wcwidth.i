@@ -1,9 +1,12 @@
+/* fribidi_wcwidth.c is only compiled into fribidi_create_wcwidth, as the
+   reference for fribidi_tab_wcwidth.i.  The library uses fribidi_width.c. */
+
 #include "fribidi.h"
 
-#define	mk_wcwidth	FRIBIDI_API fribidi_wcwidth
-#define	mk_wcswidth	FRIBIDI_API fribidi_wcswidth
-#define	mk_wcwidth_cjk	FRIBIDI_API fribidi_wcwidth_cjk
-#define	mk_wcswidth_cjk	FRIBIDI_API fribidi_wcswidth_cjk
+#define	mk_wcwidth	fribidi_wcwidth_reference
+#define	mk_wcswidth	fribidi_wcswidth_reference
+#define	mk_wcwidth_cjk	fribidi_wcwidth_cjk_reference
+#define	mk_wcswidth_cjk	fribidi_wcswidth_cjk_reference
 
 #define wchar_t		FriBidiChar
 #define size_t		FriBidiStrIndex
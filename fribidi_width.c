@@ -0,0 +1,163 @@
+/* FriBidi - Library of BiDi algorithm
+ * Copyright (C) 2002 FriBidi Project (http://fribidi.sf.net/).
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library, in a file named COPYING; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307, USA
+ *
+ * For licensing issues, contact <dov@imagic.weizmann.ac.il> and
+ * <fwpg@sharif.edu>.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+#include "fribidi.h"
+
+#include "fribidi_tab_wcwidth.i"
+
+/* Characters above Unicode are narrow, as in fribidi_wcwidth.c. */
+#define WIDTH_CLASS(ch) \
+	((ch) < 0x110000 ? FRIBIDI_GET_WIDTH_CLASS (ch) \
+			 : FRIBIDI_WIDTH_CLASS_NARROW)
+
+FRIBIDI_API int
+fribidi_get_width_class (FriBidiChar ch)
+{
+  return WIDTH_CLASS (ch);
+}
+
+FRIBIDI_API int
+fribidi_wcwidth (FriBidiChar ch)
+{
+  return FriBidiWidthOfClass[WIDTH_CLASS (ch)];
+}
+
+FRIBIDI_API int
+fribidi_wcwidth_cjk (FriBidiChar ch)
+{
+  return FriBidiWidthOfClassCJK[WIDTH_CLASS (ch)];
+}
+
+FRIBIDI_API int
+fribidi_wcswidth (const FriBidiChar *str,
+		  FriBidiStrIndex len)
+{
+  int w, width = 0;
+
+  for (; *str && len-- > 0; str++)
+    if ((w = FriBidiWidthOfClass[WIDTH_CLASS (*str)]) < 0)
+      return -1;
+    else
+      width += w;
+
+  return width;
+}
+
+FRIBIDI_API int
+fribidi_wcswidth_cjk (const FriBidiChar *str,
+		      FriBidiStrIndex len)
+{
+  int w, width = 0;
+
+  for (; *str && len-- > 0; str++)
+    if ((w = FriBidiWidthOfClassCJK[WIDTH_CLASS (*str)]) < 0)
+      return -1;
+    else
+      width += w;
+
+  return width;
+}
+
+/* Printable ASCII, 0x20..0x7E, is always one column wide.  Four
+   characters are all printable ASCII if the OR of their offsets from
+   0x20 is in range, as the OR is not less than any of them. */
+#define ASCII_OFFSET(ch) ((FriBidiChar) ((ch) - 0x20))
+#define ARE_PRINTABLE_ASCII4(s) \
+	((ASCII_OFFSET ((s)[0]) | ASCII_OFFSET ((s)[1]) \
+	  | ASCII_OFFSET ((s)[2]) | ASCII_OFFSET ((s)[3])) <= 0x5E)
+
+static int
+width_prefix (const FriBidiChar *str,
+	      FriBidiStrIndex len,
+	      const signed char *width_of_class,
+	      int *prefix)
+{
+  FriBidiStrIndex i = 0;
+  int width = 0;
+
+  prefix[0] = 0;
+  while (i < len)
+    {
+      /* Fast path: four printable ASCII characters at a time. */
+      if (i + 4 <= len && ARE_PRINTABLE_ASCII4 (str + i))
+	{
+	  prefix[i + 1] = width + 1;
+	  prefix[i + 2] = width + 2;
+	  prefix[i + 3] = width + 3;
+	  prefix[i + 4] = width += 4;
+	  i += 4;
+	}
+      else
+	{
+	  int w = width_of_class[WIDTH_CLASS (str[i])];
+
+	  /* Non-printable characters take no columns. */
+	  if (w > 0)
+	    width += w;
+	  prefix[++i] = width;
+	}
+    }
+
+  return width;
+}
+
+FRIBIDI_API int
+fribidi_wcswidth_prefix (const FriBidiChar *str,
+			 FriBidiStrIndex len,
+			 int *prefix)
+{
+  return width_prefix (str, len, FriBidiWidthOfClass, prefix);
+}
+
+FRIBIDI_API int
+fribidi_wcswidth_prefix_cjk (const FriBidiChar *str,
+			     FriBidiStrIndex len,
+			     int *prefix)
+{
+  return width_prefix (str, len, FriBidiWidthOfClassCJK, prefix);
+}
+
+FRIBIDI_API FriBidiStrIndex
+fribidi_width_fit (const int *prefix,
+		   FriBidiStrIndex start,
+		   FriBidiStrIndex len,
+		   int width)
+{
+  FriBidiStrIndex lo = start, hi = len;
+  int limit = prefix[start] + width;
+
+  /* Largest end in [start, len] with prefix[end] <= limit. */
+  while (lo < hi)
+    {
+      FriBidiStrIndex mid = hi - (hi - lo) / 2;
+
+      if (prefix[mid] <= limit)
+	lo = mid;
+      else
+	hi = mid - 1;
+    }
+
+  return lo;
+}
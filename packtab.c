@@ -67,6 +67,51 @@ compare (const void *r,
 static int lev, p[22], t[22], c[22], clusters[22], s, nn;
 static int best_lev, best_p[22], best_t[22], best_c[22], best_cluster[22],
   best_s;
+static int distinct[22], budget, done;
+
+/*
+  The blocks a level is split into are always aligned blocks of the
+  original table, of pow[b] keys where b is the sum of the bits of the
+  levels so far, so the number of different ones depends on b only.
+  Count them once for every b, so that the search below does not have
+  to sort the table at every node.
+*/
+static void
+count_distinct (int *base)
+{
+  int b, j, k, blocks;
+
+  /* Count the different keys. */
+  memmove (temp, base, N * sizeof (temp[0]));
+  cmpcluster = 1;
+  qsort (temp, N, sizeof (temp[0]), compare);
+  for (k = 1, j = 1; j < N; j++)
+    if (temp[j - 1] != temp[j])
+      k++;
+  distinct[0] = k;
+
+  /* Number the different pairs of blocks of the previous size, starting
+     with the pairs of keys themselves. */
+  memmove (x, base, N * sizeof (x[0]));
+  cmpcluster = 2;
+  for (b = 1, blocks = N / 2; b <= n; b++, blocks /= 2)
+    {
+      for (j = 0; j < blocks; j++)
+	{
+	  temp[j * 3] = x[j * 2];
+	  temp[j * 3 + 1] = x[j * 2 + 1];
+	  temp[j * 3 + 2] = j;
+	}
+      qsort (temp, blocks, 3 * sizeof (temp[0]), compare);
+      for (k = 0, j = 0; j < blocks; j++)
+	{
+	  if (j && compare (temp + (j - 1) * 3, temp + j * 3))
+	    k++;
+	  x[temp[j * 3 + 2]] = k;
+	}
+      distinct[b] = k + 1;
+    }
+}
 
 static void
 found (void)
@@ -75,6 +120,8 @@ found (void)
 
   if (s < best_s)
     {
+      if (s <= budget)
+	done = 1;
       best_s = s;
       best_lev = lev;
       for (i = 0; i <= lev; i++)
@@ -90,7 +137,7 @@ found (void)
 static void
 bt (int node_size)
 {
-  int i, j, k, y, sbak, key_bytes;
+  int i, k, sbak, key_bytes;
 
   if (t[lev] == 1)
     {
@@ -100,39 +147,14 @@ bt (int node_size)
   if (lev == max_depth)
     return;
 
-  for (i = 1 - t[lev] % 2; i <= nn + (t[lev] >> nn) % 2; i++)
+  for (i = 1 - t[lev] % 2; i <= nn + (t[lev] >> nn) % 2 && !done; i++)
     {
       nn -= (p[lev] = i);
       clusters[lev] = cluster = (i && nn >= 0) ? pow[i] : t[lev];
-      cmpcluster = cluster + 1;
 
       t[lev + 1] = (t[lev] - 1) / cluster + 1;
-      for (j = 0; j < t[lev + 1]; j++)
-	{
-	  memmove (temp + j * cmpcluster, tab[lev] + j * cluster,
-		   cluster * sizeof (tab[lev][0]));
-	  temp[j * cmpcluster + cluster] = j;
-	}
-      qsort (temp, t[lev + 1], cmpcluster * sizeof (temp[0]), compare);
-      for (j = 0; j < t[lev + 1]; j++)
-	{
-	  perm[j] = temp[j * cmpcluster + cluster];
-	  temp[j * cmpcluster + cluster] = 0;
-	}
-      k = 1;
-      y = 0;
-      tab[lev + 1][perm[0]] = perm[0];
-      for (j = 1; j < t[lev + 1]; j++)
-	{
-	  if (compare (temp + y, temp + y + cmpcluster))
-	    {
-	      k++;
-	      tab[lev + 1][perm[j]] = perm[j];
-	    }
-	  else
-	    tab[lev + 1][perm[j]] = tab[lev + 1][perm[j - 1]];
-	  y += cmpcluster;
-	}
+      /* A single block of the whole level is trivially unique. */
+      k = t[lev + 1] == 1 ? 1 : distinct[n - nn];
       sbak = s;
       s += k * node_size * cluster;
       c[lev] = k;
@@ -160,6 +182,7 @@ solve (void)
 {
   best_lev = max_depth + 2;
   best_s = N * a * 2;
+  done = 0;
   lev = 0;
   s = 0;
   nn = n;
@@ -313,6 +336,12 @@ write_out ()
   write_source ();
 }
 
+void
+pack_table_set_budget (int bytes)
+{
+  budget = bytes;
+}
+
 int
 pack_table (int *base,
 	    int key_num,
@@ -335,9 +364,11 @@ pack_table (int *base,
   macro_name = p_macro_name;
   f = out;
   init (base);
-  if (!(tab = malloc ((n + 1) * sizeof (tab[0]))))
+  /* Only write_array() needs the levels themselves. */
+  if (!(tab = malloc ((max_depth + 2) * sizeof (tab[0]))))
     return 0;
   memmove (tab[0], base, key_num * sizeof (int));
+  count_distinct (base);
   solve ();
   write_out ();
   free (tab);
@@ -29,6 +29,13 @@ extern "C"
 
 #define packtab_version 2
 
+/*
+  pack_table_set_budget() makes the following pack_table() calls stop
+  searching as soon as they find a table of at most bytes bytes, instead
+  of looking for the smallest one.  The default, 0, never stops early.
+*/
+  void pack_table_set_budget (int bytes);
+
   int pack_table (int *base,
 		  int key_num,
 		  int key_size,